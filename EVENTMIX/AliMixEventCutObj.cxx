@@ -27,7 +27,9 @@ AliMixEventCutObj::AliMixEventCutObj(AliMixEventCutObj::EEPAxis_t type, Float_t
    fCutMax(max),
    fCutStep(step),
    fCutSmallVal(0),
-   fCurrentVal(min)
+   fCurrentVal(min),
+   fBinMin(),
+   fBinMax()
 {
    //
    // Default constructor
@@ -45,7 +47,9 @@ AliMixEventCutObj::AliMixEventCutObj(const AliMixEventCutObj &obj) : TObject(obj
    fCutMax(obj.fCutMax),
    fCutStep(obj.fCutStep),
    fCutSmallVal(obj.fCutSmallVal),
-   fCurrentVal(obj.fCurrentVal)
+   fCurrentVal(obj.fCurrentVal),
+   fBinMin(obj.fBinMin),
+   fBinMax(obj.fBinMax)
 {
    //
    // Copy constructor
@@ -69,6 +73,8 @@ AliMixEventCutObj &AliMixEventCutObj::operator=(const AliMixEventCutObj &obj)
       fCutStep = obj.fCutStep;
       fCutSmallVal = obj.fCutSmallVal;
       fCurrentVal = obj.fCurrentVal;
+      fBinMin = obj.fBinMin;
+      fBinMax = obj.fBinMax;
 //       fNoMore = obj.fNoMore;
    }
    return *this;
@@ -137,14 +143,37 @@ Int_t AliMixEventCutObj::GetBinNumber(Float_t num) const
    // Returns bin (index) number in current cut.
    // Returns -1 in case of out of range
    //
-   Int_t binNum = 0;
+   // Edges are the ones of the stepping loop (same float accumulation),
+   // the bin is first guessed from the uniform step and then corrected
+   if (fBinMin.empty()) InitBinEdges();
+   Int_t nBins = fBinMin.size();
+   if (nBins < 1 || !(num >= fBinMin[0])) return -1;
+
+   Float_t guess = (num - fCutMin) / fCutStep;
+   Int_t bin = (guess < nBins) ? (Int_t)guess : nBins - 1;
+   if (bin < 0) bin = 0;
+   while (bin > 0 && num < fBinMin[bin]) bin--;
+   while (bin + 1 < nBins && num >= fBinMin[bin + 1]) bin++;
+
+   // first bin containing num, as in the stepping loop
+   while (bin > 0 && num < fBinMax[bin - 1]) bin--;
+   if (num < fBinMax[bin]) return bin + 1;
+   return -1;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCutObj::InitBinEdges() const
+{
+   //
+   // Fills edges of bins used by GetBinNumber
+   //
+   fBinMin.clear();
+   fBinMax.clear();
+   if (fCutStep < 1e-5) return;
    for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) {
-      binNum++;
-      if ((num >= iCurrent) && (num < iCurrent + fCutStep - fCutSmallVal)) {
-         return binNum;
-      }
+      fBinMin.push_back(iCurrent);
+      fBinMax.push_back(iCurrent + fCutStep - fCutSmallVal);
    }
-   return -1;
 }
 
 //_________________________________________________________________________________________________
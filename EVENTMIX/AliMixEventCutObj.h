@@ -14,6 +14,8 @@
 #include <TObject.h>
 #include <TString.h>
 
+#include <vector>
+
 class AliVEvent;
 class AliAODEvent;
 class AliESDEvent;
@@ -55,6 +57,8 @@ public:
    Bool_t      IsValid();
 
 private:
+   void        InitBinEdges() const;
+
    Int_t       fCutType;       // cut type
    TString     fCutOpt;        // cut option string
    Float_t     fCutMin;        // cut min
@@ -64,7 +68,10 @@ private:
 
    Float_t     fCurrentVal;    // current value
 
-   ClassDef(AliMixEventCutObj, 3)
+   mutable std::vector<Float_t> fBinMin;   //! lower edge of each bin (cache for GetBinNumber)
+   mutable std::vector<Float_t> fBinMax;   //! upper edge of each bin (cache for GetBinNumber)
+
+   ClassDef(AliMixEventCutObj, 4)
 };
 
 #endif
@@ -9,6 +9,9 @@
 //
 
 #include <TEntryList.h>
+#include <TTree.h>
+
+#include <vector>
 
 #include "AliLog.h"
 #include "AliMixEventCutObj.h"
@@ -194,29 +197,24 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
    AliDebug(AliLog::kDebug + 5, "<-");
    Int_t num = fListOfEventCuts.GetEntriesFast();
    if (num < 1) return 0;
-   Int_t *indexes = new Int_t[num] ;
-   Int_t *lenght = new Int_t[num];
-   Int_t i = 0;
-   TObjArrayIter next(&fListOfEventCuts);
+   // flat index of the bin, first cut runs fastest
+   // (same order as CreateEntryListsRecursivly and SetCutValuesFromBinIndex)
+   Long64_t offset = 0, stride = 1;
    AliMixEventCutObj *cut;
-   while ((cut = (AliMixEventCutObj *) next())) {
-      indexes[i] = cut->GetIndex(ev);
-      if (indexes[i] < 0) {
+   for (Int_t i = 0; i < num; i++) {
+      cut = (AliMixEventCutObj *) fListOfEventCuts.UncheckedAt(i);
+      Int_t index = cut->GetIndex(ev);
+      if (index < 0) {
          AliDebug(AliLog::kDebug, Form("idEntryList %d", -1));
-         delete [] indexes;
-         delete [] lenght;
          return 0;
       }
-      lenght[i] = cut->GetNumberOfBins();
-      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, indexes[i]));
-      i++;
+      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, index));
+      offset += (index - 1) * stride;
+      stride *= cut->GetNumberOfBins();
    }
-   idEntryList = 0;
-   SearchIndexRecursive(fListOfEventCuts.GetEntries() - 1, &indexes[0], &lenght[0], idEntryList);
+   // index which start with 1 (idEntryList-1 is index in list of entry lists)
+   idEntryList = offset + 1;
    AliDebug(AliLog::kDebug, Form("idEntryList %d", idEntryList - 1));
-   // index which start with 0 (idEntryList-1)
-   delete [] indexes;
-   delete [] lenght;
    AliDebug(AliLog::kDebug + 5, "->");
    return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
 }
@@ -289,3 +287,41 @@ Bool_t AliMixEventPool::SetCutValuesFromBinIndex(Int_t index)
 
    return kTRUE;
 }
+
+//_________________________________________________________________________________________________
+TTree *AliMixEventPool::CloneTreeSortedByBin(TTree *tree) const
+{
+   //
+   // Creates copy of tree (or chain) with entries ordered by bin of pool
+   // (bin after bin, in entry order inside bin) and entries out of all bins at the end.
+   // Entry lists have to be filled in previous pass over the same tree.
+   // Mixing partners (previous entries in same entry list) are then contiguous
+   // entries of the new tree, which is written to the current directory.
+   //
+   if (!tree) return 0;
+   Long64_t nEntries = tree->GetEntries();
+   std::vector<Bool_t> isSorted(nEntries, kFALSE);
+   TTree *sorted = tree->CloneTree(0);
+   if (!sorted) return 0;
+   Long64_t nSorted = 0;
+   TEntryList *el;
+   for (Int_t i = 0; i < fListOfEntryList.GetEntriesFast(); i++) {
+      el = (TEntryList *) fListOfEntryList.At(i);
+      if (!el) continue;
+      for (Long64_t j = 0; j < el->GetN(); j++) {
+         Long64_t entry = el->GetEntry(j);
+         if (entry < 0 || entry >= nEntries || isSorted[entry]) continue;
+         isSorted[entry] = kTRUE;
+         tree->GetEntry(entry);
+         sorted->Fill();
+         nSorted++;
+      }
+   }
+   for (Long64_t entry = 0; entry < nEntries; entry++) {
+      if (isSorted[entry]) continue;
+      tree->GetEntry(entry);
+      sorted->Fill();
+   }
+   AliDebug(AliLog::kDebug, Form("%lld entries sorted in %d entry lists, %lld out of bins", nSorted, fListOfEntryList.GetEntriesFast(), nEntries - nSorted));
+   return sorted;
+}
@@ -15,6 +15,7 @@
 #include <TNamed.h>
 
 class TEntryList;
+class TTree;
 class AliMixEventCutObj;
 class AliVEvent;
 class AliMixEventPool : public TNamed {
@@ -44,6 +45,9 @@ public:
    TObjArray  *GetListOfEventCuts() { return &fListOfEventCuts; }
 
    Bool_t      SetCutValuesFromBinIndex(Int_t index);
+
+   // copy of tree with entries ordered by bin (entry lists from previous pass)
+   TTree      *CloneTreeSortedByBin(TTree *tree) const;
    void        SetBufferSize(Int_t buffer) { fBufferSize = buffer; }
    void        SetMixNumber(Int_t numMix) { fMixNumber = numMix; }
    Int_t       GetBufferSize() const { return fBufferSize; }
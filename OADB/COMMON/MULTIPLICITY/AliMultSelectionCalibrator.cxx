@@ -26,6 +26,11 @@
 #include "TList.h"
 #include "TFile.h"
 #include "TStopwatch.h"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <thread>
 
 ClassImp(AliMultSelectionCalibrator);
 
@@ -33,7 +38,7 @@ AliMultSelectionCalibrator::AliMultSelectionCalibrator() :
     TNamed(), fInputFileName(""), fBufferFileName("buffer.root"),
     fOutputFileName(""), fInput(0), fSelection(0), fMultSelectionCuts(0), fCalibHists(0),
     lNDesiredBoundaries(0), lDesiredBoundaries(0), fRunToUseAsDefault(-1),
-    fNRunRanges(0), fRunRangesMap(), fMultSelectionList(0)
+    fNRunRanges(0), fRunRangesMap(), fMultSelectionList(0), fkSinglePass(kFALSE), fNThreads(0)
 {
     // Constructor
 
@@ -60,7 +65,7 @@ AliMultSelectionCalibrator::AliMultSelectionCalibrator(const char * name, const
     TNamed(name,title), fInputFileName(""), fBufferFileName("buffer.root"),
     fOutputFileName(""), fInput(0), fSelection(0), fMultSelectionCuts(0), fCalibHists(0),
     lNDesiredBoundaries(0), lDesiredBoundaries(0), fRunToUseAsDefault(-1),
-    fNRunRanges(0), fRunRangesMap(), fMultSelectionList(0)
+    fNRunRanges(0), fRunRangesMap(), fMultSelectionList(0), fkSinglePass(kFALSE), fNThreads(0)
 {
     // Named Constructor
 
@@ -146,6 +151,12 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     //     (4a) Create run-by-run buffer files (requires averages)
     //     (4b) Compute Quantile Boundaries for all estimators
     //  (4) Save Quantiles + AliMultSelectionCuts to OADB File
+    //
+    // In single-pass mode (SetSinglePass) the estimators are evaluated
+    // with the compiled formulas while the input is read, their values
+    // are kept in memory per run and per estimator instead of being written
+    // to buffer trees, and averages and boundaries of all runs are then
+    // determined in parallel. The OADB output is the same.
 
     cout<<"=== STARTING CALIBRATION PROCEDURE ==="<<endl;
     cout<<" * Input File.....: "<<fInputFileName.Data()<<endl;
@@ -252,9 +263,8 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     Int_t lThisRunIndex = -1;
     //Buffer file with run-by-run TTree objects needed for later processing
 
-    TFile *fOutput = new TFile (fBufferFileName.Data(), "RECREATE");
+    TFile *fOutput = 0x0;
     TTree *sTree[lMaxQuantiles];
-    cout<<"Creating Trees..."<<endl;
     //N.B. No need to Exceed Run Ranges in Calibration Code here!
     Int_t lNTrees = 0;
     if( !lAutoDiscover ){
@@ -262,7 +272,28 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     }else{
         lNTrees = lMax;
     }
-    for(Int_t iRun=0; iRun<lNTrees; iRun++) {
+    //Number of selected events per run / run range
+    std::vector<Long64_t> lRunEntries(lNTrees, 0);
+    //Single-pass mode: estimator values per run / run range and estimator
+    std::vector< std::vector< std::vector<Float_t> > > lRunValues;
+    std::vector<AliMultSelection*> lRunSelections;
+    if ( fkSinglePass ){
+        cout<<"Single-pass mode: no buffer file, estimators evaluated while reading"<<endl;
+        lRunValues.resize(lNTrees);
+        //Calibration pre-optimization and setup
+        if ( !lAutoDiscover ){
+            for(Int_t iRun=0; iRun<lNTrees; iRun++) {
+                lRunSelections.push_back( (AliMultSelection*) fMultSelectionList->At(iRun) );
+                lRunSelections.back()->Setup ( fInput );
+            }
+        }else{
+            fSelection->Setup ( fInput );
+        }
+    }else{
+        fOutput = new TFile (fBufferFileName.Data(), "RECREATE");
+        cout<<"Creating Trees..."<<endl;
+    }
+    for(Int_t iRun=0; iRun<lNTrees && !fkSinglePass; iRun++) {
         sTree[iRun] = new TTree(Form("sTree%i",iRun),Form("sTree%i",iRun));
         
         //useful for debugging / cross-checking
@@ -376,24 +407,35 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
             }
         }
         if ( lSaveThisEvent ) {
-            sTree [ lIndex ] -> Fill();
+            lRunEntries[ lIndex ]++;
+            if ( !fkSinglePass ) {
+                sTree [ lIndex ] -> Fill();
+            } else {
+                AliMultSelection *lSel = lAutoDiscover ? fSelection : lRunSelections[lIndex];
+                lSel->Evaluate ( fInput );
+                std::vector< std::vector<Float_t> > &lThisRunValues = lRunValues[ lIndex ];
+                if ( (Long_t) lThisRunValues.size() < lSel->GetNEstimators() ) lThisRunValues.resize( lSel->GetNEstimators() );
+                for(Long_t iEst=0; iEst<lSel->GetNEstimators(); iEst++) {
+                    lThisRunValues[iEst].push_back( lSel->GetEstimator(iEst)->GetValue() );
+                }
+            }
         }
             
     }
     
     //Write buffer to file
-    for(Int_t iRun=0; iRun<lNRuns; iRun++) sTree[iRun]->Write();
+    for(Int_t iRun=0; iRun<lNRuns && !fkSinglePass; iRun++) sTree[iRun]->Write();
 
     if(!lAutoDiscover){
     cout<<"(3) Inspect Run Ranges and corresponding statistics: "<<endl;
     for(Int_t iRun = 0; iRun<fNRunRanges; iRun++) {
-        cout<<" --- Range #"<<iRun<<", ("<<fFirstRun[iRun]<<" - "<<fLastRun[iRun]<<"), N(events) = "<<sTree[iRun]->GetEntries()<<endl;
+        cout<<" --- Range #"<<iRun<<", ("<<fFirstRun[iRun]<<" - "<<fLastRun[iRun]<<"), N(events) = "<<lRunEntries[iRun]<<endl;
     }
     cout<<endl;
     }else{
         cout<<"(3) Inspect Runs and corresponding statistics: "<<endl;
         for(Int_t iRun = 0; iRun<fNRunRanges; iRun++) {
-            cout<<" --- Run #"<<iRun<<", (#"<<lRunNumbers[iRun]<<"), N(events) = "<<sTree[iRun]->GetEntries()<<endl;
+            cout<<" --- Run #"<<iRun<<", (#"<<lRunNumbers[iRun]<<"), N(events) = "<<lRunEntries[iRun]<<endl;
         }
         cout<<endl;
     }
@@ -408,9 +450,91 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     }
 
     // STEP 4: Actual determination of boundaries...
-    Long64_t *index;
+    Long64_t *index = 0x0;
     Double_t *lValues; 
 
+    //Single-pass mode: averages and raw boundaries of all runs / run ranges,
+    //each run being processed independently (in parallel, if requested)
+    std::vector< std::vector<Double_t> > lRunBoundaries;
+    std::vector< std::vector<Long64_t> > lRunAccepted;
+    if ( fkSinglePass ){
+        //Estimator configuration per run, taken here to leave only numerics to the threads
+        std::vector< std::vector<const AliMultEstimator*> > lRunEstimators(fNRunRanges);
+        for(Int_t iRun=0; iRun<fNRunRanges; iRun++) {
+            AliMultSelection *lSel = lAutoDiscover ? fSelection : lRunSelections[iRun];
+            for(Long_t iEst=0; iEst<lSel->GetNEstimators(); iEst++) lRunEstimators[iRun].push_back( lSel->GetEstimator(iEst) );
+            lRunValues[iRun].resize( lSel->GetNEstimators() );
+        }
+        lRunBoundaries.resize(fNRunRanges);
+        lRunAccepted.resize(fNRunRanges);
+        
+        auto lCalibrateRun = [&]( Int_t iRun ) {
+            const Long64_t ntot = lRunEntries[iRun];
+            const Int_t lNEstimatorsThis = lRunEstimators[iRun].size();
+            lRunBoundaries[iRun].assign( lNEstimatorsThis*lNDesiredBoundaries, 0.0 );
+            lRunAccepted[iRun].assign( lNEstimatorsThis, 0 );
+            for(Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
+                const AliMultEstimator *lEst = lRunEstimators[iRun][iEst];
+                std::vector<Float_t> &lThisValues = lRunValues[iRun][iEst];
+                //Averages and extreme values, summed in event order as in the Draw-based procedure
+                for( Long64_t iEntry=0; iEntry<ntot; iEntry++) {
+                    Float_t lThisVal = lThisValues[iEntry];
+                    lAvEst[iEst][iRun] += lThisVal;
+                    if( lThisVal < lMinEst[iEst][iRun] ) lMinEst[iEst][iRun] = lThisVal;
+                    if( lThisVal > lMaxEst[iEst][iRun] ) lMaxEst[iEst][iRun] = lThisVal;
+                }
+                if( ntot < 1 ) {
+                    lAvEst[iEst][iRun] = -1;
+                } else {
+                    lAvEst[iEst][iRun] /= ( (Double_t) ntot );
+                }
+                //Integer estimators are histogrammed later on
+                if( lEst->IsInteger() ) continue;
+                
+                //Descending order, as TMath::Sort: the boundary at a position is the value itself
+                std::sort( lThisValues.begin(), lThisValues.end(), std::greater<Float_t>() );
+                Long64_t lAccepted = 0;
+                if( lEst->GetUseAnchor() ){
+                    while( lAccepted<ntot && lThisValues[lAccepted] > lEst->GetAnchorPoint() ) lAccepted++;
+                }
+                lRunAccepted[iRun][iEst] = lAccepted;
+                
+                Double_t *lBoundaries = &lRunBoundaries[iRun][iEst*lNDesiredBoundaries];
+                lBoundaries[0] = 0.0;
+                if ( lMinEst[iEst][iRun] < 0 ) lBoundaries[0] = lMinEst[iEst][iRun];
+                for( Long_t lB=1; lB<lNDesiredBoundaries && ntot != 0; lB++) {
+                    Long64_t position = (Long64_t) ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) );
+                    if( lEst->GetUseAnchor() ){
+                        Double_t lAnchorPercentile = (Double_t) lEst->GetAnchorPercentile();
+                        Double_t lFractionAccepted = (((Double_t) lAccepted )/((Double_t) ntot));
+                        Double_t lScalingFactor    = lFractionAccepted/((0.01)*lAnchorPercentile);
+                        position = (Long64_t) ( ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) ) * lScalingFactor );
+                    }
+                    if(position > ntot-1 ) position = ntot-1; //protection !
+                    lBoundaries[lB] = lThisValues[position];
+                }
+            }
+        };
+        
+        Int_t lNThreads = fNThreads;
+        if ( lNThreads <= 0 ) lNThreads = std::thread::hardware_concurrency();
+        if ( lNThreads < 1 ) lNThreads = 1;
+        if ( lNThreads > fNRunRanges ) lNThreads = fNRunRanges;
+        cout<<"(3a) Determining averages and boundaries of "<<fNRunRanges<<" runs / run ranges with "<<lNThreads<<" thread(s)"<<endl;
+        if ( lNThreads <= 1 ) {
+            for(Int_t iRun=0; iRun<fNRunRanges; iRun++) lCalibrateRun(iRun);
+        } else {
+            std::atomic<Int_t> lNextRun(0);
+            std::vector<std::thread> lWorkers;
+            for(Int_t ith=0; ith<lNThreads; ith++) {
+                lWorkers.push_back(std::thread([&]() {
+                    for(Int_t iRun=lNextRun++; iRun<fNRunRanges; iRun=lNextRun++) lCalibrateRun(iRun);
+                }));
+            }
+            for(UInt_t ith=0; ith<lWorkers.size(); ith++) lWorkers[ith].join();
+        }
+    }
+
     //Histograms to store calibration information
     TH1F *hCalib[1000][lNEstimators];
     
@@ -425,33 +549,39 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
 
         const Int_t lNEstimatorsThis = fSelection->GetNEstimators();
 	
-        const Long64_t ntot = (Long64_t) sTree[iRun]->GetEntries();
+        const Long64_t ntot = lRunEntries[iRun];
         if ( !lAutoDiscover ){
             cout<<"--- Processing run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }else{
             cout<<"--- Processing run "<<lRunNumbers[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }
-        sTree[iRun]->SetEstimate(ntot+1);
+        if ( !fkSinglePass ) sTree[iRun]->SetEstimate(ntot+1);
         //Cast Run Number into drawing conditions
         for(Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
-            lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
-            lValues = sTree[iRun]->GetV1();
-            cout<<"--- Calculating averages: "<<flush;
-            for( Long64_t iEntry=0; iEntry<ntot; iEntry++) {
-                Float_t lThisVal = lValues[iEntry]; //Test
-                lAvEst[iEst][iRun] += lThisVal;
-                if( lThisVal < lMinEst[iEst][iRun] ) {
-                    lMinEst[iEst][iRun] = lThisVal;
+            if ( fkSinglePass ) {
+                //Already determined in single pass
+                lRunStats[iRun] = ntot;
+                cout<<"--- Calculating averages: "<<flush;
+            } else {
+                lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
+                lValues = sTree[iRun]->GetV1();
+                cout<<"--- Calculating averages: "<<flush;
+                for( Long64_t iEntry=0; iEntry<ntot; iEntry++) {
+                    Float_t lThisVal = lValues[iEntry]; //Test
+                    lAvEst[iEst][iRun] += lThisVal;
+                    if( lThisVal < lMinEst[iEst][iRun] ) {
+                        lMinEst[iEst][iRun] = lThisVal;
+                    }
+                    if( lThisVal > lMaxEst[iEst][iRun] ) {
+                        lMaxEst[iEst][iRun] = lThisVal;
+                    }
                 }
-                if( lThisVal > lMaxEst[iEst][iRun] ) {
-                    lMaxEst[iEst][iRun] = lThisVal;
+                if( ntot < 1 ) {
+                    lAvEst[iEst][iRun] = -1;
+                } else {
+                    lAvEst[iEst][iRun] /= ( (Double_t) ntot );
                 }
             }
-            if( sTree[iRun]->GetEntries() < 1 ) {
-                lAvEst[iEst][iRun] = -1;
-            } else {
-                lAvEst[iEst][iRun] /= ( (Double_t) (sTree[iRun]->GetEntries()) );
-            }
             cout<<" Min = "<<lMinEst[iEst][iRun]<<", Max = "<<lMaxEst[iEst][iRun]<<", Av = "<<lAvEst[iEst][iRun]<<endl;
             
             if ( TMath::Abs( lMinEst[iEst][iRun] - lMaxEst[iEst][iRun] ) < 1e-6 ){
@@ -489,60 +619,70 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
 	
         const Int_t lNEstimatorsThis = fSelection->GetNEstimators(); 
 
-        const Long64_t ntot = (Long64_t) sTree[iRun]->GetEntries();
+        const Long64_t ntot = lRunEntries[iRun];
         if ( !lAutoDiscover ){
             cout<<"--- Processing run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }else{
             cout<<"--- Processing run "<<lRunNumbers[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }
-        sTree[iRun]->SetEstimate(ntot+1);
-        // Memory allocation: don't repeat it per estimator! only per run
-        index = new Long64_t[ntot];
+        if ( !fkSinglePass ) {
+            sTree[iRun]->SetEstimate(ntot+1);
+            // Memory allocation: don't repeat it per estimator! only per run
+            index = new Long64_t[ntot];
+        }
         //Cast Run Number into drawing conditions
         for(Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
             if( ! ( fSelection->GetEstimator(iEst)->IsInteger() ) ) {
                 //==== Floating Point Calibration Engine ====
-                lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
-                cout<<"--- Sorting estimator "<<fSelection->GetEstimator(iEst)->GetName()<<"..."<<flush;
+                if ( fkSinglePass ) {
+                    //Raw boundaries already determined from the in-memory values
+                    cout<<"--- Boundaries of estimator "<<fSelection->GetEstimator(iEst)->GetName()<<" from single pass... "<<flush;
+                    lAcceptedEvents = lRunAccepted[iRun][iEst];
+                    lRunStats[iRun] = fSelection->GetEstimator(iEst)->GetUseAnchor() ? lAcceptedEvents : ntot;
+                    for( Long_t lB=0; lB<lNDesiredBoundaries; lB++) lNrawBoundaries[lB] = lRunBoundaries[iRun][iEst*lNDesiredBoundaries+lB];
+                } else {
+                    lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
+                    cout<<"--- Sorting estimator "<<fSelection->GetEstimator(iEst)->GetName()<<"..."<<flush;
                 
-                TMath::Sort(ntot,sTree[iRun]->GetV1(),index);
-                cout<<" Done! Getting Boundaries... "<<flush;
+                    TMath::Sort(ntot,sTree[iRun]->GetV1(),index);
+                    cout<<" Done! Getting Boundaries... "<<flush;
                 
-                //Special override in case anchored estimator
-                if( fSelection->GetEstimator(iEst)->GetUseAnchor() ){
-                    cout<<"Anchoring... "<<flush;
-                    //Require determination of index after which values are to be discarded
-                    //Count fraction of accepted
-                    TString lCondition = fSelection->GetEstimator(iEst)->GetDefinition();
-                    lCondition.Append(Form("> %.10f",fSelection->GetEstimator(iEst)->GetAnchorPoint() ) );
-                    lAcceptedEvents = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),lCondition.Data(),"goff");
-                    lRunStats[iRun] = lAcceptedEvents;
-                }
-                lNrawBoundaries[0] = 0.0; //Defined OK even if anchored
-                //Overwrite lower boundary in case this has a negative minimum...
-                if ( lMinEst[iEst][iRun] < 0 ) {
-                    lNrawBoundaries[0] = lMinEst[iEst][iRun];
-                    cout<<"Min Value Override, Negative..."<<flush;
-                }
+                    //Special override in case anchored estimator
+                    if( fSelection->GetEstimator(iEst)->GetUseAnchor() ){
+                        cout<<"Anchoring... "<<flush;
+                        //Require determination of index after which values are to be discarded
+                        //Count fraction of accepted
+                        TString lCondition = fSelection->GetEstimator(iEst)->GetDefinition();
+                        lCondition.Append(Form("> %.10f",fSelection->GetEstimator(iEst)->GetAnchorPoint() ) );
+                        lAcceptedEvents = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),lCondition.Data(),"goff");
+                        lRunStats[iRun] = lAcceptedEvents;
+                    }
+                    lNrawBoundaries[0] = 0.0; //Defined OK even if anchored
+                    //Overwrite lower boundary in case this has a negative minimum...
+                    if ( lMinEst[iEst][iRun] < 0 ) {
+                        lNrawBoundaries[0] = lMinEst[iEst][iRun];
+                        cout<<"Min Value Override, Negative..."<<flush;
+                    }
                 
-                for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
-                    Long64_t position = (Long64_t) ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) );
+                    for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
+                        Long64_t position = (Long64_t) ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) );
                     
-                    if( fSelection->GetEstimator(iEst)->GetUseAnchor() && ntot != 0 ){
-                        //Make sure index position lAnchorEst corresponds to lAnchorPercentile
-                        Double_t lAnchorPercentile = (Double_t) fSelection->GetEstimator(iEst)->GetAnchorPercentile();
-                        Double_t lFractionAccepted = (((Double_t) lAcceptedEvents )/((Double_t) ntot));
-                        Double_t lScalingFactor    = lFractionAccepted/((0.01)*lAnchorPercentile);
-                        //Make sure: if AnchorPercentile requested, cut at AnchorPoint
-                        position = (Long64_t) ( ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) ) * lScalingFactor );
-                        if(position > ntot-1 ) position = ntot-1; //protection !
+                        if( fSelection->GetEstimator(iEst)->GetUseAnchor() && ntot != 0 ){
+                            //Make sure index position lAnchorEst corresponds to lAnchorPercentile
+                            Double_t lAnchorPercentile = (Double_t) fSelection->GetEstimator(iEst)->GetAnchorPercentile();
+                            Double_t lFractionAccepted = (((Double_t) lAcceptedEvents )/((Double_t) ntot));
+                            Double_t lScalingFactor    = lFractionAccepted/((0.01)*lAnchorPercentile);
+                            //Make sure: if AnchorPercentile requested, cut at AnchorPoint
+                            position = (Long64_t) ( ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) ) * lScalingFactor );
+                            if(position > ntot-1 ) position = ntot-1; //protection !
+                        }
+                        //cout<<"Position requested: "<<position<<flush;
+                        sTree[iRun]->GetEntry( index[position] );
+                        //Calculate the estimator with this input, please
+                        fSelection->Evaluate ( fInput );
+                        //fSelection->PrintInfo();
+                        lNrawBoundaries[lB] = fSelection->GetEstimator(iEst)->GetValue();
                     }
-                    //cout<<"Position requested: "<<position<<flush;
-                    sTree[iRun]->GetEntry( index[position] );
-                    //Calculate the estimator with this input, please
-                    fSelection->Evaluate ( fInput );
-                    //fSelection->PrintInfo();
-                    lNrawBoundaries[lB] = fSelection->GetEstimator(iEst)->GetValue();
                 }
                 //Cross-check correct rejection of anything beyond anchor point
                 if( fSelection->GetEstimator(iEst)->GetUseAnchor() && ntot != 0 ){
@@ -594,14 +734,20 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                 Float_t lLowEdge = lMinEst[iEst][iRun]-0.5;
                 Float_t lHighEdge= lMaxEst[iEst][iRun]+0.5;
                 cout<<"Inspect: "<<lNBins<<", low "<<lLowEdge<<", high "<<lHighEdge<<endl;
-                if( sTree[iRun]->GetEntries() < 1 ) {
+                if( ntot < 1 ) {
                     //Case of an empty run!
                     hCalib[iRun][iEst] = new TH1F(Form("hCalib_%i_%s",lRunNumbers[iRun],fSelection->GetEstimator(iEst)->GetName()),"",1,0,1);
                     hCalib[iRun][iEst]->SetDirectory(0);
                 } else {
                     TH1F *hTemporary = new TH1F("hTemporary", "", lNBins, lMinEst[iEst][iRun]-0.5, lMaxEst[iEst][iRun]+0.5 );
                     //hTemporary->SetDirectory(0);
-                    lRunStats[iRun] = sTree[iRun]->Draw(Form("%s>>hTemporary",fSelection->GetEstimator(iEst)->GetDefinition().Data()),"","goff");
+                    if ( fkSinglePass ) {
+                        const std::vector<Float_t> &lThisValues = lRunValues[iRun][iEst];
+                        for( Long64_t iEntry=0; iEntry<ntot; iEntry++) hTemporary->Fill( lThisValues[iEntry] );
+                        lRunStats[iRun] = ntot;
+                    } else {
+                        lRunStats[iRun] = sTree[iRun]->Draw(Form("%s>>hTemporary",fSelection->GetEstimator(iEst)->GetDefinition().Data()),"","goff");
+                    }
                     cout<<"entries = "<<lRunStats[iRun]<<endl;
                     //In memory now: histogram with content, please normalize to unity
                     hTemporary->Scale(1./((double)(lRunStats[iRun])));
@@ -704,6 +850,9 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
         }
         //Cleanup: Delete index variable
         delete[] index;
+        index = 0x0;
+        //Single-pass mode: values of this run no longer needed
+        if ( fkSinglePass ) std::vector< std::vector<Float_t> >().swap( lRunValues[iRun] );
     }
     
     if( fRunToUseAsDefault < 0 ){
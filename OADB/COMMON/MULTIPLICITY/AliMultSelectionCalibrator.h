@@ -61,6 +61,12 @@ public:
     //Configure standard input
     void SetupStandardInput();
     
+    //Single-pass mode: all estimators are evaluated while reading the input
+    //(no buffer file), boundaries are then determined in parallel across runs
+    void SetSinglePass ( Bool_t lVal = kTRUE ) { fkSinglePass = lVal; }
+    //Number of threads for single-pass mode (0: number of available cores)
+    void SetNThreads ( Int_t lVal ) { fNThreads = lVal; }
+    
     //Master Function in this Class: To be called once filenames are set
     Bool_t Calibrate();
     
@@ -94,11 +100,15 @@ private:
     
     // TList object for storing histograms
     TList *fCalibHists; 
+    
+    Bool_t fkSinglePass; // Evaluate estimators in one pass over input
+    Int_t  fNThreads;    // Threads for single-pass boundary determination
 
-    ClassDef(AliMultSelectionCalibrator, 2);
+    ClassDef(AliMultSelectionCalibrator, 3);
     //(this classdef is only for bookkeeping, class will not usually
     // be streamed according to current workflow except in very specific
     // tests!) 
     //2 - Adjustments of extra event selections
+    //3 - Single-pass calibration mode
 };
 #endif
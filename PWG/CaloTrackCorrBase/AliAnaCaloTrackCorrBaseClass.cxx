@@ -62,6 +62,8 @@ fInputAODBranch(0x0),         fInputAODName(""),
 fOutputAODBranch(0x0),        fNewAOD(kFALSE),
 fOutputAODName(""),           fOutputAODClassName(""),
 fAODObjArrayName(""),         fAddToHistogramsName(""),
+fAODBranchDependencies(""),   fUseDefaultAODBranchDependencies(kTRUE),
+fConcurrentExecution(kFALSE),
 fCaloPID(0x0),                fCaloUtils(0x0),
 fFidCut(0x0),                 fHisto(0x0),
 fIC(0x0),                     fMCUtils(0x0),                
@@ -246,6 +248,31 @@ AliVCluster * AliAnaCaloTrackCorrBaseClass::FindCluster(TObjArray* clusters, Int
   return 0x0;
 }
 
+//______________________________________________________________________________________
+/// Names of the AOD branches, or other event resources, read or written by this analysis,
+/// space separated. AliAnaCaloTrackCorrMaker processes analyses sharing any of these names
+/// in the same thread and in the order they were added, see AliAnaCaloTrackCorrMaker::SetNumberOfThreads().
+/// By default the input AOD branch and, if created, the output AOD branch, plus
+/// the names added with AddAODBranchDependency(). SetAODBranchDependencies() replaces the default.
+/// Analyses reading other branches or sharing other objects must add them.
+/// Analyses are executed concurrently only if SwitchOnConcurrentExecution() is set,
+/// see also GetModifiedSharedResources().
+//______________________________________________________________________________________
+TString AliAnaCaloTrackCorrBaseClass::GetAODBranchDependencies() const
+{
+  TString names = "";
+
+  if ( fUseDefaultAODBranchDependencies )
+  {
+    if ( fInputAODName != "" ) names += fInputAODName + " ";
+    if ( fNewAOD && fOutputAODName != "" ) names += fOutputAODName + " ";
+  }
+
+  names += fAODBranchDependencies;
+
+  return names;
+}
+
 //______________________________________________________________________________________
 /// Recover ouput and input AOD pointers for each event in AliCaloTrackMaker.
 //______________________________________________________________________________________
@@ -138,7 +138,22 @@ public:
   virtual TClonesArray * GetInputAODBranch()               const { return fInputAODBranch  ; }
   virtual TClonesArray * GetOutputAODBranch()              const { if(fNewAOD) return fOutputAODBranch; else return fInputAODBranch ; }
   virtual TClonesArray * GetAODBranch(const TString & aodBranchName) const ;
-	
+
+  // Shared resources, used by AliAnaCaloTrackCorrMaker to run analyses in parallel
+
+  virtual TString        GetAODBranchDependencies()        const ;
+  virtual void           AddAODBranchDependency(TString name)    { fAODBranchDependencies += name + " " ; }
+  virtual void           SetAODBranchDependencies(TString names) { fAODBranchDependencies = names + " " ; fUseDefaultAODBranchDependencies = kFALSE ; }
+
+  /// Shared objects modified while processing the event, space separated:
+  /// "gRandom", "CaloUtils" (the AliCalorimeterUtils settings) or "ReaderClusters"
+  /// (the clusters of the reader, even if restored afterwards).
+  virtual TString        GetModifiedSharedResources()      const { return "" ; }
+
+  virtual void           SwitchOnConcurrentExecution()           { fConcurrentExecution = kTRUE  ; }
+  virtual void           SwitchOffConcurrentExecution()          { fConcurrentExecution = kFALSE ; }
+  virtual Bool_t         IsConcurrentExecutionOn()         const { return fConcurrentExecution   ; }
+
   // Track cluster arrays access methods
   
   virtual TClonesArray*  GetAODCaloClusters()              const ; // Output AOD clusters, not used?
@@ -428,6 +443,9 @@ private:
   TString                    fOutputAODClassName;  ///<  Type of aod objects to be stored in the TClonesArray (AliAODPWG4Particle, AliAODPWG4ParticleCorrelation ...).	
   TString                    fAODObjArrayName ;    ///<  Name of ref array kept in a TList in AliAODParticleCorrelation with clusters or track. references.
   TString                    fAddToHistogramsName; ///<  Add this string to histograms name.
+  TString                    fAODBranchDependencies;           ///<  Names of other shared AOD branches or resources used, space separated.
+  Bool_t                     fUseDefaultAODBranchDependencies; ///<  Add the input and output AOD branches to the shared resources.
+  Bool_t                     fConcurrentExecution;             ///<  The analysis may run concurrently with others, see AliAnaCaloTrackCorrMaker::SetAnalysisLanes().
   
   // Analysis helper classes access pointers
   AliCaloPID               * fCaloPID;             ///< PID calculation utils.
@@ -452,7 +470,7 @@ private:
   AliAnaCaloTrackCorrBaseClass & operator = (const AliAnaCaloTrackCorrBaseClass & bc) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrBaseClass,29) ;
+  ClassDef(AliAnaCaloTrackCorrBaseClass,30) ;
   /// \endcond
 
 } ;
@@ -19,6 +19,7 @@
 #include <TClonesArray.h>
 #include <TList.h>
 #include <TH1F.h>
+#include <TObjString.h>
 //#include <TObjectTable.h>
 #include <TGeoGlobalMagField.h>
 
@@ -31,6 +32,7 @@
 #include "AliAnaCaloTrackCorrMaker.h"
 #include "AliLog.h"
 #include "AliGenPythiaEventHeader.h"
+#include "AliLaneThreadPool.h"
 
 /// \cond CLASSIMP
 ClassImp(AliAnaCaloTrackCorrMaker) ;
@@ -50,6 +52,8 @@ fAnaDebug(0),                 fCuts(new TList),
 fScaleFactor(-1),
 fFillDataControlHisto(1),     fSumw2(0),
 fCheckPtHard(0),
+fNThreads(1),                 fLanePool(0),
+fNLaneAnalyses(-1),
 // Control histograms
 fhNEventsIn(0),               fhNEvents(0),
 fhNExoticEvents(0),           fhNEventsNoTriggerFound(0),
@@ -103,6 +107,9 @@ fScaleFactor(maker.fScaleFactor),
 fFillDataControlHisto(maker.fFillDataControlHisto),
 fSumw2(maker.fSumw2),
 fCheckPtHard(maker.fCheckPtHard),
+fNThreads(maker.fNThreads),
+fLanePool(0),
+fNLaneAnalyses(-1),
 fhNEventsIn(maker.fhNEventsIn),
 fhNEvents(maker.fhNEvents),
 fhNExoticEvents(maker.fhNExoticEvents),
@@ -180,6 +187,8 @@ AliAnaCaloTrackCorrMaker::~AliAnaCaloTrackCorrMaker()
   if (fReader)    delete fReader ;
   if (fCaloUtils) delete fCaloUtils ;
   
+  delete fLanePool ; // joins the threads
+  
   if(fCuts)
   {
 	  fCuts->Delete();
@@ -987,6 +996,9 @@ void AliAnaCaloTrackCorrMaker::Init()
     ana->Init();
     ana->InitDebug();
   }//Loop on analysis defined
+  
+  // Lanes of analyses and threads executing them, kept for all the events
+  if ( fNThreads != 1 ) SetAnalysisLanes();
 }
 
 //_____________________________________________
@@ -1018,6 +1030,7 @@ void AliAnaCaloTrackCorrMaker::Print(const Option_t * opt) const
   printf("Produce Histo              =     %d\n", fMakeHisto  ) ;
   printf("Produce AOD                =     %d\n", fMakeAOD    ) ;
   printf("Number of analysis tasks   =     %d\n", fAnalysisContainer->GetEntries()) ;
+  printf("Number of threads          =     %d\n", fNThreads   ) ;
   
   if(!strcmp("all",opt))
   {
@@ -1115,26 +1128,15 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   
   AliDebug(1,"*** Begin analysis ***");
   
-  Int_t nana = fAnalysisContainer->GetEntries() ;
-  for(Int_t iana = 0; iana <  nana; iana++)
+  if ( fNThreads != 1 )
   {
-    AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
-    
-    ana->ConnectInputOutputAODBranches(); // Sets branches for each analysis
-    
-    //Fill pool for mixed event for the analysis that need it
-    if(!fReader->IsEventTriggerAtSEOn() && isMBTrigger)
-    {
-      ana->FillEventMixPool();
-      if(!isTrigger) continue; // pool filled do not try to fill AODs or histograms if trigger is not MB
-    }
-    
-    //Make analysis, create aods in aod branch and in some cases fill histograms
-    if(fMakeAOD  )  ana->MakeAnalysisFillAOD()  ;
-    
-    //Make further analysis with aod branch and fill histograms
-    if(fMakeHisto)  ana->MakeAnalysisFillHistograms()  ;
-    
+    ProcessAnalysesInThreads(isMBTrigger, isTrigger);
+  }
+  else
+  {
+    Int_t nana = fAnalysisContainer->GetEntries() ;
+    for(Int_t iana = 0; iana <  nana; iana++)
+      ProcessAnalysis((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana), isMBTrigger, isTrigger) ;
   }
 	
   fReader->ResetLists();
@@ -1155,6 +1157,140 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   AliDebug(1,"*** End analysis ***");
 }
 
+//_____________________________________________________________________________________
+/// Execute the analysis steps for one analysis in the current event.
+///
+/// \param ana: analysis.
+/// \param isMBTrigger: event selected for mixing.
+/// \param isTrigger: event selected for the analysis.
+//_____________________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::ProcessAnalysis(AliAnaCaloTrackCorrBaseClass * ana, Bool_t isMBTrigger, Bool_t isTrigger)
+{
+  ana->ConnectInputOutputAODBranches(); // Sets branches for each analysis
+  
+  //Fill pool for mixed event for the analysis that need it
+  if(!fReader->IsEventTriggerAtSEOn() && isMBTrigger)
+  {
+    ana->FillEventMixPool();
+    if(!isTrigger) return; // pool filled do not try to fill AODs or histograms if trigger is not MB
+  }
+  
+  //Make analysis, create aods in aod branch and in some cases fill histograms
+  if(fMakeAOD  )  ana->MakeAnalysisFillAOD()  ;
+  
+  //Make further analysis with aod branch and fill histograms
+  if(fMakeHisto)  ana->MakeAnalysisFillHistograms()  ;
+}
+
+//_____________________________________________________________________________________
+/// Execute the analyses concurrently, lane by lane, see SetAnalysisLanes().
+/// The threads of the pool (AliLaneThreadPool, started in Init()) take the next
+/// lane not yet processed and execute its analyses in order. Without ROOT 6 the
+/// lanes are executed one after the other.
+///
+/// \param isMBTrigger: event selected for mixing.
+/// \param isTrigger: event selected for the analysis.
+//_____________________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::ProcessAnalysesInThreads(Bool_t isMBTrigger, Bool_t isTrigger)
+{
+  if ( fNLaneAnalyses != fAnalysisContainer->GetEntries() ) SetAnalysisLanes();
+  
+  // The eta-phi cell indices of the reader are built on request,
+  // build them before the threads share the reader
+  if ( fReader->IsEventTriggerAtSEOn() || isTrigger )
+  {
+    fReader->GetEtaPhiCellIndex(fReader->GetCTSTracks    ());
+    fReader->GetEtaPhiCellIndex(fReader->GetEMCALClusters());
+    fReader->GetEtaPhiCellIndex(fReader->GetDCALClusters ());
+    fReader->GetEtaPhiCellIndex(fReader->GetPHOSClusters ());
+    
+    // Clusters with the fixed vertex of the UE bands of AliAnaParticleIsolation
+    Double_t vertex[] = {0,0,0} ;
+    if ( fReader->GetDataType() != AliCaloTrackReader::kMC ) fReader->GetVertex(vertex);
+    fReader->GetEtaPhiCellIndex(fReader->GetEMCALClusters(), vertex);
+    fReader->GetEtaPhiCellIndex(fReader->GetPHOSClusters (), vertex);
+  }
+  
+  // Analyses of one lane
+  class AnalysisLane : public AliLaneThreadPool::LaneProcessor
+  {
+  public:
+    AnalysisLane(AliAnaCaloTrackCorrMaker * maker, Bool_t isMBTrigger, Bool_t isTrigger) :
+    fMaker(maker), fIsMBTrigger(isMBTrigger), fIsTrigger(isTrigger) { }
+    
+    void ProcessLane(Int_t lane)
+    {
+      const std::vector<Int_t> & analyses = fMaker->fLanePool->GetLane(lane);
+      for(size_t iana = 0; iana < analyses.size(); iana++)
+        fMaker->ProcessAnalysis((AliAnaCaloTrackCorrBaseClass *) fMaker->fAnalysisContainer->At(analyses[iana]), fIsMBTrigger, fIsTrigger);
+    }
+    
+  private:
+    AliAnaCaloTrackCorrMaker * fMaker;
+    Bool_t fIsMBTrigger;
+    Bool_t fIsTrigger;
+  };
+  
+  AnalysisLane processor(this, isMBTrigger, isTrigger);
+  fLanePool->ProcessLanes(processor);
+}
+
+//_____________________________________________________________________________________
+/// Group the analyses in lanes executed sequentially in one thread, and start the
+/// threads of the pool, at most one per lane. Called from Init() and again if the
+/// number of analyses or of threads changed.
+/// Two analyses are in the same lane if they share any of the names given by
+/// AliAnaCaloTrackCorrBaseClass::GetAODBranchDependencies() or
+/// AliAnaCaloTrackCorrBaseClass::GetModifiedSharedResources(), directly or through
+/// other analyses. In addition:
+///  * Analyses without AliAnaCaloTrackCorrBaseClass::SwitchOnConcurrentExecution()
+///    are all in the same lane.
+///  * If an analysis modifies the calorimeter utils or the reader clusters, which
+///    all the analyses read, all the analyses are in the same lane.
+///
+/// Lanes are ordered by their first analysis, and the analyses of
+/// a lane keep the order of the container, so that an analysis reading the AOD
+/// branch produced by another one is executed after it.
+//_____________________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::SetAnalysisLanes()
+{
+  if ( !fLanePool ) fLanePool = new AliLaneThreadPool();
+  
+  Int_t nana = fAnalysisContainer->GetEntries() ;
+  fNLaneAnalyses = nana;
+  
+  fLanePool->ResetLanes(nana);
+  
+  // Shared state read by all analyses
+  Bool_t readStateModified = kFALSE;
+  for(Int_t iana = 0; iana < nana; iana++)
+  {
+    TString modified = " " + ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana))->GetModifiedSharedResources() + " ";
+    if ( modified.Contains(" CaloUtils ") || modified.Contains(" ReaderClusters ") ) readStateModified = kTRUE;
+  }
+  
+  for(Int_t iana = 0; iana < nana; iana++)
+  {
+    AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
+    
+    TString resources = ana->GetAODBranchDependencies() + " " + ana->GetModifiedSharedResources();
+    if ( !ana->IsConcurrentExecutionOn() ) resources += " NotConcurrent";
+    if ( readStateModified )               resources += " ReaderState";
+    
+    fLanePool->AddResources(iana, resources);
+  }
+  
+  fLanePool->MakeLanes();
+  
+  Int_t nLanes   = fLanePool->GetNumberOfLanes();
+  Int_t nThreads = fNThreads > 0 ? fNThreads : AliLaneThreadPool::GetNumberOfCores();
+  if ( nThreads > nLanes ) nThreads = nLanes > 0 ? nLanes : 1;
+  fLanePool->StartThreads(nThreads);
+  
+  AliInfo(Form("%d analyses in %d independent lanes, %d threads requested, %d started",
+               nana, nLanes, fNThreads, fLanePool->GetNumberOfThreads()));
+}
+
 //__________________________________________________________
 /// Execute Terminate of analysis.
 /// Do some final plots.
@@ -17,6 +17,17 @@
 /// Control histograms like number of accepted events, vertex distribution
 /// and EMCal trigger related information are also produced here.
 ///
+/// With SetNumberOfThreads() different from 1, the analyses switched on with
+/// AliAnaCaloTrackCorrBaseClass::SwitchOnConcurrentExecution() process each event
+/// concurrently (ROOT 6), the others are executed in one thread as before.
+/// Analyses sharing an AOD branch or another resource (see
+/// AliAnaCaloTrackCorrBaseClass::GetAODBranchDependencies() and
+/// GetModifiedSharedResources()) are executed in the same thread, one after the
+/// other in the order they were added. The reader and the calorimeter utils are
+/// shared: an analysis switched on must only read them, and must declare the global
+/// state it modifies (gRandom for example). The output is the same as with the
+/// sequential execution only if these declarations are complete.
+///
 /// More information can be found in this [twiki](https://twiki.cern.ch/twiki/bin/viewauth/ALICE/PhotonHadronCorrelations).
 ///
 /// \author Gustavo Conesa Balbastre <Gustavo.Conesa.Balbastre@cern.ch>, LPSC-IN2P3-CNRS
@@ -31,6 +42,8 @@ class TH1F;
 // --- Analysis system ---
 #include "AliCaloTrackReader.h" 
 #include "AliCalorimeterUtils.h"
+class AliAnaCaloTrackCorrBaseClass;
+class AliLaneThreadPool;
 
 class AliAnaCaloTrackCorrMaker : public TObject {
 
@@ -84,6 +97,10 @@ class AliAnaCaloTrackCorrMaker : public TObject {
 
   void    SetScaleFactor(Double_t scale)   { fScaleFactor = scale  ; } 
 
+  /// Execute the analyses in n threads, 0 for the number of cores, 1 (default) sequential.
+  void    SetNumberOfThreads(Int_t n)      { fNThreads = n ; fNLaneAnalyses = -1 ; }
+  Int_t   GetNumberOfThreads()       const { return fNThreads      ; }
+
   void    SetCaloUtils(AliCalorimeterUtils * cu) { fCaloUtils = cu ; }
   void    SetReader(AliCaloTrackReader * re)     { fReader = re    ; }
   
@@ -108,6 +125,12 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   
  private:
   
+  void    ProcessAnalysis(AliAnaCaloTrackCorrBaseClass * ana, Bool_t isMBTrigger, Bool_t isTrigger) ;
+  
+  void    ProcessAnalysesInThreads(Bool_t isMBTrigger, Bool_t isTrigger) ;
+  
+  void    SetAnalysisLanes() ;
+  
   // General Data members
   
   AliCaloTrackReader  *  fReader ;                   ///<  Pointer to AliCaloTrackReader.
@@ -136,6 +159,12 @@ class AliAnaCaloTrackCorrMaker : public TObject {
     
   Bool_t   fCheckPtHard ;                            ///< For MC done in pT-Hard bins, plot specific histogram
     
+  Int_t    fNThreads ;                               ///<  Number of threads executing the analyses, 1 sequential, 0 number of cores.
+    
+  AliLaneThreadPool * fLanePool ;                    //!<! Independent lanes of analyses and the threads executing them.
+    
+  Int_t    fNLaneAnalyses ;                          //!<! Number of analyses when the lanes were set, -1 if not set.
+    
   // Control histograms
   
   TH1F *   fhNEventsIn;                              //!<! Number of input events counter histogram.
@@ -206,7 +235,7 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   AliAnaCaloTrackCorrMaker & operator = (const AliAnaCaloTrackCorrMaker & ) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrMaker,27) ;
+  ClassDef(AliAnaCaloTrackCorrMaker,28) ;
   /// \endcond
 
 } ;
@@ -0,0 +1,341 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+#include <TObjArray.h>
+
+// --- C++ ---
+#include <algorithm>
+
+// --- AliRoot system ---
+#include "AliAODPWG4Particle.h"
+#include "AliVTrack.h"
+#include "AliVCluster.h"
+#include "AliMixedEvent.h"
+#include "AliLog.h"
+
+// --- CaloTrackCorrelations ---
+#include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiIndex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackEtaPhiIndex) ;
+/// \endcond
+
+//____________________________________
+/// Default constructor.
+//____________________________________
+AliCaloTrackEtaPhiIndex::AliCaloTrackEtaPhiIndex() :
+TObject(),
+fCellSize(0.1),
+fList(0x0),
+fNEntries(0),
+fFixedVertex(kFALSE),
+fEtaMin(0),
+fNEtaCells(0),
+fNPhiCells(0),
+fCellStart(),
+fCellEntries(),
+fUnplaced(),
+fEntryCell(),
+fEntryEta(),
+fMomentum(),
+fTrackVector()
+{
+  for(Int_t i = 0; i < 3; i++) fVertex[i] = 0;
+}
+
+//____________________________________
+/// Forget the indexed list, called by AliCaloTrackReader::ResetLists().
+//____________________________________
+void AliCaloTrackEtaPhiIndex::Clear(const Option_t * /*opt*/)
+{
+  fList      = 0x0;
+  fNEntries  = 0;
+  fNEtaCells = 0;
+  fNPhiCells = 0;
+
+  fCellStart  .clear();
+  fCellEntries.clear();
+  fUnplaced   .clear();
+}
+
+//____________________________________________________________________
+/// Sort the entries of the list in eta-phi cells.
+/// The eta and phi of the entries are obtained as in AliIsolationCut::MakeIsolationCut():
+/// track momentum, cluster momentum with respect to the vertex of its event,
+/// or AliAODPWG4Particle kinematics in case of mixed events.
+/// If a vertex is given, the cluster momentum is calculated with respect to it,
+/// as done by the consumer of the index.
+///
+/// \param list: list of tracks or clusters of the reader.
+/// \param reader: pointer to AliCaloTrackReader. Needed to access the vertex.
+/// \param vertex: fixed vertex of the cluster momentum, null for the vertex of the cluster event.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiIndex::Fill(TObjArray * list, AliCaloTrackReader * reader, const Double_t * vertex)
+{
+  Clear();
+
+  if ( !list ) return ;
+
+  fList      = list ;
+  fNEntries  = list->GetEntriesFast();
+
+  fFixedVertex = ( vertex != 0x0 );
+  for(Int_t i = 0; i < 3; i++) fVertex[i] = vertex ? vertex[i] : 0;
+
+  if ( fCellSize <= 0 )
+  {
+    AliWarning(Form("Wrong cell size %f, set it to 0.1",fCellSize));
+    fCellSize = 0.1;
+  }
+
+  fNPhiCells = TMath::CeilNint(TMath::TwoPi()/fCellSize);
+
+  fEntryCell.assign(fNEntries,-1);
+  fEntryEta .assign(fNEntries, 0);
+
+  // Get eta-phi of the entries, keep the phi cell for later
+  const Float_t kMaxEta = 20; // entries at larger eta (pT = 0) are not placed in cells
+
+  Float_t etaMax = -kMaxEta;
+  Float_t etaMin =  kMaxEta;
+  Float_t eta    = -100. ;
+  Float_t phi    = -100. ;
+
+  for(Int_t ient = 0; ient < fNEntries; ient++)
+  {
+    TObject * obj = list->At(ient);
+
+    AliVTrack          * track    = dynamic_cast<AliVTrack*>         (obj) ;
+    AliVCluster        * calo     = dynamic_cast<AliVCluster*>       (obj) ;
+    AliAODPWG4Particle * particle = dynamic_cast<AliAODPWG4Particle*>(obj) ;
+
+    if      ( track )
+    {
+      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+      if ( fTrackVector.Pt() <= 0 ) continue ;
+
+      eta = fTrackVector.Eta();
+      phi = fTrackVector.Phi();
+    }
+    else if ( calo )
+    {
+      if ( fFixedVertex )
+      {
+        calo->GetMomentum(fMomentum,fVertex) ;
+      }
+      else
+      {
+        // Get the index where the cluster comes, to retrieve the corresponding vertex
+        Int_t evtIndex = 0 ;
+        if (reader->GetMixedEvent())
+          evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+
+        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+      }
+      if ( fMomentum.Pt() <= 0 ) continue ;
+
+      eta = fMomentum.Eta();
+      phi = fMomentum.Phi();
+    }
+    else if ( particle )
+    {
+      if ( particle->Pt() <= 0 ) continue ;
+
+      eta = particle->Eta();
+      phi = particle->Phi();
+    }
+    else continue ;
+
+    if ( !TMath::Finite(eta) || !TMath::Finite(phi) || TMath::Abs(eta) > kMaxEta ) continue ;
+
+    if ( phi < 0 ) phi+=TMath::TwoPi();
+
+    Int_t iphi = TMath::Max(0, TMath::Min(fNPhiCells-1, Int_t(phi/fCellSize)));
+
+    fEntryEta [ient] = eta;
+    fEntryCell[ient] = iphi;
+
+    if ( eta < etaMin ) etaMin = eta;
+    if ( eta > etaMax ) etaMax = eta;
+  }
+
+  fEtaMin    = etaMin;
+  fNEtaCells = etaMax >= etaMin ? Int_t((etaMax-etaMin)/fCellSize)+1 : 0;
+
+  // Counting sort of the entries, keeps the list order inside each cell
+  Int_t ncells = fNEtaCells*fNPhiCells;
+  fCellStart.assign(ncells+1,0);
+
+  for(Int_t ient = 0; ient < fNEntries; ient++)
+  {
+    if ( fEntryCell[ient] < 0 )
+    {
+      fUnplaced.push_back(ient);
+      continue;
+    }
+
+    Int_t ieta = TMath::Min(fNEtaCells-1, Int_t((fEntryEta[ient]-fEtaMin)/fCellSize));
+    fEntryCell[ient] = ieta*fNPhiCells + fEntryCell[ient];
+    fCellStart[fEntryCell[ient]+1]++;
+  }
+
+  for(Int_t icell = 0; icell < ncells; icell++) fCellStart[icell+1] += fCellStart[icell];
+
+  fCellEntries.resize(fCellStart[ncells]);
+  std::vector<Int_t> next(fCellStart.begin(), fCellStart.end()-1);
+
+  for(Int_t ient = 0; ient < fNEntries; ient++)
+  {
+    if ( fEntryCell[ient] >= 0 ) fCellEntries[next[fEntryCell[ient]]++] = ient;
+  }
+
+  AliDebug(1,Form("List %s: %d entries, %d not placed, %d x %d cells, eta min %2.2f",
+                  list->GetName(), fNEntries, (Int_t) fUnplaced.size(), fNEtaCells, fNPhiCells, fEtaMin));
+}
+
+//____________________________________________________________________
+/// \return True if filled with this list and vertex convention in the current event.
+/// \param list: list of tracks or clusters.
+/// \param vertex: fixed vertex of the cluster momentum, null for the vertex of the cluster event.
+//____________________________________________________________________
+Bool_t AliCaloTrackEtaPhiIndex::IsIndexOf(const TObjArray * list, const Double_t * vertex) const
+{
+  if ( !list || list != fList || list->GetEntriesFast() != fNEntries ) return kFALSE ;
+
+  if ( fFixedVertex != ( vertex != 0x0 ) ) return kFALSE ;
+
+  if ( vertex && ( vertex[0] != fVertex[0] || vertex[1] != fVertex[1] || vertex[2] != fVertex[2] ) ) return kFALSE ;
+
+  return kTRUE ;
+}
+
+//____________________________________________________________________
+/// Get the phi cells at less than a given distance from a direction,
+/// in at most two ranges of consecutive cells because of the wrap at 2 pi.
+///
+/// \param phi: azimuthal angle of the direction, in [0, 2 pi).
+/// \param dPhi: distance in phi.
+/// \param ranges: first and last cell of each range, output, size 4.
+/// \return number of ranges.
+//____________________________________________________________________
+Int_t AliCaloTrackEtaPhiIndex::GetPhiCellRanges(Float_t phi, Float_t dPhi, Int_t * ranges) const
+{
+  Float_t twoPi = TMath::TwoPi();
+
+  ranges[0] = 0;
+  ranges[1] = fNPhiCells-1;
+
+  if ( 2*dPhi >= twoPi ) return 1 ;
+
+  Float_t phiLow  = phi - dPhi;
+  Float_t phiHigh = phi + dPhi;
+  Int_t   nranges = 1;
+
+  if      ( phiLow < 0 )
+  {
+    ranges[0] = Int_t((phiLow+twoPi)/fCellSize);
+    ranges[2] = 0;
+    ranges[3] = Int_t(phiHigh/fCellSize);
+    nranges   = 2;
+  }
+  else if ( phiHigh >= twoPi )
+  {
+    ranges[0] = Int_t(phiLow/fCellSize);
+    ranges[2] = 0;
+    ranges[3] = Int_t((phiHigh-twoPi)/fCellSize);
+    nranges   = 2;
+  }
+  else
+  {
+    ranges[0] = Int_t(phiLow /fCellSize);
+    ranges[1] = Int_t(phiHigh/fCellSize);
+  }
+
+  for(Int_t i = 0; i < 2*nranges; i++) ranges[i] = TMath::Max(0, TMath::Min(fNPhiCells-1, ranges[i]));
+
+  // both ranges share a cell, all the cells are selected
+  if ( nranges == 2 && ranges[3] >= ranges[0] )
+  {
+    ranges[0] = 0;
+    return 1 ;
+  }
+
+  return nranges ;
+}
+
+//____________________________________________________________________
+/// Get the entries of the list close to a given direction, in list order.
+/// Cells are selected if they are at less than dEta + cell size in eta
+/// and (or, for bands) at less than dPhi + cell size in phi from the
+/// direction, with phi distances modulo 2 pi. Only the eta and phi cell
+/// ranges of the region are visited, the cells of a range are consecutive
+/// in fCellEntries. The small selection is then sorted back to list order.
+///
+/// \param eta: pseudorapidity of the direction, i.e. of the isolation candidate.
+/// \param phi: azimuthal angle of the direction.
+/// \param dEta: half width in eta of the region.
+/// \param dPhi: half width in phi of the region.
+/// \param bands: select the union of the eta and phi bands instead of their intersection.
+/// \param entries: indices in the list of the selected entries, output.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiIndex::GetEntriesInRegion(Float_t eta, Float_t phi, Float_t dEta, Float_t dPhi, Bool_t bands,
+                                                 std::vector<Int_t> & entries) const
+{
+  entries.clear();
+
+  if ( !fList ) return ;
+
+  Float_t twoPi = TMath::TwoPi();
+  phi -= twoPi*TMath::Floor(phi/twoPi);
+
+  // Eta cells of the region, at most one cell away from the eta band
+  Float_t etaLow   = (eta - dEta - fCellSize - fEtaMin)/fCellSize;
+  Float_t etaHigh  = (eta + dEta + fCellSize - fEtaMin)/fCellSize;
+  Int_t   ietaLow  = TMath::Max(0,            TMath::FloorNint(etaLow ));
+  Int_t   ietaHigh = TMath::Min(fNEtaCells-1, TMath::FloorNint(etaHigh));
+
+  // Phi cells of the region, at most one cell away from the phi band
+  Int_t phiRanges[4];
+  Int_t nPhiRanges = GetPhiCellRanges(phi, dPhi + fCellSize, phiRanges);
+
+  Int_t ietaFirst = bands ? 0            : ietaLow ;
+  Int_t ietaLast  = bands ? fNEtaCells-1 : ietaHigh;
+
+  for(Int_t ieta = ietaFirst; ieta <= ietaLast; ieta++)
+  {
+    Int_t firstCell = ieta*fNPhiCells;
+
+    if ( bands && ieta >= ietaLow && ieta <= ietaHigh )
+    {
+      // eta band: all the phi cells
+      entries.insert(entries.end(), fCellEntries.begin()+fCellStart[firstCell], fCellEntries.begin()+fCellStart[firstCell+fNPhiCells]);
+      continue ;
+    }
+
+    for(Int_t irange = 0; irange < nPhiRanges; irange++)
+    {
+      entries.insert(entries.end(),
+                     fCellEntries.begin()+fCellStart[firstCell+phiRanges[2*irange]],
+                     fCellEntries.begin()+fCellStart[firstCell+phiRanges[2*irange+1]+1]);
+    }
+  }
+
+  entries.insert(entries.end(), fUnplaced.begin(), fUnplaced.end());
+
+  std::sort(entries.begin(), entries.end());
+}
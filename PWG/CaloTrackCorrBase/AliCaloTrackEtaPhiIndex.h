@@ -0,0 +1,110 @@
+#ifndef ALICALOTRACKETAPHIINDEX_H
+#define ALICALOTRACKETAPHIINDEX_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackEtaPhiIndex
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Eta-phi cell index of a list of tracks or clusters of the event
+///
+/// The entries of one of the reader lists (CTS tracks, EMCAL or PHOS clusters)
+/// are sorted in cells of fixed size in eta and phi, once per event.
+/// For each isolation candidate, the cone and UE band sums then only loop
+/// over the entries in the cells near the candidate, instead of the full list.
+///
+/// The selection returns a superset of the entries in the region, with a
+/// margin of one cell, and in the order of the list, so that the sums done
+/// with the usual selection on each entry are identical to the ones of the
+/// loop over the full list. Entries whose eta and phi cannot be obtained
+/// are always returned.
+///
+/// The eta and phi of the clusters depend on the vertex used for their
+/// momentum: an index is built either with the vertex of the event of each
+/// cluster, as in AliIsolationCut, or with a fixed vertex given by the
+/// consumer, as in the UE band methods of AliAnaParticleIsolation.
+///
+/// The index is built and owned by AliCaloTrackReader, see
+/// AliCaloTrackReader::GetEtaPhiCellIndex().
+//_________________________________________________________________________
+
+// --- ROOT system ---
+#include <TObject.h>
+#include <TLorentzVector.h>
+#include <TVector3.h>
+class TObjArray ;
+
+// --- C++ ---
+#include <vector>
+
+// --- ANALYSIS system ---
+class AliCaloTrackReader ;
+
+class AliCaloTrackEtaPhiIndex : public TObject {
+
+ public:
+
+  AliCaloTrackEtaPhiIndex() ; // default ctor
+
+  /// Virtual destructor.
+  virtual ~AliCaloTrackEtaPhiIndex() { ; }
+
+  void       Fill(TObjArray * list, AliCaloTrackReader * reader, const Double_t * vertex = 0x0) ;
+
+  void       Clear(const Option_t * opt = "") ;
+
+  Bool_t     IsIndexOf(const TObjArray * list, const Double_t * vertex = 0x0) const ;
+
+  void       GetEntriesInRegion(Float_t eta, Float_t phi, Float_t dEta, Float_t dPhi, Bool_t bands,
+                                std::vector<Int_t> & entries) const ;
+
+  Float_t    GetCellSize()            const { return fCellSize       ; }
+  void       SetCellSize(Float_t size)      { fCellSize = size       ; }
+
+ private:
+
+  Float_t    fCellSize ;         ///< Size of the cells in eta and in phi (rad)
+
+  const TObjArray * fList ;      //!<! Indexed list, null if not filled in this event.
+
+  Int_t      fNEntries ;         //!<! Number of entries of the list when filled.
+
+  Bool_t     fFixedVertex ;      //!<! Cluster momentum with respect to fVertex instead of the vertex of its event.
+
+  Double_t   fVertex[3] ;        //!<! Fixed vertex of the cluster momentum.
+
+  Float_t    fEtaMin ;           //!<! Lower eta edge of the first cell.
+
+  Int_t      fNEtaCells ;        //!<! Number of cells in eta.
+
+  Int_t      fNPhiCells ;        //!<! Number of cells in phi, covering 0 to 2 pi.
+
+  std::vector<Int_t> fCellStart ;   //!<! Position in fCellEntries of the first entry of each cell, plus the end.
+
+  std::vector<Int_t> fCellEntries ; //!<! List entries sorted by cell, in list order inside each cell.
+
+  std::vector<Int_t> fUnplaced ;    //!<! List entries without eta-phi, returned by every selection.
+
+  std::vector<Int_t> fEntryCell ;   //!<! Cell of each list entry, -1 if unplaced, temporal.
+
+  std::vector<Float_t> fEntryEta ;  //!<! Eta of each list entry, temporal.
+
+  TLorentzVector fMomentum;      //!<! Momentum of cluster, temporal object.
+
+  TVector3   fTrackVector;       //!<! Track moment, temporal object.
+
+  Int_t      GetPhiCellRanges(Float_t phi, Float_t dPhi, Int_t * ranges) const ;
+
+  /// Copy constructor not implemented.
+  AliCaloTrackEtaPhiIndex(              const AliCaloTrackEtaPhiIndex & g) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackEtaPhiIndex & operator = (const AliCaloTrackEtaPhiIndex & g) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackEtaPhiIndex,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKETAPHIINDEX_H
@@ -43,6 +43,7 @@
 
 // ---- CaloTrackCorr ---
 #include "AliCalorimeterUtils.h"
+#include "AliCaloTrackEtaPhiIndex.h"
 #include "AliCaloTrackReader.h"
 
 // ---- Jets ----
@@ -75,6 +76,7 @@ fUseTrackDCACut(0),
 fAODBranchList(0x0),
 fCTSTracks(0x0),             fEMCALClusters(0x0),
 fDCALClusters(0x0),          fPHOSClusters(0x0),
+fUseEtaPhiCellIndex(0),      fEtaPhiCellIndexCellSize(0.1),
 fEMCALCells(0x0),            fPHOSCells(0x0),
 fInputEvent(0x0),            fOutputEvent(0x0),fMC(0x0),
 fFillCTS(0),                 fFillEMCAL(0),
@@ -138,6 +140,7 @@ fhNEventsAfterCut(0),        fNMCGenerToAccept(0),            fMCGenerEventHeade
   for(Int_t i = 0; i < 7; i++) fhPHOSClusterCutsE  [i]= 0x0 ;  
   for(Int_t i = 0; i < 6; i++) fhCTSTrackCutsPt    [i]= 0x0 ;    
   for(Int_t j = 0; j < 5; j++) { fMCGenerToAccept  [j] =  ""; fMCGenerIndexToAccept[j] = -1; }
+  for(Int_t i = 0; i < 8; i++) fEtaPhiCellIndex    [i]= 0x0 ;
   
   InitParameters();
 }
@@ -192,6 +195,8 @@ void AliCaloTrackReader::DeletePointers()
     delete fPHOSClusters ;
   }
   
+  for(Int_t i = 0; i < 8; i++) delete fEtaPhiCellIndex[i] ;
+  
   if(fVertex)
   {
     for (Int_t i = 0; i < fNMixedEvent; i++)
@@ -3043,6 +3048,7 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
   printf("Use EMCAL Cells =     %d\n",     fFillEMCALCells) ;
   printf("Use PHOS  Cells =     %d\n",     fFillPHOSCells) ;
   printf("Track status    =     %d\n", (Int_t) fTrackStatus) ;
+  printf("Eta-phi cell index =  %d, cell size %1.2f\n", fUseEtaPhiCellIndex, fEtaPhiCellIndexCellSize) ;
 
   printf("Track Mult Eta Cut =  %2.2f\n",  fTrackMultEtaCut) ;
 
@@ -3176,6 +3182,45 @@ void AliCaloTrackReader::RemapMCLabelForAODs(Int_t & label)
   //printf("AliCaloTrackReader::RemapMCLabelForAODs() - Label not found set to -1 \n");
 }
 
+//___________________________________________________________________________
+/// Eta-phi cell index of one of the arrays of the reader, to loop only on the
+/// tracks or clusters close to an isolation candidate.
+/// Built on the first request in the event, only if switched on.
+/// \return the index, null if not used or if the list is not an array of the reader
+/// (mixed events, references of the AOD particles ...).
+/// The cluster eta and phi must be obtained as done by the consumer: with the
+/// vertex of the event of each cluster (default, as in AliIsolationCut) or with
+/// a fixed vertex, for example {0,0,0} for kMC data.
+/// \param list: array of tracks or clusters, GetCTSTracks(), GetEMCALClusters() ...
+/// \param vertex: fixed vertex of the cluster momentum, null for the vertex of the cluster event.
+//___________________________________________________________________________
+AliCaloTrackEtaPhiIndex * AliCaloTrackReader::GetEtaPhiCellIndex(TObjArray * list, const Double_t * vertex)
+{
+  if ( !fUseEtaPhiCellIndex || !list ) return 0x0;
+  
+  Int_t ilist = -1;
+  if      ( list == fCTSTracks     ) ilist = 0;
+  else if ( list == fEMCALClusters ) ilist = 1;
+  else if ( list == fDCALClusters  ) ilist = 2;
+  else if ( list == fPHOSClusters  ) ilist = 3;
+  
+  if ( ilist < 0 ) return 0x0;
+  
+  // The vertex does not enter the track direction
+  if ( ilist == 0 ) vertex = 0x0;
+  if ( vertex     ) ilist += 4;
+  
+  if ( !fEtaPhiCellIndex[ilist] ) fEtaPhiCellIndex[ilist] = new AliCaloTrackEtaPhiIndex();
+  
+  if ( !fEtaPhiCellIndex[ilist]->IsIndexOf(list, vertex) )
+  {
+    fEtaPhiCellIndex[ilist]->SetCellSize(fEtaPhiCellIndexCellSize);
+    fEtaPhiCellIndex[ilist]->Fill(list, this, vertex);
+  }
+  
+  return fEtaPhiCellIndex[ilist];
+}
+
 //___________________________________
 /// Reset lists, called in AliAnaCaloTrackCorrMaker.
 //___________________________________
@@ -3185,6 +3230,11 @@ void AliCaloTrackReader::ResetLists()
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
   if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
   
+  for(Int_t i = 0; i < 8; i++)
+  {
+    if(fEtaPhiCellIndex[i]) fEtaPhiCellIndex[i] -> Clear();
+  }
+  
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
   
@@ -52,6 +52,7 @@ class AliVCluster;
 #include "AliFiducialCut.h"
 class AliCalorimeterUtils;
 #include "AliAnaWeights.h"
+class AliCaloTrackEtaPhiIndex;
 
 // Jets
 class AliAODJetEventBackground;
@@ -300,6 +301,16 @@ public:
   virtual TObjArray*     GetPHOSClusters()           const { return fPHOSClusters           ; }
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
+
+  // Eta-phi cell index of the arrays, for the isolation cone and UE band sums
+  
+  void             SwitchOnEtaPhiCellIndex()               { fUseEtaPhiCellIndex = kTRUE  ; }
+  void             SwitchOffEtaPhiCellIndex()              { fUseEtaPhiCellIndex = kFALSE ; }
+  Bool_t           IsEtaPhiCellIndexUsed()           const { return fUseEtaPhiCellIndex   ; }
+  void             SetEtaPhiCellIndexCellSize(Float_t s)   { fEtaPhiCellIndexCellSize = s ; }
+  Float_t          GetEtaPhiCellIndexCellSize()      const { return fEtaPhiCellIndexCellSize ; }
+  
+  AliCaloTrackEtaPhiIndex* GetEtaPhiCellIndex(TObjArray * list, const Double_t * vertex = 0x0) ;
   
   //-------------------------------------
   // Event/track selection methods
@@ -790,6 +801,13 @@ public:
   /// Temporal array with PHOS  CaloClusters.
   TObjArray      * fPHOSClusters ;                 //-> 
   
+  Bool_t           fUseEtaPhiCellIndex;            ///<  Build on request an eta-phi cell index of the arrays, see GetEtaPhiCellIndex().
+  Float_t          fEtaPhiCellIndexCellSize;       ///<  Size in eta and phi of the cells of the index.
+  
+  /// Eta-phi cell index of the CTS, EMCAL, DCAL and PHOS arrays, built on first request in the event.
+  /// Entries 4 to 7: cluster momentum with respect to a fixed vertex.
+  AliCaloTrackEtaPhiIndex * fEtaPhiCellIndex[8];   //!<! 
+  
   AliVCaloCells  * fEMCALCells ;                   //!<! Temporal array with EMCAL AliVCaloCells.
   AliVCaloCells  * fPHOSCells ;                    //!<! Temporal array with PHOS  AliVCaloCells.
 
@@ -974,7 +992,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,77) ;
+  ClassDef(AliCaloTrackReader,78) ;
   /// \endcond
 
 } ;
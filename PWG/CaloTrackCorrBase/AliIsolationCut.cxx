@@ -27,6 +27,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiIndex.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -54,7 +55,8 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fListEntries()
 {
   InitParameters();
 }
@@ -453,6 +455,11 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   Int_t       ntrackrefs   = 0;
   Int_t       nclusterrefs = 0;
   
+  // If the reader provides an eta-phi cell index of the list, loop only on the
+  // entries close to the candidate: in the cone, and in the eta and phi bands
+  // if needed for the UE subtraction. Same sums as with the loop on all entries.
+  Bool_t uebands = (fICMethod == kSumBkgSubIC);
+  
   // --------------------------------
   // Check charged tracks in cone.
   // --------------------------------
@@ -460,8 +467,15 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
-    for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+    AliCaloTrackEtaPhiIndex * index = reader->GetEtaPhiCellIndex(plCTS);
+    if(index) index->GetEntriesInRegion(etaC, phiC, fConeSize, fConeSize, uebands, fListEntries);
+    
+    Int_t nentries = index ? (Int_t) fListEntries.size() : plCTS->GetEntries();
+    
+    for(Int_t ient = 0; ient < nentries ; ient ++ )
     {
+      Int_t ipr = index ? fListEntries[ient] : ient;
+      
       AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
       
       if(track)
@@ -606,8 +620,15 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
     
-    for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+    AliCaloTrackEtaPhiIndex * index = reader->GetEtaPhiCellIndex(plNe);
+    if(index) index->GetEntriesInRegion(etaC, phiC, fConeSize, fConeSize, uebands, fListEntries);
+    
+    Int_t nentries = index ? (Int_t) fListEntries.size() : plNe->GetEntries();
+    
+    for(Int_t ient = 0; ient < nentries ; ient ++ )
     {
+      Int_t ipr = index ? fListEntries[ient] : ient;
+      
       AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
       
       if(calo)
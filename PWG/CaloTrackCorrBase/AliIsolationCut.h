@@ -23,6 +23,9 @@
 class TObjArray ;
 #include <TLorentzVector.h>
 
+// --- C++ ---
+#include <vector>
+
 // --- ANALYSIS system ---
 class AliAODPWG4ParticleCorrelation ;
 class AliCaloTrackReader ;
@@ -140,6 +143,8 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
 
+  std::vector<Int_t> fListEntries; //!<! Entries of the track/cluster list close to the candidate, from the reader eta-phi cell index, temporal.
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -147,7 +152,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,11) ;
+  ClassDef(AliIsolationCut,12) ;
   /// \endcond
 
 } ;
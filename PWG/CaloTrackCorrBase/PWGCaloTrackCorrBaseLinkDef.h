@@ -11,6 +11,7 @@
 #pragma link C++ class AliMCAnalysisUtils+;
 #pragma link C++ class AliIsolationCut+;
 #pragma link C++ class AliCaloTrackReader+;
+#pragma link C++ class AliCaloTrackEtaPhiIndex+;
 #pragma link C++ class AliCaloTrackESDReader+;
 #pragma link C++ class AliCaloTrackAODReader+;
 #pragma link C++ class AliCaloTrackMCReader+;
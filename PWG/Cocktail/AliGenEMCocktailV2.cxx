@@ -46,6 +46,7 @@
 #include "AliGenCocktailEntry.h"
 #include "AliGenEMCocktailV2.h"
 #include "AliGenEMlibV2.h"
+#include "AliGenEMTabulatedParam.h"
 #include "AliGenBox.h"
 #include "AliGenParam.h"
 #include "AliMC.h"
@@ -71,7 +72,9 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fUseYWeighting(kFALSE),
   fDynPtRange(kFALSE),
   fForceConv(kFALSE),
-  fSelectedParticles(kGenHadrons)
+  fSelectedParticles(kGenHadrons),
+  fSamplingAccuracy(0.),
+  fValidateSampling(kFALSE)
 {
   // Constructor
 }
@@ -200,7 +203,7 @@ void AliGenEMCocktailV2::CreateCocktail()
   // Create and add electron sources to the generator
   // pizero
   if(fSelectedParticles&kGenPizero){
-    AliGenParam *genpizero=0;
+    AliGenEMTabulatedParam *genpizero=0;
     Char_t namePizero[10];
     snprintf(namePizero,10,"Pizero");
     //fNPart/0.925: increase number of particles so that we have the chosen number of particles in the chosen eta range
@@ -213,7 +216,7 @@ void AliGenEMCocktailV2::CreateCocktail()
     // NOTE Friederike: the additional factors here cannot be fixed numbers, if you need them
     // 					generate a setting which puts them for you but never do it hardcoded - electrons are not the only ones
     //					using the cocktail
-    genpizero = new AliGenParam(fNPart, new AliGenEMlibV2(), AliGenEMlibV2::kPizero, "DUMMY");
+    genpizero = new AliGenEMTabulatedParam(fNPart, new AliGenEMlibV2(), AliGenEMlibV2::kPizero, "DUMMY");
     genpizero->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(namePizero,genpizero);
@@ -230,11 +233,11 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(221);
 
-    AliGenParam *geneta=0;
+    AliGenEMTabulatedParam *geneta=0;
     Char_t nameEta[10];
     snprintf(nameEta,10,"Eta");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    geneta = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kEta, "DUMMY");
+    geneta = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kEta, "DUMMY");
     geneta->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameEta,geneta,maxPtStretchFactor);
@@ -251,11 +254,11 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(113);
 
-    AliGenParam *genrho=0;
+    AliGenEMTabulatedParam *genrho=0;
     Char_t nameRho[10];
     snprintf(nameRho,10,"Rho");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    genrho = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kRho0, "DUMMY");
+    genrho = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kRho0, "DUMMY");
     genrho->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameRho,genrho,maxPtStretchFactor);
@@ -272,11 +275,11 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(223);
 
-    AliGenParam *genomega=0;
+    AliGenEMTabulatedParam *genomega=0;
     Char_t nameOmega[10];
     snprintf(nameOmega,10,"Omega");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    genomega = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kOmega, "DUMMY");
+    genomega = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kOmega, "DUMMY");
     genomega->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameOmega,genomega,maxPtStretchFactor);
@@ -293,11 +296,11 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(331);
 
-    AliGenParam *genetaprime=0;
+    AliGenEMTabulatedParam *genetaprime=0;
     Char_t nameEtaprime[10];
     snprintf(nameEtaprime,10,"Etaprime");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    genetaprime = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kEtaprime, "DUMMY");
+    genetaprime = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kEtaprime, "DUMMY");
     genetaprime->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameEtaprime,genetaprime,maxPtStretchFactor);
@@ -314,11 +317,11 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(333);
 
-    AliGenParam *genphi=0;
+    AliGenEMTabulatedParam *genphi=0;
     Char_t namePhi[10];
     snprintf(namePhi,10,"Phi");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    genphi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kPhi, "DUMMY");
+    genphi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kPhi, "DUMMY");
     genphi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(namePhi,genphi,maxPtStretchFactor);
@@ -335,11 +338,11 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(443);
 
-    AliGenParam *genjpsi=0;
+    AliGenEMTabulatedParam *genjpsi=0;
     Char_t nameJpsi[10];
     snprintf(nameJpsi,10,"Jpsi");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    genjpsi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kJpsi, "DUMMY");
+    genjpsi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kJpsi, "DUMMY");
     genjpsi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameJpsi,genjpsi,maxPtStretchFactor);
@@ -356,10 +359,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(3212);
 
-    AliGenParam * gensigma=0;
+    AliGenEMTabulatedParam *gensigma=0;
     Char_t nameSigma[10];
     snprintf(nameSigma,10, "Sigma0");
-    gensigma = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kSigma0, "DUMMY");
+    gensigma = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kSigma0, "DUMMY");
     gensigma->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameSigma,gensigma,maxPtStretchFactor);
@@ -376,10 +379,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(310);
 
-    AliGenParam * genkzeroshort=0;
+    AliGenEMTabulatedParam *genkzeroshort=0;
     Char_t nameK0short[10];
     snprintf(nameK0short, 10, "K0short");
-    genkzeroshort = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kK0s, "DUMMY");
+    genkzeroshort = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kK0s, "DUMMY");
     genkzeroshort->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameK0short,genkzeroshort,maxPtStretchFactor);
@@ -396,10 +399,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(130);
 
-    AliGenParam * genkzerolong=0;
+    AliGenEMTabulatedParam *genkzerolong=0;
     Char_t nameK0long[10];
     snprintf(nameK0long, 10, "K0long");
-    genkzerolong = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kK0l, "DUMMY");
+    genkzerolong = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kK0l, "DUMMY");
     genkzerolong->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameK0long,genkzerolong,maxPtStretchFactor);
@@ -416,10 +419,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(3122);
 
-    AliGenParam * genLambda=0;
+    AliGenEMTabulatedParam *genLambda=0;
     Char_t nameLambda[10];
     snprintf(nameLambda, 10, "Lambda");
-    genLambda = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kLambda, "DUMMY");
+    genLambda = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kLambda, "DUMMY");
     genLambda->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameLambda,genLambda,maxPtStretchFactor);
@@ -436,10 +439,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(2224);
 
-    AliGenParam * genkdeltaPlPl=0;
+    AliGenEMTabulatedParam *genkdeltaPlPl=0;
     Char_t nameDeltaPlPl[10];
     snprintf(nameDeltaPlPl, 10, "DeltaPlPl");
-    genkdeltaPlPl = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaPlPl, "DUMMY");
+    genkdeltaPlPl = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaPlPl, "DUMMY");
     genkdeltaPlPl->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameDeltaPlPl,genkdeltaPlPl,maxPtStretchFactor);
@@ -456,10 +459,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(2214);
 
-    AliGenParam * genkdeltaPl=0;
+    AliGenEMTabulatedParam *genkdeltaPl=0;
     Char_t nameDeltaPl[10];
     snprintf(nameDeltaPl, 10, "DeltaPl");
-    genkdeltaPl = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaPl, "DUMMY");
+    genkdeltaPl = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaPl, "DUMMY");
     genkdeltaPl->SetYRange(fYMin, fYMax);
     AddSource2Generator(nameDeltaPl,genkdeltaPl,maxPtStretchFactor);
     TF1 *fPtDeltaPl = genkdeltaPl->GetPt();
@@ -475,10 +478,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(1114);
 
-    AliGenParam * genkdeltaMi=0;
+    AliGenEMTabulatedParam *genkdeltaMi=0;
     Char_t nameDeltaMi[10];
     snprintf(nameDeltaMi, 10, "DeltaMi");
-    genkdeltaMi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaMi, "DUMMY");
+    genkdeltaMi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaMi, "DUMMY");
     genkdeltaMi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameDeltaMi,genkdeltaMi,maxPtStretchFactor);
@@ -495,10 +498,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(2114);
 
-    AliGenParam * genkdeltaZero=0;
+    AliGenEMTabulatedParam *genkdeltaZero=0;
     Char_t nameDeltaZero[10];
     snprintf(nameDeltaZero, 10, "DeltaZero");
-    genkdeltaZero = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaZero, "DUMMY");
+    genkdeltaZero = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kDeltaZero, "DUMMY");
     genkdeltaZero->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameDeltaZero,genkdeltaZero,maxPtStretchFactor);
@@ -515,10 +518,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(213);
 
-    AliGenParam * genkrhoPl=0;
+    AliGenEMTabulatedParam *genkrhoPl=0;
     Char_t nameRhoPl[10];
     snprintf(nameRhoPl, 10, "RhoPl");
-    genkrhoPl = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kRhoPl, "DUMMY");
+    genkrhoPl = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kRhoPl, "DUMMY");
     genkrhoPl->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameRhoPl,genkrhoPl,maxPtStretchFactor);
@@ -535,10 +538,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(213);
 
-    AliGenParam * genkrhoMi=0;
+    AliGenEMTabulatedParam *genkrhoMi=0;
     Char_t nameRhoMi[10];
     snprintf(nameRhoMi, 10, "RhoMi");
-    genkrhoMi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kRhoMi, "DUMMY");
+    genkrhoMi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kRhoMi, "DUMMY");
     genkrhoMi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameRhoMi,genkrhoMi,maxPtStretchFactor);
@@ -555,10 +558,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(313);
 
-    AliGenParam * genkK0star=0;
+    AliGenEMTabulatedParam *genkK0star=0;
     Char_t nameK0star[10];
     snprintf(nameK0star, 10, "K0star");
-    genkK0star = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kK0star, "DUMMY");
+    genkK0star = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kK0star, "DUMMY");
     genkK0star->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameK0star,genkK0star,maxPtStretchFactor);
@@ -575,10 +578,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(321);
 
-    AliGenParam * genkKPl=0;
+    AliGenEMTabulatedParam *genkKPl=0;
     Char_t nameKPl[10];
     snprintf(nameKPl, 10, "KPl");
-    genkKPl = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kKPl, "DUMMY");
+    genkKPl = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kKPl, "DUMMY");
     genkKPl->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameKPl,genkKPl,maxPtStretchFactor);
@@ -595,10 +598,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(321);
 
-    AliGenParam * genkKMi=0;
+    AliGenEMTabulatedParam *genkKMi=0;
     Char_t nameKMi[10];
     snprintf(nameKMi, 10, "KMi");
-    genkKMi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kKMi, "DUMMY");
+    genkKMi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kKMi, "DUMMY");
     genkKMi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameKMi,genkKMi,maxPtStretchFactor);
@@ -615,10 +618,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(-3334);
 
-    AliGenParam * genkOmegaPl=0;
+    AliGenEMTabulatedParam *genkOmegaPl=0;
     Char_t nameOmegaPl[10];
     snprintf(nameOmegaPl, 10, "OmegaPl");
-    genkOmegaPl = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kOmegaPl, "DUMMY");
+    genkOmegaPl = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kOmegaPl, "DUMMY");
     genkOmegaPl->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameOmegaPl,genkOmegaPl,maxPtStretchFactor);
@@ -635,10 +638,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(3334);
 
-    AliGenParam * genkOmegaMi=0;
+    AliGenEMTabulatedParam *genkOmegaMi=0;
     Char_t nameOmegaMi[10];
     snprintf(nameOmegaMi, 10, "OmegaMi");
-    genkOmegaMi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kOmegaMi, "DUMMY");
+    genkOmegaMi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kOmegaMi, "DUMMY");
     genkOmegaMi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameOmegaMi,genkOmegaMi,maxPtStretchFactor);
@@ -655,10 +658,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(-3312);
 
-    AliGenParam * genkXiPl=0;
+    AliGenEMTabulatedParam *genkXiPl=0;
     Char_t nameXiPl[10];
     snprintf(nameXiPl, 10, "XiPl");
-    genkXiPl = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kXiPl, "DUMMY");
+    genkXiPl = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kXiPl, "DUMMY");
     genkXiPl->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameXiPl,genkXiPl,maxPtStretchFactor);
@@ -675,10 +678,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(3312);
 
-    AliGenParam * genkXiMi=0;
+    AliGenEMTabulatedParam *genkXiMi=0;
     Char_t nameXiMi[10];
     snprintf(nameXiMi, 10, "XiMi");
-    genkXiMi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kXiMi, "DUMMY");
+    genkXiMi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kXiMi, "DUMMY");
     genkXiMi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameXiMi,genkXiMi,maxPtStretchFactor);
@@ -695,10 +698,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(3224);
 
-    AliGenParam * genkSigmaPl=0;
+    AliGenEMTabulatedParam *genkSigmaPl=0;
     Char_t nameSigmaPl[10];
     snprintf(nameSigmaPl, 10, "SigmaPl");
-    genkSigmaPl = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kSigmaPl, "DUMMY");
+    genkSigmaPl = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kSigmaPl, "DUMMY");
     genkSigmaPl->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameSigmaPl,genkSigmaPl,maxPtStretchFactor);
@@ -715,10 +718,10 @@ void AliGenEMCocktailV2::CreateCocktail()
     Double_t maxPtStretchFactor = 1.;
     if (fDynPtRange) maxPtStretchFactor = GetMaxPtStretchFactor(3114);
 
-    AliGenParam * genkSigmaMi=0;
+    AliGenEMTabulatedParam *genkSigmaMi=0;
     Char_t nameSigmaMi[10];
     snprintf(nameSigmaMi, 10, "SigmaMi");
-    genkSigmaMi = new AliGenParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kSigmaMi, "DUMMY");
+    genkSigmaMi = new AliGenEMTabulatedParam((Int_t)(maxPtStretchFactor*fNPart), new AliGenEMlibV2(), AliGenEMlibV2::kSigmaMi, "DUMMY");
     genkSigmaMi->SetYRange(fYMin, fYMax);
 
     AddSource2Generator(nameSigmaMi,genkSigmaMi,maxPtStretchFactor);
@@ -741,11 +744,11 @@ void AliGenEMCocktailV2::CreateCocktail()
   
   if(fSelectedParticles&kGenDirectRealGamma){
     TDatabasePDG::Instance()->AddParticle("DirectRealGamma","DirectRealGamma",0,true,0,0,gammaPDG->ParticleClass(),220000);
-    AliGenParam *genDirectRealG=0;
+    AliGenEMTabulatedParam *genDirectRealG=0;
     Char_t nameDirectRealG[10];
     snprintf(nameDirectRealG,10,"DirectRealGamma");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    genDirectRealG = new AliGenParam(fNPart, new AliGenEMlibV2(), AliGenEMlibV2::kDirectRealGamma, "DUMMY");
+    genDirectRealG = new AliGenEMTabulatedParam(fNPart, new AliGenEMlibV2(), AliGenEMlibV2::kDirectRealGamma, "DUMMY");
     genDirectRealG->SetYRange(fYMin, fYMax);
     AddSource2Generator(nameDirectRealG,genDirectRealG);
     TF1 *fPtDirectRealG = genDirectRealG->GetPt();
@@ -758,11 +761,11 @@ void AliGenEMCocktailV2::CreateCocktail()
   
   if(fSelectedParticles&kGenDirectVirtGamma){
     TDatabasePDG::Instance()->AddParticle("DirectVirtGamma","DirectVirtGamma",0,true,0,0,gammaPDG->ParticleClass(),220001);
-    AliGenParam *genDirectVirtG=0;
+    AliGenEMTabulatedParam *genDirectVirtG=0;
     Char_t nameDirectVirtG[10];
     snprintf(nameDirectVirtG,10,"DirectVirtGamma");
     // NOTE: the additional factors are set back to one as they are not the same for photons and electrons
-    genDirectVirtG = new AliGenParam(fNPart, new AliGenEMlibV2(), AliGenEMlibV2::kDirectVirtGamma, "DUMMY");
+    genDirectVirtG = new AliGenEMTabulatedParam(fNPart, new AliGenEMlibV2(), AliGenEMlibV2::kDirectVirtGamma, "DUMMY");
     genDirectVirtG->SetYRange(fYMin, fYMax);
     AddSource2Generator(nameDirectVirtG,genDirectVirtG);
     TF1 *fPtDirectVirtG = genDirectVirtG->GetPt();
@@ -776,7 +779,7 @@ void AliGenEMCocktailV2::CreateCocktail()
 
 //-------------------------------------------------------------------
 void AliGenEMCocktailV2::AddSource2Generator(Char_t* nameSource,
-                                             AliGenParam* const genSource,
+                                             AliGenEMTabulatedParam* const genSource,
                                              Double_t maxPtStretchFactor)
 {
   // add sources to the cocktail
@@ -788,6 +791,7 @@ void AliGenEMCocktailV2::AddSource2Generator(Char_t* nameSource,
   genSource->SetWeighting(fWeightingMode);
   genSource->SetForceGammaConversion(fForceConv);
   if (!TVirtualMC::GetMC()) genSource->SetDecayer(fDecayer);
+  genSource->SetTabulatedPtSampling(fSamplingAccuracy, fValidateSampling);
   genSource->Init();
 
   AddGenerator(genSource,nameSource,1.); // Adding Generator
@@ -27,6 +27,7 @@
 #include "TH2F.h"
 
 class AliGenCocktailEntry;
+class AliGenEMTabulatedParam;
 
 class AliGenEMCocktailV2 : public AliGenCocktail
 {
@@ -66,6 +67,7 @@ public:
   void    SetCentrality(AliGenEMlibV2::Centrality_t cent)             { fCentrality = cent;               }
   void    SetV2Systematic(AliGenEMlibV2::v2Sys_t v2sys)               { fV2Systematic = v2sys;            }
   void    SetForceGammaConversion(Bool_t force=kTRUE)                 { fForceConv=force;                 }
+  void    SetTabulatedSampling(Double_t accuracy=1.e-5, Bool_t validate=kFALSE) { fSamplingAccuracy = accuracy; fValidateSampling = validate; }
   void    SetHeaviestHadron(ParticleGenerator_t part);
   static  Bool_t  SetPtParametrizations();
   static  void    SetMtScalingFactors();
@@ -82,6 +84,7 @@ public:
   TString   GetParametrizationFile()          const                   { return fParametrizationFile;      }
   TString   GetParametrizationFileDirectory() const                   { return fParametrizationDir;       }
   Int_t     GetNumberOfParticles()            const                   { return fNPart;                    }
+  Double_t  GetSamplingAccuracy()             const                   { return fSamplingAccuracy;         }
   Double_t  GetMaxPtStretchFactor(Int_t pdgCode);
   Double_t  GetYWeight(Int_t pdgCode, TParticle* part);
   void      GetPtRange(Double_t &ptMin, Double_t &ptMax);
@@ -112,7 +115,7 @@ private:
   AliGenEMCocktailV2(const AliGenEMCocktailV2 &cocktail);
   AliGenEMCocktailV2 & operator=(const AliGenEMCocktailV2 &cocktail);
   
-  void AddSource2Generator(Char_t *nameReso, AliGenParam* const genReso, Double_t maxPtStretchFactor = 1.);
+  void AddSource2Generator(Char_t *nameReso, AliGenEMTabulatedParam* const genReso, Double_t maxPtStretchFactor = 1.);
 
   AliDecayer*     fDecayer;                             // External decayer
   Decay_t         fDecayMode;                           // decay mode in which resonances are forced to decay, default: kAll
@@ -135,8 +138,10 @@ private:
   Bool_t        fDynPtRange;                            // select if the pt range for the generation should be adapted to different mother particle weights dynamically
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
+  Double_t      fSamplingAccuracy;                      // accuracy of the tabulated pt sampling (kAnalog), switched off if <= 0
+  Bool_t        fValidateSampling;                      // compare tabulated sampling and TF1::GetRandom for each source
   
-  ClassDef(AliGenEMCocktailV2,8)                        // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,9)                        // cocktail for EM physics
 };
 
 #endif
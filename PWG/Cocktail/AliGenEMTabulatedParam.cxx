@@ -0,0 +1,80 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// AliGenParam with the pt of the analog generation drawn from the         //
+// adaptive table of AliGenEMTabulatedSampler (see AliGenEMTabulatedTF1).  //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+// AliGenParam draws the pt of each particle with fPtPara->GetRandom() in
+// the analog weighting mode (flat pt otherwise). After AliGenParam::Init
+// the pt parametrization is replaced by an AliGenEMTabulatedTF1 copy, all
+// the rest of the generation is unchanged.
+// The rapidity and the azimuth are not tabulated: the y parametrizations
+// of AliGenEMlibV2 are flat, for which the equidistant table of
+// TF1::GetRandom is already exact, and the dN/dphi of AliGenParam gets the
+// v2 of the pt of each particle, so a table would be rebuilt per particle.
+
+#include "AliGenEMTabulatedSampler.h"
+#include "AliGenEMTabulatedTF1.h"
+#include "AliGenEMTabulatedParam.h"
+#include "AliLog.h"
+
+ClassImp(AliGenEMTabulatedParam)
+
+//________________________________________________________________________
+AliGenEMTabulatedParam::AliGenEMTabulatedParam():AliGenParam(),
+  fPtSamplingAccuracy(0.),
+  fValidatePtSampling(kFALSE)
+{
+  // Default constructor
+}
+
+//________________________________________________________________________
+AliGenEMTabulatedParam::AliGenEMTabulatedParam(Int_t npart, const AliGenLib *library, Int_t param, const char *tname):
+  AliGenParam(npart, library, param, tname),
+  fPtSamplingAccuracy(0.),
+  fValidatePtSampling(kFALSE)
+{
+  // Constructor, same as AliGenParam
+}
+
+//________________________________________________________________________
+void AliGenEMTabulatedParam::Init()
+{
+  // Initialisation of AliGenParam, then tabulated pt sampling if requested
+  AliGenParam::Init();
+  if (fPtSamplingAccuracy <= 0. || !fPtPara) return;
+
+  AliGenEMTabulatedTF1 *ptPara = new AliGenEMTabulatedTF1(*fPtPara, fPtSamplingAccuracy);
+  if (!ptPara->IsTabulated()) {
+    AliWarning(Form("No table for %s, TF1::GetRandom is used", fPtPara->GetName()));
+    delete ptPara;
+    return;
+  }
+  AliInfo(Form("%s sampled on %d adaptive bins (accuracy %g)", ptPara->GetName(), ptPara->GetSampler().GetNumberOfBins(), fPtSamplingAccuracy));
+
+  if (fValidatePtSampling) {
+    // compare with TF1::GetRandom of the original parametrization
+    AliGenEMTabulatedSampler sampler;
+    sampler.SetAccuracy(fPtSamplingAccuracy);
+    sampler.Validate(fPtPara);
+  }
+
+  delete fPtPara;
+  fPtPara = ptPara;
+}
@@ -0,0 +1,43 @@
+#ifndef AliGenEMTabulatedParam_H
+#define AliGenEMTabulatedParam_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// AliGenParam with the pt of the analog generation drawn from the         //
+// adaptive table of AliGenEMTabulatedSampler (see AliGenEMTabulatedTF1).  //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+#include "AliGenParam.h"
+
+class AliGenLib;
+
+class AliGenEMTabulatedParam : public AliGenParam
+{
+public:
+
+  AliGenEMTabulatedParam();
+  AliGenEMTabulatedParam(Int_t npart, const AliGenLib *library, Int_t param, const char *tname = 0);
+  virtual ~AliGenEMTabulatedParam() {}
+
+  virtual void Init();
+
+  // setters
+  void      SetTabulatedPtSampling(Double_t accuracy, Bool_t validate=kFALSE) { fPtSamplingAccuracy = accuracy; fValidatePtSampling = validate; }
+
+  // getters
+  Double_t  GetPtSamplingAccuracy()           const                   { return fPtSamplingAccuracy;       }
+
+private:
+  AliGenEMTabulatedParam(const AliGenEMTabulatedParam &param);
+  AliGenEMTabulatedParam & operator=(const AliGenEMTabulatedParam &param);
+
+  Double_t      fPtSamplingAccuracy;                    // accuracy of the tabulated pt sampling, switched off if <= 0
+  Bool_t        fValidatePtSampling;                    // compare tabulated sampling and TF1::GetRandom in Init
+
+  ClassDef(AliGenEMTabulatedParam,1)                    // AliGenParam with tabulated pt sampling
+};
+
+#endif
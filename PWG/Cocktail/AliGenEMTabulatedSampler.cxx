@@ -0,0 +1,302 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// Tabulated inverse-CDF sampling of one-dimensional TF1 distributions     //
+// (pt, y, phi parametrizations of the EM cocktail).                       //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+// TF1::GetRandom tabulates the integral on fNpx (default 100) equidistant
+// bins, and recomputes the table whenever the parameters change. Here the
+// table is built with adaptive bins: starting from 64 equidistant bins, a
+// bin is split in two as long as its trapezoidal and Simpson integrals
+// differ by more than fAccuracy times the total integral. The function is
+// assumed to be linear inside the final bins, which gives the inversion of
+// the cumulative distribution in closed form.
+
+#include <algorithm>
+#include <TF1.h>
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "AliLog.h"
+#include "AliGenEMTabulatedSampler.h"
+
+ClassImp(AliGenEMTabulatedSampler)
+
+//________________________________________________________________________
+AliGenEMTabulatedSampler::AliGenEMTabulatedSampler():TObject(),
+  fAccuracy(1.e-5),
+  fMaxNBins(1000000),
+  fFunction(0x0),
+  fXmin(0.),
+  fXmax(0.),
+  fParameters(),
+  fX(),
+  fY(),
+  fCumulative()
+{
+  // Constructor
+}
+
+//________________________________________________________________________
+Bool_t AliGenEMTabulatedSampler::Build(const TF1 *func)
+{
+  // Build the table on the range of the function
+  if (!func) return kFALSE;
+  return Build(func, func->GetXmin(), func->GetXmax());
+}
+
+//________________________________________________________________________
+Bool_t AliGenEMTabulatedSampler::Build(const TF1 *func, Double_t xmin, Double_t xmax)
+{
+  // Build the table of the cumulative distribution of func in [xmin,xmax]
+  fFunction = 0x0;
+  fParameters.clear();
+  fX.clear();
+  fY.clear();
+  fCumulative.clear();
+  if (!func || !(xmax > xmin)) return kFALSE;
+
+  // function value, negative and non-finite values are not sampled
+  struct Value {
+    static Double_t Eval(const TF1 *f, Double_t x) {
+      Double_t y = f->Eval(x);
+      return (TMath::Finite(y) && y > 0.) ? y : 0.;
+    }
+  };
+
+  // starting bins, also used for the scale of the accuracy
+  const Int_t nStart = 64;
+  std::vector<Double_t> xStart(nStart+1), yStart(nStart+1);
+  Double_t total = 0.;
+  for (Int_t i=0; i<=nStart; i++) {
+    xStart[i] = (i == nStart) ? xmax : xmin + (xmax-xmin)*i/nStart;
+    yStart[i] = Value::Eval(func, xStart[i]);
+    if (i > 0) total += (xStart[i]-xStart[i-1])*(yStart[i]+4.*Value::Eval(func, 0.5*(xStart[i]+xStart[i-1]))+yStart[i-1])/6.;
+  }
+  if (!(total > 0.)) {
+    AliError(Form("Function %s has no positive integral in [%g,%g]", func->GetName(), xmin, xmax));
+    return kFALSE;
+  }
+  Double_t tolerance = fAccuracy*total;
+  Double_t minWidth  = (xmax-xmin)*1.e-12;
+
+  // bins to be processed, the last one is the next in x
+  struct Bin { Double_t a, fa, b, fb; };
+  std::vector<Bin> stack;
+  for (Int_t i=nStart; i>0; i--) {
+    Bin bin = {xStart[i-1], yStart[i-1], xStart[i], yStart[i]};
+    stack.push_back(bin);
+  }
+
+  fX.push_back(xmin);
+  fY.push_back(yStart[0]);
+  fCumulative.push_back(0.);
+  while (!stack.empty()) {
+    Bin bin = stack.back();
+    stack.pop_back();
+    Double_t width = bin.b - bin.a;
+    Double_t m = 0.5*(bin.a + bin.b);
+    Double_t fm = Value::Eval(func, m);
+    Double_t trapezoid = 0.5*width*(bin.fa + bin.fb);
+    Double_t simpson = width*(bin.fa + 4.*fm + bin.fb)/6.;
+    Bool_t split = TMath::Abs(simpson - trapezoid) > tolerance && width > minWidth
+                   && (Int_t)(fX.size() + stack.size()) < fMaxNBins;
+    if (split) {
+      Bin right = {m, fm, bin.b, bin.fb};
+      Bin left  = {bin.a, bin.fa, m, fm};
+      stack.push_back(right);
+      stack.push_back(left);
+    } else {
+      fX.push_back(bin.b);
+      fY.push_back(bin.fb);
+      fCumulative.push_back(fCumulative.back() + trapezoid);
+    }
+  }
+  if (!(fCumulative.back() > 0.)) {
+    fX.clear();
+    fY.clear();
+    fCumulative.clear();
+    return kFALSE;
+  }
+
+  fFunction = func;
+  fXmin = xmin;
+  fXmax = xmax;
+  fParameters.assign(func->GetParameters(), func->GetParameters() + func->GetNpar());
+  AliDebug(1, Form("Table for %s in [%g,%g]: %d bins", func->GetName(), xmin, xmax, GetNumberOfBins()));
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Bool_t AliGenEMTabulatedSampler::IsBuiltFor(const TF1 *func, Double_t xmin, Double_t xmax) const
+{
+  // Check if the table is the one of func, in [xmin,xmax], with its current parameters
+  if (!func || func != fFunction || fCumulative.empty()) return kFALSE;
+  if (xmin != fXmin || xmax != fXmax) return kFALSE;
+  if (func->GetNpar() != (Int_t)fParameters.size()) return kFALSE;
+  for (Int_t i=0; i<func->GetNpar(); i++) {
+    if (func->GetParameter(i) != fParameters[i]) return kFALSE;
+  }
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Double_t AliGenEMTabulatedSampler::GetRandom(const TF1 *func)
+{
+  // Random number distributed according to func in its range
+  if (!func) return 0.;
+  return GetRandom(func, func->GetXmin(), func->GetXmax());
+}
+
+//________________________________________________________________________
+Double_t AliGenEMTabulatedSampler::GetRandom(const TF1 *func, Double_t xmin, Double_t xmax)
+{
+  // Random number distributed according to func in [xmin,xmax]
+  if (!IsBuiltFor(func, xmin, xmax) && !Build(func, xmin, xmax)) return xmin;
+  return GetRandomFromTable(gRandom->Rndm());
+}
+
+//________________________________________________________________________
+Double_t AliGenEMTabulatedSampler::GetRandomFromTable(Double_t u) const
+{
+  // Value x of the tabulated distribution with cumulative probability u
+  Int_t nBins = GetNumberOfBins();
+  if (nBins < 1) return fXmin;
+
+  Double_t target = u*fCumulative.back();
+  Int_t i = std::upper_bound(fCumulative.begin(), fCumulative.end(), target) - fCumulative.begin() - 1;
+  if (i < 0) i = 0;
+  if (i >= nBins) i = nBins-1;
+
+  // solve fa*t + slope*t^2/2 = r for t in [0,width]
+  Double_t r = target - fCumulative[i];
+  Double_t width = fX[i+1] - fX[i];
+  Double_t fa = fY[i];
+  Double_t slope = (fY[i+1] - fa)/width;
+  Double_t disc = fa*fa + 2.*slope*r;
+  Double_t denom = fa + TMath::Sqrt(disc > 0. ? disc : 0.);
+  Double_t t = (denom > 0.) ? 2.*r/denom : 0.;
+  if (t < 0.) t = 0.;
+  if (t > width) t = width;
+  return fX[i] + t;
+}
+
+//________________________________________________________________________
+Int_t AliGenEMTabulatedSampler::GetEquivalentNpx() const
+{
+  // Number of equidistant bins with the width of the smallest bin of the table
+  Int_t nBins = GetNumberOfBins();
+  if (nBins < 1) return 0;
+  Double_t minWidth = fXmax - fXmin;
+  for (Int_t i=0; i<nBins; i++) minWidth = TMath::Min(minWidth, fX[i+1] - fX[i]);
+  Double_t npx = TMath::Ceil((fXmax - fXmin)/minWidth);
+  return (npx < 1.e7) ? (Int_t)npx : 10000000;
+}
+
+//________________________________________________________________________
+static void SampleMoments(const Double_t sum[4], Double_t moments[3])
+{
+  // Mean, rms and skewness from the sums of 1, x, x^2, x^3
+  Double_t m1 = sum[1]/sum[0], m2 = sum[2]/sum[0], m3 = sum[3]/sum[0];
+  Double_t var = TMath::Max(m2 - m1*m1, 0.);
+  moments[0] = m1;
+  moments[1] = TMath::Sqrt(var);
+  moments[2] = (var > 0.) ? (m3 - 3.*m1*m2 + 2.*m1*m1*m1)/TMath::Power(var, 1.5) : 0.;
+}
+
+//________________________________________________________________________
+Bool_t AliGenEMTabulatedSampler::Validate(TF1 *func, Int_t nSamples, Double_t nSigma)
+{
+  // Compare mean, rms and skewness of nSamples random numbers from the
+  // table and from TF1::GetRandom, in the range of the function.
+  // The uncertainties of the moments are estimated from their spread
+  // between batches of the samples, which does not assume normal tails.
+  // The random numbers are drawn from a private generator with fixed seed,
+  // gRandom is left untouched.
+  // Returns kTRUE if all the differences are below nSigma standard deviations.
+  const Int_t kMaxBatches = 100;
+  if (!func) return kFALSE;
+  Int_t nBatches = TMath::Min(kMaxBatches, nSamples/10);
+  if (nBatches < 2) return kFALSE;
+  Double_t xmin = func->GetXmin();
+  Double_t xmax = func->GetXmax();
+  if (!IsBuiltFor(func, xmin, xmax) && !Build(func, xmin, xmax)) return kFALSE;
+
+  // TF1::GetRandom draws from gRandom
+  TRandom3 random(4357);
+  TRandom *savedRandom = gRandom;
+  gRandom = &random;
+
+  // sums of the full samples and moments of the batches, shifted by xmin
+  Double_t total[2][4] = {{0.}};
+  Double_t batch[2][3] = {{0.}}, batch2[2][3] = {{0.}};
+  for (Int_t b=0; b<nBatches; b++) {
+    Int_t n = nSamples/nBatches + ((b < nSamples%nBatches) ? 1 : 0);
+    Double_t sum[2][4] = {{0.}};
+    for (Int_t i=0; i<n; i++) {
+      Double_t x[2] = {GetRandomFromTable(random.Rndm()) - xmin, func->GetRandom(xmin, xmax) - xmin};
+      for (Int_t j=0; j<2; j++) {
+        sum[j][0] += 1.;
+        sum[j][1] += x[j];
+        sum[j][2] += x[j]*x[j];
+        sum[j][3] += x[j]*x[j]*x[j];
+      }
+    }
+    for (Int_t j=0; j<2; j++) {
+      Double_t moments[3];
+      SampleMoments(sum[j], moments);
+      for (Int_t k=0; k<3; k++) {
+        batch[j][k] += moments[k];
+        batch2[j][k] += moments[k]*moments[k];
+      }
+      for (Int_t k=0; k<4; k++) total[j][k] += sum[j][k];
+    }
+  }
+  gRandom = savedRandom;
+
+  // moments of the full samples, with the batch means uncertainties
+  Double_t moments[2][3], err[2][3];
+  for (Int_t j=0; j<2; j++) {
+    SampleMoments(total[j], moments[j]);
+    for (Int_t k=0; k<3; k++) {
+      Double_t mean = batch[j][k]/nBatches;
+      Double_t var = TMath::Max(batch2[j][k]/nBatches - mean*mean, 0.)*nBatches/(nBatches - 1.);
+      err[j][k] = TMath::Sqrt(var/nBatches);
+    }
+  }
+  moments[0][0] += xmin;
+  moments[1][0] += xmin;
+
+  Double_t pull[3];
+  for (Int_t k=0; k<3; k++) {
+    Double_t errDiff = TMath::Sqrt(err[0][k]*err[0][k] + err[1][k]*err[1][k]);
+    pull[k] = (errDiff > 0.) ? (moments[0][k] - moments[1][k])/errDiff : 0.;
+  }
+
+  const Char_t *names[3] = {"mean    ", "rms     ", "skewness"};
+  AliInfo(Form("%s in [%g,%g]: %d bins (equidistant: %d), TF1 Npx %d, %d samples in %d batches",
+               func->GetName(), xmin, xmax, GetNumberOfBins(), GetEquivalentNpx(), func->GetNpx(), nSamples, nBatches));
+  for (Int_t k=0; k<3; k++)
+    AliInfo(Form("  %s table %g +- %g GetRandom %g +- %g (%.1f sigma)", names[k],
+                 moments[0][k], err[0][k], moments[1][k], err[1][k], pull[k]));
+
+  Bool_t ok = TMath::Abs(pull[0]) < nSigma && TMath::Abs(pull[1]) < nSigma && TMath::Abs(pull[2]) < nSigma;
+  if (!ok) AliWarning(Form("Tabulated sampling of %s differs from TF1::GetRandom", func->GetName()));
+  return ok;
+}
@@ -0,0 +1,76 @@
+#ifndef AliGenEMTabulatedSampler_H
+#define AliGenEMTabulatedSampler_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// Tabulated inverse-CDF sampling of one-dimensional TF1 distributions     //
+// (pt, y, phi parametrizations of the EM cocktail).                       //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+// The cumulative distribution is tabulated once per function, range and
+// parameter set, with bins split until the integral of each bin is known
+// to the requested accuracy (relative to the total integral). Random
+// numbers are then obtained by a binary search in the table and the
+// inversion of the linear interpolation of the function inside the bin.
+// Validate() compares the moments of the tabulated sampling with the ones
+// of TF1::GetRandom, with uncertainties from batch means and a private
+// random generator.
+
+#include <vector>
+#include "TObject.h"
+
+class TF1;
+
+class AliGenEMTabulatedSampler : public TObject
+{
+public:
+
+  AliGenEMTabulatedSampler();
+  virtual ~AliGenEMTabulatedSampler() {}
+
+  // table
+  Bool_t    Build(const TF1 *func);
+  Bool_t    Build(const TF1 *func, Double_t xmin, Double_t xmax);
+  Bool_t    IsBuiltFor(const TF1 *func, Double_t xmin, Double_t xmax) const;
+
+  // sampling, the table is rebuilt if the function, its range or its parameters changed
+  Double_t  GetRandom(const TF1 *func);
+  Double_t  GetRandom(const TF1 *func, Double_t xmin, Double_t xmax);
+  Double_t  GetRandomFromTable(Double_t u) const;
+
+  // comparison of the moments with TF1::GetRandom, kTRUE if compatible within nSigma
+  Bool_t    Validate(TF1 *func, Int_t nSamples = 1000000, Double_t nSigma = 5.);
+
+  // setters
+  void      SetAccuracy(Double_t accuracy)                            { fAccuracy = accuracy;             }
+  void      SetMaxNumberOfBins(Int_t nbins)                           { fMaxNBins = nbins;                }
+
+  // getters
+  Double_t  GetAccuracy()                     const                   { return fAccuracy;                 }
+  Int_t     GetMaxNumberOfBins()              const                   { return fMaxNBins;                 }
+  Int_t     GetNumberOfBins()                 const                   { return fX.empty() ? 0 : fX.size()-1; }
+  Double_t  GetIntegral()                     const                   { return fCumulative.empty() ? 0. : fCumulative.back(); }
+  Int_t     GetEquivalentNpx()                const;
+
+private:
+  AliGenEMTabulatedSampler(const AliGenEMTabulatedSampler &sampler);
+  AliGenEMTabulatedSampler & operator=(const AliGenEMTabulatedSampler &sampler);
+
+  Double_t              fAccuracy;                      // target accuracy of the integral of each bin, relative to the total integral
+  Int_t                 fMaxNBins;                      // maximum number of bins of the table
+
+  const TF1*            fFunction;                      //! function of the table
+  Double_t              fXmin;                          //! lower edge of the table
+  Double_t              fXmax;                          //! upper edge of the table
+  std::vector<Double_t> fParameters;                    //! parameters of the function when the table was built
+  std::vector<Double_t> fX;                             //! bin edges
+  std::vector<Double_t> fY;                             //! function values at the bin edges (negative values set to 0)
+  std::vector<Double_t> fCumulative;                    //! integral up to each bin edge
+
+  ClassDef(AliGenEMTabulatedSampler,1)                  // tabulated inverse-CDF sampling of TF1
+};
+
+#endif
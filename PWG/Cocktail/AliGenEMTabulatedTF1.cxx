@@ -0,0 +1,87 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// Copy of a TF1 whose random numbers are drawn from the adaptive table    //
+// of AliGenEMTabulatedSampler instead of the fNpx equidistant bins of     //
+// TF1::GetRandom.                                                         //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+// Evaluation, integration and all other TF1 methods are the ones of the
+// copied function. If no table can be built (no positive integral in the
+// requested range) the random numbers are the ones of TF1::GetRandom.
+
+#include <TRandom.h>
+
+#include "AliGenEMTabulatedTF1.h"
+
+ClassImp(AliGenEMTabulatedTF1)
+
+//________________________________________________________________________
+AliGenEMTabulatedTF1::AliGenEMTabulatedTF1():TF1(),
+  fSampler()
+{
+  // Default constructor
+}
+
+//________________________________________________________________________
+AliGenEMTabulatedTF1::AliGenEMTabulatedTF1(const TF1 &func, Double_t accuracy):TF1(func),
+  fSampler()
+{
+  // Copy func and tabulate it in its range
+  fSampler.SetAccuracy(accuracy);
+  UpdateTable(GetXmin(), GetXmax());
+}
+
+//________________________________________________________________________
+Bool_t AliGenEMTabulatedTF1::UpdateTable(Double_t xmin, Double_t xmax)
+{
+  // Rebuild the table if the range or the parameters changed
+  return fSampler.IsBuiltFor(this, xmin, xmax) || fSampler.Build(this, xmin, xmax);
+}
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,24,0)
+//________________________________________________________________________
+Double_t AliGenEMTabulatedTF1::GetRandom(TRandom *rng, Option_t *opt)
+{
+  // Random number distributed according to the function in its range
+  return GetRandom(GetXmin(), GetXmax(), rng, opt);
+}
+
+//________________________________________________________________________
+Double_t AliGenEMTabulatedTF1::GetRandom(Double_t xmin, Double_t xmax, TRandom *rng, Option_t *opt)
+{
+  // Random number distributed according to the function in [xmin,xmax]
+  if (!UpdateTable(xmin, xmax)) return TF1::GetRandom(xmin, xmax, rng, opt);
+  return fSampler.GetRandomFromTable(rng ? rng->Rndm() : gRandom->Rndm());
+}
+#else
+//________________________________________________________________________
+Double_t AliGenEMTabulatedTF1::GetRandom()
+{
+  // Random number distributed according to the function in its range
+  return GetRandom(GetXmin(), GetXmax());
+}
+
+//________________________________________________________________________
+Double_t AliGenEMTabulatedTF1::GetRandom(Double_t xmin, Double_t xmax)
+{
+  // Random number distributed according to the function in [xmin,xmax]
+  if (!UpdateTable(xmin, xmax)) return TF1::GetRandom(xmin, xmax);
+  return fSampler.GetRandomFromTable(gRandom->Rndm());
+}
+#endif
@@ -0,0 +1,49 @@
+#ifndef AliGenEMTabulatedTF1_H
+#define AliGenEMTabulatedTF1_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// Copy of a TF1 whose random numbers are drawn from the adaptive table    //
+// of AliGenEMTabulatedSampler instead of the fNpx equidistant bins of     //
+// TF1::GetRandom.                                                         //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+#include <RVersion.h>
+#include "TF1.h"
+#include "AliGenEMTabulatedSampler.h"
+
+class AliGenEMTabulatedTF1 : public TF1
+{
+public:
+
+  AliGenEMTabulatedTF1();
+  AliGenEMTabulatedTF1(const TF1 &func, Double_t accuracy);
+  virtual ~AliGenEMTabulatedTF1() {}
+
+  // sampling from the table, which is rebuilt if the range or the parameters changed
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,24,0)
+  virtual Double_t GetRandom(TRandom *rng = nullptr, Option_t *opt = nullptr);
+  virtual Double_t GetRandom(Double_t xmin, Double_t xmax, TRandom *rng = nullptr, Option_t *opt = nullptr);
+#else
+  virtual Double_t GetRandom();
+  virtual Double_t GetRandom(Double_t xmin, Double_t xmax);
+#endif
+
+  Bool_t   IsTabulated()                      const                   { return fSampler.GetNumberOfBins() > 0; }
+  const AliGenEMTabulatedSampler& GetSampler() const                  { return fSampler;                  }
+
+private:
+  AliGenEMTabulatedTF1(const AliGenEMTabulatedTF1 &func);
+  AliGenEMTabulatedTF1 & operator=(const AliGenEMTabulatedTF1 &func);
+
+  Bool_t   UpdateTable(Double_t xmin, Double_t xmax);
+
+  AliGenEMTabulatedSampler fSampler;                    //! table of the cumulative distribution
+
+  ClassDef(AliGenEMTabulatedTF1,1)                      // TF1 sampled from an adaptive inverse-CDF table
+};
+
+#endif
@@ -8,4 +8,7 @@
 #pragma link C++ class AliGenEMCocktail+;
 #pragma link C++ class AliGenEMlibV2+;
 #pragma link C++ class AliGenEMCocktailV2+;
+#pragma link C++ class AliGenEMTabulatedSampler+;
+#pragma link C++ class AliGenEMTabulatedTF1+;
+#pragma link C++ class AliGenEMTabulatedParam+;
 #endif
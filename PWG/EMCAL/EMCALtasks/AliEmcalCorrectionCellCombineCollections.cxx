@@ -130,6 +130,18 @@ Bool_t AliEmcalCorrectionCellCombineCollections::Run()
   return kTRUE;
 }
 
+/**
+ * Adds the objects used in the events: the cells of the external event which are copied
+ * and the combined cells, in addition to the input cells.
+ */
+void AliEmcalCorrectionCellCombineCollections::GetEventObjectNames(std::set <std::string> & names) const
+{
+  AliEmcalCorrectionComponent::GetEventObjectNames(names);
+
+  names.insert(EventObjectName(fExternalCellsBranchName, true));
+  names.insert(EventObjectName(fCreatedCellsBranchName, fEventManager.UseEmbeddingEvent()));
+}
+
 /**
  * Create cells combined from the input event and the external (embedded) event.
  * This is only necessary for cells because they basic object is a cell "container" rather than the actual
@@ -37,6 +37,7 @@ class AliEmcalCorrectionCellCombineCollections : public AliEmcalCorrectionCompon
   void UserCreateOutputObjects();
   void ExecOnce();
   Bool_t Run();
+  void GetEventObjectNames(std::set <std::string> & names) const;
 
   std::string GetExternalCellsBranchName()                      const { return fExternalCellsBranchName; }
   std::string GetCombinedCellsBranchName()                      const { return fCreatedCellsBranchName; }
@@ -202,6 +202,18 @@ Bool_t AliEmcalCorrectionClusterTrackMatcher::Run()
   return kTRUE;
 }
 
+/**
+ * Adds the objects used in the events. The propagation of the tracks uses the global
+ * geometry manager, which is added as well so that track matchers are never executed
+ * concurrently.
+ */
+void AliEmcalCorrectionClusterTrackMatcher::GetEventObjectNames(std::set <std::string> & names) const
+{
+  AliEmcalCorrectionComponent::GetEventObjectNames(names);
+
+  names.insert("gGeoManager");
+}
+
 /**
  * Get momentum bin.
  */
@@ -64,6 +64,7 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   void UserCreateOutputObjects();
   void ExecOnce();
   Bool_t Run();
+  void GetEventObjectNames(std::set <std::string> & names) const;
   
  protected:
   Int_t         GetMomBin(Double_t p) const;
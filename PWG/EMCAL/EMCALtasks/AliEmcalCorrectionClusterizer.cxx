@@ -936,6 +936,18 @@ Bool_t AliEmcalCorrectionClusterizer::CheckIfRunChanged()
   return runChanged;
 }
 
+/**
+ * Adds the objects used in the events. In addition to the cells and the output clusters,
+ * the original clusters of the event are read to propagate the MC labels.
+ */
+void AliEmcalCorrectionClusterizer::GetEventObjectNames(std::set <std::string> & names) const
+{
+  AliEmcalCorrectionComponent::GetEventObjectNames(names);
+
+  std::string defaultClusters = AliEmcalContainerUtils::DetermineUseDefaultName(AliEmcalContainerUtils::kCluster, fEsdMode);
+  names.insert(EventObjectName(defaultClusters, fEventManager.UseEmbeddingEvent()));
+}
+
 /**
  * Clear the EMCal clusters from the cluster TClonesArray.
  */
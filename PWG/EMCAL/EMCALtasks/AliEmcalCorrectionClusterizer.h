@@ -44,6 +44,7 @@ class AliEmcalCorrectionClusterizer : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+  void GetEventObjectNames(std::set <std::string> & names) const;
   
 protected:
   void           Clusterize();
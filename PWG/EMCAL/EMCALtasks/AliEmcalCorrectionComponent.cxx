@@ -209,6 +209,45 @@ void AliEmcalCorrectionComponent::UpdateCells()
   fCaloCells->Sort();
 }
 
+/**
+ * Adds the names of the objects used in the events by the component, each qualified with
+ * the event in which it is located (see EventObjectName()). Components using any common
+ * object are executed sequentially by AliEmcalCorrectionTask, while the others may be
+ * executed concurrently.
+ *
+ * The base implementation adds the branches of the cluster and particle containers. The
+ * cells are added by the correction task, which knows from which event they are taken.
+ * Components accessing other objects (for instance directly from the event) must add them
+ * here, as well as any global object that cannot be used from several threads at a time.
+ *
+ * @param[in,out] names Names of the objects used in the events
+ */
+void AliEmcalCorrectionComponent::GetEventObjectNames(std::set <std::string> & names) const
+{
+  TIter nextClusColl(&fClusterCollArray);
+  while (AliEmcalContainer * cont = static_cast<AliEmcalContainer *>(nextClusColl())) {
+    names.insert(EventObjectName(cont->GetArrayName().Data(), cont->GetIsEmbedding()));
+  }
+
+  TIter nextPartColl(&fParticleCollArray);
+  while (AliEmcalContainer * cont = static_cast<AliEmcalContainer *>(nextPartColl())) {
+    names.insert(EventObjectName(cont->GetArrayName().Data(), cont->GetIsEmbedding()));
+  }
+}
+
+/**
+ * Name of an object used in the events, as added by GetEventObjectNames().
+ *
+ * @param[in] branchName Name of the branch of the object
+ * @param[in] isEmbedding True if the object is taken from the external (embedded) event
+ *
+ * @return Name of the object qualified with its event
+ */
+std::string AliEmcalCorrectionComponent::EventObjectName(const std::string & branchName, bool isEmbedding)
+{
+  return isEmbedding ? branchName + " (embedded)" : branchName;
+}
+
 /**
  * Check whether the run changed.
  */
@@ -2,6 +2,7 @@
 #define ALIEMCALCORRECTIONCOMPONENT_H
 
 #include <map>
+#include <set>
 #include <string>
 
 // CINT can't handle the yaml header!
@@ -84,6 +85,9 @@ class AliEmcalCorrectionComponent : public TNamed {
   void                    RemoveParticleContainer(Int_t i=0)                     { fParticleCollArray.RemoveAt(i)                      ; }
   void                    RemoveClusterContainer(Int_t i=0)                      { fClusterCollArray.RemoveAt(i)                       ; }
   AliVCaloCells          *GetCaloCells()  const { return fCaloCells; }
+  // Objects used in the events, to determine which components are independent
+  virtual void GetEventObjectNames(std::set <std::string> & names) const;
+  static std::string EventObjectName(const std::string & branchName, bool isEmbedding);
   TList                  *GetOutputList() const { return fOutput; }
   
   void SetCaloCells(AliVCaloCells * cells) { fCaloCells = cells; }
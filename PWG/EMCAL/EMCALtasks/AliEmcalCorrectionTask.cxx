@@ -31,6 +31,7 @@
 #include "AliAODEvent.h"
 
 #include "AliAnalysisTaskEmcalEmbeddingHelper.h"
+#include "AliLaneThreadPool.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionTask);
@@ -83,6 +84,10 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fBeamType(kNA),
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fNThreads(1),
+  fLanePool(nullptr),
+  fRunNumber(-1),
+  fExternalRunNumber(-1),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -131,6 +136,10 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fBeamType(kNA),
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fNThreads(1),
+  fLanePool(nullptr),
+  fRunNumber(-1),
+  fExternalRunNumber(-1),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -179,6 +188,10 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const AliEmcalCorrectionTask & ta
   fBeamType(task.fBeamType),
   fForceBeamType(task.fForceBeamType),
   fNeedEmcalGeom(task.fNeedEmcalGeom),
+  fNThreads(task.fNThreads),
+  fLanePool(nullptr),
+  fRunNumber(-1),
+  fExternalRunNumber(-1),
   fGeom(task.fGeom),
   fParticleCollArray(*(static_cast<TObjArray *>(task.fParticleCollArray.Clone()))),
   fClusterCollArray(*(static_cast<TObjArray *>(task.fClusterCollArray.Clone()))),
@@ -245,6 +258,10 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
   swap(first.fBeamType, second.fBeamType);
   swap(first.fForceBeamType, second.fForceBeamType);
   swap(first.fNeedEmcalGeom, second.fNeedEmcalGeom);
+  swap(first.fNThreads, second.fNThreads);
+  swap(first.fLanePool, second.fLanePool);
+  swap(first.fRunNumber, second.fRunNumber);
+  swap(first.fExternalRunNumber, second.fExternalRunNumber);
   swap(first.fGeom, second.fGeom);
   swap(first.fParticleCollArray, second.fParticleCollArray);
   swap(first.fClusterCollArray, second.fClusterCollArray);
@@ -259,6 +276,7 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
 AliEmcalCorrectionTask::~AliEmcalCorrectionTask()
 {
   // Destructor
+  delete fLanePool;
 }
 
 /**
@@ -1352,15 +1370,157 @@ Bool_t AliEmcalCorrectionTask::Run()
     component->SetCentralityBin(fCentBin);
     component->SetCentrality(fCent);
     component->SetVertex(fVertex);
-
-    component->Run();
   }
 
+  RunComponents();
+
   PostData(1, fOutput);
 
   return kTRUE;
 }
 
+/**
+ * Calls Run() for each component. By default, the components are executed sequentially in the
+ * configured order. If more than one thread is requested, the lanes of components determined
+ * by DetermineComponentLanes() are executed concurrently by the threads of an AliLaneThreadPool,
+ * each lane sequentially in one thread.
+ *
+ * The components are always executed sequentially in the first event of each run (of the input
+ * or the external event), since they load their run dependent parameters in Run() (through
+ * CheckIfRunChanged()), and this is not safe to do from several threads.
+ */
+void AliEmcalCorrectionTask::RunComponents()
+{
+  if (fNThreads != 1 && !IsNewRun())
+  {
+    if (!fLanePool) {
+      DetermineComponentLanes();
+    }
+
+    // Components of one lane
+    class ComponentLane : public AliLaneThreadPool::LaneProcessor
+    {
+     public:
+      ComponentLane(const AliLaneThreadPool & pool, const std::vector <AliEmcalCorrectionComponent *> & components):
+        fPool(pool), fComponents(components) {}
+
+      void ProcessLane(Int_t lane)
+      {
+        for (auto icomponent : fPool.GetLane(lane)) {
+          fComponents.at(icomponent)->Run();
+        }
+      }
+
+     private:
+      const AliLaneThreadPool & fPool;
+      const std::vector <AliEmcalCorrectionComponent *> & fComponents;
+    };
+
+    ComponentLane processor(*fLanePool, fCorrectionComponents);
+    fLanePool->ProcessLanes(processor);
+    return;
+  }
+
+  for (auto component : fCorrectionComponents)
+  {
+    component->Run();
+  }
+}
+
+/**
+ * Checks whether the run of the input event or of the external (embedded) event changed
+ * since the previous event.
+ *
+ * @return True in the first event of a run
+ */
+bool AliEmcalCorrectionTask::IsNewRun()
+{
+  Int_t runNumber = InputEvent()->GetRunNumber();
+  Int_t externalRunNumber = -1;
+  const auto embeddingHelper = AliAnalysisTaskEmcalEmbeddingHelper::GetInstance();
+  if (embeddingHelper && embeddingHelper->GetExternalEvent()) {
+    externalRunNumber = embeddingHelper->GetExternalEvent()->GetRunNumber();
+  }
+
+  bool newRun = (runNumber != fRunNumber || externalRunNumber != fExternalRunNumber);
+  fRunNumber = runNumber;
+  fExternalRunNumber = externalRunNumber;
+
+  return newRun;
+}
+
+/**
+ * Groups the components in lanes which can be executed concurrently, and starts the threads
+ * executing them, at most one per lane. Two components are in the same lane if they use a common
+ * object in the events, directly or through other components. The objects of each component are
+ * its cells and the names given by AliEmcalCorrectionComponent::GetEventObjectNames(), qualified by
+ * the event in which they are located. The cells are also identified by their address, in case
+ * two cell containers point to the same object. Components modifying the same cells or clusters in
+ * place are thus always executed one after the other in the same thread. The components of a lane
+ * keep the configured order, so that a component using the output of another one is executed after it.
+ */
+void AliEmcalCorrectionTask::DetermineComponentLanes()
+{
+  if (!fLanePool) {
+    fLanePool = new AliLaneThreadPool();
+  }
+
+  size_t nComponents = fCorrectionComponents.size();
+  fLanePool->ResetLanes(nComponents);
+
+  std::string cellsNamesProperty = GetInputFieldNameFromInputObjectType(AliEmcalContainerUtils::kCaloCells) + "Names";
+  for (size_t i = 0; i < nComponents; i++)
+  {
+    AliEmcalCorrectionComponent * component = fCorrectionComponents.at(i);
+
+    std::set <std::string> names;
+    component->GetEventObjectNames(names);
+
+    // The cells are not stored in containers by the component
+    std::vector <std::string> cellsNames;
+    AliEmcalCorrectionComponent::GetProperty(cellsNamesProperty, cellsNames, fUserConfiguration, fDefaultConfiguration, false, component->GetName());
+    for (auto const & cellsName : cellsNames)
+    {
+      AliEmcalCorrectionCellContainer * cellCont = GetCellContainer(cellsName);
+      if (cellCont) {
+        names.insert(AliEmcalCorrectionComponent::EventObjectName(cellCont->GetBranchName(), cellCont->GetIsEmbedding()));
+      }
+    }
+    if (component->GetCaloCells()) {
+      names.insert(AliLaneThreadPool::GetPointerName(component->GetCaloCells()).Data());
+    }
+
+    // Resource names are separated by blanks
+    TString resources;
+    for (auto name : names)
+    {
+      AliDebugStream(2) << "Component " << component->GetName() << " uses " << name << std::endl;
+      std::replace(name.begin(), name.end(), ' ', '_');
+      resources += TString(" ") + name.c_str();
+    }
+    fLanePool->AddResources(i, resources);
+  }
+
+  fLanePool->MakeLanes();
+
+  Int_t nLanes = fLanePool->GetNumberOfLanes();
+  Int_t nThreads = fNThreads > 0 ? fNThreads : AliLaneThreadPool::GetNumberOfCores();
+  if (nThreads > nLanes) {
+    nThreads = nLanes > 0 ? nLanes : 1;
+  }
+  fLanePool->StartThreads(nThreads);
+
+  std::stringstream tempSS;
+  for (Int_t lane = 0; lane < nLanes; lane++)
+  {
+    tempSS << "\n\tLane " << lane << ":";
+    for (auto icomponent : fLanePool->GetLane(lane)) {
+      tempSS << " " << fCorrectionComponents.at(icomponent)->GetName();
+    }
+  }
+  AliInfo(TString::Format("%d components in %d independent lanes, %d threads requested, %d started:%s", (Int_t) nComponents, nLanes, fNThreads, fLanePool->GetNumberOfThreads(), tempSS.str().c_str()));
+}
+
 /**
  * Executed when the file is changed. Also calls UserNotify() for each component.
  */
@@ -1815,6 +1975,8 @@ std::string AliEmcalCorrectionTask::toString(bool includeYAMLConfigurationInfo)
   PrintRequestedContainersInformation(AliEmcalContainerUtils::kCaloCells, tempSS);
   PrintRequestedContainersInformation(AliEmcalContainerUtils::kCluster, tempSS);
   PrintRequestedContainersInformation(AliEmcalContainerUtils::kTrack, tempSS);
+  // Concurrent execution
+  tempSS << "\nNumber of threads: " << fNThreads << "\n";
 
   if (includeYAMLConfigurationInfo == true) {
     tempSS << "\nUser Configuration:\n";
@@ -10,6 +10,7 @@ class AliEmcalCorrectionCellContainer;
 class AliEmcalCorrectionComponent;
 class AliEMCALGeometry;
 class AliVEvent;
+class AliLaneThreadPool;
 
 #include <iosfwd>
 
@@ -35,6 +36,11 @@ class AliVEvent;
  * AliAnalysisTaskEmcal, the relevant event information is loaded, and then
  * the Run() function of each correction is called.
  *
+ * Components which do not share any object in the events (see
+ * AliEmcalCorrectionComponent::GetEventObjectNames()), such as the cell and
+ * cluster corrections of the input and external events when embedding, can be
+ * executed concurrently by setting the number of threads with SetNumberOfThreads().
+ *
  * In general, this steering class handles all of the configuration of the
  * corrections, including passing the relevant EMCal containers and event objects.
  *
@@ -97,6 +103,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Set
   void                        SetForceBeamType(BeamType f)                          { fForceBeamType     = f                              ; }
   void                        SetNeedEmcalGeometry(Bool_t b)                        { fNeedEmcalGeom     = b                              ; }
+  void                        SetNumberOfThreads(Int_t n)                           { fNThreads          = n                              ; }
   // Centrality options
   void                        SetUseNewCentralityEstimation(Bool_t b)               { fUseNewCentralityEstimation = b                     ; }
   void                        SetCentralityEstimator(const char * c)                { fCentEst           = c                              ; }
@@ -168,6 +175,9 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Execute component functions
   void UserCreateOutputObjectsComponents();
   void ExecOnceComponents();
+  void RunComponents();
+  bool IsNewRun();
+  void DetermineComponentLanes();
 
   // Initialization functions
   void InitializeConfiguration();
@@ -227,6 +237,10 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   BeamType                    fBeamType;                   //!<! Event beam type
   BeamType                    fForceBeamType;              ///< forced beam type
   Bool_t                      fNeedEmcalGeom;              ///< whether or not the task needs the emcal geometry
+  Int_t                       fNThreads;                   ///< Number of threads executing the independent components (1: sequential, 0: number of cores)
+  AliLaneThreadPool          *fLanePool;                   //!<! Components grouped by the objects they share and threads executing them, see DetermineComponentLanes()
+  Int_t                       fRunNumber;                  //!<! Run number of the input event of the previous event
+  Int_t                       fExternalRunNumber;          //!<! Run number of the external (embedded) event of the previous event
   AliEMCALGeometry           *fGeom;                       //!<! Emcal geometry
 
   TObjArray                   fParticleCollArray;          ///< Particle/track collection array
@@ -236,7 +250,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 4); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 5); // EMCal correction task
   /// \endcond
 };
 
@@ -32,6 +32,7 @@
 #include "AliEMCALTriggerRawPatch.h"
 #include "AliEmcalTriggerMakerKernel.h"
 #include "AliEmcalTriggerSetupInfo.h"
+#include "AliEmcalTriggerSummedAreaFinder.h"
 #include "AliLog.h"
 #include "AliVCaloCells.h"
 #include "AliVCaloTrigger.h"
@@ -50,6 +51,9 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fTriggerBitConfig(nullptr),
   fPatchFinder(nullptr),
   fLevel0PatchFinder(nullptr),
+  fSummedAreaPatchFinder(nullptr),
+  fLevel0SummedAreaFinder(nullptr),
+  fUseSummedAreaPatchFinder(kFALSE),
   fL0MinTime(7),
   fL0MaxTime(10),
   fMinCellAmp(0),
@@ -72,7 +76,9 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
-  fADCtoGeV(1.)
+  fADCtoGeV(1.),
+  fBadChannelMask(),
+  fOfflineBadChannelMask()
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
@@ -89,6 +95,8 @@ AliEmcalTriggerMakerKernel::~AliEmcalTriggerMakerKernel() {
   delete fTriggerBitMap;
   delete fPatchFinder;
   delete fLevel0PatchFinder;
+  delete fSummedAreaPatchFinder;
+  delete fLevel0SummedAreaFinder;
   if(fTriggerBitConfig) delete fTriggerBitConfig;
 }
 
@@ -99,6 +107,9 @@ void AliEmcalTriggerMakerKernel::Init(){
     SetTriggerBitConfig(triggerBitConfig);
   }
 
+  // Channel masks are transient: rebuild them from the bad channel lists
+  BuildChannelMasks();
+
   fPatchAmplitudes = new AliEMCALTriggerDataGrid<double>;
   fPatchADCSimple = new AliEMCALTriggerDataGrid<double>;
   fPatchADC = new AliEMCALTriggerDataGrid<double>;
@@ -128,6 +139,9 @@ void AliEmcalTriggerMakerKernel::AddL1TriggerAlgorithm(Int_t rowmin, Int_t rowma
   trigger->SetPatchSize(patchSize);
   trigger->SetSubregionSize(subregionSize);
   fPatchFinder->AddTriggerAlgorithm(trigger);
+
+  if (!fSummedAreaPatchFinder) fSummedAreaPatchFinder = new AliEmcalTriggerSummedAreaFinder;
+  fSummedAreaPatchFinder->AddTriggerAlgorithm(rowmin, rowmax, bitmask, patchSize, subregionSize);
 }
 
 void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize)
@@ -136,6 +150,17 @@ void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowma
   fLevel0PatchFinder = new AliEMCALTriggerAlgorithm<double>(rowmin, rowmax, bitmask);
   fLevel0PatchFinder->SetPatchSize(patchSize);
   fLevel0PatchFinder->SetSubregionSize(subregionSize);
+
+  if (!fLevel0SummedAreaFinder) fLevel0SummedAreaFinder = new AliEmcalTriggerSummedAreaFinder;
+  fLevel0SummedAreaFinder->ClearTriggerAlgorithms();
+  fLevel0SummedAreaFinder->AddTriggerAlgorithm(rowmin, rowmax, bitmask, patchSize, subregionSize);
+}
+
+void AliEmcalTriggerMakerKernel::ResetL1TriggerAlgorithms()
+{
+  if (fPatchFinder) delete fPatchFinder;
+  fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  if (fSummedAreaPatchFinder) fSummedAreaPatchFinder->ClearTriggerAlgorithms();
 }
 
 void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
@@ -144,8 +169,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
   SetTriggerBitConfig(triggerBitConfig);
 
   // Initialize patch finder
-  if (fPatchFinder) delete fPatchFinder;
-  fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  ResetL1TriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -161,8 +185,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2015()
   SetTriggerBitConfig(triggerBitConfig);
 
   // Initialize patch finder
-  if (fPatchFinder) delete fPatchFinder;
-  fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  ResetL1TriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -178,8 +201,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPPb2013()
   SetTriggerBitConfig(triggerBitConfig);
 
   // Initialize patch finder
-  if (fPatchFinder) delete fPatchFinder;
-  fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  ResetL1TriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -193,8 +215,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2012()
   SetTriggerBitConfig(triggerBitConfig);
 
   // Initialize patch finder
-  if (fPatchFinder) delete fPatchFinder;
-  fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  ResetL1TriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -208,8 +229,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2011()
   SetTriggerBitConfig(triggerBitConfig);
 
   // Initialize patch finder
-  if (fPatchFinder) delete fPatchFinder;
-  fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  ResetL1TriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -223,8 +243,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2011()
   SetTriggerBitConfig(triggerBitConfig);
 
   // Initialize patch finder
-  if (fPatchFinder) delete fPatchFinder;
-  fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  ResetL1TriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   fConfigured = true;
@@ -341,7 +360,7 @@ void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
     }
 
     // exclude channel completely if it is masked as hot channel
-    if (fBadChannels.find(absId) != fBadChannels.end()){
+    if (IsBadFastOR(absId)){
       AliDebugStream(1) << "Found ADC for masked fastor " << absId << ", rejecting" << std::endl;
       continue;
     }
@@ -391,7 +410,7 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
     Short_t cellId = cells->GetCellNumber(iCell);
 
     // Check bad channel map
-    if (fOfflineBadChannels.find(cellId) != fOfflineBadChannels.end()) {
+    if (IsOfflineBadCell(cellId)) {
       AliDebugStream(1) << "Cell " << cellId << " masked as bad channel, rejecting." << std::endl;
       continue;
     }
@@ -407,7 +426,7 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
       // Exclude FEE amplitudes from cells which are within a TRU which is masked at
       // online level. Using this the online acceptance can be applied to offline
       // patches as well.
-      if(fBadChannels.find(absId) != fBadChannels.end()){
+      if(IsBadFastOR(absId)){
         AliDebugStream(1) << "Cell " << cellId << " corresponding to masked fastor " << absId << ", rejecting." << std::endl;
         continue;
       }
@@ -488,7 +507,10 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
   std::vector<AliEMCALTriggerRawPatch> patches;
-  if (fPatchFinder) {
+  if (fUseSummedAreaPatchFinder && fSummedAreaPatchFinder) {
+    patches = fSummedAreaPatchFinder->FindPatches(useL0amp ? *fPatchAmplitudes : *fPatchADC, *fPatchADCSimple);
+  }
+  else if (fPatchFinder) {
     if (useL0amp) {
       patches = fPatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
     }
@@ -544,7 +566,8 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
 
   // Find Level0 patches
   std::vector<AliEMCALTriggerRawPatch> l0patches;
-  if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+  if (fUseSummedAreaPatchFinder && fLevel0SummedAreaFinder) l0patches = fLevel0SummedAreaFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+  else if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
   for(std::vector<AliEMCALTriggerRawPatch>::iterator patchit = l0patches.begin(); patchit != l0patches.end(); ++patchit){
     Int_t offlinebits = 0, onlinebits = 0;
     if(HasPHOSOverlap(*patchit)) continue;
@@ -667,10 +690,26 @@ AliEmcalTriggerMakerKernel::ELevel0TriggerStatus_t AliEmcalTriggerMakerKernel::C
 
 void AliEmcalTriggerMakerKernel::ClearFastORBadChannels(){
   fBadChannels.clear();
+  fBadChannelMask.clear();
 }
 
 void AliEmcalTriggerMakerKernel::ClearOfflineBadChannels() {
   fOfflineBadChannels.clear();
+  fOfflineBadChannelMask.clear();
+}
+
+void AliEmcalTriggerMakerKernel::BuildChannelMasks(){
+  fBadChannelMask.clear();
+  for(std::set<Short_t>::const_iterator it = fBadChannels.begin(); it != fBadChannels.end(); ++it) AddToChannelMask(fBadChannelMask, *it);
+  fOfflineBadChannelMask.clear();
+  for(std::set<Short_t>::const_iterator it = fOfflineBadChannels.begin(); it != fOfflineBadChannels.end(); ++it) AddToChannelMask(fOfflineBadChannelMask, *it);
+}
+
+void AliEmcalTriggerMakerKernel::AddToChannelMask(std::vector<bool> &mask, Short_t absId){
+  // negative IDs are looked up in the list
+  if(absId < 0) return;
+  if(absId >= static_cast<Int_t>(mask.size())) mask.resize(absId + 1, false);
+  mask[absId] = true;
 }
 
 Bool_t AliEmcalTriggerMakerKernel::IsGammaPatch(const AliEMCALTriggerRawPatch &patch) const {
@@ -23,6 +23,7 @@ class AliVVZERO;
 template<class T> class AliEMCALTriggerDataGrid;
 template<class T> class AliEMCALTriggerAlgorithm;
 template<class T> class AliEMCALTriggerPatchFinder;
+class AliEmcalTriggerSummedAreaFinder;
 
 // To be moved to AliRoot in AliEMCALTriggerConstants.h at the first occasion
 namespace EMCALTrigger {
@@ -203,7 +204,7 @@ public:
    * @brief Add a FastOR bad channel to the list
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); }
+  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); AddToChannelMask(fBadChannelMask, absId); }
 
   /**
    * @brief Read the FastOR bad channel map from a standard stream
@@ -226,7 +227,7 @@ public:
    * @brief Add an offline bad channel to the set
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); }
+  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); AddToChannelMask(fOfflineBadChannelMask, absId); }
 
   /**
    * @brief Read the offline bad channel map from a standard stream
@@ -309,6 +310,23 @@ public:
    */
   void SetApplyOnlineBadChannelMaskingToOffline(Bool_t doApply = kTRUE) { fApplyOnlineBadChannelsToOffline = doApply; }
 
+  /**
+   * @brief Use summed-area tables to find the trigger patches
+   *
+   * The patch sums are obtained from a summed-area table built once per data grid
+   * (AliEmcalTriggerSummedAreaFinder) instead of being summed from scratch by the
+   * sliding-window algorithms. The patches (positions, ADC sums, order) are identical
+   * to the ones of the standard patch finder.
+   * @param[in] doUse If true the summed-area patch finder is used
+   */
+  void SetUseSummedAreaPatchFinder(Bool_t doUse = kTRUE) { fUseSummedAreaPatchFinder = doUse; }
+
+  /**
+   * @brief Check whether the summed-area patch finder is used
+   * @return True if the summed-area patch finder is used
+   */
+  Bool_t IsUsingSummedAreaPatchFinder() const { return fUseSummedAreaPatchFinder; }
+
   /**
    * @brief Reset all data grids and VZERO-dependent L1 thresholds
    */
@@ -459,6 +477,49 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Delete all L1 trigger algorithms (standard and summed-area patch finders)
+   */
+  void ResetL1TriggerAlgorithms();
+
+  /**
+   * @brief Check whether a FastOR is masked online
+   * @param[in] absId Absolute ID of the FastOR
+   * @return True if the FastOR is in the list of bad channels
+   */
+  Bool_t IsBadFastOR(Int_t absId) const { return IsInChannelMask(fBadChannelMask, fBadChannels, absId); }
+
+  /**
+   * @brief Check whether a cell is masked offline
+   * @param[in] absId Absolute ID of the cell
+   * @return True if the cell is in the list of offline bad channels
+   */
+  Bool_t IsOfflineBadCell(Int_t absId) const { return IsInChannelMask(fOfflineBadChannelMask, fOfflineBadChannels, absId); }
+
+  /**
+   * @brief Rebuild the channel bitmasks from the lists of bad channels
+   */
+  void BuildChannelMasks();
+
+  /**
+   * @brief Set the bit of a channel in a channel bitmask, extending it if needed
+   * @param[in,out] mask Channel bitmask
+   * @param[in] absId Absolute ID of the channel
+   */
+  static void AddToChannelMask(std::vector<bool> &mask, Short_t absId);
+
+  /**
+   * @brief Look up a channel in a bitmask, or in the list for negative IDs
+   * @param[in] mask Channel bitmask
+   * @param[in] channels List of channels the mask was built from
+   * @param[in] absId Absolute ID of the channel
+   * @return True if the channel is in the list
+   */
+  static Bool_t IsInChannelMask(const std::vector<bool> &mask, const std::set<Short_t> &channels, Int_t absId) {
+    if(absId >= 0) return absId < static_cast<Int_t>(mask.size()) && mask[absId];
+    return channels.find(absId) != channels.end();
+  }
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -466,6 +527,9 @@ protected:
 
   AliEMCALTriggerPatchFinder<double>       *fPatchFinder;                 ///< The actual patch finder
   AliEMCALTriggerAlgorithm<double>         *fLevel0PatchFinder;           ///< Patch finder for Level0 patches
+  AliEmcalTriggerSummedAreaFinder          *fSummedAreaPatchFinder;       ///< Summed-area patch finder with the same algorithms as fPatchFinder
+  AliEmcalTriggerSummedAreaFinder          *fLevel0SummedAreaFinder;      ///< Summed-area patch finder with the Level0 algorithm
+  Bool_t                                    fUseSummedAreaPatchFinder;    ///< Use the summed-area patch finders
   Int_t                                     fL0MinTime;                   ///< Minimum L0 time
   Int_t                                     fL0MaxTime;                   ///< Maximum L0 time
   Int_t                                     fMinCellAmp;                  ///< Minimum offline amplitude of the cells used to generate the patches
@@ -494,9 +558,11 @@ protected:
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
+  std::vector<bool>                         fBadChannelMask;              //!<! Bitmask of the bad channels, indexed by abs ID
+  std::vector<bool>                         fOfflineBadChannelMask;       //!<! Bitmask of the offline bad channels, indexed by abs ID
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
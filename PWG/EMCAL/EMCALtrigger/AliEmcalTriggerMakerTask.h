@@ -171,6 +171,16 @@ public:
     if(fTriggerMaker) fTriggerMaker->SetApplyOnlineBadChannelMaskingToOffline(doApply);
   }
 
+  /**
+   * @brief Find the trigger patches with summed-area tables instead of sliding-window sums.
+   *
+   * The patches are identical to the ones of the standard patch finder.
+   * @param[in] doUse If true the summed-area patch finder is used
+   */
+  void SetUseSummedAreaPatchFinder(Bool_t doUse = kTRUE) {
+    if(fTriggerMaker) fTriggerMaker->SetUseSummedAreaPatchFinder(doUse);
+  }
+
   void SetTriggerThresholdJetLow   ( Int_t a, Int_t b, Int_t c ) {
     if(fTriggerMaker) fTriggerMaker->SetTriggerThresholdJetLow(a, b, c);
   }
@@ -0,0 +1,140 @@
+/**************************************************************************
+ * Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+#include <cmath>
+
+#include "AliEMCALTriggerDataGrid.h"
+#include "AliEMCALTriggerRawPatch.h"
+#include "AliEmcalTriggerSummedAreaFinder.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalTriggerSummedAreaFinder)
+/// \endcond
+
+AliEmcalTriggerSummedAreaFinder::AliEmcalTriggerSummedAreaFinder():
+  TObject(),
+  fRowMin(),
+  fRowMax(),
+  fBitMask(),
+  fPatchSize(),
+  fSubregionSize(),
+  fNCols(0),
+  fNRows(0)
+{
+  for(int itable = 0; itable < 2; itable++){
+    fIntegral[itable] = kFALSE;
+    fNonNegative[itable] = kFALSE;
+  }
+}
+
+void AliEmcalTriggerSummedAreaFinder::AddTriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize){
+  fRowMin.push_back(rowmin);
+  fRowMax.push_back(rowmax);
+  fBitMask.push_back(bitmask);
+  fPatchSize.push_back(patchSize);
+  fSubregionSize.push_back(subregionSize);
+}
+
+void AliEmcalTriggerSummedAreaFinder::ClearTriggerAlgorithms(){
+  fRowMin.clear();
+  fRowMax.clear();
+  fBitMask.clear();
+  fPatchSize.clear();
+  fSubregionSize.clear();
+}
+
+std::vector<AliEMCALTriggerRawPatch> AliEmcalTriggerSummedAreaFinder::FindPatches(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc){
+  std::vector<AliEMCALTriggerRawPatch> result;
+  BuildTable(adc, 0);
+  BuildTable(offlineAdc, 1);
+
+  for(size_t ialgo = 0; ialgo < fRowMin.size(); ialgo++){
+    // same loop as the sliding-window algorithm
+    const int patchSize = fPatchSize[ialgo], subregionSize = fSubregionSize[ialgo];
+    if(subregionSize <= 0) continue;
+    const int rowStartMax = fRowMax[ialgo] - (patchSize - 1),
+              colStartMax = adc.GetNumberOfCols() - patchSize;
+    for(int irow = fRowMin[ialgo]; irow <= rowStartMax; irow += subregionSize){
+      for(int icol = 0; icol <= colStartMax; icol += subregionSize){
+        double sumadc = GetPatchSum(0, icol, irow, patchSize),
+               sumofflineAdc = GetPatchSum(1, icol, irow, patchSize);
+        if(sumadc > 0 || sumofflineAdc > 0){
+          AliEMCALTriggerRawPatch recpatch(icol, irow, patchSize, sumadc, sumofflineAdc);
+          recpatch.SetBitmask(fBitMask[ialgo]);
+          result.push_back(recpatch);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+void AliEmcalTriggerSummedAreaFinder::BuildTable(const AliEMCALTriggerDataGrid<double> &grid, Int_t itable){
+  fNCols = grid.GetNumberOfCols();
+  fNRows = grid.GetNumberOfRows();
+  const int stride = fNCols + 1;
+  std::vector<Double_t> &values = fValues[itable], &sums = fSums[itable];
+  std::vector<Int_t> &nonzero = fNonZero[itable];
+  values.resize(fNCols * fNRows);
+  sums.assign(stride * (fNRows + 1), 0.);
+  nonzero.assign(stride * (fNRows + 1), 0);
+
+  // Sums of integers are exact as long as all partial sums stay below 2^53
+  const double kMaxExactSum = 4503599627370496.;  // 2^52
+  bool integral = true, nonnegative = true;
+  double sumabs = 0;
+  for(int irow = 0; irow < fNRows; irow++){
+    for(int icol = 0; icol < fNCols; icol++){
+      double value = grid(icol, irow);
+      values[irow * fNCols + icol] = value;
+      if(value < 0 || std::isnan(value)) nonnegative = false;
+      if(!(value == std::floor(value))) integral = false;   // also rejects inf and nan
+      sumabs += std::fabs(value);
+      int above = (irow + 1) * stride + icol + 1, below = irow * stride + icol + 1;
+      sums[above] = value + sums[below] + sums[above - 1] - sums[below - 1];
+      nonzero[above] = (value != 0 ? 1 : 0) + nonzero[below] + nonzero[above - 1] - nonzero[below - 1];
+    }
+  }
+  fIntegral[itable] = integral && sumabs < kMaxExactSum;
+  fNonNegative[itable] = nonnegative;
+}
+
+Double_t AliEmcalTriggerSummedAreaFinder::GetPatchSum(Int_t itable, Int_t col, Int_t row, Int_t size) const {
+  // channels outside the grid do not contribute (out-of-bounds in the sliding-window algorithm)
+  const int colmin = std::max(col, 0), rowmin = std::max(row, 0),
+            colmax = std::min(col + size, fNCols), rowmax = std::min(row + size, fNRows);
+  if(colmin >= colmax || rowmin >= rowmax) return 0.;
+  const int stride = fNCols + 1;
+  const int i11 = rowmax * stride + colmax, i10 = rowmin * stride + colmax,
+            i01 = rowmax * stride + colmin, i00 = rowmin * stride + colmin;
+
+  if(fIntegral[itable]){
+    const std::vector<Double_t> &sums = fSums[itable];
+    return sums[i11] - sums[i10] - sums[i01] + sums[i00];
+  }
+  if(fNonNegative[itable]){
+    const std::vector<Int_t> &nonzero = fNonZero[itable];
+    if(nonzero[i11] - nonzero[i10] - nonzero[i01] + nonzero[i00] == 0) return 0.;
+  }
+  // sequential sum, same order as the sliding-window algorithm
+  const std::vector<Double_t> &values = fValues[itable];
+  double sum = 0;
+  for(int jrow = rowmin; jrow < rowmax; jrow++){
+    for(int jcol = colmin; jcol < colmax; jcol++){
+      sum += values[jrow * fNCols + jcol];
+    }
+  }
+  return sum;
+}
@@ -0,0 +1,114 @@
+#ifndef ALIEMCALTRIGGERSUMMEDAREAFINDER_H
+#define ALIEMCALTRIGGERSUMMEDAREAFINDER_H
+/* Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliEMCALTriggerRawPatch;
+template<class T> class AliEMCALTriggerDataGrid;
+
+/**
+ * @class AliEmcalTriggerSummedAreaFinder
+ * @brief Trigger patch finder based on summed-area tables
+ * @ingroup EMCALTRGFW
+ *
+ * Equivalent of AliEMCALTriggerPatchFinder with a set of sliding-window
+ * AliEMCALTriggerAlgorithms (same patches, same order, same ADC sums).
+ * Instead of summing every patch from scratch, a summed-area table is built
+ * once per data grid, from which the sum of any patch is obtained with four
+ * lookups.
+ *
+ * The patch sums must be bit-identical to the sequential sums of the sliding-window
+ * finder. This is guaranteed for grids with integer values (online ADCs): sums of
+ * integers are exact in double precision in any order. For other grids (offline
+ * ADCs from cell energies) the table only counts the non-zero channels: patches
+ * without any non-zero channel have sum 0, the others are summed channel by
+ * channel in the same order as the sliding-window finder.
+ */
+class AliEmcalTriggerSummedAreaFinder : public TObject {
+public:
+
+  /**
+   * @brief Constructor
+   */
+  AliEmcalTriggerSummedAreaFinder();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalTriggerSummedAreaFinder() {}
+
+  /**
+   * @brief Add a sliding-window algorithm
+   *
+   * Same parameters as AliEMCALTriggerAlgorithm (without thresholds)
+   * @param[in] rowmin Minimum row value
+   * @param[in] rowmax Maximum row value
+   * @param[in] bitmask Offline bit mask to be applied to the patches
+   * @param[in] patchSize Size of the patches
+   * @param[in] subregionSize Size of the sliding sub region
+   */
+  void AddTriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize);
+
+  /**
+   * @brief Remove all algorithms
+   */
+  void ClearTriggerAlgorithms();
+
+  /**
+   * @brief Get the number of algorithms
+   * @return Number of algorithms
+   */
+  Int_t GetNumberOfTriggerAlgorithms() const { return fRowMin.size(); }
+
+  /**
+   * @brief Find patches with all algorithms, in the order they were added
+   *
+   * Patches are accepted if either the online or the offline ADC sum is above 0.
+   * @param[in] adc Grid with online ADC values
+   * @param[in] offlineAdc Grid with offline ADC values (same dimensions)
+   * @return List of patches
+   */
+  std::vector<AliEMCALTriggerRawPatch> FindPatches(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc);
+
+protected:
+  /**
+   * @brief Fill the tables of one grid
+   * @param[in] grid Input data grid
+   * @param[in] itable Table index (0 - online, 1 - offline)
+   */
+  void BuildTable(const AliEMCALTriggerDataGrid<double> &grid, Int_t itable);
+
+  /**
+   * @brief Sum of a patch, identical to the sequential sum over rows and columns
+   * @param[in] itable Table index (0 - online, 1 - offline)
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Patch size
+   * @return Sum of the channels of the patch inside the grid
+   */
+  Double_t GetPatchSum(Int_t itable, Int_t col, Int_t row, Int_t size) const;
+
+  std::vector<Int_t>                fRowMin;              ///< Minimum row of each algorithm
+  std::vector<Int_t>                fRowMax;              ///< Maximum row of each algorithm
+  std::vector<UInt_t>               fBitMask;             ///< Bit mask of each algorithm
+  std::vector<Int_t>                fPatchSize;           ///< Patch size of each algorithm
+  std::vector<Int_t>                fSubregionSize;       ///< Sliding step of each algorithm
+
+  Int_t                             fNCols;               //!<! Columns of the current grids
+  Int_t                             fNRows;               //!<! Rows of the current grids
+  std::vector<Double_t>             fValues[2];           //!<! Channel values (row-major)
+  std::vector<Double_t>             fSums[2];             //!<! Summed-area tables of the values ((cols+1) x (rows+1))
+  std::vector<Int_t>                fNonZero[2];          //!<! Summed-area tables of the non-zero channels
+  Bool_t                            fIntegral[2];         //!<! All values integer: sums from the table are exact
+  Bool_t                            fNonNegative[2];      //!<! No negative value: empty patches have sum 0
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTriggerSummedAreaFinder, 1);
+  /// \endcond
+};
+
+#endif
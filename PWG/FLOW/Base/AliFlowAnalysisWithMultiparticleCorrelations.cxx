@@ -24,6 +24,7 @@
 #define AliFlowAnalysisWithMultiparticleCorrelations_cxx
 
 #include "AliFlowAnalysisWithMultiparticleCorrelations.h"
+#include "AliFlowMultiparticleCorrelator.h"
 
 using std::endl;
 using std::cout;
@@ -64,6 +65,8 @@ AliFlowAnalysisWithMultiparticleCorrelations::AliFlowAnalysisWithMultiparticleCo
  fQvectorFlagsPro(NULL),
  fCalculateQvector(kFALSE),
  fCalculateDiffQvectors(kFALSE),
+ fUseCorrelatorEngine(kFALSE),
+ fCorrelator(NULL),
  // 3.) Correlations:
  fCorrelationsList(NULL),
  fCorrelationsFlagsPro(NULL),
@@ -169,6 +172,7 @@ AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleC
  // Destructor.
  
  delete fHistList;
+ delete fCorrelator;
 
 } // end of AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleCorrelations()
 
@@ -420,7 +424,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CrossCheckPointersUsedInMake(
 
  // a) Correlations;
  // b) Event-by-event cumulants;
- // c) ...
+ // c) Correlator engine.
 
  TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::CrossCheckPointersUsedInMake()"; 
 
@@ -454,6 +458,9 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CrossCheckPointersUsedInMake(
   }
  } // if(fCalculateEbECumulants)
 
+ // c) Correlator engine:
+ if(fUseCorrelatorEngine && !fCorrelator){Fatal(sMethodName.Data(),"fUseCorrelatorEngine && !fCorrelator");}
+
 } // void AliFlowAnalysisWithMultiparticleCorrelations::CrossCheckPointersUsedInMake()
 
 //=======================================================================================================================
@@ -794,6 +801,25 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateDiffCorrelations(Ali
   } // for(Int_t co=0;co<4;co++) // [1p,2p,3p,4p]
  } // for(Int_t cs=0;cs<2;cs++) // [0=cos,1=sin]
 
+ // With the engine the correlators are obtained for all bins at once:
+ if(this->UseEngineForDiffQvectors())
+ {
+  std::vector<AliFlowMultiparticleCorrelator::Complex_t> num, den;
+  for(Int_t co=1;co<4;co++) // [2p,3p,4p]
+  {
+   if(!fCorrelator->DiffCorrelators(co+1,fDiffHarmonics[co],num,den)){continue;}
+   for(Int_t b=1;b<=nBins;b++)
+   {
+    Double_t d = den[b-1].real();
+    if(!(d>0.)){continue;}
+    Double_t w = d; // TBI add support for other options for the weight
+    if(fCalculateDiffCos){fDiffCorrelationsPro[0][co]->Fill(fDiffCorrelationsPro[0][co]->GetBinCenter(b),num[b-1].real()/d,w);}
+    if(fCalculateDiffSin){fDiffCorrelationsPro[1][co]->Fill(fDiffCorrelationsPro[1][co]->GetBinCenter(b),num[b-1].imag()/d,w);}
+   } // for(Int_t b=1;b<=nBins;b++)
+  } // for(Int_t co=1;co<4;co++) // [2p,3p,4p]
+  return;
+ } // if(this->UseEngineForDiffQvectors())
+
  // TBI: The lines below are genuine, most delicious, spaghetti ever... To be reimplemented (one day).
  if(fCalculateDiffCos)
  {
@@ -972,6 +998,15 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
   } // if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
  } // for(UInt_t t=0;t<=TString(string).Length();t++)
 
+ // With the engine all orders go through the memoized recursion:
+ if(fCorrelator && whichCorr>=1)
+ {
+  Int_t zero[8] = {0,0,0,0,0,0,0,0};
+  AliFlowMultiparticleCorrelator::Complex_t c = fCorrelator->Correlator(whichCorr,numerator ? n : zero);
+  if(!numerator || bRealPart){return c.real();}
+  return c.imag();
+ } // if(fCorrelator && whichCorr>=1)
+
  switch(whichCorr)
  {
   case 1:
@@ -2035,15 +2070,19 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
    dEta = pTrack->Eta();
    if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
 
-   // Calculate Q-vector components:
-   for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+   // Calculate Q-vector components (the engine only buffers the particle here):
+   if(fCorrelator){fCorrelator->AddParticle(dPhi,wPhi*wPt*wEta);}
+   else
    {
-    for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
+    for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
     {
-     if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-     fQvector[h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
-    } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
-   } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+     for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
+     {
+      if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
+      fQvector[h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
+     } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
+    } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+   }
   } // if(pTrack->InRPSelection()) // fill Q-vector components only with reference particles
 
   // Differential Q-vectors (a.k.a. p-vector and q-vector):
@@ -2071,6 +2110,11 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
      {
       binNo = fDiffCorrelationsPro[0][0]->FindBin(dEta); // TBI: hardwired [0][0]
      }
+   if(this->UseEngineForDiffQvectors())
+   {
+    fCorrelator->AddDiffParticle(binNo-1,dPhi,1.,pTrack->InRPSelection());
+    continue;
+   }
    // Calculate p-vector components:
    for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
    {
@@ -2104,6 +2148,20 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 
  } // for(Int_t t=0;t<nTracks;t++) // loop over all tracks
 
+ // Build all tables of the engine in one pass and copy the Q-vector components used by the rest of this class:
+ if(fCorrelator)
+ {
+  fCorrelator->Fill();
+  for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+  {
+   for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
+   {
+    AliFlowMultiparticleCorrelator::Complex_t qv = fCorrelator->Q(h,wp);
+    fQvector[h][wp] = TComplex(qv.real(),qv.imag());
+   }
+  }
+ } // if(fCorrelator)
+
 } // void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimple *anEvent)
 
 //=======================================================================================================================
@@ -2641,10 +2699,10 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
  // Book all the stuff for Q-vector.
 
  // a) Book the profile holding all the flags for Q-vector;
- // ...
+ // b) Create the correlator engine.
 
  // a) Book the profile holding all the flags for Q-vector:
- fQvectorFlagsPro = new TProfile("fQvectorFlagsPro","Flags for Q-vectors",2,0,2);
+ fQvectorFlagsPro = new TProfile("fQvectorFlagsPro","Flags for Q-vectors",3,0,3);
  fQvectorFlagsPro->SetTickLength(-0.01,"Y");
  fQvectorFlagsPro->SetMarkerStyle(25);
  fQvectorFlagsPro->SetLabelSize(0.03);
@@ -2654,9 +2712,15 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
  fQvectorFlagsPro->SetLineColor(kBlack);
  fQvectorFlagsPro->GetXaxis()->SetBinLabel(1,"fCalculateQvector"); fQvectorFlagsPro->Fill(0.5,fCalculateQvector); 
  fQvectorFlagsPro->GetXaxis()->SetBinLabel(2,"fCalculateDiffQvectors"); fQvectorFlagsPro->Fill(1.5,fCalculateDiffQvectors); 
+ fQvectorFlagsPro->GetXaxis()->SetBinLabel(3,"fUseCorrelatorEngine"); fQvectorFlagsPro->Fill(2.5,fUseCorrelatorEngine); 
  fQvectorList->Add(fQvectorFlagsPro);
 
- // ...
+ // b) Create the correlator engine:
+ if(fUseCorrelatorEngine)
+ {
+  delete fCorrelator;
+  fCorrelator = new AliFlowMultiparticleCorrelator(fMaxHarmonic,fMaxCorrelator,100); // TBI hardwired 100, as for fpvector
+ }
 
 } // void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
 
@@ -3535,6 +3599,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::GetPointersForQvector()
  // c) Set again all flags:
  fCalculateQvector = (Bool_t)fQvectorFlagsPro->GetBinContent(1);
  fCalculateDiffQvectors = (Bool_t)fQvectorFlagsPro->GetBinContent(2);
+ fUseCorrelatorEngine = (Bool_t)fQvectorFlagsPro->GetBinContent(3);
 
 } // void AliFlowAnalysisWithMultiparticleCorrelations::GetPointersForQvector()
 
@@ -3862,6 +3927,8 @@ void AliFlowAnalysisWithMultiparticleCorrelations::ResetQvector()
 {
  // Reset all Q-vector components to zero before starting a new event. 
 
+ if(fCorrelator){fCorrelator->Reset();}
+
  for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++) 
  {
   for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight powe
@@ -5118,6 +5185,25 @@ TComplex AliFlowAnalysisWithMultiparticleCorrelations::FourDiff(Int_t n1, Int_t
 
 //=======================================================================================================================
 
+Bool_t AliFlowAnalysisWithMultiparticleCorrelations::UseEngineForDiffQvectors() const
+{
+ // p- and q-vectors are taken from the engine only without weights, since q() remaps the
+ // weight power when weights are used only for RPs or only for POIs.
+
+ if(!fCorrelator || !fCalculateDiffQvectors){return kFALSE;}
+ for(Int_t rp=0;rp<2;rp++) // [RP,POI]
+ {
+  for(Int_t ppe=0;ppe<3;ppe++) // [phi,pt,eta]
+  {
+   if(fUseWeights[rp][ppe]){return kFALSE;}
+  }
+ }
+ return kTRUE;
+
+} // Bool_t AliFlowAnalysisWithMultiparticleCorrelations::UseEngineForDiffQvectors() const
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithMultiparticleCorrelations::SetDiffHarmonics(Int_t order, Int_t *harmonics)
 {
  // Set harmonics for all differential correlators. 
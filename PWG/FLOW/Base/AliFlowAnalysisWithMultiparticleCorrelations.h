@@ -31,6 +31,8 @@
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
 
+class AliFlowMultiparticleCorrelator;
+
 class AliFlowAnalysisWithMultiparticleCorrelations{
  public:
   AliFlowAnalysisWithMultiparticleCorrelations();
@@ -160,6 +162,8 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t GetCalculateQvector() const {return this->fCalculateQvector;};
   void SetCalculateDiffQvectors(Bool_t cdqv) {this->fCalculateDiffQvectors = cdqv;};
   Bool_t GetCalculateDiffQvectors() const {return this->fCalculateDiffQvectors;};
+  void SetUseCorrelatorEngine(Bool_t uce) {this->fUseCorrelatorEngine = uce;};
+  Bool_t GetUseCorrelatorEngine() const {return this->fUseCorrelatorEngine;};
 
   //  5.3.) Correlations:
   void SetCorrelationsList(TList* const cl) {this->fCorrelationsList = cl;};
@@ -311,6 +315,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   virtual TComplex TwoDiff(Int_t n1, Int_t n2);
   virtual TComplex ThreeDiff(Int_t n1, Int_t n2, Int_t n3);
   virtual TComplex FourDiff(Int_t n1, Int_t n2, Int_t n3, Int_t n4);
+  virtual Bool_t UseEngineForDiffQvectors() const;
   virtual Double_t Weight(const Double_t &value, const char *type, const char *variable); // value, [RP,POI], [phi,pt,eta]
   virtual Double_t CastStringToCorrelation(const char *string, Bool_t numerator);
   virtual Double_t Covariance(const char *x, const char *y, TProfile2D *profile2D, Bool_t bUnbiasedEstimator = kFALSE);
@@ -385,6 +390,8 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateDiffQvectors; // to calculate or not to calculate p- and q-vector components, that's a Boolean...  
   TComplex fpvector[100][49][9]; // p-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
   TComplex fqvector[100][49][9]; // q-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
+  Bool_t fUseCorrelatorEngine;   // fill Q-, p- and q-vectors and evaluate correlators with AliFlowMultiparticleCorrelator
+  AliFlowMultiparticleCorrelator *fCorrelator; //! the engine itself (created in Init())
 
   // 3.) Correlations:
   TList *fCorrelationsList;           // list to hold all correlations objects
@@ -476,7 +483,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Int_t fHighestHarmonicEtaGaps;      // 2-p correlations with eta gaps will be calculated for harmonics [fLowestHarmonicEtaGaps,fHighestHarmonicEtaGaps]
   TProfile *fEtaGapsPro[6];           // [harmonic] different eta gaps are different bins
 
-  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,6);
+  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,7);
 
 };
 
@@ -22,6 +22,8 @@
 
 #define AliFlowAnalysisWithQCumulants_cxx
 
+#include <algorithm>
+#include <vector>
 #include "Riostream.h"
 #include "AliFlowCommonConstants.h"
 #include "AliFlowCommonHist.h"
@@ -459,6 +461,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
        } // end of if(fCalculate2DDiffFlow)
       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     if(fCalculateDiffFlow){this->MarkOccupiedDiffFlowBins(0,ptEta);}
      // Checking if RP particle is also POI particle:      
      if(aftsTrack->InPOISelection())
      {
@@ -541,6 +544,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
       } // end of if(fCalculate2DDiffFlow)
      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+    if(fCalculateDiffFlow){this->MarkOccupiedDiffFlowBins(1,ptEta);}
    } // end of if(pTrack->InPOISelection())    
   } else // to if(aftsTrack)
     {
@@ -548,6 +552,15 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     }
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
+ // Occupied pt and eta bins are visited in increasing order by the differential flow kernels:
+ for(Int_t t=0;t<2;t++) // type: RP or POI
+ {
+  for(Int_t pe=0;pe<2;pe++) // pt or eta
+  {
+   std::sort(fDiffFlowOccupiedBins[t][pe].begin(),fDiffFlowOccupiedBins[t][pe].end());
+  }
+ } 
+
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
  for(Int_t p=0;p<8;p++)
  {
@@ -596,49 +609,49 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
   if(!(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights))
   {
    // Without using particle weights:
-   this->CalculateDiffFlowCorrelations("RP","Pt"); 
-   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelations("RP","Eta");}
-   this->CalculateDiffFlowCorrelations("POI","Pt");
-   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelations("POI","Eta");}
+   this->CalculateDiffFlowCorrelations(kRP,kPt); 
+   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelations(kRP,kEta);}
+   this->CalculateDiffFlowCorrelations(kPOI,kPt);
+   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelations(kPOI,kEta);}
    // Non-isotropic terms:
-   this->CalculateDiffFlowCorrectionsForNUASinTerms("RP","Pt");
-   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTerms("RP","Eta");}
-   this->CalculateDiffFlowCorrectionsForNUASinTerms("POI","Pt");
-   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTerms("POI","Eta");}
-   this->CalculateDiffFlowCorrectionsForNUACosTerms("RP","Pt");
-   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTerms("RP","Eta");}
-   this->CalculateDiffFlowCorrectionsForNUACosTerms("POI","Pt");
-   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTerms("POI","Eta");}   
+   this->CalculateDiffFlowCorrectionsForNUASinTerms(kRP,kPt);
+   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTerms(kRP,kEta);}
+   this->CalculateDiffFlowCorrectionsForNUASinTerms(kPOI,kPt);
+   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTerms(kPOI,kEta);}
+   this->CalculateDiffFlowCorrectionsForNUACosTerms(kRP,kPt);
+   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTerms(kRP,kEta);}
+   this->CalculateDiffFlowCorrectionsForNUACosTerms(kPOI,kPt);
+   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTerms(kPOI,kEta);}   
   } else // to if(!(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights))
     {
      // With using particle weights:   
-     this->CalculateDiffFlowCorrelationsUsingParticleWeights("RP","Pt"); 
-     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelationsUsingParticleWeights("RP","Eta");} 
-     this->CalculateDiffFlowCorrelationsUsingParticleWeights("POI","Pt"); 
-     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelationsUsingParticleWeights("POI","Eta");} 
+     this->CalculateDiffFlowCorrelationsUsingParticleWeights(kRP,kPt); 
+     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelationsUsingParticleWeights(kRP,kEta);} 
+     this->CalculateDiffFlowCorrelationsUsingParticleWeights(kPOI,kPt); 
+     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrelationsUsingParticleWeights(kPOI,kEta);} 
      // Non-isotropic terms:
-     this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("RP","Pt");
-     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("RP","Eta");}
-     this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("POI","Pt");
-     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("POI","Eta");}
-     this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("RP","Pt");
-     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("RP","Eta");}
-     this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("POI","Pt");
-     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("POI","Eta");}   
+     this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kRP,kPt);
+     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kRP,kEta);}
+     this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kPOI,kPt);
+     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kPOI,kEta);}
+     this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kRP,kPt);
+     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kRP,kEta);}
+     this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kPOI,kPt);
+     if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kPOI,kEta);}   
     }     
   // Whether or not using particle weights the following is calculated in the same way:  
-  this->CalculateDiffFlowProductOfCorrelations("RP","Pt");
-  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowProductOfCorrelations("RP","Eta");}
-  this->CalculateDiffFlowProductOfCorrelations("POI","Pt");
-  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowProductOfCorrelations("POI","Eta");}
-  this->CalculateDiffFlowSumOfEventWeights("RP","Pt");
-  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfEventWeights("RP","Eta");}
-  this->CalculateDiffFlowSumOfEventWeights("POI","Pt");
-  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfEventWeights("POI","Eta");}
-  this->CalculateDiffFlowSumOfProductOfEventWeights("RP","Pt");
-  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfProductOfEventWeights("RP","Eta");}
-  this->CalculateDiffFlowSumOfProductOfEventWeights("POI","Pt");
-  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfProductOfEventWeights("POI","Eta");}   
+  this->CalculateDiffFlowProductOfCorrelations(kRP,kPt);
+  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowProductOfCorrelations(kRP,kEta);}
+  this->CalculateDiffFlowProductOfCorrelations(kPOI,kPt);
+  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowProductOfCorrelations(kPOI,kEta);}
+  this->CalculateDiffFlowSumOfEventWeights(kRP,kPt);
+  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfEventWeights(kRP,kEta);}
+  this->CalculateDiffFlowSumOfEventWeights(kPOI,kPt);
+  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfEventWeights(kPOI,kEta);}
+  this->CalculateDiffFlowSumOfProductOfEventWeights(kRP,kPt);
+  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfProductOfEventWeights(kRP,kEta);}
+  this->CalculateDiffFlowSumOfProductOfEventWeights(kPOI,kPt);
+  if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowSumOfProductOfEventWeights(kPOI,kEta);}   
  } // end of if(!fEvaluateDiffFlowNestedLoops && fCalculateDiffFlow)
 
  // h) Call the methods which calculate correlations for 2D differential flow:
@@ -953,10 +966,10 @@ void AliFlowAnalysisWithQCumulants::EvaluateDiffFlowNestedLoops(AliFlowEventSimp
   {
    // 1.) Reduced correlations:
    //  Q-vectors:
-   this->CalculateDiffFlowCorrelations("RP","Pt");
-   this->CalculateDiffFlowCorrelations("RP","Eta");
-   this->CalculateDiffFlowCorrelations("POI","Pt");
-   this->CalculateDiffFlowCorrelations("POI","Eta");
+   this->CalculateDiffFlowCorrelations(kRP,kPt);
+   this->CalculateDiffFlowCorrelations(kRP,kEta);
+   this->CalculateDiffFlowCorrelations(kPOI,kPt);
+   this->CalculateDiffFlowCorrelations(kPOI,kEta);
    //  Nested loops:
    this->EvaluateDiffFlowCorrelationsWithNestedLoops(anEvent,"RP","Pt"); 
    this->EvaluateDiffFlowCorrelationsWithNestedLoops(anEvent,"RP","Eta"); 
@@ -964,14 +977,14 @@ void AliFlowAnalysisWithQCumulants::EvaluateDiffFlowNestedLoops(AliFlowEventSimp
    this->EvaluateDiffFlowCorrelationsWithNestedLoops(anEvent,"POI","Eta"); 
    // 2.) Reduced corrections for non-uniform acceptance:
    //  Q-vectors:
-   this->CalculateDiffFlowCorrectionsForNUASinTerms("RP","Pt");
-   this->CalculateDiffFlowCorrectionsForNUASinTerms("RP","Eta");
-   this->CalculateDiffFlowCorrectionsForNUASinTerms("POI","Pt");
-   this->CalculateDiffFlowCorrectionsForNUASinTerms("POI","Eta");
-   this->CalculateDiffFlowCorrectionsForNUACosTerms("RP","Pt");
-   this->CalculateDiffFlowCorrectionsForNUACosTerms("RP","Eta");
-   this->CalculateDiffFlowCorrectionsForNUACosTerms("POI","Pt");
-   this->CalculateDiffFlowCorrectionsForNUACosTerms("POI","Eta");
+   this->CalculateDiffFlowCorrectionsForNUASinTerms(kRP,kPt);
+   this->CalculateDiffFlowCorrectionsForNUASinTerms(kRP,kEta);
+   this->CalculateDiffFlowCorrectionsForNUASinTerms(kPOI,kPt);
+   this->CalculateDiffFlowCorrectionsForNUASinTerms(kPOI,kEta);
+   this->CalculateDiffFlowCorrectionsForNUACosTerms(kRP,kPt);
+   this->CalculateDiffFlowCorrectionsForNUACosTerms(kRP,kEta);
+   this->CalculateDiffFlowCorrectionsForNUACosTerms(kPOI,kPt);
+   this->CalculateDiffFlowCorrectionsForNUACosTerms(kPOI,kEta);
    //  Nested loops:
    this->EvaluateDiffFlowCorrectionTermsForNUAWithNestedLoops(anEvent,"RP","Pt");
    this->EvaluateDiffFlowCorrectionTermsForNUAWithNestedLoops(anEvent,"RP","Eta");
@@ -992,18 +1005,18 @@ void AliFlowAnalysisWithQCumulants::EvaluateDiffFlowNestedLoops(AliFlowEventSimp
   // Using particle weights:
   if(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights)
   {
-   this->CalculateDiffFlowCorrelationsUsingParticleWeights("RP","Pt"); 
-   this->CalculateDiffFlowCorrelationsUsingParticleWeights("RP","Eta"); 
-   this->CalculateDiffFlowCorrelationsUsingParticleWeights("POI","Pt"); 
-   this->CalculateDiffFlowCorrelationsUsingParticleWeights("POI","Eta"); 
-   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("RP","Pt");
-   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("RP","Eta");
-   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("POI","Pt");
-   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights("POI","Eta");
-   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("RP","Pt");
-   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("RP","Eta");
-   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("POI","Pt");
-   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights("POI","Eta");
+   this->CalculateDiffFlowCorrelationsUsingParticleWeights(kRP,kPt); 
+   this->CalculateDiffFlowCorrelationsUsingParticleWeights(kRP,kEta); 
+   this->CalculateDiffFlowCorrelationsUsingParticleWeights(kPOI,kPt); 
+   this->CalculateDiffFlowCorrelationsUsingParticleWeights(kPOI,kEta); 
+   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kRP,kPt);
+   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kRP,kEta);
+   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kPOI,kPt);
+   this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(kPOI,kEta);
+   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kRP,kPt);
+   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kRP,kEta);
+   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kPOI,kPt);
+   this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(kPOI,kEta);
    this->EvaluateDiffFlowCorrelationsWithNestedLoopsUsingParticleWeights(anEvent,"RP","Pt"); 
    this->EvaluateDiffFlowCorrelationsWithNestedLoopsUsingParticleWeights(anEvent,"RP","Eta");
    this->EvaluateDiffFlowCorrelationsWithNestedLoopsUsingParticleWeights(anEvent,"POI","Pt"); 
@@ -16549,217 +16562,151 @@ void AliFlowAnalysisWithQCumulants::CalculateIntFlowSumOfProductOfEventWeightsNU
 
 //=======================================================================================================================
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // Calculate reduced correlations for RPs or POIs for all pt and eta bins.
+ //
+ // Only the bins which received a particle in this event are visited (in an empty bin all
+ // denominators vanish). The reduced Q-vectors of these bins are first gathered into contiguous
+ // arrays, then <2'>, <4'> and their denominators are evaluated for all bins in a single pass.
 
  // Multiplicity:
  Double_t dMult = (*fSpk)(0,0);
- 
- // real and imaginary parts of non-weighted Q-vectors evaluated in harmonics n, 2n, 3n and 4n: 
+
+ // real and imaginary parts of non-weighted Q-vectors evaluated in harmonics n and 2n:
  Double_t dReQ1n = (*fReQ)(0,0);
  Double_t dReQ2n = (*fReQ)(1,0);
- //Double_t dReQ3n = (*fReQ)(2,0);
- //Double_t dReQ4n = (*fReQ)(3,0);
  Double_t dImQ1n = (*fImQ)(0,0);
  Double_t dImQ2n = (*fImQ)(1,0);
- //Double_t dImQ3n = (*fImQ)(2,0);
- //Double_t dImQ4n = (*fImQ)(3,0);
 
  // reduced correlations are stored in fDiffFlowCorrelationsPro[0=RP,1=POI][0=pt,1=eta][correlation index]. Correlation index runs as follows:
- // 
+ //
  // 0: <<2'>>
  // 1: <<4'>>
  // 2: <<6'>>
  // 3: <<8'>>
- 
- //Int_t t = 0; // type flag 
- Int_t pe = 0; // ptEta flag
- 
- if(type == "RP")
- {
-  //t = 0;
- } else if(type == "POI")
-   {
-    //t = 1;
-   }
 
- if(ptOrEta == "Pt")
- {
-  pe = 0;
- } else if(ptOrEta == "Eta")
-   {
-    pe = 1;
-   }
-    
- Int_t nBinsPtEta[2] = {fnBinsPt,fnBinsEta};
+ Int_t t = type; // type flag
+ Int_t pe = ptOrEta; // ptEta flag
+ Int_t tq = (type == kPOI) ? 2 : 0; // q-vector: particles which are both RPs and POIs (for RPs p = q)
+
  Double_t minPtEta[2] = {fPtMin,fEtaMin};
- //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
 
- // looping over all bins and calculating reduced correlations: 
- for(Int_t b=1;b<=nBinsPtEta[pe];b++)
- {
-  // real and imaginary parts of p_{m*n,0} (non-weighted Q-vector evaluated for POIs in particular pt or eta bin): 
-  Double_t p1n0kRe = 0.;
-  Double_t p1n0kIm = 0.;
+ const std::vector<Int_t> &occupiedBins = fDiffFlowOccupiedBins[t][pe];
+ Int_t nOcc = occupiedBins.size();
+ if(0 == nOcc){return;}
+
+ // multiplicity weight (the same for all bins):
+ Int_t mWeightFlag = 0; // 0 = not set, 1 = combinations, 2 = unit
+ if(fMultiplicityWeight->Contains("combinations")){mWeightFlag = 1;}
+ else if(fMultiplicityWeight->Contains("unit")){mWeightFlag = 2;}
+
+ // a) Gather p_{n,0}, q_{n,0}, q_{2n,0}, mp and mq of the occupied bins into contiguous arrays:
+ fDiffFlowReducedQ.resize(12*nOcc);
+ Double_t *p1n0kRe = &fDiffFlowReducedQ[0];
+ Double_t *p1n0kIm = p1n0kRe + nOcc;
+ Double_t *q1n0kRe = p1n0kIm + nOcc;
+ Double_t *q1n0kIm = q1n0kRe + nOcc;
+ Double_t *q2n0kRe = q1n0kIm + nOcc;
+ Double_t *q2n0kIm = q2n0kRe + nOcc;
+ Double_t *mp = q2n0kIm + nOcc; // number of POIs in particular pt or eta bin
+ Double_t *mq = mp + nOcc; // number of particles which are both RPs and POIs in particular pt or eta bin
+ Double_t *two = mq + nOcc;
+ Double_t *den2 = two + nOcc;
+ Double_t *four = den2 + nOcc;
+ Double_t *den4 = four + nOcc;
+
+ TProfile *reP1n = fReRPQ1dEBE[t][pe][0][0];
+ TProfile *imP1n = fImRPQ1dEBE[t][pe][0][0];
+ TProfile *reQ1n = fReRPQ1dEBE[tq][pe][0][0];
+ TProfile *imQ1n = fImRPQ1dEBE[tq][pe][0][0];
+ TProfile *reQ2n = fReRPQ1dEBE[tq][pe][1][0];
+ TProfile *imQ2n = fImRPQ1dEBE[tq][pe][1][0];
+ for(Int_t i=0;i<nOcc;i++)
+ {
+  Int_t b = occupiedBins[i];
+  p1n0kRe[i] = reP1n->GetBinContent(b)*reP1n->GetBinEntries(b);
+  p1n0kIm[i] = imP1n->GetBinContent(b)*imP1n->GetBinEntries(b);
+  q1n0kRe[i] = reQ1n->GetBinContent(b)*reQ1n->GetBinEntries(b);
+  q1n0kIm[i] = imQ1n->GetBinContent(b)*imQ1n->GetBinEntries(b);
+  q2n0kRe[i] = reQ2n->GetBinContent(b)*reQ2n->GetBinEntries(b);
+  q2n0kIm[i] = imQ2n->GetBinContent(b)*imQ2n->GetBinEntries(b);
+  mp[i] = reP1n->GetBinEntries(b);
+  mq[i] = reQ1n->GetBinEntries(b);
+ } // end of for(Int_t i=0;i<nOcc;i++)
+
+ // b) Evaluate <2'> and <4'> for all occupied bins in one pass (event-level terms are hoisted):
+ Double_t dQ1nSq = pow(dReQ1n,2.)+pow(dImQ1n,2.); // |Q_n|^2
+ Double_t dReQ1nQ1n = pow(dReQ1n,2.)-pow(dImQ1n,2.); // Re[Q_n Q_n]
+ Double_t dImQ1nQ1n = 2.*dReQ1n*dImQ1n; // Im[Q_n Q_n]
+ Double_t dReQ1nQ2nStar = dReQ1n*dReQ2n+dImQ1n*dImQ2n; // Re[Q_n Q_2n^*]
+ Double_t dImQ1nQ2nStar = dImQ1n*dReQ2n-dReQ1n*dImQ2n; // Im[Q_n Q_2n^*]
+ Double_t dComb3 = dMult*(dMult-1.)*(dMult-2.);
+ Double_t dComb3Shifted = (dMult-1.)*(dMult-2.)*(dMult-3.);
+ for(Int_t i=0;i<nOcc;i++)
+ {
+  Double_t pQ = p1n0kRe[i]*dReQ1n+p1n0kIm[i]*dImQ1n; // Re[p_n Q_n^*]
+  // 2'-particle correlation:
+  den2[i] = mp[i]*dMult-mq[i];
+  two[i] = den2[i] ? (pQ-mq[i])/den2[i] : 0.;
+  // 4'-particle correlation:
+  den4[i] = (mp[i]-mq[i])*dComb3+mq[i]*dComb3Shifted;
+  four[i] = den4[i] ? (dQ1nSq*pQ
+                    - q2n0kRe[i]*dReQ1nQ1n
+                    - q2n0kIm[i]*dImQ1nQ1n
+                    - p1n0kRe[i]*dReQ1nQ2nStar
+                    + p1n0kIm[i]*dImQ1nQ2nStar
+                    - 2.*dMult*pQ
+                    - 2.*dQ1nSq*mq[i]
+                    + 6.*(q1n0kRe[i]*dReQ1n+q1n0kIm[i]*dImQ1n)
+                    + 1.*(q2n0kRe[i]*dReQ2n+q2n0kIm[i]*dImQ2n)
+                    + 2.*pQ
+                    + 2.*mq[i]*dMult
+                    - 6.*mq[i])
+                    / den4[i] : 0.;
+ } // end of for(Int_t i=0;i<nOcc;i++)
+
+ // c) Fill profiles and e-b-e histograms:
+ for(Int_t i=0;i<nOcc;i++)
+ {
+  Int_t b = occupiedBins[i];
+  Double_t dPtEta = minPtEta[pe]+(b-1)*binWidthPtEta[pe];
+  if(den2[i])
+  {
+   Double_t mWeight2pPrime = (1 == mWeightFlag) ? den2[i] : ((2 == mWeightFlag) ? 1. : 0.); // multiplicity weight for <2'>
+   // profile to get <<2'>>:
+   fDiffFlowCorrelationsPro[t][pe][0]->Fill(dPtEta,two[i],mWeight2pPrime);
+   // profile to get <<2'>^2>:
+   fDiffFlowSquaredCorrelationsPro[t][pe][0]->Fill(dPtEta,two[i]*two[i],mWeight2pPrime);
+   // histogram to store <2'> e-b-e (needed in some other methods):
+   fDiffFlowCorrelationsEBE[t][pe][0]->SetBinContent(b,two[i]);
+   fDiffFlowEventWeightsForCorrelationsEBE[t][pe][0]->SetBinContent(b,mWeight2pPrime);
+  } // end of if(den2[i])
+  if(den4[i])
+  {
+   Double_t mWeight4pPrime = (1 == mWeightFlag) ? den4[i] : ((2 == mWeightFlag) ? 1. : 0.); // multiplicity weight for <4'>
+   // profile to get <<4'>>:
+   fDiffFlowCorrelationsPro[t][pe][1]->Fill(dPtEta,four[i],mWeight4pPrime);
+   // profile to get <<4'>^2>:
+   fDiffFlowSquaredCorrelationsPro[t][pe][1]->Fill(dPtEta,four[i]*four[i],mWeight4pPrime);
+   // histogram to store <4'> e-b-e (needed in some other methods):
+   fDiffFlowCorrelationsEBE[t][pe][1]->SetBinContent(b,four[i]);
+   fDiffFlowEventWeightsForCorrelationsEBE[t][pe][1]->SetBinContent(b,mWeight4pPrime);
+  } // end of if(den4[i])
+ } // end of for(Int_t i=0;i<nOcc;i++)
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(EDiffFlowType type, EDiffFlowVariable ptOrEta);
 
-  // number of POIs in particular pt or eta bin:
-  Double_t mp = 0.;
+//=======================================================================================================================
 
-  // real and imaginary parts of q_{m*n,0} (non-weighted Q-vector evaluated for particles which are both RPs and POIs in particular pt or eta bin):
-  Double_t q1n0kRe = 0.;
-  Double_t q1n0kIm = 0.;
-  Double_t q2n0kRe = 0.;
-  Double_t q2n0kIm = 0.;
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
 
-  // number of particles which are both RPs and POIs in particular pt or eta bin:
-  Double_t mq = 0.;
-   
-  if(type == "POI")
-  {
-   // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));         
-                 
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
-  } 
-  else if(type == "RP")
-  {
-   // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
-                 
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
-  }
-      
-   if(type == "POI")
-   {
-    // p_{m*n,0}:
-    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-            * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-    p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-            * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
-            
-    mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
-    
-    //t = 1; // typeFlag = RP or POI
-   }
-   else if(type == "RP")
-   {
-    // p_{m*n,0} = q_{m*n,0}:
-    p1n0kRe = q1n0kRe; 
-    p1n0kIm = q1n0kIm; 
-            
-    mp = mq; 
-    
-    //t = 0; // typeFlag = RP or POI
-   }
-      
-   // 2'-particle correlation for particular pt or eta bin:
-   Double_t two1n1nPtEta = 0.;
-   Double_t mWeight2pPrime = 0.; // multiplicity weight for <2'>
-   if(mp*dMult-mq)
-   {
-    two1n1nPtEta = (p1n0kRe*dReQ1n+p1n0kIm*dImQ1n-mq)
-                 / (mp*dMult-mq);
-    // determine multiplicity weight:
-    if(fMultiplicityWeight->Contains("combinations"))
-    {
-     mWeight2pPrime = mp*dMult-mq;
-    } else if(fMultiplicityWeight->Contains("unit"))
-      {
-       mWeight2pPrime = 1.;    
-      } 
-    if(type == "POI") // to be improved (I do not this if)
-    { 
-     // fill profile to get <<2'>> for POIs
-     fDiffFlowCorrelationsPro[1][pe][0]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],two1n1nPtEta,mWeight2pPrime);
-     // fill profile to get <<2'>^2> for POIs
-     fDiffFlowSquaredCorrelationsPro[1][pe][0]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],two1n1nPtEta*two1n1nPtEta,mWeight2pPrime);   
-     // histogram to store <2'> for POIs e-b-e (needed in some other methods):
-     fDiffFlowCorrelationsEBE[1][pe][0]->SetBinContent(b,two1n1nPtEta);      
-     fDiffFlowEventWeightsForCorrelationsEBE[1][pe][0]->SetBinContent(b,mWeight2pPrime);      
-    }
-    else if(type == "RP") // to be improved (I do not this if)
-    {
-     // profile to get <<2'>> for RPs:
-     fDiffFlowCorrelationsPro[0][pe][0]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],two1n1nPtEta,mWeight2pPrime);     
-     // profile to get <<2'>^2> for RPs:
-     fDiffFlowSquaredCorrelationsPro[0][pe][0]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],two1n1nPtEta*two1n1nPtEta,mWeight2pPrime);          
-     // histogram to store <2'> for RPs e-b-e (needed in some other methods):
-     fDiffFlowCorrelationsEBE[0][pe][0]->SetBinContent(b,two1n1nPtEta); 
-     fDiffFlowEventWeightsForCorrelationsEBE[0][pe][0]->SetBinContent(b,mWeight2pPrime); 
-    }
-   } // end of if(mp*dMult-mq)
-  
-   // 4'-particle correlation:
-   Double_t four1n1n1n1nPtEta = 0.;
-   Double_t mWeight4pPrime = 0.; // multiplicity weight for <4'>
-   if((mp-mq)*dMult*(dMult-1.)*(dMult-2.)
-       + mq*(dMult-1.)*(dMult-2.)*(dMult-3.)) // to be improved (introduce a new variable for this expression)
-   {
-    four1n1n1n1nPtEta = ((pow(dReQ1n,2.)+pow(dImQ1n,2.))*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)
-                      - q2n0kRe*(pow(dReQ1n,2.)-pow(dImQ1n,2.))
-                      - 2.*q2n0kIm*dReQ1n*dImQ1n
-                      - p1n0kRe*(dReQ1n*dReQ2n+dImQ1n*dImQ2n)
-                      + p1n0kIm*(dImQ1n*dReQ2n-dReQ1n*dImQ2n)
-                      - 2.*dMult*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)
-                      - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*mq                      
-                      + 6.*(q1n0kRe*dReQ1n+q1n0kIm*dImQ1n)                                            
-                      + 1.*(q2n0kRe*dReQ2n+q2n0kIm*dImQ2n)                      
-                      + 2.*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)                       
-                      + 2.*mq*dMult                      
-                      - 6.*mq)        
-                      / ((mp-mq)*dMult*(dMult-1.)*(dMult-2.)
-                          + mq*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-    // determine multiplicity weight:
-    if(fMultiplicityWeight->Contains("combinations"))
-    {
-     mWeight4pPrime = (mp-mq)*dMult*(dMult-1.)*(dMult-2.) + mq*(dMult-1.)*(dMult-2.)*(dMult-3.);
-    } else if(fMultiplicityWeight->Contains("unit"))
-      {
-       mWeight4pPrime = 1.;    
-      }     
-    if(type == "POI")
-    {
-     // profile to get <<4'>> for POIs:
-     fDiffFlowCorrelationsPro[1][pe][1]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],four1n1n1n1nPtEta,mWeight4pPrime);      
-     // profile to get <<4'>^2> for POIs:
-     fDiffFlowSquaredCorrelationsPro[1][pe][1]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],four1n1n1n1nPtEta*four1n1n1n1nPtEta,mWeight4pPrime); 
-     // histogram to store <4'> for POIs e-b-e (needed in some other methods):
-     fDiffFlowCorrelationsEBE[1][pe][1]->SetBinContent(b,four1n1n1n1nPtEta);                               
-     fDiffFlowEventWeightsForCorrelationsEBE[1][pe][1]->SetBinContent(b,mWeight4pPrime);                               
-    }
-    else if(type == "RP")
-    {
-     // profile to get <<4'>> for RPs:
-     fDiffFlowCorrelationsPro[0][pe][1]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],four1n1n1n1nPtEta,mWeight4pPrime);    
-     // profile to get <<4'>^2> for RPs:
-     fDiffFlowSquaredCorrelationsPro[0][pe][1]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],four1n1n1n1nPtEta*four1n1n1n1nPtEta,mWeight4pPrime);    
-     // histogram to store <4'> for RPs e-b-e (needed in some other methods):
-     fDiffFlowCorrelationsEBE[0][pe][1]->SetBinContent(b,four1n1n1n1nPtEta);                   
-     fDiffFlowEventWeightsForCorrelationsEBE[0][pe][1]->SetBinContent(b,mWeight4pPrime);                   
-    }
-   } // end of if((mp-mq)*dMult*(dMult-1.)*(dMult-2.)
-     //            +mq*(dMult-1.)*(dMult-2.)*(dMult-3.))
-   
- } // end of for(Int_t b=1;b<=nBinsPtEta[pe];b++)
- 
-   
-} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(TString type, TString ptOrEta);
+ this->CalculateDiffFlowCorrelations(DiffFlowType(type),DiffFlowVariable(ptOrEta));
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(TString type, TString ptOrEta)
 
 //=======================================================================================================================
 
@@ -17078,7 +17025,7 @@ void AliFlowAnalysisWithQCumulants::Calculate2DDiffFlowCorrelations(TString type
 
 //=======================================================================================================================
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // Calculate sums of various event weights for reduced correlations. 
  // (These quantitites are needed in expressions for unbiased estimators relevant for the statistical errors.)
@@ -17086,18 +17033,18 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString t
  Int_t typeFlag = 0;
  Int_t ptEtaFlag = 0;
 
- if(type == "RP")
+ if(type == kRP)
  {
   typeFlag = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     typeFlag = 1;
    } 
      
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   ptEtaFlag = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     ptEtaFlag = 1;
    } 
@@ -17146,11 +17093,11 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString t
  // looping over bins:
  for(Int_t b=1;b<=nBinsPtEta[pe];b++)
  {
-  if(type == "RP")
+  if(type == kRP)
   {
    mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
-  } else if(type == "POI")
+  } else if(type == kPOI)
     {
      mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
      mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
@@ -17180,11 +17127,21 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString t
  
 } // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights()
 
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowSumOfEventWeights(DiffFlowType(type),DiffFlowVariable(ptOrEta));
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString type, TString ptOrEta)
+
 
 //=======================================================================================================================
 
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // Calculate sum of products of various event weights for both types of correlations (the ones for int. and diff. flow). 
  // (These quantitites are needed in expressions for unbiased estimators relevant for the statistical errors.)
@@ -17198,18 +17155,18 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
  Int_t typeFlag = 0;
  Int_t ptEtaFlag = 0;
 
- if(type == "RP")
+ if(type == kRP)
  {
   typeFlag = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     typeFlag = 1;
    } 
      
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   ptEtaFlag = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     ptEtaFlag = 1;
    } 
@@ -17265,11 +17222,11 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
  // looping over bins:
  for(Int_t b=1;b<=nBinsPtEta[pe];b++)
  {
-  if(type == "RP")
+  if(type == kRP)
   {
    mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
-  } else if(type == "POI")
+  } else if(type == kPOI)
     {
      mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
      mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
@@ -17318,6 +17275,16 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
  
 
 
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowSumOfProductOfEventWeights(DiffFlowType(type),DiffFlowVariable(ptOrEta));
+
 } // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(TString type, TString ptOrEta)
 
 //=======================================================================================================================
@@ -17426,7 +17393,7 @@ void AliFlowAnalysisWithQCumulants::FinalizeReducedCorrelations(TString type, TS
 
 //=======================================================================================================================
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // store products: <2><2'>, <2><4'>, <2><6'>, <2><8'>, <2'><4>, 
  //                 <2'><4'>, <2'><6>, <2'><6'>, <2'><8>, <2'><8'>,
@@ -17437,18 +17404,18 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TStri
  Int_t typeFlag = 0;
  Int_t ptEtaFlag = 0;
 
- if(type == "RP")
+ if(type == kRP)
  {
   typeFlag = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     typeFlag = 1;
    } 
      
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   ptEtaFlag = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     ptEtaFlag = 1;
    } 
@@ -17511,11 +17478,11 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TStri
   
   /*
   // to be improved (I should not do this here again)
-  if(type == "RP")
+  if(type == kRP)
   {
    mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
-  } else if(type == "POI")
+  } else if(type == kPOI)
     {
      mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
      mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
@@ -17567,6 +17534,16 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TStri
   //fDiffFlowProductOfCorrelationsPro[t][pe][6][7]->Fill(minPtEta[pe]+(b-1)*binWidthPtEta[pe],eightEBE*eightReducedEBE,dW8*dw8); // storing <8><8'> 
  } // end of for(Int_t b=1;b<=nBinsPtEta[pe];b++       
      
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(EDiffFlowType type, EDiffFlowVariable ptOrEta)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowProductOfCorrelations(DiffFlowType(type),DiffFlowVariable(ptOrEta));
+
 } // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TString type, TString ptOrEta)
 
 //=======================================================================================================================
@@ -20757,30 +20734,29 @@ void AliFlowAnalysisWithQCumulants::StoreHarmonic()
 
 //=======================================================================================================================
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWeights(TString type, TString ptOrEta) // type = RP or POI 
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta) // type = RP or POI 
 {
  // Calculate all correlations needed for differential flow using particle weights.
  
  Int_t t = 0; // type flag 
  Int_t pe = 0; // ptEta flag
  
- if(type == "RP")
+ if(type == kRP)
  {
   t = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     t = 1;
    }
 
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   pe = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     pe = 1;
    }
     
- Int_t nBinsPtEta[2] = {fnBinsPt,fnBinsEta};
  Double_t minPtEta[2] = {fPtMin,fEtaMin};
  //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
@@ -20803,8 +20779,10 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
  Double_t dSM3p1k = (*fSpk)(2,1);
  
  // looping over all bins and calculating reduced correlations: 
- for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ const std::vector<Int_t> &occupiedBins = fDiffFlowOccupiedBins[t][pe]; // empty bins do not contribute
+ for(UInt_t ob=0;ob<occupiedBins.size();ob++)
  {
+  Int_t b = occupiedBins[ob];
   // real and imaginary parts of p_{m*n,0} (non-weighted Q-vector evaluated for POIs in particular (pt,eta) bin):  
   Double_t p1n0kRe = 0.;
   Double_t p1n0kIm = 0.;
@@ -20827,7 +20805,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
   // M0111 from Eq. (118) in QC2c (to be improved (notation))
   Double_t dM0111 = 0.;
  
-  if(type == "POI")
+  if(type == kPOI)
   {
    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
            * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
@@ -20858,7 +20836,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
           - 3.*(s1p1k*(dSM2p1k-dSM1p2k)
           + 2.*(s1p3k-s1p2k*dSM1p1k));
   }
-   else if(type == "RP")
+   else if(type == kRP)
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
     q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
@@ -20934,9 +20912,19 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
     fDiffFlowCorrelationsEBE[t][pe][1]->SetBinContent(b,four1n1n1n1nW0W1W1W1);      
     fDiffFlowEventWeightsForCorrelationsEBE[t][pe][1]->SetBinContent(b,dM0111);      
    } // end of if(dM0111)
- } // end of for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ } // end of for(UInt_t ob=0;ob<occupiedBins.size();ob++)
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta); // type = RP or POI 
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWeights(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowCorrelationsUsingParticleWeights(DiffFlowType(type),DiffFlowVariable(ptOrEta));
 
-} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWeights(TString type, TString ptOrEta); // type = RP or POI 
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWeights(TString type, TString ptOrEta)
 
 //=======================================================================================================================
 
@@ -21057,6 +21045,18 @@ void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities()
     }
    }      
   }
+  // occupied bins (only the touched entries of the occupancy mask are cleared):
+  for(Int_t t=0;t<2;t++) // type (0 = RP, 1 = POI)
+  {  
+   for(Int_t pe=0;pe<2;pe++) // pt or eta
+   {
+    for(UInt_t ob=0;ob<fDiffFlowOccupiedBins[t][pe].size();ob++)
+    {
+     fDiffFlowOccupancy[t][pe][fDiffFlowOccupiedBins[t][pe][ob]] = kFALSE;
+    }
+    fDiffFlowOccupiedBins[t][pe].clear();
+   }
+  }
  } // end of if(fCalculateDiffFlow)   
 
  // 2D (pt,eta)
@@ -21086,7 +21086,29 @@ void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities()
 
 //=======================================================================================================================
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::MarkOccupiedDiffFlowBins(Int_t t, Double_t *ptEta)
+{
+ // Record the pt and eta bins of fReRPQ1dEBE[t] filled by the current particle (t = 0 for RP, 1 for POI).
+ // Bins of RP&&POI particles are a subset of POI bins, so they are not recorded separately.
+ 
+ for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+ {
+  TProfile *profile = fReRPQ1dEBE[t][pe][0][0];
+  if(!profile){continue;}
+  Int_t nBins = profile->GetNbinsX();
+  Int_t b = profile->FindFixBin(ptEta[pe]);
+  if(b<1 || b>nBins){continue;} // underflow and overflow are not used in differential flow
+  if((Int_t)fDiffFlowOccupancy[t][pe].size()<nBins+1){fDiffFlowOccupancy[t][pe].resize(nBins+1,kFALSE);}
+  if(fDiffFlowOccupancy[t][pe][b]){continue;}
+  fDiffFlowOccupancy[t][pe][b] = kTRUE;
+  fDiffFlowOccupiedBins[t][pe].push_back(b);
+ } // end of for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+
+} // end of void AliFlowAnalysisWithQCumulants::MarkOccupiedDiffFlowBins(Int_t t, Double_t *ptEta)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // Calculate correction terms for non-uniform acceptance for differential flow (sin terms).
  
@@ -21115,30 +21137,31 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
  Int_t t = 0; // type flag 
  Int_t pe = 0; // ptEta flag
  
- if(type == "RP")
+ if(type == kRP)
  {
   t = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     t = 1;
    }
 
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   pe = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     pe = 1;
    }
     
- Int_t nBinsPtEta[2] = {fnBinsPt,fnBinsEta};
  Double_t minPtEta[2] = {fPtMin,fEtaMin};
  //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
 
  // looping over all bins and calculating correction terms: 
- for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ const std::vector<Int_t> &occupiedBins = fDiffFlowOccupiedBins[t][pe]; // empty bins do not contribute
+ for(UInt_t ob=0;ob<occupiedBins.size();ob++)
  {
+  Int_t b = occupiedBins[ob];
   // real and imaginary parts of p_{m*n,0} (non-weighted Q-vector evaluated for POIs in particular pt or eta bin): 
   Double_t p1n0kRe = 0.;
   Double_t p1n0kIm = 0.;
@@ -21155,7 +21178,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
   // number of particles which are both RPs and POIs in particular pt or eta bin:
   Double_t mq = 0.;
    
-  if(type == "POI")
+  if(type == kPOI)
   {
    // q_{m*n,0}:
    q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
@@ -21169,7 +21192,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
                  
    mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
   } 
-  else if(type == "RP")
+  else if(type == kRP)
   {
    // q_{m*n,0}:
    q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
@@ -21183,7 +21206,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
                  
    mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
   }    
-  if(type == "POI")
+  if(type == kPOI)
   {
    // p_{m*n,0}:
    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
@@ -21195,7 +21218,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
     
    t = 1; // typeFlag = RP or POI
   }
-  else if(type == "RP")
+  else if(type == kRP)
   {
    // p_{m*n,0} = q_{m*n,0}:
    p1n0kRe = q1n0kRe; 
@@ -21255,15 +21278,25 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
    // histogram to store <sin n(psi1+phi2)> e-b-e (needed in some other methods):
    fDiffFlowCorrectionTermsForNUAEBE[t][pe][0][3]->SetBinContent(b,sinP1nPsi1M1nPhi2MPhi3);
   } // end of if(mq*(dMult-1.)*(dMult-2.)+(mp-mq)*dMult*(dMult-1.))   
- } // end of for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ } // end of for(UInt_t ob=0;ob<occupiedBins.size();ob++)
  
-} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(TString type, TString ptOrEta)
+} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(EDiffFlowType type, EDiffFlowVariable ptOrEta)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowCorrectionsForNUASinTerms(DiffFlowType(type),DiffFlowVariable(ptOrEta));
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(TString type, TString ptOrEta)
 
 
 //=======================================================================================================================
 
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // Calculate correction terms for non-uniform acceptance for differential flow (cos terms).
  
@@ -21292,30 +21325,31 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
  Int_t t = 0; // type flag 
  Int_t pe = 0; // ptEta flag
  
- if(type == "RP")
+ if(type == kRP)
  {
   t = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     t = 1;
    }
 
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   pe = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     pe = 1;
    }
     
- Int_t nBinsPtEta[2] = {fnBinsPt,fnBinsEta};
  Double_t minPtEta[2] = {fPtMin,fEtaMin};
  //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
 
  // looping over all bins and calculating correction terms: 
- for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ const std::vector<Int_t> &occupiedBins = fDiffFlowOccupiedBins[t][pe]; // empty bins do not contribute
+ for(UInt_t ob=0;ob<occupiedBins.size();ob++)
  {
+  Int_t b = occupiedBins[ob];
   // real and imaginary parts of p_{m*n,0} (non-weighted Q-vector evaluated for POIs in particular pt or eta bin): 
   Double_t p1n0kRe = 0.;
   Double_t p1n0kIm = 0.;
@@ -21332,7 +21366,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
   // number of particles which are both RPs and POIs in particular pt or eta bin:
   Double_t mq = 0.;
    
-  if(type == "POI")
+  if(type == kPOI)
   {
    // q_{m*n,0}:
    q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
@@ -21346,7 +21380,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
                  
    mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
   } 
-  else if(type == "RP")
+  else if(type == kRP)
   {
    // q_{m*n,0}:
    q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
@@ -21360,7 +21394,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
                  
    mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
   }    
-  if(type == "POI")
+  if(type == kPOI)
   {
    // p_{m*n,0}:
    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
@@ -21372,7 +21406,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
     
    t = 1; // typeFlag = RP or POI
   }
-  else if(type == "RP")
+  else if(type == kRP)
   {
    // p_{m*n,0} = q_{m*n,0}:
    p1n0kRe = q1n0kRe; 
@@ -21433,9 +21467,19 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
    // histogram to store <sin n(psi1+phi2)> e-b-e (needed in some other methods):
    fDiffFlowCorrectionTermsForNUAEBE[t][pe][1][3]->SetBinContent(b,cosP1nPsi1M1nPhi2MPhi3);
   } // end of if(mq*(dMult-1.)*(dMult-2.)+(mp-mq)*dMult*(dMult-1.))   
- } // end of for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ } // end of for(UInt_t ob=0;ob<occupiedBins.size();ob++)
  
-} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(TString type, TString ptOrEta)
+} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(EDiffFlowType type, EDiffFlowVariable ptOrEta)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowCorrectionsForNUACosTerms(DiffFlowType(type),DiffFlowVariable(ptOrEta));
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(TString type, TString ptOrEta)
 
 //=========================================================================================================================
 
@@ -24012,7 +24056,7 @@ void AliFlowAnalysisWithQCumulants::EvaluateIntFlowCorrectionsForNUAWithNestedLo
 
 //=======================================================================================================================
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // Calculate correction terms for non-uniform acceptance for differential flow (cos terms) using particle weights.
  
@@ -24044,30 +24088,31 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
  Int_t t = 0; // type flag 
  Int_t pe = 0; // ptEta flag
  
- if(type == "RP")
+ if(type == kRP)
  {
   t = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     t = 1;
    }
 
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   pe = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     pe = 1;
    }
     
- Int_t nBinsPtEta[2] = {fnBinsPt,fnBinsEta};
  Double_t minPtEta[2] = {fPtMin,fEtaMin};
  //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
  
  // looping over all bins and calculating correction terms: 
- for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ const std::vector<Int_t> &occupiedBins = fDiffFlowOccupiedBins[t][pe]; // empty bins do not contribute
+ for(UInt_t ob=0;ob<occupiedBins.size();ob++)
  {
+  Int_t b = occupiedBins[ob];
   // real and imaginary parts of p_{m*n,0} (non-weighted Q-vector evaluated for POIs in particular pt or eta bin): 
   Double_t p1n0kRe = 0.;
   Double_t p1n0kIm = 0.;
@@ -24092,7 +24137,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
   Double_t dM01 = 0.;
   Double_t dM011 = 0.;
   
-  if(type == "POI")
+  if(type == kPOI)
   {           
    // q_{m*n,k}:
    q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
@@ -24107,7 +24152,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
    
    s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
    s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
-  }else if(type == "RP")
+  }else if(type == kRP)
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
     q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
@@ -24126,7 +24171,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
     //mq = fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here) 
   }    
   
-  if(type == "POI")
+  if(type == kPOI)
   {
    // p_{m*n,k}:   
    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
@@ -24141,7 +24186,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
        
    // typeFlag = RP (0) or POI (1):   
    t = 1; 
-  } else if(type == "RP")
+  } else if(type == kRP)
     {  
      // to be improved (cross-checked):
      p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
@@ -24211,15 +24256,25 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
    fDiffFlowCorrectionTermsForNUAEBE[t][pe][1][3]->SetBinContent(b,cosP1nPsi1M1nPhi2MPhi3W2W3);
   } // end of if(dM011)   
  
- } // end of for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ } // end of for(UInt_t ob=0;ob<occupiedBins.size();ob++)
    
-} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(TString type, TString ptOrEta)
+} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(DiffFlowType(type),DiffFlowVariable(ptOrEta));
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(TString type, TString ptOrEta)
 
 
 //=======================================================================================================================
 
 
-void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(TString type, TString ptOrEta)
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta)
 {
  // Calculate correction terms for non-uniform acceptance for differential flow (sin terms).
   
@@ -24250,30 +24305,31 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
  Int_t t = 0; // type flag 
  Int_t pe = 0; // ptEta flag
  
- if(type == "RP")
+ if(type == kRP)
  {
   t = 0;
- } else if(type == "POI")
+ } else if(type == kPOI)
    {
     t = 1;
    }
 
- if(ptOrEta == "Pt")
+ if(ptOrEta == kPt)
  {
   pe = 0;
- } else if(ptOrEta == "Eta")
+ } else if(ptOrEta == kEta)
    {
     pe = 1;
    }
     
- Int_t nBinsPtEta[2] = {fnBinsPt,fnBinsEta};
  Double_t minPtEta[2] = {fPtMin,fEtaMin};
  //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
 
  // looping over all bins and calculating correction terms: 
- for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ const std::vector<Int_t> &occupiedBins = fDiffFlowOccupiedBins[t][pe]; // empty bins do not contribute
+ for(UInt_t ob=0;ob<occupiedBins.size();ob++)
  {
+  Int_t b = occupiedBins[ob];
   // real and imaginary parts of p_{m*n,0} (non-weighted Q-vector evaluated for POIs in particular pt or eta bin): 
   Double_t p1n0kRe = 0.;
   Double_t p1n0kIm = 0.;
@@ -24298,7 +24354,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
   Double_t dM01 = 0.;
   Double_t dM011 = 0.;
 
-  if(type == "POI")
+  if(type == kPOI)
   {    
    // q_{m*n,k}:
    //q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
@@ -24313,7 +24369,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
    
    s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
    s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
-  }else if(type == "RP")
+  }else if(type == kRP)
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
     //q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
@@ -24330,7 +24386,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
     //s1p3k = pow(fs1dEBE[0][pe][3]->GetBinContent(b)*fs1dEBE[0][pe][3]->GetBinEntries(b),1.); 
   }    
   
-  if(type == "POI")
+  if(type == kPOI)
   {
    // p_{m*n,k}:   
    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
@@ -24344,7 +24400,7 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
          - 2.*(s1p1k*dSM1p1k-s1p2k);  
    // typeFlag = RP (0) or POI (1):   
    t = 1;           
-  } else if(type == "RP")
+  } else if(type == kRP)
     { 
      // to be improved (cross-checked):
      p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
@@ -24414,9 +24470,19 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
    fDiffFlowCorrectionTermsForNUAEBE[t][pe][0][3]->SetBinContent(b,sinP1nPsi1M1nPhi2MPhi3W2W3);
   } // end of if(dM011)   
   
- } // end of for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+ } // end of for(UInt_t ob=0;ob<occupiedBins.size();ob++)
+
+} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(TString type, TString ptOrEta)
+{
+ // Backward compatible interface: type = "RP" or "POI", ptOrEta = "Pt" or "Eta".
+
+ this->CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(DiffFlowType(type),DiffFlowVariable(ptOrEta));
 
-} // end of AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(TString type, TString ptOrEta)
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(TString type, TString ptOrEta)
 
 //=======================================================================================================================
    
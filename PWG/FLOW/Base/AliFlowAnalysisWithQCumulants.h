@@ -14,6 +14,7 @@
 #ifndef ALIFLOWANALYSISWITHQCUMULANTS_H
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
+#include <vector>
 #include "TMatrixD.h"
 #include "TH2D.h"
 #include "TRandom3.h"
@@ -39,6 +40,8 @@ class AliFlowCommonHistResults;
 
 class AliFlowAnalysisWithQCumulants{
  public:
+  enum EDiffFlowType {kRP=0, kPOI=1}; // first index of differential flow arrays
+  enum EDiffFlowVariable {kPt=0, kEta=1}; // second index of differential flow arrays
   AliFlowAnalysisWithQCumulants();
   virtual ~AliFlowAnalysisWithQCumulants(); 
   // 0.) methods called in the constructor:
@@ -113,6 +116,18 @@ class AliFlowAnalysisWithQCumulants{
     virtual void CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(TString type, TString ptOrEta);
     virtual void CalculateDiffFlowCorrectionsForNUASinTerms(TString type, TString ptOrEta);  
     virtual void CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(TString type, TString ptOrEta);  
+    virtual void CalculateDiffFlowCorrelations(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowCorrelationsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowProductOfCorrelations(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowSumOfEventWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowSumOfProductOfEventWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowCorrectionsForNUACosTerms(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowCorrectionsForNUASinTerms(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(EDiffFlowType type, EDiffFlowVariable ptOrEta);
+    virtual void MarkOccupiedDiffFlowBins(Int_t t, Double_t *ptEta); // t = 0 (RP) or 1 (POI)
+    static EDiffFlowType DiffFlowType(const TString &type) {return (type == "POI") ? kPOI : kRP;};
+    static EDiffFlowVariable DiffFlowVariable(const TString &ptOrEta) {return (ptOrEta == "Eta") ? kEta : kPt;};
     // 2e.) 2D differential flow:
     virtual void Calculate2DDiffFlowCorrelations(TString type); // type = RP or POI
     // 2f.) Other differential correlators (i.e. Teaney-Yan correlator):    
@@ -716,6 +731,9 @@ class AliFlowAnalysisWithQCumulants{
   TH1D *fDiffFlowCorrelationsEBE[2][2][4]; //! [0=RP,1=POI][0=pt,1=eta][reduced correlation index]
   TH1D *fDiffFlowEventWeightsForCorrelationsEBE[2][2][4]; //! [0=RP,1=POI][0=pt,1=eta][event weights for reduced correlation index]
   TH1D *fDiffFlowCorrectionTermsForNUAEBE[2][2][2][10]; //! [0=RP,1=POI][0=pt,1=eta][0=sin terms,1=cos terms][correction term index]
+  std::vector<Int_t> fDiffFlowOccupiedBins[2][2]; //! bins of fReRPQ1dEBE filled in this event [0=RP,1=POI][0=pt,1=eta]
+  std::vector<Bool_t> fDiffFlowOccupancy[2][2]; //! occupancy mask for fDiffFlowOccupiedBins [0=RP,1=POI][0=pt,1=eta][bin]
+  std::vector<Double_t> fDiffFlowReducedQ; //! scratch: reduced Q-vectors of the occupied bins gathered in CalculateDiffFlowCorrelations
   //   2D:
   TProfile2D *fReRPQ2dEBE[3][4][9]; // real part of r_{m*n,k}(pt,eta), p_{m*n,k}(pt,eta) and q_{m*n,k}(pt,eta)
   TProfile2D *fImRPQ2dEBE[3][4][9]; // imaginary part of r_{m*n,k}(pt,eta), p_{m*n,k}(pt,eta) and q_{m*n,k}(pt,eta)
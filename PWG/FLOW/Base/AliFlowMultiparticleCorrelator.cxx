@@ -0,0 +1,432 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+ /************************************
+ * standalone engine for generic     *
+ * multi-particle correlators from   *
+ * Q-, p- and q-vector tables        *
+ ************************************/
+
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+#include "TError.h"
+#include "AliFlowMultiparticleCorrelator.h"
+
+//================================================================================================================
+
+AliFlowMultiparticleCorrelator::AliFlowMultiparticleCorrelator(Int_t maxHarmonic, Int_t maxCorrelator, Int_t nDiffBins):
+ fMaxHarmonic(0),
+ fMaxCorrelator(0),
+ fNDiffBins(0),
+ fNHarmonics(0),
+ fNPowers(0),
+ fTableSize(0),
+ fQ(),
+ fp(),
+ fq(),
+ fPhi(),
+ fWeight(),
+ fWeighted(kFALSE),
+ fDiffPhi(),
+ fDiffWeight(),
+ fOverlapPhi(),
+ fOverlapWeight(),
+ fDiffWeighted(kFALSE),
+ fMemo()
+{
+ // Constructor.
+
+ this->SetDimensions(maxHarmonic,maxCorrelator,nDiffBins);
+
+} // AliFlowMultiparticleCorrelator::AliFlowMultiparticleCorrelator(...)
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::SetDimensions(Int_t maxHarmonic, Int_t maxCorrelator, Int_t nDiffBins)
+{
+ // Book the tables for harmonics up to maxHarmonic, correlators up to maxCorrelator and nDiffBins differential bins.
+
+ if(maxHarmonic<1 || maxCorrelator<1 || nDiffBins<0)
+ {
+  ::Fatal("AliFlowMultiparticleCorrelator::SetDimensions","maxHarmonic = %d, maxCorrelator = %d, nDiffBins = %d",maxHarmonic,maxCorrelator,nDiffBins);
+ }
+
+ fMaxHarmonic = maxHarmonic;
+ fMaxCorrelator = maxCorrelator;
+ fNDiffBins = nDiffBins;
+ fNHarmonics = fMaxHarmonic*fMaxCorrelator+1;
+ fNPowers = fMaxCorrelator+1;
+ fTableSize = fNHarmonics*fNPowers;
+
+ fQ.assign(fTableSize,Complex_t(0.,0.));
+ fp.assign(fNDiffBins*fTableSize,Complex_t(0.,0.));
+ fq.assign(fNDiffBins*fTableSize,Complex_t(0.,0.));
+ fDiffPhi.assign(fNDiffBins,std::vector<Double_t>());
+ fDiffWeight.assign(fNDiffBins,std::vector<Double_t>());
+ fOverlapPhi.assign(fNDiffBins,std::vector<Double_t>());
+ fOverlapWeight.assign(fNDiffBins,std::vector<Double_t>());
+ this->Reset();
+
+} // void AliFlowMultiparticleCorrelator::SetDimensions(Int_t maxHarmonic, Int_t maxCorrelator, Int_t nDiffBins)
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::AddParticle(Double_t phi, Double_t weight)
+{
+ // Buffer one reference particle, it enters the Q-vector at the next call to Fill().
+
+ fPhi.push_back(phi);
+ fWeight.push_back(weight);
+ if(weight != 1.){fWeighted = kTRUE;}
+
+} // void AliFlowMultiparticleCorrelator::AddParticle(Double_t phi, Double_t weight)
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::AddDiffParticle(Int_t bin, Double_t phi, Double_t weight, Bool_t isReference)
+{
+ // Buffer one particle of interest in differential bin 'bin' (p-vector). When it is also
+ // a reference particle it enters the q-vector as well. The Q-vector is not touched.
+
+ if(bin<0 || bin>=fNDiffBins){return;}
+ fDiffPhi[bin].push_back(phi);
+ fDiffWeight[bin].push_back(weight);
+ if(isReference)
+ {
+  fOverlapPhi[bin].push_back(phi);
+  fOverlapWeight[bin].push_back(weight);
+ }
+ if(weight != 1.){fDiffWeighted = kTRUE;}
+
+} // void AliFlowMultiparticleCorrelator::AddDiffParticle(Int_t bin, Double_t phi, Double_t weight, Bool_t isReference)
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::Fill()
+{
+ // Accumulate all buffered particles into the Q-, p- and q-vector tables.
+
+ if(!fPhi.empty())
+ {
+  this->Accumulate(&fQ[0],fPhi.size(),&fPhi[0],fWeighted ? &fWeight[0] : NULL);
+  fPhi.clear();
+  fWeight.clear();
+ }
+
+ for(Int_t b=0;b<fNDiffBins;b++)
+ {
+  if(!fDiffPhi[b].empty())
+  {
+   this->Accumulate(&fp[b*fTableSize],fDiffPhi[b].size(),&fDiffPhi[b][0],fDiffWeighted ? &fDiffWeight[b][0] : NULL);
+   fDiffPhi[b].clear();
+   fDiffWeight[b].clear();
+  }
+  if(!fOverlapPhi[b].empty())
+  {
+   this->Accumulate(&fq[b*fTableSize],fOverlapPhi[b].size(),&fOverlapPhi[b][0],fDiffWeighted ? &fOverlapWeight[b][0] : NULL);
+   fOverlapPhi[b].clear();
+   fOverlapWeight[b].clear();
+  }
+ } // for(Int_t b=0;b<fNDiffBins;b++)
+
+ fMemo.clear();
+
+} // void AliFlowMultiparticleCorrelator::Fill()
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::Fill(Int_t n, const Double_t *phi, const Double_t *weight)
+{
+ // Accumulate n reference particles directly from arrays (weight = NULL means unit weights).
+
+ if(n<=0 || !phi){return;}
+ this->Accumulate(&fQ[0],n,phi,weight);
+ fMemo.clear();
+
+} // void AliFlowMultiparticleCorrelator::Fill(Int_t n, const Double_t *phi, const Double_t *weight)
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::Reset()
+{
+ // Reset all tables and buffers before the next event (the memory is kept).
+
+ std::fill(fQ.begin(),fQ.end(),Complex_t(0.,0.));
+ std::fill(fp.begin(),fp.end(),Complex_t(0.,0.));
+ std::fill(fq.begin(),fq.end(),Complex_t(0.,0.));
+ fPhi.clear();
+ fWeight.clear();
+ fWeighted = kFALSE;
+ for(Int_t b=0;b<fNDiffBins;b++)
+ {
+  fDiffPhi[b].clear();
+  fDiffWeight[b].clear();
+  fOverlapPhi[b].clear();
+  fOverlapWeight[b].clear();
+ }
+ fDiffWeighted = kFALSE;
+ fMemo.clear();
+
+} // void AliFlowMultiparticleCorrelator::Reset()
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::Accumulate(Complex_t *table, Int_t n, const Double_t *phi, const Double_t *weight) const
+{
+ // Add sum_i w_i^p exp(i h phi_i) to table[h][p] for all h and p. The particles are processed
+ // in blocks, within a block cos(h phi) and sin(h phi) are obtained by rotating with (cos(phi),sin(phi)).
+
+ const Int_t kBlock = 64;
+ Double_t c1[kBlock], s1[kBlock], ch[kBlock], sh[kBlock], wp[kBlock];
+
+ for(Int_t start=0;start<n;start+=kBlock)
+ {
+  Int_t m = (n-start < kBlock) ? n-start : kBlock;
+  const Double_t *w = weight ? weight+start : NULL;
+  for(Int_t i=0;i<m;i++)
+  {
+   c1[i] = cos(phi[start+i]);
+   s1[i] = sin(phi[start+i]);
+   ch[i] = 1.;
+   sh[i] = 0.;
+  }
+
+  for(Int_t h=0;h<fNHarmonics;h++)
+  {
+   Complex_t *row = table + h*fNPowers;
+   if(w)
+   {
+    for(Int_t i=0;i<m;i++){wp[i] = 1.;}
+    for(Int_t pw=0;pw<fNPowers;pw++)
+    {
+     Double_t re = 0., im = 0.;
+     for(Int_t i=0;i<m;i++)
+     {
+      re += wp[i]*ch[i];
+      im += wp[i]*sh[i];
+     }
+     row[pw] += Complex_t(re,im);
+     for(Int_t i=0;i<m;i++){wp[i] *= w[i];}
+    } // for(Int_t pw=0;pw<fNPowers;pw++)
+   } else
+     {
+      // unit weights: all powers are equal
+      Double_t re = 0., im = 0.;
+      for(Int_t i=0;i<m;i++)
+      {
+       re += ch[i];
+       im += sh[i];
+      }
+      for(Int_t pw=0;pw<fNPowers;pw++){row[pw] += Complex_t(re,im);}
+     }
+
+   // rotate by phi: (h+1)*phi
+   for(Int_t i=0;i<m;i++)
+   {
+    Double_t c = ch[i]*c1[i]-sh[i]*s1[i];
+    sh[i] = sh[i]*c1[i]+ch[i]*s1[i];
+    ch[i] = c;
+   }
+  } // for(Int_t h=0;h<fNHarmonics;h++)
+ } // for(Int_t start=0;start<n;start+=kBlock)
+
+} // void AliFlowMultiparticleCorrelator::Accumulate(...)
+
+//================================================================================================================
+
+AliFlowMultiparticleCorrelator::Complex_t AliFlowMultiparticleCorrelator::Correlator(Int_t n, const Int_t *harmonics)
+{
+ // Generic n-particle correlation <exp[i(n1*phi1+...+nn*phin)]> (not normalized). The denominator
+ // is obtained by calling this method with all harmonics set to zero.
+
+ if(n<1 || n>fMaxCorrelator || n>16)
+ {
+  ::Error("AliFlowMultiparticleCorrelator::Correlator","%d-particle correlator not available (max. %d)",n,fMaxCorrelator);
+  return Complex_t(0.,0.);
+ }
+
+ Int_t harmonic[16];
+ Int_t sum = 0;
+ for(Int_t i=0;i<n;i++)
+ {
+  harmonic[i] = harmonics[i];
+  sum += abs(harmonics[i]);
+ }
+ if(sum>=fNHarmonics)
+ {
+  ::Error("AliFlowMultiparticleCorrelator::Correlator","sum of harmonics %d exceeds the Q-vector table (%d)",sum,fNHarmonics-1);
+  return Complex_t(0.,0.);
+ }
+
+ return this->Recursion(n,harmonic);
+
+} // AliFlowMultiparticleCorrelator::Complex_t AliFlowMultiparticleCorrelator::Correlator(Int_t n, const Int_t *harmonics)
+
+//================================================================================================================
+
+Bool_t AliFlowMultiparticleCorrelator::MakeKey(Int_t n, const Int_t *harmonic, Int_t mult, Int_t skip, Key_t &key) const
+{
+ // Pack the arguments of Recursion(); return kFALSE if they do not fit into the key.
+
+ if(n>8 || mult>15 || skip>15){return kFALSE;}
+ key.fHarmonics = 0;
+ for(Int_t i=0;i<n;i++)
+ {
+  if(harmonic[i]<-127 || harmonic[i]>127){return kFALSE;}
+  key.fHarmonics |= ((ULong64_t)(harmonic[i]+128)) << (8*i);
+ }
+ key.fMeta = (UInt_t)n | ((UInt_t)mult << 4) | ((UInt_t)skip << 8);
+ return kTRUE;
+
+} // Bool_t AliFlowMultiparticleCorrelator::MakeKey(...)
+
+//================================================================================================================
+
+AliFlowMultiparticleCorrelator::Complex_t AliFlowMultiparticleCorrelator::Recursion(Int_t n, Int_t *harmonic, Int_t mult, Int_t skip)
+{
+ // Calculate multi-particle correlators by using recursion originally developed by
+ // Kristjan Gulbrandsen (gulbrand@nbi.dk), with the terms of the current event memoized.
+
+ Int_t nm1 = n-1;
+ if(nm1 == 0){return Q(harmonic[0],mult);}
+
+ Key_t key;
+ Bool_t bMemo = this->MakeKey(n,harmonic,mult,skip,key);
+ if(bMemo)
+ {
+  std::unordered_map<Key_t,Complex_t,KeyHash_t>::const_iterator it = fMemo.find(key);
+  if(it != fMemo.end()){return it->second;}
+ }
+
+ Complex_t c(Q(harmonic[nm1],mult));
+ c *= Recursion(nm1,harmonic);
+ if(nm1 == skip)
+ {
+  if(bMemo){fMemo[key] = c;}
+  return c;
+ }
+
+ Int_t multp1 = mult+1;
+ Int_t nm2 = n-2;
+ Int_t counter1 = 0;
+ Int_t hhold = harmonic[counter1];
+ harmonic[counter1] = harmonic[nm2];
+ harmonic[nm2] = hhold + harmonic[nm1];
+ Complex_t c2(Recursion(nm1,harmonic,multp1,nm2));
+ Int_t counter2 = n-3;
+ while(counter2 >= skip)
+ {
+  harmonic[nm2] = harmonic[counter1];
+  harmonic[counter1] = hhold;
+  ++counter1;
+  hhold = harmonic[counter1];
+  harmonic[counter1] = harmonic[nm2];
+  harmonic[nm2] = hhold + harmonic[nm1];
+  c2 += Recursion(nm1,harmonic,multp1,counter2);
+  --counter2;
+ }
+ harmonic[nm2] = harmonic[counter1];
+ harmonic[counter1] = hhold;
+
+ Complex_t result = (mult == 1) ? c-c2 : c-Double_t(mult)*c2;
+ if(bMemo){fMemo[key] = result;}
+ return result;
+
+} // AliFlowMultiparticleCorrelator::Complex_t AliFlowMultiparticleCorrelator::Recursion(...)
+
+//================================================================================================================
+
+Bool_t AliFlowMultiparticleCorrelator::DiffCorrelators(Int_t order, const Int_t *harmonics, std::vector<Complex_t> &num, std::vector<Complex_t> &den) const
+{
+ // Differential correlators <exp[i(n1*psi1+n2*phi2+...)]> (psi labels POI, phi labels RPs) of order 1..4
+ // in all differential bins at once. The products of Q-vector components do not depend on the bin and
+ // are evaluated only once, the loop over bins then only touches the p- and q-vector tables.
+ // num[b] and den[b] are the numerator and the denominator (all harmonics zero) in bin b.
+
+ if(order<1 || order>4 || order>fMaxCorrelator)
+ {
+  ::Error("AliFlowMultiparticleCorrelator::DiffCorrelators","%d-particle differential correlator not available",order);
+  return kFALSE;
+ }
+ Int_t sum = 0;
+ for(Int_t i=0;i<order;i++){sum += abs(harmonics[i]);}
+ if(sum>=fNHarmonics)
+ {
+  ::Error("AliFlowMultiparticleCorrelator::DiffCorrelators","sum of harmonics %d exceeds the Q-vector table (%d)",sum,fNHarmonics-1);
+  return kFALSE;
+ }
+
+ num.resize(fNDiffBins);
+ den.resize(fNDiffBins);
+
+ const Int_t zero[4] = {0,0,0,0};
+ for(Int_t nd=0;nd<2;nd++) // [numerator,denominator]
+ {
+  const Int_t *h = (0==nd) ? harmonics : zero;
+  std::vector<Complex_t> &out = (0==nd) ? num : den;
+  Int_t n1 = h[0];
+  switch(order)
+  {
+   case 1:
+    for(Int_t b=0;b<fNDiffBins;b++){out[b] = p(b,n1,1);}
+   break;
+
+   case 2:
+   {
+    Int_t n2 = h[1];
+    Complex_t q2 = Q(n2,1);
+    for(Int_t b=0;b<fNDiffBins;b++){out[b] = p(b,n1,1)*q2-q(b,n1+n2,2);}
+   }
+   break;
+
+   case 3:
+   {
+    Int_t n2 = h[1], n3 = h[2];
+    Complex_t aP = Q(n2,1)*Q(n3,1)-Q(n2+n3,2);
+    Complex_t a12 = -Q(n3,1);
+    Complex_t a13 = -Q(n2,1);
+    for(Int_t b=0;b<fNDiffBins;b++)
+    {
+     out[b] = p(b,n1,1)*aP+q(b,n1+n2,2)*a12+q(b,n1+n3,2)*a13+2.*q(b,n1+n2+n3,3);
+    }
+   }
+   break;
+
+   case 4:
+   {
+    Int_t n2 = h[1], n3 = h[2], n4 = h[3];
+    Complex_t Q2 = Q(n2,1), Q3 = Q(n3,1), Q4 = Q(n4,1);
+    Complex_t Q23 = Q(n2+n3,2), Q24 = Q(n2+n4,2), Q34 = Q(n3+n4,2);
+    Complex_t aP = Q2*Q3*Q4-Q23*Q4-Q3*Q24-Q2*Q34+2.*Q(n2+n3+n4,3);
+    Complex_t a12 = Q34-Q3*Q4;
+    Complex_t a13 = Q24-Q2*Q4;
+    Complex_t a14 = Q23-Q2*Q3;
+    Complex_t a123 = 2.*Q4, a124 = 2.*Q3, a134 = 2.*Q2;
+    for(Int_t b=0;b<fNDiffBins;b++)
+    {
+     out[b] = p(b,n1,1)*aP
+            + q(b,n1+n2,2)*a12+q(b,n1+n3,2)*a13+q(b,n1+n4,2)*a14
+            + q(b,n1+n2+n3,3)*a123+q(b,n1+n2+n4,3)*a124+q(b,n1+n3+n4,3)*a134
+            - 6.*q(b,n1+n2+n3+n4,4);
+    }
+   }
+   break;
+  } // switch(order)
+ } // for(Int_t nd=0;nd<2;nd++)
+
+ return kTRUE;
+
+} // Bool_t AliFlowMultiparticleCorrelator::DiffCorrelators(...)
@@ -0,0 +1,125 @@
+/*
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.
+ * See cxx source for full Copyright notice
+ * $Id$
+ */
+
+ /************************************
+ * standalone engine for generic     *
+ * multi-particle correlators from   *
+ * Q-, p- and q-vector tables        *
+ ************************************/
+
+#ifndef ALIFLOWMULTIPARTICLECORRELATOR_H
+#define ALIFLOWMULTIPARTICLECORRELATOR_H
+
+// Usage (once per event):
+//
+//  AliFlowMultiparticleCorrelator mpc(6,8,nPtBins);
+//  for(...){mpc.AddParticle(phi,w);}               // reference particles
+//  for(...){mpc.AddDiffParticle(bin,phi,w,isRP);}  // particles of interest
+//  mpc.Fill();                                     // builds all tables in one pass
+//  Int_t h[4] = {2,2,-2,-2};
+//  std::complex<double> four = mpc.Correlator(4,h);
+//  mpc.DiffCorrelators(2,h,num,den);               // all differential bins at once
+//  mpc.Reset();
+//
+// Q{n,p} = sum_i w_i^p exp(i n phi_i) is stored densely as [n][p] for
+// n = 0..maxHarmonic*maxCorrelator and p = 0..maxCorrelator, the negative
+// harmonics are obtained by complex conjugation. The buffered particles are
+// accumulated in blocks: cos(n phi) and sin(n phi) are propagated by rotation
+// over n, so only one cos/sin per particle is evaluated and the inner loops
+// run over contiguous arrays of particles.
+//
+// Correlators of arbitrary order are evaluated with the recursion of
+// K. Gulbrandsen (gulbrand@nbi.dk). Intermediate results are memoized per
+// event, so the many correlators booked in an analysis share their common
+// sub-terms (including all the denominators).
+
+#include <complex>
+#include <vector>
+#include <unordered_map>
+#include "Rtypes.h"
+
+class AliFlowMultiparticleCorrelator{
+ public:
+  typedef std::complex<double> Complex_t;
+
+  AliFlowMultiparticleCorrelator(Int_t maxHarmonic = 6, Int_t maxCorrelator = 8, Int_t nDiffBins = 0);
+  ~AliFlowMultiparticleCorrelator() {;}
+
+  void SetDimensions(Int_t maxHarmonic, Int_t maxCorrelator, Int_t nDiffBins = 0);
+  Int_t GetMaxHarmonic() const {return fMaxHarmonic;};
+  Int_t GetMaxCorrelator() const {return fMaxCorrelator;};
+  Int_t GetNDiffBins() const {return fNDiffBins;};
+
+  // Event filling:
+  void AddParticle(Double_t phi, Double_t weight = 1.);
+  void AddDiffParticle(Int_t bin, Double_t phi, Double_t weight = 1., Bool_t isReference = kFALSE);
+  void Fill();
+  void Fill(Int_t n, const Double_t *phi, const Double_t *weight = NULL);
+  void Reset();
+
+  // Vector components, Q{-n,p} = Q{n,p}^*:
+  Complex_t Q(Int_t n, Int_t wp) const
+  {
+   return (n>=0) ? fQ[n*fNPowers+wp] : std::conj(fQ[-n*fNPowers+wp]);
+  }
+  Complex_t p(Int_t bin, Int_t n, Int_t wp) const
+  {
+   const Complex_t *t = &fp[bin*fTableSize];
+   return (n>=0) ? t[n*fNPowers+wp] : std::conj(t[-n*fNPowers+wp]);
+  }
+  Complex_t q(Int_t bin, Int_t n, Int_t wp) const
+  {
+   const Complex_t *t = &fq[bin*fTableSize];
+   return (n>=0) ? t[n*fNPowers+wp] : std::conj(t[-n*fNPowers+wp]);
+  }
+
+  // Correlators:
+  Complex_t Correlator(Int_t n, const Int_t *harmonics);
+  Bool_t DiffCorrelators(Int_t order, const Int_t *harmonics, std::vector<Complex_t> &num, std::vector<Complex_t> &den) const;
+
+ private:
+  AliFlowMultiparticleCorrelator(const AliFlowMultiparticleCorrelator&);
+  AliFlowMultiparticleCorrelator& operator=(const AliFlowMultiparticleCorrelator&);
+
+  // memoization key: harmonics packed in 8 bits each, (n,mult,skip) in fMeta
+  struct Key_t{
+   ULong64_t fHarmonics;
+   UInt_t fMeta;
+   bool operator==(const Key_t &other) const {return fHarmonics == other.fHarmonics && fMeta == other.fMeta;}
+  };
+  struct KeyHash_t{
+   size_t operator()(const Key_t &k) const {return (size_t)((k.fHarmonics*11400714819323198485ull) ^ k.fMeta);}
+  };
+
+  void Accumulate(Complex_t *table, Int_t n, const Double_t *phi, const Double_t *weight) const;
+  Bool_t MakeKey(Int_t n, const Int_t *harmonic, Int_t mult, Int_t skip, Key_t &key) const;
+  Complex_t Recursion(Int_t n, Int_t *harmonic, Int_t mult = 1, Int_t skip = 0);
+
+  Int_t fMaxHarmonic;   // maximum harmonic of a single particle
+  Int_t fMaxCorrelator; // maximum correlator order
+  Int_t fNDiffBins;     // number of differential (pt or eta) bins
+  Int_t fNHarmonics;    // fMaxHarmonic*fMaxCorrelator+1
+  Int_t fNPowers;       // fMaxCorrelator+1
+  Int_t fTableSize;     // fNHarmonics*fNPowers
+
+  std::vector<Complex_t> fQ; // Q-vector table [n][p]
+  std::vector<Complex_t> fp; // p-vector tables [bin][n][p]
+  std::vector<Complex_t> fq; // q-vector tables [bin][n][p]
+
+  // particles buffered until Fill():
+  std::vector<Double_t> fPhi;    // reference particles
+  std::vector<Double_t> fWeight; // their weights
+  Bool_t fWeighted;              // some reference weight differs from 1
+  std::vector< std::vector<Double_t> > fDiffPhi;        // particles of interest [bin]
+  std::vector< std::vector<Double_t> > fDiffWeight;     // their weights [bin]
+  std::vector< std::vector<Double_t> > fOverlapPhi;     // particles of interest which are also reference [bin]
+  std::vector< std::vector<Double_t> > fOverlapWeight;  // their weights [bin]
+  Bool_t fDiffWeighted;          // some differential weight differs from 1
+
+  std::unordered_map<Key_t,Complex_t,KeyHash_t> fMemo; // memoized recursion terms of the current event
+};
+
+#endif
@@ -8,6 +8,8 @@
 */
 #include "AliFlowBayesianPID.h"
 
+#include <vector>
+
 #include "TDatabasePDG.h"
 #include "AliESDEvent.h"
 #include "AliESDtrack.h"
@@ -36,7 +38,7 @@ TH1D* AliFlowBayesianPID::fgHtofChannelDist=NULL;
 
 //________________________________________________________________________
 AliFlowBayesianPID::AliFlowBayesianPID(AliESDpid *esdpid) 
-  :      AliPIDResponse(), fPIDesd(NULL), fDB(TDatabasePDG::Instance()), fNewTrackParam(0), fTOFresolution(84.0), fTOFResponseF(NULL), fTPCResponseF(NULL),fWTofMism(0.0), fProbTofMism(0.0), fZ(0) ,fMassTOF(0), fBBdata(NULL),fCurrCentrality(100),fPsi(999),fPsiRes(999),fIsMC(kFALSE),fForceOldDedx(kFALSE),fDedx(0.0),fIsTOFheaderAOD(0)
+  :      AliPIDResponse(), fPIDesd(NULL), fDB(TDatabasePDG::Instance()), fNewTrackParam(0), fTOFresolution(84.0), fTOFResponseF(NULL), fTPCResponseF(NULL),fWTofMism(0.0), fProbTofMism(0.0), fZ(0) ,fMassTOF(0), fBBdata(NULL),fCurrCentrality(100),fPsi(999),fPsiRes(999),fIsMC(kFALSE),fForceOldDedx(kFALSE),fDedx(0.0),fIsTOFheaderAOD(0),fPriorsCentrBin(-1),fNBatch(0),fBatchSize(0),fBatchWeights(),fBatchPriors(),fBatchProb(),fBatchTofMism(),fBatchProbTofMism(),fBatchAccepted(),fBatchZ(),fBatchMassTOF()
 {
   // Constructor
   Bool_t redopriors = kFALSE;
@@ -124,6 +126,12 @@ AliFlowBayesianPID::AliFlowBayesianPID(AliESDpid *esdpid)
   fTPCResponseF->SetParameter(0,1./fTPCResponseF->Integral(-7,7));
   fTPCResponseF->SetLineColor(4);
 
+  // parameters for the inline evaluation of the responses
+  for(Int_t i=0;i < 4;i++){
+    fTOFResponsePar[i] = fTOFResponseF->GetParameter(i);
+    fTPCResponsePar[i] = fTPCResponseF->GetParameter(i);
+  }
+
   fBBdata = new TF1("fBBdata", "[0] * AliExternalTrackParam::BetheBlochAleph(x, [1], [2], [3], [4], [5])",0.1, 4000.);
 
   // initialize the mask
@@ -609,32 +617,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
   fDedx = dedx;
 
   if(t->GetStatus() & AliESDtrack::kTPCout && dedx > 40 && fMaskOR[0]){ // if TPC PID available    
-    for(Int_t iS=0;iS<fgkNspecies;iS++){
-      Float_t dedxExp=GetExpDeDx(t,iS);
-      
-      Float_t resolutionTPC = 1;
-      if(iS==0) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kElectron); 
-      else if(iS==1) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kMuon);
-      else if(iS==2) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kPion);
-      else if(iS==3) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kKaon);
-      else if(iS==4) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kProton);
-      else if(iS==5) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kDeuteron);
-      else if(iS==6) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kTriton);
-      else if(iS==7) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[7])*5*0.07;
-      else if(iS==8) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[8])*5*0.07;
-      
-      if(centr < 0) resolutionTPC *= 0.78;
-      if(centr < 10) resolutionTPC *= 1.0;
-      else if(centr < 20) resolutionTPC *= 1.0;
-      else if(centr < 30) resolutionTPC *= 1.0;
-      else if(centr < 40) resolutionTPC *= 0.95;
-      else if(centr < 50) resolutionTPC *= 0.93;
-      else if(centr < 60) resolutionTPC *= 0.91;
-      else if(centr < 70) resolutionTPC *= 0.88;
-      else resolutionTPC *= 0.83;
-      
-      fWeights[0][iS] = fTPCResponseF->Eval((dedx - dedxExp)/resolutionTPC)/resolutionTPC;
-    }
+    ComputeTPCWeights(t,momtpc,dedx,t->GetTPCsignalN());
     fMaskCurrent[0] = kTRUE;
   }
   else{
@@ -668,14 +651,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
     inttimes[7] = inttimes[0] / p * fMass[7] * TMath::Sqrt(1+p*p/fMass[7]/fMass[7]);
     inttimes[8] = inttimes[0] / p * fMass[8] * TMath::Sqrt(1+p*p/fMass[8]/fMass[8]);
 
-    for(Int_t iS=0;iS<fgkNspecies;iS++){
-      Float_t expsigma = fPIDesd->GetTOFResponse().GetExpectedSigma(p, inttimes[iS], fMass[iS]);
-      Float_t delta = timeTOF - inttimes[iS];
-      if (TMath::Abs(delta) > 5*expsigma) {
-	fWeights[1][iS] = mismfrac*mismweight;
-      } else
-	fWeights[1][iS] = fTOFResponseF->Eval(delta/expsigma)/expsigma + mismfrac*mismweight;
-    }
+    ComputeTOFWeights(p,timeTOF,inttimes,mismfrac*mismweight);
     fMaskCurrent[1] = kTRUE;
   }
   else{
@@ -757,33 +733,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
 
   // TPC
   if(t->GetStatus() & AliESDtrack::kTPCout && dedx > 40 && fMaskOR[0]){ // if TPC PID available    
-    for(Int_t iS=0;iS<fgkNspecies;iS++){
-
-      Float_t dedxExp=GetExpDeDx(t,iS);
-
-      Float_t resolutionTPC = 1;
-      if(iS==0) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kElectron); 
-      else if(iS==1) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kMuon);
-      else if(iS==2) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kPion);
-      else if(iS==3) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kKaon);
-      else if(iS==4) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kProton);
-      else if(iS==5) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kDeuteron);
-      else if(iS==6) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kTriton);
-      else if(iS==7) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[7])*5*0.07;
-      else if(iS==8) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[8])*5*0.07;
-
-      if(centr < 0) resolutionTPC *= 0.78;
-      if(centr < 10) resolutionTPC *= 1.0;
-      else if(centr < 20) resolutionTPC *= 1.0;
-      else if(centr < 30) resolutionTPC *= 1.0;
-      else if(centr < 40) resolutionTPC *= 0.95;
-      else if(centr < 50) resolutionTPC *= 0.93;
-      else if(centr < 60) resolutionTPC *= 0.91;
-      else if(centr < 70) resolutionTPC *= 0.88;
-      else resolutionTPC *= 0.83;
-      
-      fWeights[0][iS] = fTPCResponseF->Eval((dedx - dedxExp)/resolutionTPC)/resolutionTPC;
-    }
+    ComputeTPCWeights(t,momtpc,dedx,t->GetTPCsignalN());
     fMaskCurrent[0] = kTRUE;
   }
   else{
@@ -820,38 +770,25 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
     inttimes[7] = inttimes[0] / p * fMass[7] * TMath::Sqrt(1+p*p/fMass[7]/fMass[7]);
     inttimes[8] = inttimes[0] / p * fMass[8] * TMath::Sqrt(1+p*p/fMass[8]/fMass[8]);
 
-    for(Int_t iS=0;iS<fgkNspecies;iS++){
-
-      if(!fIsTOFheaderAOD){
-	if(iS==0){
-	  AliAODPid *pidObj = t->GetDetPid();
-	  if (!pidObj) fPIDesd->GetTOFResponse().SetTimeResolution(fTOFresolution);
-	  else{
-	    Double_t sigmaTOFPidInAOD[10];
-	    pidObj->GetTOFpidResolution(sigmaTOFPidInAOD);
-	    if(sigmaTOFPidInAOD[0] > fTOFresolution){
-	      fPIDesd->GetTOFResponse().SetTimeResolution(sigmaTOFPidInAOD[0]); // use the electron TOF PID sigma as time resolution (including the T0 used)
-	      Float_t newElSigma = fPIDesd->GetTOFResponse().GetExpectedSigma(p, inttimes[0], fMass[0]);
-	      Float_t newpar = fPIDesd->GetTOFResponse().GetTrackParameter(3);
-	      sigmaTOFPidInAOD[0] = TMath::Sqrt(2*sigmaTOFPidInAOD[0]*sigmaTOFPidInAOD[0] - newElSigma*newElSigma - (50*50 - newpar*newpar)/p/p);
-	      fPIDesd->GetTOFResponse().SetTimeResolution(sigmaTOFPidInAOD[0]); // use the electron TOF PID sigma as time resolution (including the T0 used)
-	      
-	      //            fPIDesd->GetTOFResponse().Dump();
-	      //	    printf("sigmaBayes(%f) = %f %f (%f %f %f)\n",t->P(),sigmaTOFPidInAOD[0],newElSigma,p, inttimes[0], fMass[0]);
-	    }
-	    else
-	      fPIDesd->GetTOFResponse().SetTimeResolution(fTOFresolution);
-	  }
+    if(!fIsTOFheaderAOD){
+      AliAODPid *pidObj = t->GetDetPid();
+      if (!pidObj) fPIDesd->GetTOFResponse().SetTimeResolution(fTOFresolution);
+      else{
+	Double_t sigmaTOFPidInAOD[10];
+	pidObj->GetTOFpidResolution(sigmaTOFPidInAOD);
+	if(sigmaTOFPidInAOD[0] > fTOFresolution){
+	  fPIDesd->GetTOFResponse().SetTimeResolution(sigmaTOFPidInAOD[0]); // use the electron TOF PID sigma as time resolution (including the T0 used)
+	  Float_t newElSigma = fPIDesd->GetTOFResponse().GetExpectedSigma(p, inttimes[0], fMass[0]);
+	  Float_t newpar = fPIDesd->GetTOFResponse().GetTrackParameter(3);
+	  sigmaTOFPidInAOD[0] = TMath::Sqrt(2*sigmaTOFPidInAOD[0]*sigmaTOFPidInAOD[0] - newElSigma*newElSigma - (50*50 - newpar*newpar)/p/p);
+	  fPIDesd->GetTOFResponse().SetTimeResolution(sigmaTOFPidInAOD[0]); // use the electron TOF PID sigma as time resolution (including the T0 used)
 	}
+	else
+	  fPIDesd->GetTOFResponse().SetTimeResolution(fTOFresolution);
       }
-
-      Float_t expsigma = fPIDesd->GetTOFResponse().GetExpectedSigma(p, inttimes[iS], fMass[iS]);
-      Float_t delta = timeTOF - inttimes[iS];
-      if (TMath::Abs(delta) > 5*expsigma) {
-	fWeights[1][iS] = mismfrac*mismweight;
-      } else
-	fWeights[1][iS] = fTOFResponseF->Eval(delta/expsigma)/expsigma + mismfrac*mismweight;
     }
+
+    ComputeTOFWeights(p,timeTOF,inttimes,mismfrac*mismweight);
     fMaskCurrent[1] = kTRUE;
   }
   else{
@@ -872,12 +809,9 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
 void AliFlowBayesianPID::ComputeProb(const AliESDtrack *t,Float_t /*centrObsolete*/){
   // compute Bayesian probablities
   ComputeWeights(t);
-  Float_t priors[fgkNspecies];
   fProbTofMism = 0;
 
-  Float_t centr = fCurrCentrality;
-
-  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(fghPriors[iS]->GetXaxis()->FindBin(centr),fghPriors[iS]->GetYaxis()->FindBin(t->Pt()));
+  const Float_t *priors = fPriorsCache[GetPriorsPtBin(t->Pt())];
 
 
   if((!fMaskAND[0] || fMaskCurrent[0]) && (!fMaskAND[1] || fMaskCurrent[1])){
@@ -901,7 +835,12 @@ void AliFlowBayesianPID::ComputeProb(const AliESDtrack *t,Float_t /*centrObsolet
     for(Int_t iS=0;iS<fgkNspecies;iS++) fProb[iS] = 0;
     fProbTofMism = 0;   
   }
-  
+
+  ComputeMassZ(t);
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::ComputeMassZ(const AliESDtrack *t){
+  // mass/Z from TOF and charge from the TPC dE/dx
   if(t->P() > 0.2 && t->GetTPCsignal() > 40 && (t->GetStatus() & AliESDtrack::kTOFout) && (t->GetStatus() & AliESDtrack::kTIME) && (t->GetIntegratedLength() > 365.)&& t->GetTOFsignal()> 12000){
     Double_t ptpc[3];
     t->GetInnerPxPyPz(ptpc);
@@ -935,12 +874,9 @@ void AliFlowBayesianPID::ComputeProb(const AliESDtrack *t,Float_t /*centrObsolet
 void AliFlowBayesianPID::ComputeProb(const AliAODTrack *t, const AliAODEvent *aod){
   // compute Bayesian probablities
   ComputeWeights(t,aod);
-  Float_t priors[fgkNspecies];
   fProbTofMism = 0;
 
-  Float_t centr = fCurrCentrality;
-
-  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(fghPriors[iS]->GetXaxis()->FindBin(centr),fghPriors[iS]->GetYaxis()->FindBin(t->Pt()));
+  const Float_t *priors = fPriorsCache[GetPriorsPtBin(t->Pt())];
 
 
   if((!fMaskAND[0] || fMaskCurrent[0]) && (!fMaskAND[1] || fMaskCurrent[1])){
@@ -994,6 +930,188 @@ void AliFlowBayesianPID::ComputeProb(const AliAODTrack *t, const AliAODEvent *ao
   
 }
 //________________________________________________________________________
+Int_t AliFlowBayesianPID::ComputeProb(Int_t ntracks,const AliESDtrack * const *tracks){
+  // compute Bayesian probablities for all the tracks of an event (NULL tracks get zero probabilities)
+  // results are stored as arrays over the tracks, see GetBatchProb()
+  ResizeBatch(ntracks);
+  for(Int_t i=0;i < ntracks;i++){
+    const AliESDtrack *t = tracks[i];
+    if(!t){
+      ClearBatchTrack(i);
+      continue;
+    }
+    ComputeWeights(t);
+    FillBatchTrack(i,t->Pt());
+    ComputeMassZ(t);
+    fBatchZ[i] = fZ;
+    fBatchMassTOF[i] = fMassTOF;
+  }
+  CombineBatch();
+  return ntracks;
+}
+//________________________________________________________________________
+Int_t AliFlowBayesianPID::ComputeProb(Int_t ntracks,const AliAODTrack * const *tracks,const AliAODEvent *aod){
+  // compute Bayesian probablities for all the tracks of an event (NULL tracks get zero probabilities)
+  // results are stored as arrays over the tracks, see GetBatchProb()
+  ResizeBatch(ntracks);
+  fZ=0;
+  fMassTOF=0;
+  for(Int_t i=0;i < ntracks;i++){
+    const AliAODTrack *t = tracks[i];
+    if(!t){
+      ClearBatchTrack(i);
+      continue;
+    }
+    ComputeWeights(t,aod);
+    FillBatchTrack(i,t->Pt());
+    fBatchZ[i] = 0; // track length not written in aod
+    fBatchMassTOF[i] = 0;
+  }
+  CombineBatch();
+  return ntracks;
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::ResizeBatch(Int_t ntracks){
+  // arrays are only grown, the allocation is reused for the following events
+  fNBatch = ntracks;
+  fBatchSize = TMath::Max(fBatchSize,ntracks);
+  fBatchWeights.resize(2*fgkNspecies*fBatchSize);
+  fBatchPriors.resize(fgkNspecies*fBatchSize);
+  fBatchProb.resize(fgkNspecies*fBatchSize);
+  fBatchTofMism.resize(fBatchSize);
+  fBatchProbTofMism.resize(fBatchSize);
+  fBatchAccepted.resize(fBatchSize);
+  fBatchZ.resize(fBatchSize);
+  fBatchMassTOF.resize(fBatchSize);
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::FillBatchTrack(Int_t i,Float_t pt){
+  // copy the detector weights of the current track into the batch arrays
+  const Float_t *priors = fPriorsCache[GetPriorsPtBin(pt)];
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    fBatchWeights[iS*fBatchSize+i] = fWeights[0][iS];
+    fBatchWeights[(fgkNspecies+iS)*fBatchSize+i] = fWeights[1][iS];
+    fBatchPriors[iS*fBatchSize+i] = priors[iS];
+  }
+  fBatchTofMism[i] = fWTofMism;
+  fBatchAccepted[i] = (!fMaskAND[0] || fMaskCurrent[0]) && (!fMaskAND[1] || fMaskCurrent[1]);
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::ClearBatchTrack(Int_t i){
+  // no track: all the weights are zero
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    fBatchWeights[iS*fBatchSize+i] = 0;
+    fBatchWeights[(fgkNspecies+iS)*fBatchSize+i] = 0;
+    fBatchPriors[iS*fBatchSize+i] = 0;
+  }
+  fBatchTofMism[i] = 0;
+  fBatchAccepted[i] = 0;
+  fBatchZ[i] = 0;
+  fBatchMassTOF[i] = 0;
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::CombineBatch(){
+  // Bayesian combination of TPC and TOF weights with the priors, loops run over the tracks
+  Float_t *rcc = &fBatchProbTofMism[0]; // normalization, then used for the mismatch probability
+
+  // normalization sum_s w_tpc w_tof C
+  for(Int_t i=0;i < fNBatch;i++) rcc[i] = 0;
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    const Float_t *wTPC = &fBatchWeights[iS*fBatchSize];
+    const Float_t *wTOF = &fBatchWeights[(fgkNspecies+iS)*fBatchSize];
+    const Float_t *prior = &fBatchPriors[iS*fBatchSize];
+    Float_t *prob = &fBatchProb[iS*fBatchSize];
+    for(Int_t i=0;i < fNBatch;i++){
+      prob[i] = wTPC[i]*wTOF[i]*prior[i];
+      rcc[i] += prob[i];
+    }
+  }
+
+  // probabilities
+  for(Int_t i=0;i < fNBatch;i++){
+    if(!fBatchAccepted[i] || !(rcc[i] > 0)) rcc[i] = 0;
+  }
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    Float_t *prob = &fBatchProb[iS*fBatchSize];
+    for(Int_t i=0;i < fNBatch;i++) prob[i] = (rcc[i] > 0) ? prob[i]/rcc[i] : 0;
+  }
+
+  // TOF mismatch probability sum_s w_tpc w_mism C / rcc
+  for(Int_t i=0;i < fNBatch;i++){
+    Float_t sum = 0;
+    for(Int_t iS=0;iS<fgkNspecies;iS++) sum += fBatchWeights[iS*fBatchSize+i]*fBatchPriors[iS*fBatchSize+i];
+    rcc[i] = (rcc[i] > 0) ? sum*fBatchTofMism[i]/rcc[i] : 0;
+  }
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::ComputeTPCWeights(const AliVTrack *t,Float_t momtpc,Float_t dedx,Int_t ncl){
+  // TPC weights for all the species: expected signals and resolutions first, then one response evaluation
+  Float_t centr = fCurrCentrality;
+  Float_t centrFactor = 1;
+  if(centr < 0) centrFactor *= 0.78;
+  if(centr < 10) centrFactor *= 1.0;
+  else if(centr < 20) centrFactor *= 1.0;
+  else if(centr < 30) centrFactor *= 1.0;
+  else if(centr < 40) centrFactor *= 0.95;
+  else if(centr < 50) centrFactor *= 0.93;
+  else if(centr < 60) centrFactor *= 0.91;
+  else if(centr < 70) centrFactor *= 0.88;
+  else centrFactor *= 0.83;
+
+  Float_t resolutionTPC[fgkNspecies],nsigma[fgkNspecies];
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    Float_t dedxExp=GetExpDeDx(t,iS);
+    if(iS < 7) resolutionTPC[iS] = fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,ncl,(AliPID::EParticleType) iS); // e,mu,pi,K,p,d,t
+    else resolutionTPC[iS] = fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[iS])*5*0.07; // 3He, 4He
+    resolutionTPC[iS] *= centrFactor;
+    nsigma[iS] = (dedx - dedxExp)/resolutionTPC[iS];
+  }
+
+  EvalResponse(fTPCResponsePar,nsigma,fWeights[0]);
+  for(Int_t iS=0;iS<fgkNspecies;iS++) fWeights[0][iS] /= resolutionTPC[iS];
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::ComputeTOFWeights(Float_t p,Float_t timeTOF,const Double_t *inttimes,Float_t mismatch){
+  // TOF weights for all the species (time resolution has to be set before)
+  Float_t expsigma[fgkNspecies],nsigma[fgkNspecies];
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    expsigma[iS] = fPIDesd->GetTOFResponse().GetExpectedSigma(p, inttimes[iS], fMass[iS]);
+    nsigma[iS] = (timeTOF - inttimes[iS])/expsigma[iS];
+  }
+
+  EvalResponse(fTOFResponsePar,nsigma,fWeights[1]);
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    if (TMath::Abs(timeTOF - inttimes[iS]) > 5*expsigma[iS]) fWeights[1][iS] = mismatch;
+    else fWeights[1][iS] = fWeights[1][iS]/expsigma[iS] + mismatch;
+  }
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::EvalResponse(const Double_t *par,const Float_t *x,Float_t *y){
+  // same shape as fTPCResponseF and fTOFResponseF (Gaussian + exponential tail) for all the species
+  // par = {norm,mean,sigma,tail start in sigma}
+  const Double_t cut = par[1]+par[3]*par[2];
+  const Double_t gausCoeff = -0.5/par[2]/par[2];
+  const Double_t tailCoeff = -par[3]/par[2];
+  const Double_t tailShift = par[1]+par[3]*par[2]*0.5;
+  for(Int_t iS=0;iS<fgkNspecies;iS++){
+    Double_t d = x[iS]-par[1];
+    Double_t arg = (x[iS] < cut) ? d*d*gausCoeff : (x[iS]-tailShift)*tailCoeff;
+    y[iS] = (x[iS] == cut) ? 0 : par[0]*TMath::Exp(arg);
+  }
+}
+//________________________________________________________________________
+Int_t AliFlowBayesianPID::GetPriorsPtBin(Float_t pt){
+  // pt bin of the priors, the cache is refreshed when the centrality bin changes
+  Int_t centrBin = fghPriors[0]->GetXaxis()->FindBin(fCurrCentrality);
+  if(centrBin != fPriorsCentrBin){
+    for(Int_t ipt=0;ipt < fgkNptPriors;ipt++){
+      for(Int_t iS=0;iS<fgkNspecies;iS++) fPriorsCache[ipt][iS] = fghPriors[iS]->GetBinContent(centrBin,ipt);
+    }
+    fPriorsCentrBin = centrBin;
+  }
+  return TMath::Min(fghPriors[0]->GetYaxis()->FindBin(pt),fgkNptPriors-1);
+}
+//________________________________________________________________________
 void AliFlowBayesianPID::SetPsiCorrectionDeDx(Float_t psi,Float_t res){
   fPsi=psi;
   fPsiRes=res;
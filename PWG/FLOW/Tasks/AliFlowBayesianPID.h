@@ -7,6 +7,8 @@
 #ifndef ALIFLOWBAYESIANPID_H
 #define ALIFLOWBAYESIANPID_H
 
+#include <vector>
+
 #include "AliESDpid.h"
 #include "AliPIDResponse.h"
 
@@ -68,6 +70,12 @@ More details:
      TH2D *hPr = mypid->GetHistoPriors(isp); // 2D (centrality - pT) histo for the priors of specie-isp (centrality < 0 means pp collisions)
                                              // all the priors are normalized to the pion ones
 
+Batch mode (all the tracks of the event in one call, same results as the track loop above):
+
+     mypid->ComputeProb(ntracks,tracks); // tracks = array of AliESDtrack* or AliAODTrack* (then also pass the AOD event)
+     const Float_t *probPi = mypid->GetBatchProb(2); // probability to be a pion for each track
+     const Float_t *probMism = mypid->GetBatchProbTofMism(); // TOF mismatch probability for each track
+
 */
 
 class AliFlowBayesianPID : public AliPIDResponse{
@@ -114,6 +122,16 @@ class AliFlowBayesianPID : public AliPIDResponse{
   void ComputeProb(const AliESDtrack *t){ComputeProb(t,0.0);}; 
   void ComputeWeights(const AliAODTrack *t,const AliAODEvent *aod=NULL);
   void ComputeProb(const AliAODTrack *t,const AliAODEvent *aod=NULL); // obsolete method
+  Int_t ComputeProb(Int_t ntracks,const AliESDtrack * const *tracks); // batch over the tracks of the event
+  Int_t ComputeProb(Int_t ntracks,const AliAODTrack * const *tracks,const AliAODEvent *aod=NULL); // batch over the tracks of the event
+
+  // batch results (arrays over the tracks of the last batch)
+  Int_t GetNBatchTracks() const {return fNBatch;};
+  const Float_t *GetBatchProb(Int_t specie) const {if(specie >=0 && specie < fgkNspecies && fNBatch > 0) return &fBatchProb[specie*fBatchSize]; else return NULL;};
+  const Float_t *GetBatchProbTofMism() const {return fNBatch > 0 ? &fBatchProbTofMism[0] : NULL;};
+  const Float_t *GetBatchZ() const {return fNBatch > 0 ? &fBatchZ[0] : NULL;};
+  const Float_t *GetBatchMassOverZ() const {return fNBatch > 0 ? &fBatchMassTOF[0] : NULL;};
+  Bool_t GetBatchAccepted(Int_t itrack) const {return (itrack >= 0 && itrack < fNBatch) ? fBatchAccepted[itrack] : kFALSE;};
 
   void SetTOFres(Float_t res){fTOFresolution=res;};
 
@@ -123,9 +141,19 @@ class AliFlowBayesianPID : public AliPIDResponse{
 
  private: 
   void SetPriors();
+  void ComputeMassZ(const AliESDtrack *t);
+  void ComputeTPCWeights(const AliVTrack *t,Float_t momtpc,Float_t dedx,Int_t ncl);
+  void ComputeTOFWeights(Float_t p,Float_t timeTOF,const Double_t *inttimes,Float_t mismatch);
+  static void EvalResponse(const Double_t *par,const Float_t *x,Float_t *y);
+  Int_t GetPriorsPtBin(Float_t pt);
+  void ResizeBatch(Int_t ntracks);
+  void FillBatchTrack(Int_t i,Float_t pt);
+  void ClearBatchTrack(Int_t i);
+  void CombineBatch();
 
   static const Int_t fgkNdetectors = 2; // Number of detector used for PID
   static const Int_t fgkNspecies = 9;// 0=el, 1=mu, 2=pi, 3=ka, 4=pr, 5=deuteron, 6=triton, 7=He3 
+  static const Int_t fgkNptPriors = 82; // pt bins of the priors histos (including underflow and overflow)
   static TH2D* fghPriors[fgkNspecies]; // histo with priors (hardcoded)
   static TSpline3 *fgMism; // function for mismatch
 
@@ -164,7 +192,23 @@ class AliFlowBayesianPID : public AliPIDResponse{
 
   static TH1D *fgHtofChannelDist; // channel distance from IP
 
-  ClassDef(AliFlowBayesianPID, 10); // example of analysis
+  Double_t fTOFResponsePar[4]; //! parameters of fTOFResponseF (evaluated inline)
+  Double_t fTPCResponsePar[4]; //! parameters of fTPCResponseF (evaluated inline)
+  Int_t fPriorsCentrBin; //! centrality bin of the cached priors (-1 = empty cache)
+  Float_t fPriorsCache[fgkNptPriors][fgkNspecies]; //! priors of the current centrality bin [pt bin][specie]
+
+  Int_t fNBatch; //! number of tracks in the last batch
+  Int_t fBatchSize; //! allocated tracks in the batch arrays
+  std::vector<Float_t> fBatchWeights; //! detector weights [det][specie][track]
+  std::vector<Float_t> fBatchPriors; //! priors [specie][track]
+  std::vector<Float_t> fBatchProb; //! Bayesian probabilities [specie][track]
+  std::vector<Float_t> fBatchTofMism; //! TOF mismatch weight [track]
+  std::vector<Float_t> fBatchProbTofMism; //! TOF mismatch probability [track]
+  std::vector<Char_t> fBatchAccepted; //! detector mask fulfilled [track]
+  std::vector<Float_t> fBatchZ; //! measured charge [track]
+  std::vector<Float_t> fBatchMassTOF; //! mass/Z [track]
+
+  ClassDef(AliFlowBayesianPID, 11); // example of analysis
 };
 
 #endif
@@ -1,5 +1,7 @@
 #include <vector>
 #include <iostream>
+#include <algorithm>
+#include <utility>
 
 #include "TMath.h"
 
@@ -17,7 +19,8 @@ ClassImp(AliEventClassifierSpherocity)
 
 AliEventClassifierSpherocity::AliEventClassifierSpherocity(const char* name, const char* title,
 					     TList *taskOutputList)
-  : AliEventClassifierBase(name, title, taskOutputList)
+  : AliEventClassifierBase(name, title, taskOutputList),
+    fUseExactSpherocity(kFALSE)
 {
   fExpectedMinValue = 0;
   fExpectedMaxValue = 1;
@@ -51,13 +54,60 @@ void AliEventClassifierSpherocity::CalculateClassifierValue(AliMCEvent *event, A
   // Step size in phi unit vector used to find m spherocity
   Float_t phiStepSize = 0.1;
 
-  // Computing total pt
+  // Computing total pt, selecting the tracks only once
   Float_t sumapt = 0;
+  vector<Double_t> pt, phi;
   Int_t ntracks = event->GetNumberOfTracks();
   for (Int_t iTrack = 0; iTrack < ntracks; iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
     if (!TrackPassesSelection(track, stack, iTrack)) continue;
     sumapt += track->Pt();
+    pt.push_back(track->Pt());
+    phi.push_back(track->Phi());
+  }
+  Int_t nselected = pt.size();
+
+  if (fUseExactSpherocity) {
+    // The sum of |pT x n| is concave between two consecutive track
+    // directions (modulo pi): its minimum is reached for n along one of
+    // the tracks. Fold the momenta to [0,pi), sort them in azimuth, and
+    // get each candidate from running sums (tracks before the axis count
+    // with a negative sign, the ones after with a positive sign).
+    vector<Double_t> px(nselected), py(nselected);
+    vector< pair<Double_t, Int_t> > order(nselected);
+    Double_t sumx = 0, sumy = 0;
+    for (Int_t i = 0; i < nselected; i++) {
+      px[i] = pt[i] * TMath::Cos(phi[i]);
+      py[i] = pt[i] * TMath::Sin(phi[i]);
+      Double_t psi = TMath::ATan2(py[i], px[i]);
+      if (psi < 0) {
+	psi += TMath::Pi();
+	px[i] = -px[i];
+	py[i] = -py[i];
+      }
+      if (psi >= TMath::Pi()) psi -= TMath::Pi();
+      order[i] = make_pair(psi, i);
+      sumx += px[i];
+      sumy += py[i];
+    }
+    sort(order.begin(), order.end());
+
+    Double_t belowx = 0, belowy = 0;
+    for (Int_t k = 0; k < nselected; k++) {
+      Int_t j = order[k].second;
+      Double_t ptj = TMath::Sqrt(px[j] * px[j] + py[j] * py[j]);
+      if (ptj > 0 && sumapt > 0) {
+	// projection on the normal to n = p_j / |p_j|
+	Double_t numerator = TMath::Abs(((sumx - 2 * belowx) * (-py[j]) + (sumy - 2 * belowy) * px[j]) / ptj);
+	sumRatioSquare = TMath::Power((numerator / sumapt), 2);
+	if (sumRatioSquare < minimalSumRatioSquare)
+	  minimalSumRatioSquare = sumRatioSquare;
+      }
+      belowx += px[j];
+      belowy += py[j];
+    }
+    fClassifierValue = (minimalSumRatioSquare * TMath::Pi() * TMath::Pi()) / 4.0;
+    return;
   }
   
   // Getting thrust
@@ -69,12 +119,9 @@ void AliEventClassifierSpherocity::CalculateClassifierValue(AliMCEvent *event, A
     phiparam=((TMath::Pi()) * i * phiStepSize) / 180; // parametrization of the angle
     nx = TMath::Cos(phiparam);            // x component of an unitary vector n
     ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-    for(Int_t iTrack = 0; iTrack < ntracks; ++iTrack){
-      AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
-      if (!TrackPassesSelection(track, stack, iTrack)) continue;
-      
-      Float_t pxA = track->Pt() * TMath::Cos(track->Phi());
-      Float_t pyA = track->Pt() * TMath::Sin(track->Phi());
+    for(Int_t iTrack = 0; iTrack < nselected; ++iTrack){
+      Float_t pxA = pt[iTrack] * TMath::Cos(phi[iTrack]);
+      Float_t pyA = pt[iTrack] * TMath::Sin(phi[iTrack]);
       //product between p projection in XY plane and the unitary vector
       numerator += TMath::Abs( ny * pxA - nx * pyA );
     }
@@ -6,16 +6,21 @@
 class AliEventClassifierSpherocity : public AliEventClassifierBase {
  public:
   AliEventClassifierSpherocity()
-    : AliEventClassifierBase() {}
+    : AliEventClassifierBase(), fUseExactSpherocity(kFALSE) {}
   AliEventClassifierSpherocity(const char* name, const char* title,
 			TList *taskOutputList);
   virtual ~AliEventClassifierSpherocity() {}
 
+  // Minimise over the track directions (exact) instead of the scan in steps of 0.1 degree
+  void SetUseExactSpherocity(Bool_t exact) { fUseExactSpherocity = exact; }
+
  private:
   Bool_t TrackPassesSelection(AliMCParticle* track, AliStack *stack, Int_t iTrack);
   void CalculateClassifierValue(AliMCEvent *event, AliStack *stack);
+
+  Bool_t fUseExactSpherocity;  // exact minimisation instead of the step scan
   
-  ClassDef(AliEventClassifierSpherocity, 1);
+  ClassDef(AliEventClassifierSpherocity, 2);
 };
 
 #endif
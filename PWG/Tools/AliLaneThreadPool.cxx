@@ -0,0 +1,240 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <TROOT.h>
+#endif
+#include <TObjArray.h>
+#include <TObjString.h>
+
+#include "AliLaneThreadPool.h"
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+/**
+ * Worker threads waiting for the lanes of the next ProcessLanes() call.
+ * Each call is a new generation: the workers wake up when the generation
+ * changes, take lanes until none is left, and the last one to finish
+ * wakes up the calling thread.
+ */
+struct AliLaneThreadPool::Workers {
+  std::vector<std::thread>    fThreads;                ///< Worker threads
+  std::mutex                  fMutex;                  ///< Protects the members below
+  std::condition_variable     fWakeUp;                 ///< New generation or stop
+  std::condition_variable     fFinished;               ///< All workers done with the generation
+  LaneProcessor              *fProcessor;              ///< Processor of the current generation
+  Int_t                       fNLanes;                 ///< Number of lanes of the current generation
+  std::atomic<Int_t>          fNextLane;               ///< Next lane to be processed
+  ULong64_t                   fGeneration;             ///< Number of ProcessLanes() calls
+  Int_t                       fNBusy;                  ///< Workers not done with the current generation
+  Bool_t                      fStop;                   ///< Workers have to return
+
+  Workers() : fThreads(), fMutex(), fWakeUp(), fFinished(), fProcessor(nullptr), fNLanes(0),
+    fNextLane(0), fGeneration(0), fNBusy(0), fStop(kFALSE) {}
+
+  void Drain(LaneProcessor *processor, Int_t nlanes) {
+    Int_t lane;
+    while((lane = fNextLane++) < nlanes) processor->ProcessLane(lane);
+  }
+
+  void Run() {
+    ULong64_t done = 0;
+    while(true){
+      LaneProcessor *processor = nullptr;
+      Int_t nlanes = 0;
+      {
+        std::unique_lock<std::mutex> lock(fMutex);
+        fWakeUp.wait(lock, [&]{ return fStop || fGeneration != done; });
+        if(fStop) return;
+        done = fGeneration;
+        processor = fProcessor;
+        nlanes = fNLanes;
+      }
+      Drain(processor, nlanes);
+      {
+        std::lock_guard<std::mutex> lock(fMutex);
+        if(--fNBusy == 0) fFinished.notify_one();
+      }
+    }
+  }
+};
+#else
+struct AliLaneThreadPool::Workers {
+};
+#endif
+
+AliLaneThreadPool::AliLaneThreadPool():
+  fParent(),
+  fOwner(),
+  fLanes(),
+  fWorkers(0)
+{
+}
+
+AliLaneThreadPool::~AliLaneThreadPool() {
+  StopThreads();
+}
+
+/**
+ * Start a new set of nitems items, each in its own lane until resources
+ * are declared.
+ * @param[in] nitems Number of items
+ */
+void AliLaneThreadPool::ResetLanes(Int_t nitems){
+  fParent.resize(nitems);
+  for(Int_t item = 0; item < nitems; item++) fParent[item] = item;
+  fOwner.clear();
+  fLanes.clear();
+}
+
+/**
+ * Declare resources shared by an item. The item is joined with all the
+ * items which declared one of the same names before.
+ * @param[in] item Index of the item
+ * @param[in] names Names of the resources, separated by blanks
+ */
+void AliLaneThreadPool::AddResources(Int_t item, const TString &names){
+  if(item < 0 || item >= GetNumberOfItems()) return;
+  TObjArray *tokens = names.Tokenize(" ");
+  for(Int_t itoken = 0; itoken < tokens->GetEntriesFast(); itoken++){
+    const TString &name = static_cast<TObjString *>(tokens->At(itoken))->GetString();
+    std::map<TString, Int_t>::iterator found = fOwner.find(name);
+    if(found == fOwner.end()) fOwner[name] = item;
+    else fParent[FindRoot(item)] = FindRoot(found->second);
+  }
+  delete tokens;
+}
+
+/**
+ * Group the items in lanes, once all the resources are declared.
+ */
+void AliLaneThreadPool::MakeLanes(){
+  fLanes.clear();
+  std::map<Int_t, Int_t> laneOfRoot;
+  for(Int_t item = 0; item < GetNumberOfItems(); item++){
+    Int_t root = FindRoot(item);
+    std::map<Int_t, Int_t>::iterator found = laneOfRoot.find(root);
+    if(found == laneOfRoot.end()){
+      found = laneOfRoot.insert(std::make_pair(root, Int_t(fLanes.size()))).first;
+      fLanes.push_back(std::vector<Int_t>());
+    }
+    fLanes[found->second].push_back(item);
+  }
+}
+
+Int_t AliLaneThreadPool::FindRoot(Int_t item){
+  while(fParent[item] != item) item = fParent[item] = fParent[fParent[item]];
+  return item;
+}
+
+/**
+ * Name of a resource identified by its address.
+ * @param[in] pointer Address of the shared object
+ * @return Resource name
+ */
+TString AliLaneThreadPool::GetPointerName(const void *pointer){
+  return TString::Format("%p", pointer);
+}
+
+/**
+ * Create the worker threads, they are kept until StopThreads() or the
+ * destruction of the pool. The calling thread of ProcessLanes() counts
+ * as one of the threads. Nothing is done without ROOT 6.
+ * @param[in] nthreads Number of threads, 0 for the number of cores
+ */
+void AliLaneThreadPool::StartThreads(Int_t nthreads){
+  StopThreads();
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if(nthreads <= 0) nthreads = GetNumberOfCores();
+  if(nthreads <= 1) return;
+
+  static std::once_flag threadSafety;
+  std::call_once(threadSafety, []{ ROOT::EnableThreadSafety(); });
+
+  fWorkers = new Workers;
+  for(Int_t ithread = 1; ithread < nthreads; ithread++)
+    fWorkers->fThreads.push_back(std::thread(&Workers::Run, fWorkers));
+#else
+  (void) nthreads;
+#endif
+}
+
+/**
+ * Stop and join the worker threads.
+ */
+void AliLaneThreadPool::StopThreads(){
+  if(!fWorkers) return;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  {
+    std::lock_guard<std::mutex> lock(fWorkers->fMutex);
+    fWorkers->fStop = kTRUE;
+  }
+  fWorkers->fWakeUp.notify_all();
+  for(auto &thread : fWorkers->fThreads) thread.join();
+#endif
+  delete fWorkers;
+  fWorkers = 0;
+}
+
+/**
+ * @return Number of threads processing the lanes, including the calling thread
+ */
+Int_t AliLaneThreadPool::GetNumberOfThreads() const {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if(fWorkers) return fWorkers->fThreads.size() + 1;
+#endif
+  return 1;
+}
+
+/**
+ * @return Number of cores of the machine, 1 without ROOT 6
+ */
+Int_t AliLaneThreadPool::GetNumberOfCores(){
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  Int_t ncores = std::thread::hardware_concurrency();
+  if(ncores > 0) return ncores;
+#endif
+  return 1;
+}
+
+/**
+ * Process all the lanes with the workers and the calling thread, returns
+ * when all the lanes are done.
+ * @param[in] processor Processing of one lane
+ */
+void AliLaneThreadPool::ProcessLanes(LaneProcessor &processor){
+  Int_t nlanes = GetNumberOfLanes();
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if(fWorkers && nlanes > 1){
+    {
+      std::lock_guard<std::mutex> lock(fWorkers->fMutex);
+      fWorkers->fProcessor = &processor;
+      fWorkers->fNLanes = nlanes;
+      fWorkers->fNextLane = 0;
+      fWorkers->fNBusy = fWorkers->fThreads.size();
+      fWorkers->fGeneration++;
+    }
+    fWorkers->fWakeUp.notify_all();
+    fWorkers->Drain(&processor, nlanes);
+    std::unique_lock<std::mutex> lock(fWorkers->fMutex);
+    fWorkers->fFinished.wait(lock, [&]{ return fWorkers->fNBusy == 0; });
+    return;
+  }
+#endif
+  for(Int_t lane = 0; lane < nlanes; lane++) processor.ProcessLane(lane);
+}
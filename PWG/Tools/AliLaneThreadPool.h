@@ -0,0 +1,85 @@
+#ifndef ALILANETHREADPOOL_H
+#define ALILANETHREADPOOL_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <map>
+#include <vector>
+#include <Rtypes.h>
+#include <TString.h>
+
+/**
+ * @class AliLaneThreadPool
+ * @brief Concurrent execution of independent lanes of work items in a persistent thread pool
+ *
+ * # Lanes
+ *
+ * The items (analyses, correction components, ...) are numbered 0 to n-1 in
+ * the order they are normally executed. Each item declares the resources it
+ * shares with other items (AOD branches, containers, objects, global state)
+ * as names with AddResources(). Items sharing a name, directly or through
+ * other items, are put in the same lane by MakeLanes(). The items of a lane
+ * keep their order, and lanes are ordered by their first item. Different
+ * lanes do not share any declared resource and can be processed concurrently.
+ * Pointers can be declared with their address as name, see GetPointerName().
+ *
+ * # Threads
+ *
+ * StartThreads() creates the worker threads once, they wait for work between
+ * two calls of ProcessLanes(). ProcessLanes() hands the lanes to the workers
+ * and to the calling thread, each taking the next lane not yet processed,
+ * and returns when all the lanes are done. ROOT thread safety is switched on
+ * with the first pool started. Without ROOT 6, or with a single thread, the
+ * lanes are processed one after the other in the calling thread.
+ *
+ * The pool is not thread safe itself: ProcessLanes() must not be called
+ * concurrently on the same pool.
+ */
+class AliLaneThreadPool {
+public:
+
+  /**
+   * @class LaneProcessor
+   * @brief Processing of the items of one lane, implemented by the user of the pool
+   */
+  class LaneProcessor {
+  public:
+    virtual ~LaneProcessor() {}
+    virtual void ProcessLane(Int_t lane) = 0;
+  };
+
+  AliLaneThreadPool();
+  virtual ~AliLaneThreadPool();
+
+  // Lanes
+  void ResetLanes(Int_t nitems);
+  void AddResources(Int_t item, const TString &names);
+  void MakeLanes();
+  Int_t GetNumberOfItems() const { return fParent.size(); }
+  Int_t GetNumberOfLanes() const { return fLanes.size(); }
+  const std::vector<Int_t> &GetLane(Int_t lane) const { return fLanes[lane]; }
+
+  static TString GetPointerName(const void *pointer);
+
+  // Threads
+  void StartThreads(Int_t nthreads);
+  void StopThreads();
+  Int_t GetNumberOfThreads() const;
+  static Int_t GetNumberOfCores();
+  void ProcessLanes(LaneProcessor &processor);
+
+private:
+  AliLaneThreadPool(const AliLaneThreadPool &);
+  AliLaneThreadPool &operator=(const AliLaneThreadPool &);
+
+  Int_t FindRoot(Int_t item);
+
+  struct Workers;
+
+  std::vector<Int_t>                fParent;           ///< Union-find parent of each item
+  std::map<TString, Int_t>          fOwner;            ///< First item declaring each resource
+  std::vector< std::vector<Int_t> > fLanes;            ///< Items of each lane
+  Workers                          *fWorkers;          ///< Worker threads, null if not started
+};
+
+#endif
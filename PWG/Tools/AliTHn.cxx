@@ -282,9 +282,9 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
 }
 
 template <class TemplateArray, typename TemplateType>
-void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBin(const Double_t *var)
 {
-  // fills an entry
+  // returns the global bin index of <var>, -1 if any variable is in the under/overflow
 
   // fill axis cache
   if (!axisCache)
@@ -327,13 +327,25 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 
     // under/overflow not supported
     if (tmpBin < 1 || tmpBin > fNbinsCache[i])
-      return;
+      return -1;
     
     // bins start from 0 here
     bin += tmpBin - 1;
 //     Printf("%lld", bin);
   }
 
+  return bin;
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+{
+  // fills an entry
+
+  Long64_t bin = GetGlobalBin(var);
+  if (bin < 0)
+    return;
+
   if (!fValues[istep])
   {
     fValues[istep] = new TemplateArray(fNBins);
@@ -360,6 +372,37 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::AddEntries(const Double_t *var, Int_t istep, Double_t sumw, Double_t sumw2)
+{
+  // adds the sum of weights <sumw> and of squared weights <sumw2> of several entries falling into the same bin
+  // equivalent to calling Fill for each of the entries
+
+  Long64_t bin = GetGlobalBin(var);
+  if (bin < 0)
+    return;
+
+  if (!fValues[istep])
+  {
+    fValues[istep] = new TemplateArray(fNBins);
+    AliInfo(Form("Created values container for step %d", istep));
+  }
+
+  if (sumw2 != sumw)
+  {
+    // not all weights are 1
+    if (!fSumw2[istep])
+    {
+      fSumw2[istep] = new TemplateArray(*fValues[istep]);
+      AliInfo(Form("Created sumw2 container for step %d", istep));
+    }
+  }
+
+  fValues[istep]->GetArray()[bin] += sumw;
+  if (fSumw2[istep])
+    fSumw2[istep]->GetArray()[bin] += sumw2;
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
@@ -48,6 +48,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  void AddEntries(const Double_t *var, Int_t istep, Double_t sumw, Double_t sumw2);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -66,6 +67,7 @@ class AliTHnT : public AliTHnBase
 protected:
   void Init();
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
+  Long64_t GetGlobalBin(const Double_t *var);
   
   Long64_t fNBins;   // number of total bins
   Int_t    fNVars;   // number of variables
@@ -50,7 +50,8 @@ ClassImp(AliHistogramCollection)
 
 //_____________________________________________________________________________
 AliHistogramCollection::AliHistogramCollection(const char* name, const char* title) 
-: TNamed(name,title), fMap(0x0), fMustShowEmptyHistogram(kFALSE), fMapVersion(0), fMessages()
+: TNamed(name,title), fMap(0x0), fMustShowEmptyHistogram(kFALSE), fMapVersion(0), fMessages(),
+  fHandles(), fHandleIdentifiers(), fHandleHistoNames(), fHandleHistos()
 {
   /// Ctor
 }
@@ -139,6 +140,7 @@ void
 AliHistogramCollection::Delete(Option_t*)
 {
   /// Delete all the histograms
+  ForgetHandleHistos();
   fMap->DeleteAll();
   delete fMap;
   fMap=0x0;
@@ -344,6 +346,95 @@ AliHistogramCollection::Histo(const char* keyA, const char* keyB,
   return InternalHisto(Form("/%s/%s/%s/%s/",keyA,keyB,keyC,keyD),histoname);
 }
 
+//_____________________________________________________________________________
+Int_t
+AliHistogramCollection::Handle(const char* identifier) const
+{
+  /// Get the handle of histogram keyA/keyB/keyC/keyD/histoname (or histoname
+  /// for a top level histogram), to be used with Histo(Int_t).
+  /// The identifier is interpreted as in Histo(const char*), but
+  /// no action (:PX, etc...) is allowed.
+  
+  TString keys, histoname;
+  
+  if (!InternalSplit(identifier,keys,histoname)) return -1;
+  
+  return InternalHandle(keys.Data(),histoname.Data());
+}
+
+//_____________________________________________________________________________
+Int_t
+AliHistogramCollection::Handle(const char* keyA, const char* histoname) const
+{
+  /// Get the handle of histo for (keyA,histoname)
+  
+  return InternalHandle(Form("/%s/",keyA),histoname);
+}
+
+//_____________________________________________________________________________
+Int_t
+AliHistogramCollection::Handle(const char* keyA, const char* keyB,
+                               const char* histoname) const
+{
+  /// Get the handle of histo for (keyA,keyB,histoname)
+  
+  return InternalHandle(Form("/%s/%s/",keyA,keyB),histoname);
+}
+
+//_____________________________________________________________________________
+Int_t
+AliHistogramCollection::Handle(const char* keyA, const char* keyB, const char* keyC,
+                               const char* histoname) const
+{
+  /// Get the handle of histo for (keyA,keyB,keyC,histoname)
+  
+  return InternalHandle(Form("/%s/%s/%s/",keyA,keyB,keyC),histoname);
+}
+
+//_____________________________________________________________________________
+Int_t
+AliHistogramCollection::Handle(const char* keyA, const char* keyB,
+                               const char* keyC, const char* keyD,
+                               const char* histoname) const
+{
+  /// Get the handle of histo for (keyA,keyB,keyC,keyD,histoname)
+  
+  return InternalHandle(Form("/%s/%s/%s/%s/",keyA,keyB,keyC,keyD),histoname);
+}
+
+//_____________________________________________________________________________
+Bool_t
+AliHistogramCollection::InternalSplit(const TString& identifier,
+                                      TString& keys, TString& histoname) const
+{
+  /// Split identifier keyA/keyB/keyC/keyD/histoname into the keys
+  /// (/keyA/keyB/keyC/keyD/) and the histogram name.
+  /// With 0 or 1 slash, the identifier is just the histogram name.
+  
+  Int_t nslashes = identifier.CountChar('/');
+  
+  keys = "";
+  histoname = identifier;
+  
+  if ( nslashes <= 1 ) return kTRUE;
+  
+  if ( nslashes > 5 )
+  {
+    AliError(Form("Invalid identifier %s",identifier.Data()));
+    return kFALSE;
+  }
+  
+  keys = "/";
+  for ( Int_t i = 0; i < nslashes-1; ++i )
+  {
+    keys += InternalDecode(identifier,i);
+    keys += "/";
+  }
+  histoname = InternalDecode(identifier,-1);
+  
+  return kTRUE;
+}
+
 //_____________________________________________________________________________
 TString
 AliHistogramCollection::HistoName(const char* identifier) const
@@ -412,42 +503,13 @@ AliHistogramCollection::Histo(const char* sidentifier) const
 
   delete a;
 
-  Int_t nslashes = identifier.CountChar('/');
-
   TH1* h(0x0);
   
-  switch (nslashes)
+  TString keys, histoname;
+  
+  if (InternalSplit(identifier,keys,histoname))
   {
-    case 0:
-    case 1:
-      // no slash : the identifier is just the histogram name
-      h = InternalHisto("",identifier);
-      break;      
-    case 2:
-      h = Histo(InternalDecode(identifier,0),
-                InternalDecode(identifier,-1));
-      break;
-    case 3:
-      h = Histo(InternalDecode(identifier,0),
-                InternalDecode(identifier,1),
-                InternalDecode(identifier,-1));
-      break;
-    case 4:
-      h = Histo(InternalDecode(identifier,0),
-                InternalDecode(identifier,1),
-                InternalDecode(identifier,2),
-                InternalDecode(identifier,-1));
-      break;
-    case 5:
-      h = Histo(InternalDecode(identifier,0),
-                InternalDecode(identifier,1),
-                InternalDecode(identifier,2),
-                InternalDecode(identifier,3),
-                InternalDecode(identifier,-1));
-      break;
-    default:
-      AliError(Form("Invalid identifier %s",identifier.Data()));
-      break;
+    h = InternalHisto(keys.Data(),histoname.Data());
   }
   
   if (h)
@@ -550,6 +612,63 @@ AliHistogramCollection::InternalHisto(const char* identifier,
   return h;
 }
 
+//_____________________________________________________________________________
+Int_t
+AliHistogramCollection::InternalHandle(const char* identifier,
+                                       const char* histoname) const
+{
+  /// Get the handle for (identifier,histoname), creating it if needed.
+  /// A handle is never invalidated : the same (identifier,histoname) always
+  /// gets the same handle, even if the histogram does not exist (yet), is
+  /// removed or adopted again. The histogram is then looked up again by
+  /// Histo(Int_t).
+  
+  std::string key(identifier);
+  key += histoname;
+  
+  std::map<std::string,Int_t>::const_iterator it = fHandles.find(key);
+  
+  if ( it != fHandles.end() ) return it->second;
+  
+  Int_t handle = fHandleHistos.size();
+  
+  fHandles[key] = handle;
+  fHandleIdentifiers.push_back(identifier);
+  fHandleHistoNames.push_back(histoname);
+  fHandleHistos.push_back(InternalHisto(identifier,histoname));
+  
+  return handle;
+}
+
+//_____________________________________________________________________________
+TH1*
+AliHistogramCollection::InternalHandleHisto(Int_t handle) const
+{
+  /// Slow path of Histo(Int_t) : look up the histogram of a handle
+  /// not resolved yet (or any more)
+  
+  if ( handle < 0 || handle >= static_cast<Int_t>(fHandleHistos.size()) )
+  {
+    TString msg(Form("Invalid handle %d",handle));
+    fMessages[msg.Data()]++;
+    return 0x0;
+  }
+  
+  fHandleHistos[handle] = InternalHisto(fHandleIdentifiers[handle].c_str(),
+                                        fHandleHistoNames[handle].c_str());
+  
+  return fHandleHistos[handle];
+}
+
+//_____________________________________________________________________________
+void
+AliHistogramCollection::ForgetHandleHistos() const
+{
+  /// Histograms will be looked up again at the next Histo(Int_t) call
+  
+  fHandleHistos.assign(fHandleHistos.size(),static_cast<TH1*>(0x0));
+}
+
 //_____________________________________________________________________________
 TString
 AliHistogramCollection::KeyA(const char* identifier) const
@@ -1194,6 +1313,9 @@ AliHistogramCollection::Remove(TObject* key)
     return 0x0;
   }
   
+  std::map<std::string,Int_t>::const_iterator it = fHandles.find(Form("%s%s",skey.Data(),h->GetName()));
+  if ( it != fHandles.end() ) fHandleHistos[it->second] = 0x0;
+  
   return o;
 }
 
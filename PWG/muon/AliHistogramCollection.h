@@ -16,6 +16,10 @@
 /// owner of the histograms it holds. This is why you should not
 /// use the (inherited from TCollection) Add() method but the Adopt() methods
 ///
+/// For histograms filled many times, the key path can be resolved once with
+/// the Handle() methods, and the histogram then obtained with Histo(handle),
+/// without any string manipulation or map lookup.
+///
 /// \author Laurent Aphecetche
 
 #ifndef ROOT_TNamed
@@ -30,6 +34,7 @@
 #include "Riostream.h"
 #include <map>
 #include <string>
+#include <vector>
 
 class TH1;
 class TMap;
@@ -73,6 +78,19 @@ public:
   TH1* Histo(const char* keyA, const char* keyB, const char* keyC, const char* histoname) const;
   TH1* Histo(const char* keyA, const char* keyB, const char* keyC, const char* keyD, const char* histoname) const;
   
+  Int_t Handle(const char* identifier) const;
+  Int_t Handle(const char* keyA, const char* histoname) const;
+  Int_t Handle(const char* keyA, const char* keyB, const char* histoname) const;
+  Int_t Handle(const char* keyA, const char* keyB, const char* keyC, const char* histoname) const;
+  Int_t Handle(const char* keyA, const char* keyB, const char* keyC, const char* keyD, const char* histoname) const;
+
+  /// Get histo from a handle obtained with Handle()
+  TH1* Histo(Int_t handle) const
+  {
+    if ( handle >= 0 && handle < static_cast<Int_t>(fHandleHistos.size()) && fHandleHistos[handle] ) return fHandleHistos[handle];
+    return InternalHandleHisto(handle);
+  }
+  
   virtual TIterator* CreateIterator(Bool_t dir = kIterForward) const;
   
   virtual TList* CreateListOfKeysA() const;
@@ -121,7 +139,16 @@ private:
 
   TString InternalDecode(const char* identifier, Int_t index) const;
   
+  Bool_t InternalSplit(const TString& identifier, TString& keys, TString& histoname) const;
+  
   TH1* InternalHisto(const char* identifier, const char* histoname) const;  
+  
+  Int_t InternalHandle(const char* identifier, const char* histoname) const;
+  
+  TH1* InternalHandleHisto(Int_t handle) const;
+  
+  void ForgetHandleHistos() const;
+  
   TObjArray* SortAllIdentifiers() const;
   
   TString NormalizeName(const char* identifier, const char* action) const;
@@ -134,8 +161,12 @@ private:
   Bool_t fMustShowEmptyHistogram; // Whether or not to show empty histograms with the Print method
   mutable Int_t fMapVersion; // internal version of map (to avoid custom streamer...)
   mutable std::map<std::string,int> fMessages; //! log messages
+  mutable std::map<std::string,Int_t> fHandles; //! handle of each full identifier
+  mutable std::vector<std::string> fHandleIdentifiers; //! identifier (/keyA/keyB/keyC/keyD/) of each handle
+  mutable std::vector<std::string> fHandleHistoNames; //! histogram name of each handle
+  mutable std::vector<TH1*> fHandleHistos; //! histogram of each handle, 0x0 if not (yet) resolved
   
-  ClassDef(AliHistogramCollection,7) // A collection of histograms
+  ClassDef(AliHistogramCollection,8) // A collection of histograms
 };
 
 class AliHistogramCollectionIterator : public TIterator
@@ -63,7 +63,13 @@ AliJFFlucAnalysis::AliJFFlucAnalysis()
 	//fh_Qvector(),
 	fh_ntracks(),
 	fh_vn(),
-	fh_vn_vn()
+	fh_vn_vn(),
+	fh_pt_flat(),
+	fh_eta_flat(),
+	fh_phi_flat(),
+	fh_vn_flat(),
+	fh_vn_vn_flat(),
+	fh_correlator_flat()
 {
 	const int NCent = 7;
 	static Double_t CentBin[NCent+1] = {0, 5, 10, 20, 30, 40, 50, 60};
@@ -116,7 +122,13 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const char *name)
 	//fh_Qvector(),
 	fh_ntracks(),
 	fh_vn(),
-	fh_vn_vn()
+	fh_vn_vn(),
+	fh_pt_flat(),
+	fh_eta_flat(),
+	fh_phi_flat(),
+	fh_vn_flat(),
+	fh_vn_vn_flat(),
+	fh_correlator_flat()
 {
 	cout << "analysis task created " << endl;
 	const int NCent = 7;
@@ -182,15 +194,25 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const AliJFFlucAnalysis& a):
 	fh_cent(a.fh_cent),
 	fh_ImpactParameter(a.fh_ImpactParameter),
 	fh_vertex(a.fh_vertex),
+	fh_pt(a.fh_pt),
 	fh_eta(a.fh_eta),
 	fh_phi(a.fh_phi),
 	//fh_Qvector(a.fh_Qvector),
 	fh_ntracks(a.fh_ntracks),
 	fh_vn(a.fh_vn),
-	fh_vn_vn(a.fh_vn_vn)
+	fh_vn_vn(a.fh_vn_vn),
+	fh_correlator(a.fh_correlator),
+	fh_pt_flat(),
+	fh_eta_flat(),
+	fh_phi_flat(),
+	fh_vn_flat(),
+	fh_vn_vn_flat(),
+	fh_correlator_flat()
 {
 	//copy constructor
 	//	DefineOutput(1, TList::Class() );
+	// the flat accessors stay unbound: the copied fh_* have no bins yet (see
+	// AliJTH1 copy constructor), they are bound at the first UserExec
 }
 //________________________________________________________________________
 AliJFFlucAnalysis& AliJFFlucAnalysis::operator = (const AliJFFlucAnalysis& ap){
@@ -342,11 +364,25 @@ void AliJFFlucAnalysis::UserCreateOutputObjects(){
 		<< "END" ; // fBin_h > not stand for harmonics, only for v2, v3, v4, v5
 	//AliJTH1D set done.
 
+	// strides for the direct access in the loops
+	BindFlatHistograms();
+
 	fHMG->Print();
 	fHMG->WriteConfig();
 
 }
 
+//________________________________________________________________________
+void AliJFFlucAnalysis::BindFlatHistograms(){
+	// flat accessors of the fills in the loops, on the fh_* of this object
+	fh_pt_flat.Set( fh_pt );
+	fh_eta_flat.Set( fh_eta );
+	fh_phi_flat.Set( fh_phi );
+	fh_vn_flat.Set( fh_vn );
+	fh_vn_vn_flat.Set( fh_vn_vn );
+	fh_correlator_flat.Set( fh_correlator );
+}
+
 //________________________________________________________________________
 AliJFFlucAnalysis::~AliJFFlucAnalysis() {
 	delete fInputList;
@@ -360,6 +396,7 @@ AliJFFlucAnalysis::~AliJFFlucAnalysis() {
 void AliJFFlucAnalysis::UserExec(Option_t *) {
 	// Main loop
 	// init
+	if( !fh_correlator_flat.IsSet() ) BindFlatHistograms(); // copies are bound here
 	for(int ih=0; ih<kNH; ih++){
 		for(int im=0; im<3; im++){ //method
 			fSingleVn[ih][im] = -9999;
@@ -469,7 +506,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	for(int ih=2; ih< kNH; ih++){
 		for(int ik=0; ik<nKL; ik++){
 			if(vn2[ih][ik] != -999)
-				fh_vn[ih][ik][fCBin]->Fill( vn2[ih][ik] , ebe_2p_weight ); // Fill hvn2
+				fh_vn_flat(ih,ik,fCBin)->Fill( vn2[ih][ik] , ebe_2p_weight ); // Fill hvn2
 		}
 	}
 
@@ -478,7 +515,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 			for( int ihh=2; ihh<kNH; ihh++){
 				for(int ikk=1; ikk<nKL; ikk++){
 					if(vn2_vn2[ih][ik][ihh][ikk] != -999 )
-						fh_vn_vn[ih][ik][ihh][ikk][fCBin]->Fill( vn2_vn2[ih][ik][ihh][ikk], ebe_4p_weight ) ; // Fill hvn_vn
+						fh_vn_vn_flat(ih,ik,ihh,ikk,fCBin)->Fill( vn2_vn2[ih][ik][ihh][ikk], ebe_4p_weight ) ; // Fill hvn_vn
 				}
 			}
 		}
@@ -514,31 +551,31 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	TComplex nV4V4V3V3 = (QnA[4]*QnB_star[4]*QnA[3]*QnB_star[3]) - ((1/(NSubTracks[1]-1) * QnB_star[7] * QnA[4] *QnA[3] ))
 		- ((1/(NSubTracks[0]-1) * QnA[7]*QnB_star[4] * QnB_star[3])) + (1/((NSubTracks[0]-1)*(NSubTracks[1]-1))*QnA[7]*QnB_star[7] );
 
-	fh_correlator[0][fCBin]->Fill( V4V2starv2_2.Re() );
-	fh_correlator[1][fCBin]->Fill( V4V2starv2_4.Re() );
-	fh_correlator[2][fCBin]->Fill( V4V2star.Re() ) ; // added 2015.3.18
-	fh_correlator[3][fCBin]->Fill( V5V2starV3starv2_2.Re() );
-	fh_correlator[4][fCBin]->Fill( V5V2starV3star.Re() );
-	fh_correlator[5][fCBin]->Fill( V5V2starV3startv3_2.Re() );
-	fh_correlator[6][fCBin]->Fill( V6V2star_3.Re() );
-	fh_correlator[7][fCBin]->Fill( V6V3star_2.Re() );
-	fh_correlator[8][fCBin]->Fill( V7V2star_2V3star.Re() ) ;
+	fh_correlator_flat(0,fCBin)->Fill( V4V2starv2_2.Re() );
+	fh_correlator_flat(1,fCBin)->Fill( V4V2starv2_4.Re() );
+	fh_correlator_flat(2,fCBin)->Fill( V4V2star.Re() ) ; // added 2015.3.18
+	fh_correlator_flat(3,fCBin)->Fill( V5V2starV3starv2_2.Re() );
+	fh_correlator_flat(4,fCBin)->Fill( V5V2starV3star.Re() );
+	fh_correlator_flat(5,fCBin)->Fill( V5V2starV3startv3_2.Re() );
+	fh_correlator_flat(6,fCBin)->Fill( V6V2star_3.Re() );
+	fh_correlator_flat(7,fCBin)->Fill( V6V3star_2.Re() );
+	fh_correlator_flat(8,fCBin)->Fill( V7V2star_2V3star.Re() ) ;
 
-	fh_correlator[9][fCBin]->Fill( nV4V2star.Re() ); // added 2015.6.10
-	fh_correlator[10][fCBin]->Fill( nV5V2starV3star.Re() );
-	fh_correlator[11][fCBin]->Fill( nV6V3star_2.Re() ) ;
+	fh_correlator_flat(9,fCBin)->Fill( nV4V2star.Re() ); // added 2015.6.10
+	fh_correlator_flat(10,fCBin)->Fill( nV5V2starV3star.Re() );
+	fh_correlator_flat(11,fCBin)->Fill( nV6V3star_2.Re() ) ;
 
 	// use this to avoid self-correlation 4p correlation (2 particles from A, 2 particles from B) -> MA(MA-1)MB(MB-1) : evt weight..
-	fh_correlator[12][fCBin]->Fill( nV4V4V2V2.Re() , ebe_4p_weight);
-	fh_correlator[13][fCBin]->Fill( nV3V3V2V2.Re() , ebe_4p_weight);
+	fh_correlator_flat(12,fCBin)->Fill( nV4V4V2V2.Re() , ebe_4p_weight);
+	fh_correlator_flat(13,fCBin)->Fill( nV3V3V2V2.Re() , ebe_4p_weight);
 
-	fh_correlator[14][fCBin]->Fill( nV5V5V2V2.Re() , ebe_4p_weight);
-	fh_correlator[15][fCBin]->Fill( nV5V5V3V3.Re() , ebe_4p_weight);
-	fh_correlator[16][fCBin]->Fill( nV4V4V3V3.Re() , ebe_4p_weight);
+	fh_correlator_flat(14,fCBin)->Fill( nV5V5V2V2.Re() , ebe_4p_weight);
+	fh_correlator_flat(15,fCBin)->Fill( nV5V5V3V3.Re() , ebe_4p_weight);
+	fh_correlator_flat(16,fCBin)->Fill( nV4V4V3V3.Re() , ebe_4p_weight);
 
 	//higher order correlators, added 2017.8.10
-	fh_correlator[17][fCBin]->Fill( V8V2starV3star_2.Re() );
-	fh_correlator[18][fCBin]->Fill( V8V2star_4.Re() );
+	fh_correlator_flat(17,fCBin)->Fill( V8V2starV3star_2.Re() );
+	fh_correlator_flat(18,fCBin)->Fill( V8V2star_4.Re() );
 
 
 	if(IsSCptdep == kTRUE){
@@ -717,12 +754,12 @@ void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
 		}
 		//
 		if( TMath::Abs(eta) > eta1 && TMath::Abs(eta) < eta2 ){
-			fh_eta[fCBin]->Fill(eta , 1./ effCorr );
-			fh_pt[fCBin]->Fill(pt, 1./ effCorr );
+			fh_eta_flat(fCBin)->Fill(eta , 1./ effCorr );
+			fh_pt_flat(fCBin)->Fill(pt, 1./ effCorr );
 			if( eta < 0 )
-				fh_phi[fCBin][0]->Fill( phi_module_corr * phi, 1./effCorr) ;
+				fh_phi_flat(fCBin,0)->Fill( phi_module_corr * phi, 1./effCorr) ;
 			if( eta > 0 )
-				fh_phi[fCBin][1]->Fill( phi_module_corr * phi, 1./effCorr) ;
+				fh_phi_flat(fCBin,1)->Fill( phi_module_corr * phi, 1./effCorr) ;
 		}
 	}
 	for(int iaxis=0; iaxis<3; iaxis++){
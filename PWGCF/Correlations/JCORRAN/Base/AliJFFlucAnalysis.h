@@ -74,6 +74,8 @@ public:
 	Double_t Get_vn( int ih, int imethod ){ return fSingleVn[ih][imethod]; } // method 0:SP, 1:QC(with eta gap), 2:QC(without eta gap)
 
 private:
+	void BindFlatHistograms(); // bind the flat accessors to the fh_* of this object
+
 	enum{kH0, kH1, kH2, kH3, kH4, kH5, kH6, kH7, kH8, kNH}; //harmonics // do we need vn up to v8? .. yes we need..
 	enum{kK0, kK1, kK2, kK3, kK4, nKL}; // order // do we really need vn^8
 
@@ -154,7 +156,15 @@ private:
 	AliJTH1D fh_QvectorQCphi;//!
 	AliJTH1D fh_evt_SP_QC_ratio_2p;//! // check SP QC evt by evt ratio
 	AliJTH1D fh_evt_SP_QC_ratio_4p;//! // check SP QC evt by evt ratio
-	ClassDef(AliJFFlucAnalysis, 1); // example of analysis
+
+	// flat accessors for the fills in the track and harmonic loops, same histograms as above
+	AliJTH1Flat<TH1D,1> fh_pt_flat;//! // [iCent]
+	AliJTH1Flat<TH1D,1> fh_eta_flat;//! // [iCent]
+	AliJTH1Flat<TH1D,2> fh_phi_flat;//! // [iCent][isub]
+	AliJTH1Flat<TH1D,3> fh_vn_flat;//! // [ih][ik][iCent]
+	AliJTH1Flat<TH1D,5> fh_vn_vn_flat;//! // [ih][ik][ihh][ikk][iCent]
+	AliJTH1Flat<TH1D,2> fh_correlator_flat;//! // [icorr][iCent]
+	ClassDef(AliJFFlucAnalysis, 2); // example of analysis
 };
 
 #endif
@@ -369,6 +369,88 @@ class AliJTH1DerivedPlayer {
         AliJTH1Derived<T> * fCMD;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// AliJTH1Flat                                                          //
+//                                                                      //
+// Direct access to the histograms of an AliJTH1Derived with N indices. //
+// The strides are computed once in Set(), after the bins are fixed     //
+// with "END", and the histograms are kept in a flat vector:            //
+//   AliJTH1Flat<TH1D,2> hphi( fh_phi );  hphi(ic,isub)->Fill(phi);     //
+// is the same histogram as fh_phi[ic][isub], without the index setting //
+// of the player. Histograms not built yet (Lazy) are built by the      //
+// AliJTH1Derived at first access, with the same name and directory.    //
+//////////////////////////////////////////////////////////////////////////
+// Compile time check of the number of indices of AliJTH1Flat::operator():
+// only the specialisation for a right number of indices is defined.
+template< bool RightNumberOfIndices > struct AliJTH1FlatCheckIndices;
+template<> struct AliJTH1FlatCheckIndices<true> { AliJTH1FlatCheckIndices(){} };
+
+template< typename T, int N >
+class AliJTH1Flat {
+    public:
+        AliJTH1Flat():fCMD(NULL),fItems(){ for( int d=0;d<N;d++ ){ fSize[d]=0;fStride[d]=0; } }
+        AliJTH1Flat( AliJTH1Derived<T> & cmd ):fCMD(NULL),fItems(){ Set(cmd); }
+        void Set( AliJTH1Derived<T> & cmd ){
+            if( cmd.GetEntries() == 0 ) { JERROR(cmd.GetName()+" has no fixed bins, add \"END\" first"); }
+            if( cmd.Dimension() != N ) { JERROR(Form("%s has dimension %d, not %d",cmd.GetName().Data(),cmd.Dimension(),N)); }
+            fCMD = &cmd;
+            int stride = 1;
+            for( int d=N-1;d>=0;d-- ){
+                fSize[d] = cmd.SizeOf(d);
+                fStride[d] = stride;
+                stride *= fSize[d];
+            }
+            fItems.assign( stride, (T*)NULL );
+        }
+        bool IsSet() const { return fCMD != NULL; }
+
+        T* operator()( int i0 ){
+            AliJTH1FlatCheckIndices< N == 1 >(); // compile time check
+            int i[1] = {i0}; return At(i);
+        }
+        T* operator()( int i0, int i1 ){
+            AliJTH1FlatCheckIndices< N == 2 >(); // compile time check
+            int i[2] = {i0,i1}; return At(i);
+        }
+        T* operator()( int i0, int i1, int i2 ){
+            AliJTH1FlatCheckIndices< N == 3 >(); // compile time check
+            int i[3] = {i0,i1,i2}; return At(i);
+        }
+        T* operator()( int i0, int i1, int i2, int i3 ){
+            AliJTH1FlatCheckIndices< N == 4 >(); // compile time check
+            int i[4] = {i0,i1,i2,i3}; return At(i);
+        }
+        T* operator()( int i0, int i1, int i2, int i3, int i4 ){
+            AliJTH1FlatCheckIndices< N == 5 >(); // compile time check
+            int i[5] = {i0,i1,i2,i3,i4}; return At(i);
+        }
+        T* operator()( int i0, int i1, int i2, int i3, int i4, int i5 ){
+            AliJTH1FlatCheckIndices< N == 6 >(); // compile time check
+            int i[6] = {i0,i1,i2,i3,i4,i5}; return At(i);
+        }
+        T* At( const int * index ){
+            int iG = 0;
+            for( int d=0;d<N;d++ ){
+                if( unsigned(index[d]) >= unsigned(fSize[d]) ){ JERROR(Form("wrong Index %d of %dth in ",index[d],d)+fCMD->GetName()); }
+                iG += index[d]*fStride[d];
+            }
+            T * item = fItems[iG];
+            return item ? item : Build(iG);
+        }
+    private:
+        T* Build( int iG ){
+            fCMD->ClearIndex();
+            for( int d=0;d<N;d++ ) fCMD->SetIndex( (iG/fStride[d])%fSize[d], d );
+            T * item = static_cast<T*>(fCMD->GetItem());
+            fItems[iG] = item;
+            return item;
+        }
+        AliJTH1Derived<T> * fCMD;
+        int fSize[N];
+        int fStride[N];
+        std::vector<T*> fItems;
+};
+
 typedef AliJTH1Derived<TH1D> AliJTH1D;
 typedef AliJTH1Derived<TH2D> AliJTH2D;
 typedef AliJTH1Derived<TProfile> AliJTProfile;
@@ -0,0 +1,376 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-----------------------------------------------------------------
+//           Pair distributions from FFT cross-correlations
+//   Used by AliBalancePsi (see UsePairFFT) for the (Delta eta,
+//   Delta phi) distributions of the charge combinations
+//-----------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <TMath.h>
+#include <TAxis.h>
+
+#include "AliBalancePairFFT.h"
+
+//____________________________________________________________________//
+AliBalancePairFFT::AliBalancePairFFT() :
+  fNSubBins(1),
+  fNDeltaEtaBins(0),
+  fNDeltaPhiBins(0),
+  fDeltaEtaEdges(),
+  fEtaCellWidth(0.),
+  fNPhiCells(0),
+  fPhiOffsetBin(),
+  fEtaMin(0.),
+  fNEtaCells(0),
+  fEtaOffsetBin(),
+  fEtaPlan(),
+  fPhiPlan(),
+  fUnitWeights(kTRUE),
+  fTrigger(),
+  fAssociated(),
+  fAssociatedGroupOfId(),
+  fAssociatedIndexOfId(),
+  fProduct(),
+  fProductW2(),
+  fLineOut(),
+  fScratch() {
+  // Default constructor
+  fEtaPlan.fN = 0;
+  fPhiPlan.fN = 0;
+}
+
+//____________________________________________________________________//
+Bool_t AliBalancePairFFT::Configure(const TAxis *deltaEta, const TAxis *deltaPhi, Int_t nSubBins) {
+  // Sets up the grids for the given pair axes.
+  // Both axes need (approximately, edges are given with a few digits)
+  // uniform bins and the Delta phi axis has to cover 2 pi.
+  if(!deltaEta || !deltaPhi) return kFALSE;
+  fNSubBins = (nSubBins < 1) ? 1 : nSubBins;
+
+  const TAxis *axes[2] = {deltaEta, deltaPhi};
+  for(Int_t iAxis = 0; iAxis < 2; iAxis++) {
+    Int_t nBins = axes[iAxis]->GetNbins();
+    Double_t width = (axes[iAxis]->GetXmax() - axes[iAxis]->GetXmin())/nBins;
+    for(Int_t iBin = 1; iBin <= nBins; iBin++) {
+      if(TMath::Abs(axes[iAxis]->GetBinWidth(iBin) - width) > 1e-3*width)
+	return kFALSE;
+    }
+  }
+  if(TMath::Abs(deltaPhi->GetXmax() - deltaPhi->GetXmin() - TMath::TwoPi()) > 1e-3)
+    return kFALSE;
+
+  // Delta eta
+  fNDeltaEtaBins = deltaEta->GetNbins();
+  fDeltaEtaEdges.resize(fNDeltaEtaBins+1);
+  for(Int_t iBin = 0; iBin <= fNDeltaEtaBins; iBin++)
+    fDeltaEtaEdges[iBin] = deltaEta->GetBinLowEdge(iBin+1);
+  fEtaCellWidth = (deltaEta->GetXmax() - deltaEta->GetXmin())/fNDeltaEtaBins/fNSubBins;
+
+  // Delta phi: periodic, the offset of two cells is mapped to the axis range
+  fNDeltaPhiBins = deltaPhi->GetNbins();
+  fNPhiCells = fNDeltaPhiBins*fNSubBins;
+  Double_t phiCellWidth = TMath::TwoPi()/fNPhiCells;
+  fPhiOffsetBin.resize(fNPhiCells);
+  for(Int_t iCell = 0; iCell < fNPhiCells; iCell++) {
+    Double_t dphi = (iCell + 0.5)*phiCellWidth;
+    while(dphi >= deltaPhi->GetXmin() + TMath::TwoPi()) dphi -= TMath::TwoPi();
+    while(dphi < deltaPhi->GetXmin()) dphi += TMath::TwoPi();
+    Int_t bin = deltaPhi->FindFixBin(dphi);
+    fPhiOffsetBin[iCell] = (bin >= 1 && bin <= fNDeltaPhiBins) ? bin-1 : -1;
+  }
+  MakePlan(fPhiPlan, fNPhiCells);
+  fEtaPlan.fN = 0;
+
+  return kTRUE;
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::Reset(Double_t etaMin, Double_t etaMax, Int_t nTriggerGroups, Int_t nAssociatedGroups) {
+  // Prepares a new event: all particles have etaMin <= eta <= etaMax
+  for(UInt_t iGroup = 0; iGroup < fAssociated.size(); iGroup++) {
+    const std::vector<Int_t> &ids = fAssociated[iGroup].fId;
+    for(UInt_t i = 0; i < ids.size(); i++) fAssociatedGroupOfId[ids[i]] = -1;
+  }
+  fTrigger.resize(nTriggerGroups);
+  fAssociated.resize(nAssociatedGroups);
+  for(Int_t iGroup = 0; iGroup < nTriggerGroups; iGroup++) fTrigger[iGroup].Clear();
+  for(Int_t iGroup = 0; iGroup < nAssociatedGroups; iGroup++) fAssociated[iGroup].Clear();
+  fUnitWeights = kTRUE;
+
+  // trigger cells 0..fNEtaCells-1, associated cells 0..fNEtaCells (half a cell shifted)
+  fEtaMin = etaMin;
+  fNEtaCells = (Int_t)((etaMax - etaMin)/fEtaCellWidth) + 1;
+  Int_t nEta = NextFastSize(2*fNEtaCells);
+  if(nEta != fEtaPlan.fN) MakePlan(fEtaPlan, nEta);
+
+  // cell offsets -fNEtaCells ... fNEtaCells-1
+  fEtaOffsetBin.resize(2*fNEtaCells);
+  for(Int_t iOffset = 0; iOffset < 2*fNEtaCells; iOffset++) {
+    Double_t deta = (iOffset - fNEtaCells + 0.5)*fEtaCellWidth;
+    Int_t bin = std::upper_bound(fDeltaEtaEdges.begin(), fDeltaEtaEdges.end(), deta) - fDeltaEtaEdges.begin();
+    fEtaOffsetBin[iOffset] = (bin >= 1 && bin <= fNDeltaEtaBins) ? bin-1 : -1;
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::AddTrigger(Int_t group, Int_t id, Double_t eta, Double_t phi, Double_t weight) {
+  // Adds a trigger particle to a group
+  Group_t &g = fTrigger[group];
+  Int_t etaCell = (Int_t)((eta - fEtaMin)/fEtaCellWidth);
+  if(etaCell > fNEtaCells-1) etaCell = fNEtaCells-1;
+  if(etaCell < 0) etaCell = 0;
+  Int_t phiCell = (Int_t)TMath::Floor(phi/TMath::TwoPi()*fNPhiCells) % fNPhiCells;
+  if(phiCell < 0) phiCell += fNPhiCells;
+  g.fId.push_back(id);
+  g.fEtaCell.push_back(etaCell);
+  g.fPhiCell.push_back(phiCell);
+  g.fWeight.push_back(weight);
+  if(weight != 1.) fUnitWeights = kFALSE;
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::AddAssociated(Int_t group, Int_t id, Double_t eta, Double_t phi, Double_t weight) {
+  // Adds an associated particle to a group (grid shifted by half a cell)
+  Group_t &g = fAssociated[group];
+  Int_t etaCell = (Int_t)((eta - fEtaMin)/fEtaCellWidth + 0.5);
+  if(etaCell > fNEtaCells) etaCell = fNEtaCells;
+  if(etaCell < 0) etaCell = 0;
+  Int_t phiCell = (Int_t)TMath::Floor(phi/TMath::TwoPi()*fNPhiCells + 0.5) % fNPhiCells;
+  if(phiCell < 0) phiCell += fNPhiCells;
+  if(id >= (Int_t)fAssociatedGroupOfId.size()) {
+    fAssociatedGroupOfId.resize(id+1, -1);
+    fAssociatedIndexOfId.resize(id+1, -1);
+  }
+  fAssociatedGroupOfId[id] = group;
+  fAssociatedIndexOfId[id] = g.fId.size();
+  g.fId.push_back(id);
+  g.fEtaCell.push_back(etaCell);
+  g.fPhiCell.push_back(phiCell);
+  g.fWeight.push_back(weight);
+  if(weight != 1.) fUnitWeights = kFALSE;
+}
+
+//____________________________________________________________________//
+Bool_t AliBalancePairFFT::IsFFTFavourable(Int_t triggerGroup, Int_t associatedGroup) const {
+  // Rough cost model (in units of one AliTHn fill of the pair loop):
+  // inverse FFT ~0.1 per point and stage, one fill per pair bin
+  Double_t nPairs = (Double_t)fTrigger[triggerGroup].fId.size()*fAssociated[associatedGroup].fId.size();
+  Double_t nPoints = (Double_t)fEtaPlan.fN*fNPhiCells;
+  return nPairs > 0.1*nPoints*TMath::Log2(nPoints) + 1.25*fNDeltaEtaBins*fNDeltaPhiBins;
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::Correlate(Int_t triggerGroup, Int_t associatedGroup, Bool_t excludeSelf,
+				  std::vector<Double_t> &sumw, std::vector<Double_t> &sumw2) {
+  // Sum of weights (and of squared weights) of the pairs of a trigger and
+  // an associated group in the (Delta eta, Delta phi) bins.
+  // With unit weights the pair counts are rounded to integers.
+  Group_t &trigger = fTrigger[triggerGroup];
+  Group_t &associated = fAssociated[associatedGroup];
+  if(!trigger.fHasSpectrum) MakeSpectrum(trigger);
+  if(!associated.fHasSpectrum) MakeSpectrum(associated);
+
+  const Int_t nEta = fEtaPlan.fN;
+  const Int_t nPhi = fNPhiCells;
+  const Int_t nPoints = nEta*nPhi;
+
+  // cross-correlation: IFFT( T * conj(A) )
+  fProduct.resize(nPoints);
+  for(Int_t k = 0; k < nPoints; k++) fProduct[k] = trigger.fSpectrum[k]*std::conj(associated.fSpectrum[k]);
+  Transform2D(fProduct, kTRUE);
+  if(!fUnitWeights) {
+    fProductW2.resize(nPoints);
+    for(Int_t k = 0; k < nPoints; k++) fProductW2[k] = trigger.fSpectrumW2[k]*std::conj(associated.fSpectrumW2[k]);
+    Transform2D(fProductW2, kTRUE);
+  }
+
+  // no auto-correlations: remove the pairs of a particle with itself
+  if(excludeSelf) {
+    for(UInt_t i = 0; i < trigger.fId.size(); i++) {
+      Int_t id = trigger.fId[i];
+      if(id >= (Int_t)fAssociatedGroupOfId.size() || fAssociatedGroupOfId[id] != associatedGroup) continue;
+      Int_t j = fAssociatedIndexOfId[id];
+      Int_t dEta = (trigger.fEtaCell[i] - associated.fEtaCell[j] + nEta) % nEta;
+      Int_t dPhi = (trigger.fPhiCell[i] - associated.fPhiCell[j] + nPhi) % nPhi;
+      Double_t w2 = trigger.fWeight[i]*associated.fWeight[j];
+      fProduct[dEta*nPhi+dPhi] -= w2*nPoints;
+      if(!fUnitWeights) fProductW2[dEta*nPhi+dPhi] -= w2*w2*nPoints;
+    }
+  }
+
+  // numerical noise of the transforms
+  Double_t tolerance = 0.;
+  if(!fUnitWeights) {
+    Double_t sumTrigger = 0., sumAssociated = 0.;
+    for(UInt_t i = 0; i < trigger.fWeight.size(); i++) sumTrigger += TMath::Abs(trigger.fWeight[i]);
+    for(UInt_t j = 0; j < associated.fWeight.size(); j++) sumAssociated += TMath::Abs(associated.fWeight[j]);
+    tolerance = 1e-10*sumTrigger*sumAssociated;
+  }
+
+  sumw.assign(fNDeltaEtaBins*fNDeltaPhiBins, 0.);
+  sumw2.assign(fNDeltaEtaBins*fNDeltaPhiBins, 0.);
+  const Double_t norm = 1./nPoints;
+  for(Int_t iOffset = 0; iOffset < 2*fNEtaCells; iOffset++) {
+    Int_t binEta = fEtaOffsetBin[iOffset];
+    if(binEta < 0) continue;
+    Int_t row = ((iOffset - fNEtaCells) + nEta) % nEta;
+    for(Int_t dPhi = 0; dPhi < nPhi; dPhi++) {
+      Int_t binPhi = fPhiOffsetBin[dPhi];
+      if(binPhi < 0) continue;
+      Int_t bin = binEta*fNDeltaPhiBins + binPhi;
+      Double_t x = fProduct[row*nPhi+dPhi].real()*norm;
+      if(fUnitWeights) {
+	x = TMath::Floor(x + 0.5);
+	if(x <= 0.) continue;
+	sumw[bin] += x;
+	sumw2[bin] += x;
+      }
+      else {
+	if(TMath::Abs(x) <= tolerance) continue;
+	sumw[bin] += x;
+	sumw2[bin] += fProductW2[row*nPhi+dPhi].real()*norm;
+      }
+    }
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::MakeSpectrum(Group_t &group) {
+  // 2D FFT of the weight grid of a group (and of the squared weights if needed)
+  const Int_t nPoints = fEtaPlan.fN*fNPhiCells;
+  for(Int_t iPower = 1; iPower <= (fUnitWeights ? 1 : 2); iPower++) {
+    std::vector<Complex_t> &grid = (iPower == 1) ? group.fSpectrum : group.fSpectrumW2;
+    grid.assign(nPoints, Complex_t(0.,0.));
+    for(UInt_t i = 0; i < group.fId.size(); i++) {
+      Double_t w = (iPower == 1) ? group.fWeight[i] : group.fWeight[i]*group.fWeight[i];
+      grid[group.fEtaCell[i]*fNPhiCells + group.fPhiCell[i]] += w;
+    }
+    Transform2D(grid, kFALSE);
+  }
+  group.fHasSpectrum = kTRUE;
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::Transform2D(std::vector<Complex_t> &grid, Bool_t inverse) {
+  // In-place 2D FFT (rows: phi, columns: eta). The inverse is not normalised.
+  const Int_t nEta = fEtaPlan.fN;
+  const Int_t nPhi = fNPhiCells;
+  if(inverse)
+    for(UInt_t k = 0; k < grid.size(); k++) grid[k] = std::conj(grid[k]);
+
+  fLineOut.resize(TMath::Max(nEta, nPhi));
+  // rows (empty rows of the particle grids stay empty)
+  for(Int_t iEta = 0; iEta < nEta; iEta++) {
+    Complex_t *row = &grid[iEta*nPhi];
+    Bool_t empty = kTRUE;
+    for(Int_t iPhi = 0; iPhi < nPhi && empty; iPhi++) empty = (row[iPhi] == Complex_t(0.,0.));
+    if(empty) continue;
+    Transform(fPhiPlan, row, 1, &fLineOut[0], &fPhiPlan.fFactors[0], 1, fScratch);
+    std::copy(fLineOut.begin(), fLineOut.begin()+nPhi, row);
+  }
+  // columns
+  for(Int_t iPhi = 0; iPhi < nPhi; iPhi++) {
+    Transform(fEtaPlan, &grid[iPhi], nPhi, &fLineOut[0], &fEtaPlan.fFactors[0], 1, fScratch);
+    for(Int_t iEta = 0; iEta < nEta; iEta++) grid[iEta*nPhi+iPhi] = fLineOut[iEta];
+  }
+
+  if(inverse)
+    for(UInt_t k = 0; k < grid.size(); k++) grid[k] = std::conj(grid[k]);
+}
+
+//____________________________________________________________________//
+Int_t AliBalancePairFFT::NextFastSize(Int_t n) {
+  // Smallest m >= n with prime factors 2, 3 and 5 only
+  if(n < 1) return 1;
+  for(Int_t m = n; ; m++) {
+    Int_t r = m;
+    while(r % 2 == 0) r /= 2;
+    while(r % 3 == 0) r /= 3;
+    while(r % 5 == 0) r /= 5;
+    if(r == 1) return m;
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::MakePlan(Plan_t &plan, Int_t n) {
+  // Factorisation (radix 4 first, then 2, 3, 5, ...) and twiddle factors
+  plan.fN = n;
+  plan.fFactors.clear();
+  Int_t p = 4;
+  Int_t remaining = n;
+  do {
+    while(remaining % p) {
+      if(p == 4) p = 2;
+      else if(p == 2) p = 3;
+      else p += 2;
+      if(p*p > remaining) p = remaining;
+    }
+    remaining /= p;
+    plan.fFactors.push_back(p);
+    plan.fFactors.push_back(remaining);
+  } while(remaining > 1);
+
+  plan.fTwiddles.resize(n);
+  for(Int_t k = 0; k < n; k++) {
+    Double_t phase = -TMath::TwoPi()*k/n;
+    plan.fTwiddles[k] = Complex_t(TMath::Cos(phase), TMath::Sin(phase));
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePairFFT::Transform(const Plan_t &plan, const Complex_t *in, Int_t inStride, Complex_t *out,
+				  const Int_t *factors, Int_t fstride, std::vector<Complex_t> &scratch) {
+  // Recursive mixed-radix decimation in time (forward transform):
+  // out[k] = sum_j in[j*inStride] exp(-2 pi i j k / n)
+  const Int_t p = factors[0];
+  const Int_t m = factors[1];
+
+  if(m == 1) {
+    for(Int_t k = 0; k < p; k++) out[k] = in[k*fstride*inStride];
+  }
+  else {
+    for(Int_t q = 0; q < p; q++)
+      Transform(plan, in + q*fstride*inStride, inStride, out + q*m, factors + 2, fstride*p, scratch);
+  }
+
+  const Complex_t *twiddles = &plan.fTwiddles[0];
+  if(p == 2) {
+    for(Int_t k = 0; k < m; k++) {
+      Complex_t t = out[k+m]*twiddles[k*fstride];
+      out[k+m] = out[k] - t;
+      out[k] += t;
+    }
+    return;
+  }
+
+  // generic butterfly
+  if((Int_t)scratch.size() < p) scratch.resize(p);
+  for(Int_t u = 0; u < m; u++) {
+    for(Int_t q1 = 0, k = u; q1 < p; q1++, k += m) scratch[q1] = out[k];
+    for(Int_t q1 = 0, k = u; q1 < p; q1++, k += m) {
+      Int_t twiddleIndex = 0;
+      Complex_t sum = scratch[0];
+      for(Int_t q = 1; q < p; q++) {
+	twiddleIndex += fstride*k;
+	if(twiddleIndex >= plan.fN) twiddleIndex -= plan.fN;
+	sum += scratch[q]*twiddles[twiddleIndex];
+      }
+      out[k] = sum;
+    }
+  }
+}
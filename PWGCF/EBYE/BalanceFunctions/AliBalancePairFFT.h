@@ -0,0 +1,109 @@
+#ifndef ALIBALANCEPAIRFFT_H
+#define ALIBALANCEPAIRFFT_H
+/*  See cxx source for full Copyright notice */
+
+//-------------------------------------------------------------------------
+//                          Class AliBalancePairFFT
+//   Pair distributions in (Delta eta, Delta phi) from FFT cross-correlations
+//
+//   Trigger and associated particles are histogrammed, per group (charge,
+//   pT bin, ...), on an (eta, phi) grid whose cells are the pair bins
+//   divided by nSubBins. The pair distribution of a trigger and an
+//   associated group is the cross-correlation of their grids, computed
+//   with 2D FFTs (periodic in phi, zero padded in eta). The spectra of a
+//   group are computed once per event and reused for all its partners.
+//
+//   A pair of cells at offset d (in cells) is attributed to the pair bin
+//   containing (d+1/2)*cellWidth (the associated grid is shifted by half a
+//   cell), i.e. pairs are smeared by at most one cell (bin-edge effects).
+//   Auto-correlations can be removed exactly (same particle id).
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <complex>
+#include "Rtypes.h"
+
+class TAxis;
+
+class AliBalancePairFFT {
+ public:
+  typedef std::complex<double> Complex_t;
+
+  AliBalancePairFFT();
+  ~AliBalancePairFFT() {}
+
+  // set up the grids from the pair axes, kFALSE if the binning can not be used
+  Bool_t Configure(const TAxis *deltaEta, const TAxis *deltaPhi, Int_t nSubBins);
+  Int_t  GetNDeltaEtaBins() const {return fNDeltaEtaBins;}
+  Int_t  GetNDeltaPhiBins() const {return fNDeltaPhiBins;}
+
+  // per event
+  void   Reset(Double_t etaMin, Double_t etaMax, Int_t nTriggerGroups, Int_t nAssociatedGroups);
+  void   AddTrigger(Int_t group, Int_t id, Double_t eta, Double_t phi, Double_t weight);
+  void   AddAssociated(Int_t group, Int_t id, Double_t eta, Double_t phi, Double_t weight);
+  const std::vector<Int_t> &GetTriggers(Int_t group) const {return fTrigger[group].fId;}
+  const std::vector<Int_t> &GetAssociated(Int_t group) const {return fAssociated[group].fId;}
+
+  // rough cost comparison with the direct pair loop
+  Bool_t IsFFTFavourable(Int_t triggerGroup, Int_t associatedGroup) const;
+
+  // pair sums per (Delta eta, Delta phi) bin, index (iEta-1)*nDeltaPhiBins+(iPhi-1)
+  void   Correlate(Int_t triggerGroup, Int_t associatedGroup, Bool_t excludeSelf,
+		   std::vector<Double_t> &sumw, std::vector<Double_t> &sumw2);
+
+ private:
+  AliBalancePairFFT(const AliBalancePairFFT&);
+  AliBalancePairFFT& operator=(const AliBalancePairFFT&);
+
+  // particles of a group and their (lazily computed) spectra
+  struct Group_t {
+    std::vector<Int_t>    fId;      // particle ids
+    std::vector<Int_t>    fEtaCell; // eta cell of each particle
+    std::vector<Int_t>    fPhiCell; // phi cell of each particle
+    std::vector<Double_t> fWeight;  // weight of each particle
+    Bool_t fHasSpectrum;            // spectra computed for this event
+    std::vector<Complex_t> fSpectrum;   // FFT of the weight grid
+    std::vector<Complex_t> fSpectrumW2; // FFT of the squared weight grid
+    void Clear() {fId.clear(); fEtaCell.clear(); fPhiCell.clear(); fWeight.clear(); fHasSpectrum = kFALSE;}
+  };
+
+  // 1D mixed-radix FFT of length fN
+  struct Plan_t {
+    Int_t fN;
+    std::vector<Int_t> fFactors;      // (radix, remaining length) pairs
+    std::vector<Complex_t> fTwiddles; // exp(-2 pi i k / fN)
+  };
+
+  static Int_t NextFastSize(Int_t n);
+  static void  MakePlan(Plan_t &plan, Int_t n);
+  static void  Transform(const Plan_t &plan, const Complex_t *in, Int_t inStride, Complex_t *out, const Int_t *factors, Int_t fstride, std::vector<Complex_t> &scratch);
+  void   Transform2D(std::vector<Complex_t> &grid, Bool_t inverse);
+  void   MakeSpectrum(Group_t &group);
+
+  Int_t    fNSubBins;        // grid cells per pair bin
+  Int_t    fNDeltaEtaBins;   // pair bins in Delta eta
+  Int_t    fNDeltaPhiBins;   // pair bins in Delta phi
+  std::vector<Double_t> fDeltaEtaEdges; // Delta eta bin edges
+  Double_t fEtaCellWidth;    // eta cell width
+  Int_t    fNPhiCells;       // phi cells (over 2 pi)
+  std::vector<Int_t> fPhiOffsetBin; // Delta phi bin (0-based) of each phi cell offset
+
+  Double_t fEtaMin;          // origin of the eta grid (current event)
+  Int_t    fNEtaCells;       // eta cells of the trigger grid (current event)
+  std::vector<Int_t> fEtaOffsetBin; // Delta eta bin (0-based) of each eta cell offset (current event)
+  Plan_t   fEtaPlan;         // FFT along eta (zero padded)
+  Plan_t   fPhiPlan;         // FFT along phi
+  Bool_t   fUnitWeights;     // all weights of the current event are 1
+
+  std::vector<Group_t> fTrigger;    // trigger groups
+  std::vector<Group_t> fAssociated; // associated groups
+  std::vector<Int_t> fAssociatedGroupOfId; // associated group of each particle id (-1: none)
+  std::vector<Int_t> fAssociatedIndexOfId; // position in its associated group
+
+  std::vector<Complex_t> fProduct;  // spectrum product / correlation
+  std::vector<Complex_t> fProductW2;
+  std::vector<Complex_t> fLineOut;  // 1D work buffers
+  std::vector<Complex_t> fScratch;
+};
+
+#endif
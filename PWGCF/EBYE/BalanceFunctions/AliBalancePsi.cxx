@@ -22,6 +22,7 @@
 
 //ROOT
 #include <Riostream.h>
+#include <algorithm>
 #include <TCanvas.h>
 #include <TMath.h>
 #include <TAxis.h>
@@ -40,6 +41,7 @@
 #include "AliAODTrack.h"
 #include "AliTHn.h"
 #include "AliAnalysisTaskTriggeredBF.h"
+#include "AliBalancePairFFT.h"
 
 #include "AliBalancePsi.h"
 using std::cout;
@@ -89,7 +91,10 @@ AliBalancePsi::AliBalancePsi() :
   fVertexBinning(kFALSE),
   fCustomBinning(""),
   fBinningString(""),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fUsePairFFT(kFALSE),
+  fPairFFTSubBins(2),
+  fPairFFT(0){
   // Default constructor
 }
 
@@ -133,7 +138,10 @@ AliBalancePsi::AliBalancePsi(const AliBalancePsi& balance):
   fVertexBinning(balance.fVertexBinning),
   fCustomBinning(balance.fCustomBinning),
   fBinningString(balance.fBinningString),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fUsePairFFT(balance.fUsePairFFT),
+  fPairFFTSubBins(balance.fPairFFTSubBins),
+  fPairFFT(0){
   //copy constructor
 }
 
@@ -160,7 +168,8 @@ AliBalancePsi::~AliBalancePsi() {
   delete fHistResonancesLambda;
   delete fHistQbefore;
   delete fHistQafter;
-    
+
+  delete fPairFFT;
 }
 
 //____________________________________________________________________//
@@ -428,6 +437,12 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     AliWarning("particles TObjArray is NULL pointer --> return");
     return;
   }
+
+  // pair distributions from FFT cross-correlations
+  if(fUsePairFFT && (fPairFFT || InitPairFFT())){
+    CalculateBalancePairFFT(gReactionPlane,particles,particlesMixed,kMultorCent,vertexZ);
+    return;
+  }
   
   // define end of particle loops
   Int_t iMax = particles->GetEntriesFast();
@@ -464,6 +479,14 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   Double_t gWidthForK0s = 0.01;
   Double_t gWidthForLambda = 0.006;
   Double_t nSigmaRejection = 3.0;
+  const Double_t gMassPion   = pPion.GetMass();
+  const Double_t gMassProton = pProton.GetMass();
+  const Double_t gMassRho0   = pRho0.GetMass();
+  const Double_t gMassK0s    = pK0s.GetMass();
+  const Double_t gMassLambda = pLambda.GetMass();
+
+  // event class (string comparison only once per event)
+  const Bool_t gEventClassMultOrCent = (fEventClass=="Multiplicity" || fEventClass == "Centrality");
 
   // 1st particle loop
   for (Int_t i = 0; i < iMax; i++) {
@@ -477,26 +500,8 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     Float_t firstCorrection  = firstParticle->Correction();//==========================correction
 
     // Event plane (determine psi bin)
-    Double_t gPsiMinusPhi    =   0.;
-    Double_t gPsiMinusPhiBin = -10.;
-    gPsiMinusPhi   = TMath::Abs(firstPhi - gReactionPlane);
-    //in-plane
-    if((gPsiMinusPhi <= 7.5*TMath::DegToRad())||
-       ((172.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 187.5*TMath::DegToRad())))
-      gPsiMinusPhiBin = 0.0;
-    //intermediate
-    else if(((37.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 52.5*TMath::DegToRad()))||
-	    ((127.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 142.5*TMath::DegToRad()))||
-	    ((217.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 232.5*TMath::DegToRad()))||
-	    ((307.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 322.5*TMath::DegToRad())))
-      gPsiMinusPhiBin = 1.0;
-    //out of plane
-    else if(((82.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 97.5*TMath::DegToRad()))||
-	    ((262.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 277.5*TMath::DegToRad())))
-      gPsiMinusPhiBin = 2.0;
-    //everything else
-    else 
-      gPsiMinusPhiBin = 3.0;
+    Double_t gPsiMinusPhi    = TMath::Abs(firstPhi - gReactionPlane);
+    Double_t gPsiMinusPhiBin = GetPsiMinusPhiBin(gPsiMinusPhi);
     
     fHistPsiMinusPhi->Fill(gPsiMinusPhiBin,gPsiMinusPhi);
 
@@ -504,7 +509,7 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     
     trackVariablesSingle[0]    =  gPsiMinusPhiBin;
     trackVariablesSingle[1]    =  firstPt;
-      if(fEventClass=="Multiplicity" || fEventClass == "Centrality" ) trackVariablesSingle[0] = kMultorCent;
+    if(gEventClassMultOrCent) trackVariablesSingle[0] = kMultorCent;
     trackVariablesSingle[2]    =  vertexZ;
 
     
@@ -550,31 +555,31 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 	if (charge1 * charge2 < 0) {
 
 	  //rho0
-	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,pPion.GetMass());
-	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],pPion.GetMass());
+	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,gMassPion);
+	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],gMassPion);
 	  vectorMother = vectorDaughter[0] + vectorDaughter[1];
 	  fHistResonancesBefore->Fill(trackVariablesPair[1],trackVariablesPair[2],vectorMother.M());
-	  if(TMath::Abs(vectorMother.M() - pRho0.GetMass()) <= nSigmaRejection*gWidthForRho0)
+	  if(TMath::Abs(vectorMother.M() - gMassRho0) <= nSigmaRejection*gWidthForRho0)
 	    continue;
 	  fHistResonancesRho->Fill(trackVariablesPair[1],trackVariablesPair[2],vectorMother.M());
 	  
 	  //K0s
-	  if(TMath::Abs(vectorMother.M() - pK0s.GetMass()) <= nSigmaRejection*gWidthForK0s)
+	  if(TMath::Abs(vectorMother.M() - gMassK0s) <= nSigmaRejection*gWidthForK0s)
 	    continue;
 	  fHistResonancesK0->Fill(trackVariablesPair[1],trackVariablesPair[2],vectorMother.M());
 	  
 	  
 	  //Lambda
-	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,pPion.GetMass());
-	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],pProton.GetMass());
+	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,gMassPion);
+	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],gMassProton);
 	  vectorMother = vectorDaughter[0] + vectorDaughter[1];
-	  if(TMath::Abs(vectorMother.M() - pLambda.GetMass()) <= nSigmaRejection*gWidthForLambda)
+	  if(TMath::Abs(vectorMother.M() - gMassLambda) <= nSigmaRejection*gWidthForLambda)
 	    continue;
 	  
-	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,pProton.GetMass());
-	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],pPion.GetMass());
+	  vectorDaughter[0].SetPtEtaPhiM(firstPt,firstEta,firstPhi,gMassProton);
+	  vectorDaughter[1].SetPtEtaPhiM(secondPt[j],secondEta[j],secondPhi[j],gMassPion);
 	  vectorMother = vectorDaughter[0] + vectorDaughter[1];
-	  if(TMath::Abs(vectorMother.M() - pLambda.GetMass()) <= nSigmaRejection*gWidthForLambda)
+	  if(TMath::Abs(vectorMother.M() - gMassLambda) <= nSigmaRejection*gWidthForLambda)
 	    continue;
 	  fHistResonancesLambda->Fill(trackVariablesPair[1],trackVariablesPair[2],vectorMother.M());
 	
@@ -701,6 +706,241 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   }//end of 1st particle loop
 }  
 
+//____________________________________________________________________//
+Double_t AliBalancePsi::GetPsiMinusPhiBin(Double_t gPsiMinusPhi) const {
+  // Returns the event plane bin of |phi - Psi|
+  //in-plane
+  if((gPsiMinusPhi <= 7.5*TMath::DegToRad())||
+     ((172.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 187.5*TMath::DegToRad())))
+    return 0.0;
+  //intermediate
+  else if(((37.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 52.5*TMath::DegToRad()))||
+	  ((127.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 142.5*TMath::DegToRad()))||
+	  ((217.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 232.5*TMath::DegToRad()))||
+	  ((307.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 322.5*TMath::DegToRad())))
+    return 1.0;
+  //out of plane
+  else if(((82.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 97.5*TMath::DegToRad()))||
+	  ((262.5*TMath::DegToRad() <= gPsiMinusPhi)&&(gPsiMinusPhi <= 277.5*TMath::DegToRad())))
+    return 2.0;
+  //everything else
+  return 3.0;
+}
+
+//____________________________________________________________________//
+Bool_t AliBalancePsi::InitPairFFT() {
+  // Sets up the FFT helper for the binning of the pair histograms.
+  // The FFT mode fills all pairs of two groups of particles: it is
+  // switched off if any of the pair cuts is used.
+  if(fResonancesCut || fHBTCut || fConversionCut || fQCut){
+    AliWarning("Pair FFT mode needs the pair cuts switched off --> using the pair loop");
+    fUsePairFFT = kFALSE;
+    return kFALSE;
+  }
+
+  fPairFFT = new AliBalancePairFFT();
+  if(!fPairFFT->Configure(fHistPN->GetAxis(1,0),fHistPN->GetAxis(2,0),fPairFFTSubBins)){
+    AliWarning("Pair FFT mode needs uniform Delta eta and Delta phi (2 pi) binning --> using the pair loop");
+    delete fPairFFT;
+    fPairFFT = 0;
+    fUsePairFFT = kFALSE;
+    return kFALSE;
+  }
+
+  AliInfo(Form("Pair FFT mode: %d x %d pair bins, %d grid cells per bin",fPairFFT->GetNDeltaEtaBins(),fPairFFT->GetNDeltaPhiBins(),fPairFFTSubBins));
+  return kTRUE;
+}
+
+//____________________________________________________________________//
+void AliBalancePsi::CalculateBalancePairFFT(Double_t gReactionPlane,
+					    TObjArray *particles, 
+					    TObjArray *particlesMixed,
+					    Double_t kMultorCent,
+					    Double_t vertexZ) {
+  // Calculates the balance function with the pair distributions from FFT
+  // cross-correlations (no pair cuts).
+  // Triggers are grouped by charge, event class bin and pT,trig bin,
+  // associated particles by charge and pT,assoc bin. Each combination of
+  // groups is either correlated with FFTs (pairs at the bin centres) or,
+  // if there are only a few pairs, filled pair by pair as in CalculateBalance.
+  // With momentum ordering (pT,trig >= pT,assoc) the pT bins of the two
+  // groups decide for all their pairs, unless the bins overlap: then the
+  // pairs are filled pair by pair with the ordering of CalculateBalance.
+  Double_t trackVariablesSingle[kTrackVariablesSingle];
+  Double_t trackVariablesPair[kTrackVariablesPair];
+
+  Int_t iMax = particles->GetEntriesFast();
+  TObjArray* particlesSecond = (particlesMixed) ? particlesMixed : particles;
+  Int_t jMax = particlesSecond->GetEntriesFast();
+
+  const Bool_t gEventClassMultOrCent = (fEventClass=="Multiplicity" || fEventClass == "Centrality");
+
+  const TAxis *axisClass   = fHistPN->GetAxis(0,0);
+  const TAxis *axisPtTrig  = fHistPN->GetAxis(3,0);
+  const TAxis *axisPtAssoc = fHistPN->GetAxis(4,0);
+  const Int_t nBinsClass   = axisClass->GetNbins();
+  const Int_t nBinsPtTrig  = axisPtTrig->GetNbins();
+  const Int_t nBinsPtAssoc = axisPtAssoc->GetNbins();
+
+  // particle properties and group keys (-1: no pairs filled)
+  std::vector<Float_t> firstEta(iMax), firstPhi(iMax), firstPt(iMax), firstCorrection(iMax);
+  std::vector<Double_t> firstClass(iMax);
+  std::vector<Short_t> firstCharge(iMax);
+  std::vector<Int_t> firstKey(iMax);
+  std::vector<Float_t> secondEta(jMax), secondPhi(jMax), secondPt(jMax);
+  std::vector<Double_t> secondCorrection(jMax);
+  std::vector<Short_t> secondCharge(jMax);
+  std::vector<Int_t> secondKey(jMax);
+  Double_t etaMin = 0., etaMax = 0.;
+
+  for (Int_t i = 0; i < iMax; i++) {
+    AliBFBasicParticle* firstParticle = (AliBFBasicParticle*) particles->At(i);
+    firstEta[i]        = firstParticle->Eta();
+    firstPhi[i]        = firstParticle->Phi();
+    firstPt[i]         = firstParticle->Pt();
+    firstCorrection[i] = firstParticle->Correction();
+    firstCharge[i]     = (Short_t) firstParticle->Charge();
+
+    // Event plane (determine psi bin)
+    Double_t gPsiMinusPhi    = TMath::Abs(firstPhi[i] - gReactionPlane);
+    Double_t gPsiMinusPhiBin = GetPsiMinusPhiBin(gPsiMinusPhi);
+    fHistPsiMinusPhi->Fill(gPsiMinusPhiBin,gPsiMinusPhi);
+
+    trackVariablesSingle[0]    =  gPsiMinusPhiBin;
+    trackVariablesSingle[1]    =  firstPt[i];
+    if(gEventClassMultOrCent) trackVariablesSingle[0] = kMultorCent;
+    trackVariablesSingle[2]    =  vertexZ;
+    firstClass[i] = trackVariablesSingle[0];
+
+    //fill single particle histograms
+    if(firstCharge[i] > 0)      fHistP->Fill(trackVariablesSingle,0,firstCorrection[i]);
+    else if(firstCharge[i] < 0) fHistN->Fill(trackVariablesSingle,0,firstCorrection[i]);
+
+    Int_t binClass = axisClass->FindFixBin(firstClass[i]);
+    Int_t binPt    = axisPtTrig->FindFixBin(firstPt[i]);
+    firstKey[i] = -1;
+    if(firstCharge[i] != 0 && binClass >= 1 && binClass <= nBinsClass && binPt >= 1 && binPt <= nBinsPtTrig)
+      firstKey[i] = (((firstCharge[i] > 0) ? 0 : 1)*nBinsClass + binClass-1)*nBinsPtTrig + binPt-1;
+
+    if(i == 0 || firstEta[i] < etaMin) etaMin = firstEta[i];
+    if(i == 0 || firstEta[i] > etaMax) etaMax = firstEta[i];
+  }
+
+  for (Int_t j = 0; j < jMax; j++) {
+    AliBFBasicParticle* secondParticle = (AliBFBasicParticle*) particlesSecond->At(j);
+    secondEta[j]        = secondParticle->Eta();
+    secondPhi[j]        = secondParticle->Phi();
+    secondPt[j]         = secondParticle->Pt();
+    secondCorrection[j] = secondParticle->Correction();
+    secondCharge[j]     = (Short_t) secondParticle->Charge();
+
+    Int_t binPt = axisPtAssoc->FindFixBin(secondPt[j]);
+    secondKey[j] = -1;
+    if(secondCharge[j] != 0 && binPt >= 1 && binPt <= nBinsPtAssoc)
+      secondKey[j] = ((secondCharge[j] > 0) ? 0 : 1)*nBinsPtAssoc + binPt-1;
+
+    if((iMax == 0 && j == 0) || secondEta[j] < etaMin) etaMin = secondEta[j];
+    if((iMax == 0 && j == 0) || secondEta[j] > etaMax) etaMax = secondEta[j];
+  }
+
+  // occupied groups of this event
+  std::vector<Int_t> triggerGroups, associatedGroups;
+  for (Int_t i = 0; i < iMax; i++) if(firstKey[i] >= 0) triggerGroups.push_back(firstKey[i]);
+  for (Int_t j = 0; j < jMax; j++) if(secondKey[j] >= 0) associatedGroups.push_back(secondKey[j]);
+  std::sort(triggerGroups.begin(),triggerGroups.end());
+  triggerGroups.erase(std::unique(triggerGroups.begin(),triggerGroups.end()),triggerGroups.end());
+  std::sort(associatedGroups.begin(),associatedGroups.end());
+  associatedGroups.erase(std::unique(associatedGroups.begin(),associatedGroups.end()),associatedGroups.end());
+  if(triggerGroups.empty() || associatedGroups.empty()) return;
+
+  fPairFFT->Reset(etaMin,etaMax,triggerGroups.size(),associatedGroups.size());
+  for (Int_t i = 0; i < iMax; i++) {
+    if(firstKey[i] < 0) continue;
+    Int_t group = std::lower_bound(triggerGroups.begin(),triggerGroups.end(),firstKey[i]) - triggerGroups.begin();
+    fPairFFT->AddTrigger(group,i,firstEta[i],firstPhi[i],firstCorrection[i]);
+  }
+  for (Int_t j = 0; j < jMax; j++) {
+    if(secondKey[j] < 0) continue;
+    Int_t group = std::lower_bound(associatedGroups.begin(),associatedGroups.end(),secondKey[j]) - associatedGroups.begin();
+    fPairFFT->AddAssociated(group,j,secondEta[j],secondPhi[j],secondCorrection[j]);
+  }
+
+  const TAxis *axisDeltaEta = fHistPN->GetAxis(1,0);
+  const TAxis *axisDeltaPhi = fHistPN->GetAxis(2,0);
+  const Int_t nBinsDeltaPhi = fPairFFT->GetNDeltaPhiBins();
+  std::vector<Double_t> sumw, sumw2;
+
+  for (UInt_t iTrigger = 0; iTrigger < triggerGroups.size(); iTrigger++) {
+    Int_t key = triggerGroups[iTrigger];
+    Short_t charge1 = (key/(nBinsClass*nBinsPtTrig) == 0) ? 1 : -1;
+    Double_t centerClass  = axisClass->GetBinCenter((key/nBinsPtTrig)%nBinsClass + 1);
+    Int_t    binPtTrig    = key%nBinsPtTrig + 1;
+    Double_t centerPtTrig = axisPtTrig->GetBinCenter(binPtTrig);
+
+    for (UInt_t iAssociated = 0; iAssociated < associatedGroups.size(); iAssociated++) {
+      Short_t charge2 = (associatedGroups[iAssociated]/nBinsPtAssoc == 0) ? 1 : -1;
+      AliTHn *histPair = 0;
+      if( charge1 > 0 && charge2 < 0)       histPair = fHistPN;
+      else if( charge1 < 0 && charge2 > 0)  histPair = fHistNP;
+      else if( charge1 > 0 && charge2 > 0)  histPair = fHistPP;
+      else                                  histPair = fHistNN;
+
+      // momentum ordering: no pair, all pairs or pair by pair
+      Bool_t checkOrdering = kFALSE;
+      if(fMomentumOrdering){
+	Int_t binPtAssoc = associatedGroups[iAssociated]%nBinsPtAssoc + 1;
+	if(axisPtTrig->GetBinUpEdge(binPtTrig) <= axisPtAssoc->GetBinLowEdge(binPtAssoc))
+	  continue;
+	checkOrdering = (axisPtTrig->GetBinLowEdge(binPtTrig) < axisPtAssoc->GetBinUpEdge(binPtAssoc));
+      }
+
+      if(!checkOrdering && fPairFFT->IsFFTFavourable(iTrigger,iAssociated)){
+	fPairFFT->Correlate(iTrigger,iAssociated,!particlesMixed,sumw,sumw2);
+	trackVariablesPair[0] = centerClass;
+	trackVariablesPair[3] = centerPtTrig;
+	trackVariablesPair[4] = axisPtAssoc->GetBinCenter(associatedGroups[iAssociated]%nBinsPtAssoc + 1);
+	trackVariablesPair[5] = vertexZ;
+	for (UInt_t bin = 0; bin < sumw.size(); bin++) {
+	  if(sumw[bin] == 0.) continue;
+	  trackVariablesPair[1] = axisDeltaEta->GetBinCenter(bin/nBinsDeltaPhi + 1);
+	  trackVariablesPair[2] = axisDeltaPhi->GetBinCenter(bin%nBinsDeltaPhi + 1);
+	  histPair->AddEntries(trackVariablesPair,0,sumw[bin],sumw2[bin]);
+	}
+	continue;
+      }
+
+      // only a few pairs or overlapping pT bins: pair loop
+      const std::vector<Int_t> &triggers   = fPairFFT->GetTriggers(iTrigger);
+      const std::vector<Int_t> &associated = fPairFFT->GetAssociated(iAssociated);
+      for (UInt_t it = 0; it < triggers.size(); it++) {
+	Int_t i = triggers[it];
+	for (UInt_t ja = 0; ja < associated.size(); ja++) {
+	  Int_t j = associated[ja];
+	  if(!particlesMixed && j == i) continue; // no auto correlations (only for non mixing)
+
+	  // pT,Assoc < pT,Trig (if momentum ordering is switched ON)
+	  if(checkOrdering && firstPt[i] < secondPt[j]) continue;
+
+	  trackVariablesPair[0]    =  firstClass[i];
+	  trackVariablesPair[1]    =  firstEta[i] - secondEta[j];  // delta eta
+	  trackVariablesPair[2]    =  firstPhi[i] - secondPhi[j];  // delta phi
+	  if (trackVariablesPair[2] > TMath::Pi()) // delta phi between -pi and pi 
+	    trackVariablesPair[2] -= 2.*TMath::Pi();
+	  if (trackVariablesPair[2] <  - TMath::Pi()) 
+	    trackVariablesPair[2] += 2.*TMath::Pi();
+	  if (trackVariablesPair[2] <  - TMath::Pi()/2.) 
+	    trackVariablesPair[2] += 2.*TMath::Pi();
+	  trackVariablesPair[3]    =  firstPt[i];      // pt trigger
+	  trackVariablesPair[4]    =  secondPt[j];  // pt
+	  trackVariablesPair[5]    =  vertexZ;      // z of the primary vertex
+
+	  histPair->Fill(trackVariablesPair,0,firstCorrection[i]*secondCorrection[j]);
+	}
+      }
+    }
+  }
+}
+
 //____________________________________________________________________//
 TH1D *AliBalancePsi::GetBalanceFunctionHistogram(Int_t iVariableSingle,
 						 Int_t iVariablePair,
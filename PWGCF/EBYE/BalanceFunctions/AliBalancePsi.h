@@ -28,6 +28,7 @@ using std::vector;
 class TH1D;
 class TH2D;
 class TH3D;
+class AliBalancePairFFT;
 
 const Int_t kTrackVariablesSingle = 3;       // track variables in histogram (event class, pTtrig, vertexZ)
 const Int_t kTrackVariablesPair   = 6;       // track variables in histogram (event class, dEta, dPhi, pTtrig, ptAssociated, vertexZ)
@@ -232,6 +233,11 @@ class AliBalancePsi : public TObject {
   void UseMomentumDifferenceCut(Double_t gDeltaPtCutMin) {
     fQCut = kTRUE; fDeltaPtMin = gDeltaPtCutMin;}
 
+  // pair distributions from FFT cross-correlations (see AliBalancePairFFT)
+  // without pair cuts, nSubBins grid cells per (Delta eta, Delta phi) bin
+  void UsePairFFT(Bool_t usePairFFT = kTRUE, Int_t nSubBins = 2) {
+    fUsePairFFT = usePairFFT; fPairFFTSubBins = nSubBins;}
+
   // related to customized binning of output AliTHn
   Bool_t    IsUseVertexBinning() { return fVertexBinning; }
   TString   GetBinningString()   { return fBinningString; }
@@ -239,6 +245,13 @@ class AliBalancePsi : public TObject {
 
  private:
   Float_t   GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign); 
+  Double_t  GetPsiMinusPhiBin(Double_t gPsiMinusPhi) const;
+  Bool_t    InitPairFFT();
+  void      CalculateBalancePairFFT(Double_t gReactionPlane,
+				    TObjArray* particles,
+				    TObjArray* particlesMixed,
+				    Double_t kMultorCent,
+				    Double_t vertexZ);
 
   Bool_t fShuffle; //shuffled balance function object
   TString fAnalysisLevel; //ESD, AOD or MC
@@ -288,9 +301,13 @@ class AliBalancePsi : public TObject {
 
   TString fEventClass;
 
+  Bool_t fUsePairFFT;//pair distributions from FFT cross-correlations
+  Int_t fPairFFTSubBins;//grid cells per pair bin for the FFT mode
+  AliBalancePairFFT *fPairFFT;//! FFT helper
+
   AliBalancePsi & operator=(const AliBalancePsi & ) {return *this;}
 
-  ClassDef(AliBalancePsi, 2)
+  ClassDef(AliBalancePsi, 3)
 };
 
 #endif
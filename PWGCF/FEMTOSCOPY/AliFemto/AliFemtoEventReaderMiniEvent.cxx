@@ -0,0 +1,764 @@
+///
+/// \file AliFemtoEventReaderMiniEvent.cxx
+///
+
+#include "AliFemtoEventReaderMiniEvent.h"
+
+#include "AliFemtoEvent.h"
+#include "AliFemtoTrack.h"
+#include "AliFemtoEventCut.h"
+#include "AliFemtoTrackCut.h"
+#include "AliFmPhysicalHelixD.h"
+
+#include <TBits.h>
+#include <TBranch.h>
+#include <TChain.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TMath.h>
+#include <TTree.h>
+
+#include <cmath>
+
+#ifdef __ROOT__
+  /// \cond CLASSIMP
+  ClassImp(AliFemtoEventReaderMiniEvent);
+  /// \endcond
+#endif
+
+namespace {
+
+typedef AliFemtoEventReaderMiniEvent MiniEvent;
+
+/// Branch name, group and number of values per track of a track column
+struct ColumnInfo {
+  const char *fName;
+  UInt_t fGroup;
+  Int_t fWidth;
+};
+
+// in the order of AliFemtoEventReaderMiniEvent::EFloatColumn
+const ColumnInfo kFloatColumnInfo[] = {
+  {"Px", MiniEvent::kKinematics, 1},
+  {"Py", MiniEvent::kKinematics, 1},
+  {"Pz", MiniEvent::kKinematics, 1},
+  {"Zvtx", MiniEvent::kKinematics, 1},
+  {"ImpactD", MiniEvent::kTrackQuality, 1},
+  {"ImpactZ", MiniEvent::kTrackQuality, 1},
+  {"Cdd", MiniEvent::kTrackQuality, 1},
+  {"Cdz", MiniEvent::kTrackQuality, 1},
+  {"Czz", MiniEvent::kTrackQuality, 1},
+  {"ImpactDprim", MiniEvent::kTrackQuality, 1},
+  {"ImpactDweak", MiniEvent::kTrackQuality, 1},
+  {"ImpactDmat", MiniEvent::kTrackQuality, 1},
+  {"ITSchi2", MiniEvent::kTrackQuality, 1},
+  {"TPCchi2", MiniEvent::kTrackQuality, 1},
+  {"SigmaToVertex", MiniEvent::kTrackQuality, 1},
+  {"XatDCA", MiniEvent::kTrackQuality, 1},
+  {"YatDCA", MiniEvent::kTrackQuality, 1},
+  {"ZatDCA", MiniEvent::kTrackQuality, 1},
+  {"InnerMomentum", MiniEvent::kPID, 1},
+  {"TPCsignal", MiniEvent::kPID, 1},
+  {"TPCsignalS", MiniEvent::kPID, 1},
+  {"VTOF", MiniEvent::kPID, 1},
+  {"NSigmaTPCPi", MiniEvent::kPID, 1},
+  {"NSigmaTPCK", MiniEvent::kPID, 1},
+  {"NSigmaTPCP", MiniEvent::kPID, 1},
+  {"NSigmaTPCE", MiniEvent::kPID, 1},
+  {"NSigmaTOFPi", MiniEvent::kPID, 1},
+  {"NSigmaTOFK", MiniEvent::kPID, 1},
+  {"NSigmaTOFP", MiniEvent::kPID, 1},
+  {"NSigmaTOFE", MiniEvent::kPID, 1},
+  {"PidProbElectron", MiniEvent::kPID, 1},
+  {"PidProbPion", MiniEvent::kPID, 1},
+  {"PidProbKaon", MiniEvent::kPID, 1},
+  {"PidProbProton", MiniEvent::kPID, 1},
+  {"PidProbMuon", MiniEvent::kPID, 1},
+  {"TOFPionTime", MiniEvent::kPID, 1},
+  {"TOFKaonTime", MiniEvent::kPID, 1},
+  {"TOFProtonTime", MiniEvent::kPID, 1},
+  {"TPCPoints", MiniEvent::kTPCPoints, 3 * 12},
+  {"CorrPion", MiniEvent::kCorrections, 1},
+  {"CorrKaon", MiniEvent::kCorrections, 1},
+  {"CorrProton", MiniEvent::kCorrections, 1},
+  {"CorrPionMinus", MiniEvent::kCorrections, 1},
+  {"CorrKaonMinus", MiniEvent::kCorrections, 1},
+  {"CorrProtonMinus", MiniEvent::kCorrections, 1},
+  {"CorrAll", MiniEvent::kCorrections, 1}
+};
+
+// in the order of AliFemtoEventReaderMiniEvent::EIntColumn
+const ColumnInfo kIntColumnInfo[] = {
+  {"Charge", MiniEvent::kKinematics, 1},
+  {"TrackId", MiniEvent::kKinematics, 1},
+  {"Label", MiniEvent::kKinematics, 1},
+  {"Multiplicity", MiniEvent::kKinematics, 1},
+  {"ITSncls", MiniEvent::kTrackQuality, 1},
+  {"TPCncls", MiniEvent::kTrackQuality, 1},
+  {"TPCnclsF", MiniEvent::kTrackQuality, 1},
+  {"ITSHits", MiniEvent::kTrackQuality, 1},
+  {"KinkIndexes", MiniEvent::kTrackQuality, 3},
+  {"TPCsignalN", MiniEvent::kPID, 1},
+  {"TPCClusterMap", MiniEvent::kClusterMaps, 5},
+  {"TPCSharedMap", MiniEvent::kClusterMaps, 5}
+};
+
+static_assert(sizeof(kFloatColumnInfo) / sizeof(ColumnInfo) == MiniEvent::kNFloatColumns,
+              "float column table out of sync with EFloatColumn");
+static_assert(sizeof(kIntColumnInfo) / sizeof(ColumnInfo) == MiniEvent::kNIntColumns,
+              "int column table out of sync with EIntColumn");
+
+/// Leaf list of a track column: one value (or fixed-size array) per track
+TString LeafList(const ColumnInfo &info, char type)
+{
+  if (info.fWidth == 1) {
+    return TString::Format("%s[NTracks]/%c", info.fName, type);
+  }
+  return TString::Format("%s[NTracks][%d]/%c", info.fName, info.fWidth, type);
+}
+
+void PackBits(const TBits &bits, Int_t *words, Int_t nWords)
+{
+  const UInt_t nBits = TMath::Min(bits.GetNbits(), (UInt_t)(32 * nWords));
+  for (Int_t i = 0; i < nWords; i++) {
+    words[i] = 0;
+  }
+  for (UInt_t i = 0; i < nBits; i++) {
+    if (bits.TestBitNumber(i)) {
+      words[i / 32] |= (1u << (i % 32));
+    }
+  }
+}
+
+void UnpackBits(const Int_t *words, UInt_t nBits, TBits &bits)
+{
+  for (UInt_t i = 0; i < nBits; i++) {
+    bits.SetBitNumber(i, (words[i / 32] >> (i % 32)) & 1);
+  }
+}
+
+void StorePoint(Float_t *xyz, const AliFemtoThreeVector &point)
+{
+  xyz[0] = point.x();
+  xyz[1] = point.y();
+  xyz[2] = point.z();
+}
+
+AliFemtoThreeVector LoadPoint(const Float_t *xyz)
+{
+  return AliFemtoThreeVector(xyz[0], xyz[1], xyz[2]);
+}
+
+}
+
+//_________________________
+AliFemtoEventReaderMiniEvent::AliFemtoEventReaderMiniEvent(const char *fileName, UInt_t columns):
+  AliFemtoEventReader(),
+  fFileName(fileName),
+  fMoreFiles(),
+  fColumns(columns | kKinematics),
+  fCompression(-1),
+  fFile(NULL),
+  fTree(NULL),
+  fChain(NULL),
+  fFileColumns(0),
+  fNEntries(0),
+  fCurrentEntry(0),
+  fNEventsIO(0),
+  fNTracks(0),
+  fCapacity(0),
+  fTriggerMask(0),
+  fFlags()
+{
+  for (int i = 0; i < kNEventDoubles; i++) fEventDoubles[i] = 0.;
+  for (int i = 0; i < kNEventFloats; i++) fEventFloats[i] = 0.;
+  for (int i = 0; i < kNEventInts; i++) fEventInts[i] = 0;
+}
+
+//_________________________
+AliFemtoEventReaderMiniEvent::~AliFemtoEventReaderMiniEvent()
+{
+  Finish();
+}
+
+//_________________________
+void AliFemtoEventReaderMiniEvent::AddFile(const char *fileName)
+{
+  fMoreFiles.push_back(fileName);
+}
+
+//_________________________
+int AliFemtoEventReaderMiniEvent::Init(const char *ReadWrite, AliFemtoString &Message)
+{
+  if (fFile || fChain) {
+    Message += "AliFemtoEventReaderMiniEvent::Init: already initialized\n";
+    return 1;
+  }
+  fNEventsIO = 0;
+  if (ReadWrite && ReadWrite[0] == 'w') {
+    return InitWrite(Message);
+  }
+  return InitRead(Message);
+}
+
+//_________________________
+int AliFemtoEventReaderMiniEvent::InitWrite(AliFemtoString &Message)
+{
+  TDirectory *savedDir = gDirectory;
+  fFile = TFile::Open(fFileName, "RECREATE");
+  if (!fFile || fFile->IsZombie()) {
+    Message += Form("AliFemtoEventReaderMiniEvent: cannot create %s\n", fFileName.Data());
+    delete fFile;
+    fFile = NULL;
+    if (savedDir) savedDir->cd();
+    return 1;
+  }
+  if (fCompression >= 0) {
+    fFile->SetCompressionSettings(fCompression);
+  }
+  fFileColumns = fColumns;
+
+  // the branches are created on the column buffers
+  Reserve(64);
+
+  fFile->cd();
+  fTree = new TTree(TreeName(), "femto mini-events");
+  fTree->Branch("NTracks", &fNTracks, "NTracks/I");
+  fTree->Branch("EventD", fEventDoubles, Form("EventD[%d]/D", kNEventDoubles));
+  fTree->Branch("EventF", fEventFloats, Form("EventF[%d]/F", kNEventFloats));
+  fTree->Branch("EventI", fEventInts, Form("EventI[%d]/I", kNEventInts));
+  fTree->Branch("TriggerMask", &fTriggerMask, "TriggerMask/L");
+  fTree->Branch("Flags", &fFlags[0], "Flags[NTracks]/L");
+  for (int i = 0; i < kNFloatColumns; i++) {
+    if (fFileColumns & kFloatColumnInfo[i].fGroup) {
+      fTree->Branch(kFloatColumnInfo[i].fName, &fFloatColumns[i][0], LeafList(kFloatColumnInfo[i], 'F'));
+    }
+  }
+  for (int i = 0; i < kNIntColumns; i++) {
+    if (fFileColumns & kIntColumnInfo[i].fGroup) {
+      fTree->Branch(kIntColumnInfo[i].fName, &fIntColumns[i][0], LeafList(kIntColumnInfo[i], 'I'));
+    }
+  }
+  if (savedDir) savedDir->cd();
+
+  Message += Form("AliFemtoEventReaderMiniEvent: writing %s (columns 0x%x)\n", fFileName.Data(), fFileColumns);
+  return 0;
+}
+
+//_________________________
+int AliFemtoEventReaderMiniEvent::InitRead(AliFemtoString &Message)
+{
+  fChain = new TChain(TreeName());
+  Int_t nFiles = fChain->Add(fFileName);
+  for (size_t i = 0; i < fMoreFiles.size(); i++) {
+    nFiles += fChain->Add(fMoreFiles[i]);
+  }
+  fNEntries = nFiles > 0 ? fChain->GetEntries() : 0;
+  if (fNEntries <= 0) {
+    Message += Form("AliFemtoEventReaderMiniEvent: no events in %s\n", fFileName.Data());
+    delete fChain;
+    fChain = NULL;
+    return 1;
+  }
+  fCurrentEntry = 0;
+
+  // groups requested and present in the files; the other branches are not read
+  fFileColumns = kKinematics;
+  for (UInt_t group = kTrackQuality; group & kAllColumns; group <<= 1) {
+    if (!(fColumns & group)) {
+      continue;
+    }
+    bool present = true;
+    for (int i = 0; i < kNFloatColumns; i++) {
+      if (kFloatColumnInfo[i].fGroup == group && !fChain->GetBranch(kFloatColumnInfo[i].fName)) {
+        present = false;
+      }
+    }
+    for (int i = 0; i < kNIntColumns; i++) {
+      if (kIntColumnInfo[i].fGroup == group && !fChain->GetBranch(kIntColumnInfo[i].fName)) {
+        present = false;
+      }
+    }
+    if (present) {
+      fFileColumns |= group;
+    } else {
+      Message += Form("AliFemtoEventReaderMiniEvent: columns 0x%x not in %s\n", group, fFileName.Data());
+    }
+  }
+
+  fChain->SetBranchStatus("*", 0);
+  const char *eventBranches[] = {"NTracks", "EventD", "EventF", "EventI", "TriggerMask", "Flags"};
+  for (int i = 0; i < 6; i++) {
+    fChain->SetBranchStatus(eventBranches[i], 1);
+  }
+  for (int i = 0; i < kNFloatColumns; i++) {
+    if (fFileColumns & kFloatColumnInfo[i].fGroup) {
+      fChain->SetBranchStatus(kFloatColumnInfo[i].fName, 1);
+    }
+  }
+  for (int i = 0; i < kNIntColumns; i++) {
+    if (fFileColumns & kIntColumnInfo[i].fGroup) {
+      fChain->SetBranchStatus(kIntColumnInfo[i].fName, 1);
+    }
+  }
+
+  fCapacity = 0;
+  Reserve(64);
+
+  Message += Form("AliFemtoEventReaderMiniEvent: reading %lld events from %s (columns 0x%x)\n",
+                  fNEntries, fFileName.Data(), fFileColumns);
+  return 0;
+}
+
+//_________________________
+void AliFemtoEventReaderMiniEvent::Reserve(Int_t nTracks)
+{
+  if (nTracks <= fCapacity) {
+    return;
+  }
+  fCapacity = TMath::Max(nTracks, 2 * fCapacity);
+  fFlags.resize(fCapacity);
+  for (int i = 0; i < kNFloatColumns; i++) {
+    if (fFileColumns & kFloatColumnInfo[i].fGroup) {
+      fFloatColumns[i].resize(fCapacity * kFloatColumnInfo[i].fWidth);
+    }
+  }
+  for (int i = 0; i < kNIntColumns; i++) {
+    if (fFileColumns & kIntColumnInfo[i].fGroup) {
+      fIntColumns[i].resize(fCapacity * kIntColumnInfo[i].fWidth);
+    }
+  }
+  // the buffers may have moved
+  SetBranchAddresses();
+}
+
+//_________________________
+void AliFemtoEventReaderMiniEvent::SetBranchAddresses()
+{
+  TTree *tree = fTree ? fTree : fChain;
+  if (!tree) {
+    return;
+  }
+  tree->SetBranchAddress("NTracks", &fNTracks);
+  tree->SetBranchAddress("EventD", fEventDoubles);
+  tree->SetBranchAddress("EventF", fEventFloats);
+  tree->SetBranchAddress("EventI", fEventInts);
+  tree->SetBranchAddress("TriggerMask", &fTriggerMask);
+  tree->SetBranchAddress("Flags", &fFlags[0]);
+  for (int i = 0; i < kNFloatColumns; i++) {
+    if (fFileColumns & kFloatColumnInfo[i].fGroup) {
+      tree->SetBranchAddress(kFloatColumnInfo[i].fName, &fFloatColumns[i][0]);
+    }
+  }
+  for (int i = 0; i < kNIntColumns; i++) {
+    if (fFileColumns & kIntColumnInfo[i].fGroup) {
+      tree->SetBranchAddress(kIntColumnInfo[i].fName, &fIntColumns[i][0]);
+    }
+  }
+}
+
+//_________________________
+void AliFemtoEventReaderMiniEvent::Finish()
+{
+  if (fFile) {
+    TDirectory *savedDir = (gDirectory == fFile) ? NULL : gDirectory;
+    fFile->cd();
+    fTree->Write(0, TObject::kOverwrite);
+    fFile->Close();
+    delete fFile;  // deletes the tree
+    fFile = NULL;
+    fTree = NULL;
+    if (savedDir) savedDir->cd();
+    if (fDebug > 0) {
+      cout << "AliFemtoEventReaderMiniEvent: " << fNEventsIO << " events written to " << fFileName << endl;
+    }
+  }
+  if (fChain) {
+    delete fChain;
+    fChain = NULL;
+  }
+}
+
+//_________________________
+int AliFemtoEventReaderMiniEvent::WriteHbtEvent(AliFemtoEvent *event)
+{
+  if (!fTree || !event) {
+    return 1;
+  }
+  if (fEventCut && !fEventCut->Pass(event)) {
+    return 0;
+  }
+
+  AliFemtoTrackCollection *tracks = event->TrackCollection();
+  Reserve(tracks->size());
+  fNTracks = 0;
+  for (AliFemtoTrackIterator iter = tracks->begin(); iter != tracks->end(); ++iter) {
+    if (fTrackCut && !fTrackCut->Pass(*iter)) {
+      continue;
+    }
+    FillTrackColumns(fNTracks++, *iter);
+  }
+  FillEventColumns(event);
+
+  fTree->Fill();
+  fNEventsIO++;
+  return 0;
+}
+
+//_________________________
+AliFemtoEvent* AliFemtoEventReaderMiniEvent::ReturnHbtEvent()
+{
+  if (!fChain && !fFile) {
+    AliFemtoString message;
+    if (Init("r", message)) {
+      cout << message;
+      fReaderStatus = 1;
+      return NULL;
+    }
+  }
+  if (!fChain || fCurrentEntry >= fNEntries) {
+    fReaderStatus = 1;
+    return NULL;
+  }
+
+  // read the number of tracks first, to size the track columns
+  Long64_t localEntry = fChain->LoadTree(fCurrentEntry);
+  TBranch *nTracksBranch = localEntry < 0 ? NULL : fChain->GetTree()->GetBranch("NTracks");
+  if (!nTracksBranch || nTracksBranch->GetEntry(localEntry) <= 0) {
+    cout << "AliFemtoEventReaderMiniEvent: cannot read entry " << fCurrentEntry << endl;
+    fReaderStatus = 1;
+    return NULL;
+  }
+  Reserve(fNTracks);
+  if (fChain->GetEntry(fCurrentEntry++) <= 0) {
+    cout << "AliFemtoEventReaderMiniEvent: cannot read entry " << fCurrentEntry - 1 << endl;
+    fReaderStatus = 1;
+    return NULL;
+  }
+  fNEventsIO++;
+
+  AliFemtoEvent *event = MakeEvent();
+  for (Int_t i = 0; i < fNTracks; i++) {
+    event->TrackCollection()->push_back(MakeTrack(i, event));
+  }
+  if (fDebug > 1) {
+    cout << "AliFemtoEventReaderMiniEvent: event " << fNEventsIO << " with " << fNTracks << " tracks" << endl;
+  }
+  return event;
+}
+
+//_________________________
+AliFemtoString AliFemtoEventReaderMiniEvent::Report()
+{
+  AliFemtoString report = "\n This is the AliFemtoEventReaderMiniEvent\n";
+  report += Form(" File: %s, columns 0x%x, %lld events %s\n", fFileName.Data(),
+                 fFile || fChain ? fFileColumns : fColumns, fNEventsIO, fFile ? "written" : "read");
+  report += AliFemtoEventReader::Report();
+  return report;
+}
+
+//_________________________
+void AliFemtoEventReaderMiniEvent::FillEventColumns(const AliFemtoEvent *event)
+{
+  const AliFemtoThreeVector vertex = event->PrimVertPos();
+  const double *cov = event->PrimVertCov();
+  fEventDoubles[kMagneticField] = event->MagneticField();
+  fEventDoubles[kVertexX] = vertex.x();
+  fEventDoubles[kVertexY] = vertex.y();
+  fEventDoubles[kVertexZ] = vertex.z();
+  for (int i = 0; i < 6; i++) {
+    fEventDoubles[kVertexCov + i] = cov[i];
+  }
+
+  fEventFloats[kCentralityV0] = event->CentralityV0();
+  fEventFloats[kCentralityV0A] = event->CentralityV0A();
+  fEventFloats[kCentralityV0C] = event->CentralityV0C();
+  fEventFloats[kCentralityZNA] = event->CentralityZNA();
+  fEventFloats[kCentralityZNC] = event->CentralityZNC();
+  fEventFloats[kCentralityCL1] = event->CentralityCL1();
+  fEventFloats[kCentralityCL0] = event->CentralityCL0();
+  fEventFloats[kCentralityTKL] = event->CentralityTKL();
+  fEventFloats[kCentralityFMD] = event->CentralityFMD();
+  fEventFloats[kCentralityTrk] = event->CentralityTrk();
+  fEventFloats[kCentralityCND] = event->CentralityCND();
+  fEventFloats[kCentralityNPA] = event->CentralityNPA();
+  fEventFloats[kCentralitySPD1] = event->CentralitySPD1();
+  fEventFloats[kZDCN1Energy] = event->ZDCN1Energy();
+  fEventFloats[kZDCP1Energy] = event->ZDCP1Energy();
+  fEventFloats[kZDCN2Energy] = event->ZDCN2Energy();
+  fEventFloats[kZDCP2Energy] = event->ZDCP2Energy();
+  fEventFloats[kZDCEMEnergy] = event->ZDCEMEnergy();
+  fEventFloats[kReactionPlaneAngle] = event->ReactionPlaneAngle();
+
+  fEventInts[kRunNumber] = event->RunNumber();
+  fEventInts[kEventNumber] = event->EventNumber();
+  fEventInts[kNumberOfTracks] = event->NumberOfTracks();
+  // computed from the full track collection if not set by the reader
+  fEventInts[kNormalizedMult] = event->UncorrectedNumberOfPrimaries();
+  fEventInts[kSPDMult] = event->SPDMultiplicity();
+  fEventInts[kEstimateITSTPC] = event->MultiplicityEstimateITSTPC();
+  fEventInts[kEstimateTracklets] = event->MultiplicityEstimateTracklets();
+  fEventInts[kEstimateITSPure] = event->MultiplicityEstimateITSPure();
+  fEventInts[kZDCParticipants] = event->ZDCParticipants();
+  fEventInts[kTriggerCluster] = event->TriggerCluster();
+  fEventInts[kIsCollisionCandidate] = event->IsCollisionCandidate();
+
+  fTriggerMask = event->TriggerMask();
+}
+
+//_________________________
+void AliFemtoEventReaderMiniEvent::FillTrackColumns(Int_t index, const AliFemtoTrack *track)
+{
+  const AliFemtoThreeVector p = track->P();
+  fFloatColumns[kPx][index] = p.x();
+  fFloatColumns[kPy][index] = p.y();
+  fFloatColumns[kPz][index] = p.z();
+  fFloatColumns[kZvtx][index] = track->Zvtx();
+  fIntColumns[kCharge][index] = track->Charge();
+  fIntColumns[kTrackId][index] = track->TrackId();
+  fIntColumns[kLabel][index] = track->Label();
+  fIntColumns[kMultiplicity][index] = track->Multiplicity();
+  fFlags[index] = track->Flags();
+
+  if (fFileColumns & kTrackQuality) {
+    fFloatColumns[kImpactD][index] = track->ImpactD();
+    fFloatColumns[kImpactZ][index] = track->ImpactZ();
+    fFloatColumns[kCdd][index] = track->Cdd();
+    fFloatColumns[kCdz][index] = track->Cdz();
+    fFloatColumns[kCzz][index] = track->Czz();
+    fFloatColumns[kImpactDprim][index] = track->ImpactDprim();
+    fFloatColumns[kImpactDweak][index] = track->ImpactDweak();
+    fFloatColumns[kImpactDmat][index] = track->ImpactDmat();
+    fFloatColumns[kITSchi2][index] = track->ITSchi2();
+    fFloatColumns[kTPCchi2][index] = track->TPCchi2();
+    fFloatColumns[kSigmaToVertex][index] = track->SigmaToVertex();
+    fFloatColumns[kXatDCA][index] = track->XatDCA();
+    fFloatColumns[kYatDCA][index] = track->YatDCA();
+    fFloatColumns[kZatDCA][index] = track->ZatDCA();
+    fIntColumns[kITSncls][index] = track->ITSncls();
+    fIntColumns[kTPCncls][index] = track->TPCncls();
+    fIntColumns[kTPCnclsF][index] = track->TPCnclsF();
+    Int_t itsHits = 0;
+    for (int layer = 0; layer < 6; layer++) {
+      if (track->HasPointOnITSLayer(layer)) {
+        itsHits |= (1 << layer);
+      }
+    }
+    fIntColumns[kITSHits][index] = itsHits;
+    for (int i = 0; i < 3; i++) {
+      fIntColumns[kKinkIndexes][3 * index + i] = track->KinkIndex(i);
+    }
+  }
+
+  if (fFileColumns & kPID) {
+    fFloatColumns[kInnerMomentum][index] = track->InnerMomentum();
+    fFloatColumns[kTPCsignal][index] = track->TPCsignal();
+    fFloatColumns[kTPCsignalS][index] = track->TPCsignalS();
+    fFloatColumns[kVTOF][index] = track->VTOF();
+    fFloatColumns[kNSigmaTPCPi][index] = track->NSigmaTPCPi();
+    fFloatColumns[kNSigmaTPCK][index] = track->NSigmaTPCK();
+    fFloatColumns[kNSigmaTPCP][index] = track->NSigmaTPCP();
+    fFloatColumns[kNSigmaTPCE][index] = track->NSigmaTPCE();
+    fFloatColumns[kNSigmaTOFPi][index] = track->NSigmaTOFPi();
+    fFloatColumns[kNSigmaTOFK][index] = track->NSigmaTOFK();
+    fFloatColumns[kNSigmaTOFP][index] = track->NSigmaTOFP();
+    fFloatColumns[kNSigmaTOFE][index] = track->NSigmaTOFE();
+    fFloatColumns[kPidProbElectron][index] = track->PidProbElectron();
+    fFloatColumns[kPidProbPion][index] = track->PidProbPion();
+    fFloatColumns[kPidProbKaon][index] = track->PidProbKaon();
+    fFloatColumns[kPidProbProton][index] = track->PidProbProton();
+    fFloatColumns[kPidProbMuon][index] = track->PidProbMuon();
+    fFloatColumns[kTOFPionTime][index] = track->TOFpionTime();
+    fFloatColumns[kTOFKaonTime][index] = track->TOFkaonTime();
+    fFloatColumns[kTOFProtonTime][index] = track->TOFprotonTime();
+    fIntColumns[kTPCsignalN][index] = track->TPCsignalN();
+  }
+
+  if (fFileColumns & kTPCPoints) {
+    // entrance, 9 nominal points, exit, shifted point
+    Float_t *xyz = &fFloatColumns[kTPCPointsXYZ][3 * kNTPCPoints * index];
+    StorePoint(xyz, track->NominalTpcEntrancePoint());
+    for (int i = 0; i < 9; i++) {
+      StorePoint(xyz + 3 * (i + 1), track->NominalTpcPoint(i));
+    }
+    StorePoint(xyz + 30, track->NominalTpcExitPoint());
+    StorePoint(xyz + 33, track->NominalTpcPointShifted());
+  }
+
+  if (fFileColumns & kClusterMaps) {
+    PackBits(track->TPCclusters(), &fIntColumns[kTPCClusterMap][kNMapWords * index], kNMapWords);
+    PackBits(track->TPCsharing(), &fIntColumns[kTPCSharedMap][kNMapWords * index], kNMapWords);
+  }
+
+  if (fFileColumns & kCorrections) {
+    fFloatColumns[kCorrPion][index] = track->CorrectionPion();
+    fFloatColumns[kCorrKaon][index] = track->CorrectionKaon();
+    fFloatColumns[kCorrProton][index] = track->CorrectionProton();
+    fFloatColumns[kCorrPionMinus][index] = track->CorrectionPionMinus();
+    fFloatColumns[kCorrKaonMinus][index] = track->CorrectionKaonMinus();
+    fFloatColumns[kCorrProtonMinus][index] = track->CorrectionProtonMinus();
+    fFloatColumns[kCorrAll][index] = track->CorrectionAll();
+  }
+}
+
+//_________________________
+AliFemtoEvent* AliFemtoEventReaderMiniEvent::MakeEvent() const
+{
+  AliFemtoEvent *event = new AliFemtoEvent;
+
+  event->SetMagneticField(fEventDoubles[kMagneticField]);
+  event->SetPrimVertPos(AliFemtoThreeVector(fEventDoubles[kVertexX], fEventDoubles[kVertexY], fEventDoubles[kVertexZ]));
+  event->SetPrimVertCov(&fEventDoubles[kVertexCov]);
+
+  event->SetCentralityV0(fEventFloats[kCentralityV0]);
+  event->SetCentralityV0A(fEventFloats[kCentralityV0A]);
+  event->SetCentralityV0C(fEventFloats[kCentralityV0C]);
+  event->SetCentralityZNA(fEventFloats[kCentralityZNA]);
+  event->SetCentralityZNC(fEventFloats[kCentralityZNC]);
+  event->SetCentralityCL1(fEventFloats[kCentralityCL1]);
+  event->SetCentralityCL0(fEventFloats[kCentralityCL0]);
+  event->SetCentralityTKL(fEventFloats[kCentralityTKL]);
+  event->SetCentralityFMD(fEventFloats[kCentralityFMD]);
+  event->SetCentralityTrk(fEventFloats[kCentralityTrk]);
+  event->SetCentralityCND(fEventFloats[kCentralityCND]);
+  event->SetCentralityNPA(fEventFloats[kCentralityNPA]);
+  event->SetCentralitySPD1(fEventFloats[kCentralitySPD1]);
+  event->SetZDCN1Energy(fEventFloats[kZDCN1Energy]);
+  event->SetZDCP1Energy(fEventFloats[kZDCP1Energy]);
+  event->SetZDCN2Energy(fEventFloats[kZDCN2Energy]);
+  event->SetZDCP2Energy(fEventFloats[kZDCP2Energy]);
+  event->SetZDCEMEnergy(fEventFloats[kZDCEMEnergy]);
+  event->SetReactionPlaneAngle(fEventFloats[kReactionPlaneAngle]);
+
+  event->SetRunNumber(fEventInts[kRunNumber]);
+  event->SetEventNumber(fEventInts[kEventNumber]);
+  event->SetNumberOfTracks(fEventInts[kNumberOfTracks]);
+  event->SetNormalizedMult(fEventInts[kNormalizedMult]);
+  event->SetSPDMult(fEventInts[kSPDMult]);
+  event->SetMultiplicityEstimateITSTPC(fEventInts[kEstimateITSTPC]);
+  event->SetMultiplicityEstimateTracklets(fEventInts[kEstimateTracklets]);
+  event->SetMultiplicityEstimateITSPure(fEventInts[kEstimateITSPure]);
+  event->SetZDCParticipants(fEventInts[kZDCParticipants]);
+  event->SetTriggerCluster(fEventInts[kTriggerCluster]);
+  event->SetIsCollisionCandidate(fEventInts[kIsCollisionCandidate]);
+  event->SetTriggerMask(fTriggerMask);
+
+  return event;
+}
+
+//_________________________
+AliFemtoTrack* AliFemtoEventReaderMiniEvent::MakeTrack(Int_t index, const AliFemtoEvent *event) const
+{
+  AliFemtoTrack *track = new AliFemtoTrack();
+
+  const AliFemtoThreeVector vertex = event->PrimVertPos();
+  const double vertexXYZ[3] = {vertex.x(), vertex.y(), vertex.z()};
+  track->SetPrimaryVertex(vertexXYZ);
+  track->SetZvtx(fFloatColumns[kZvtx][index]);
+  track->SetMultiplicity(fIntColumns[kMultiplicity][index]);
+
+  const short charge = fIntColumns[kCharge][index];
+  const double px = fFloatColumns[kPx][index],
+               py = fFloatColumns[kPy][index],
+               pz = fFloatColumns[kPz][index];
+  const AliFemtoThreeVector p(px, py, pz);
+  track->SetCharge(charge);
+  track->SetP(p);
+  track->SetPt(sqrt(px * px + py * py));
+  // helix as in AliFemtoEventReaderAOD; the field of the event is in internal units
+  AliFmPhysicalHelixD helix(p, vertex, event->MagneticField(), (double)charge);
+  track->SetHelix(helix);
+
+  track->SetTrackId(fIntColumns[kTrackId][index]);
+  track->SetLabel(fIntColumns[kLabel][index]);
+  track->SetFlags(fFlags[index]);
+
+  if (fFileColumns & kTrackQuality) {
+    track->SetImpactD(fFloatColumns[kImpactD][index]);
+    track->SetImpactZ(fFloatColumns[kImpactZ][index]);
+    track->SetCdd(fFloatColumns[kCdd][index]);
+    track->SetCdz(fFloatColumns[kCdz][index]);
+    track->SetCzz(fFloatColumns[kCzz][index]);
+    track->SetImpactDprim(fFloatColumns[kImpactDprim][index]);
+    track->SetImpactDweak(fFloatColumns[kImpactDweak][index]);
+    track->SetImpactDmat(fFloatColumns[kImpactDmat][index]);
+    track->SetITSchi2(fFloatColumns[kITSchi2][index]);
+    track->SetTPCchi2(fFloatColumns[kTPCchi2][index]);
+    track->SetSigmaToVertex(fFloatColumns[kSigmaToVertex][index]);
+    track->SetXatDCA(fFloatColumns[kXatDCA][index]);
+    track->SetYatDCA(fFloatColumns[kYatDCA][index]);
+    track->SetZatDCA(fFloatColumns[kZatDCA][index]);
+    track->SetITSncls(fIntColumns[kITSncls][index]);
+    track->SetTPCncls(fIntColumns[kTPCncls][index]);
+    track->SetTPCnclsF(fIntColumns[kTPCnclsF][index]);
+    const Int_t itsHits = fIntColumns[kITSHits][index];
+    for (int layer = 0; layer < 6; layer++) {
+      track->SetITSHitOnLayer(layer, (itsHits >> layer) & 1);
+    }
+    int kinkIndexes[3];
+    for (int i = 0; i < 3; i++) {
+      kinkIndexes[i] = fIntColumns[kKinkIndexes][3 * index + i];
+    }
+    track->SetKinkIndexes(kinkIndexes);
+  }
+
+  if (fFileColumns & kPID) {
+    track->SetInnerMomentum(fFloatColumns[kInnerMomentum][index]);
+    track->SetTPCsignal(fFloatColumns[kTPCsignal][index]);
+    track->SetTPCsignalS(fFloatColumns[kTPCsignalS][index]);
+    track->SetTPCsignalN(fIntColumns[kTPCsignalN][index]);
+    track->SetVTOF(fFloatColumns[kVTOF][index]);
+    track->SetNSigmaTPCPi(fFloatColumns[kNSigmaTPCPi][index]);
+    track->SetNSigmaTPCK(fFloatColumns[kNSigmaTPCK][index]);
+    track->SetNSigmaTPCP(fFloatColumns[kNSigmaTPCP][index]);
+    track->SetNSigmaTPCE(fFloatColumns[kNSigmaTPCE][index]);
+    track->SetNSigmaTOFPi(fFloatColumns[kNSigmaTOFPi][index]);
+    track->SetNSigmaTOFK(fFloatColumns[kNSigmaTOFK][index]);
+    track->SetNSigmaTOFP(fFloatColumns[kNSigmaTOFP][index]);
+    track->SetNSigmaTOFE(fFloatColumns[kNSigmaTOFE][index]);
+    track->SetPidProbElectron(fFloatColumns[kPidProbElectron][index]);
+    track->SetPidProbPion(fFloatColumns[kPidProbPion][index]);
+    track->SetPidProbKaon(fFloatColumns[kPidProbKaon][index]);
+    track->SetPidProbProton(fFloatColumns[kPidProbProton][index]);
+    track->SetPidProbMuon(fFloatColumns[kPidProbMuon][index]);
+    track->SetTofExpectedTimes(fFloatColumns[kTOFPionTime][index],
+                               fFloatColumns[kTOFKaonTime][index],
+                               fFloatColumns[kTOFProtonTime][index]);
+  }
+
+  if (fFileColumns & kTPCPoints) {
+    const Float_t *xyz = &fFloatColumns[kTPCPointsXYZ][3 * kNTPCPoints * index];
+    double points[9][3];
+    double *pointPtrs[9];
+    for (int i = 0; i < 9; i++) {
+      for (int k = 0; k < 3; k++) {
+        points[i][k] = xyz[3 * (i + 1) + k];
+      }
+      pointPtrs[i] = points[i];
+    }
+    track->SetNominalTPCEntrancePoint(LoadPoint(xyz));
+    track->SetNominalTPCPoints(pointPtrs);
+    track->SetNominalTPCExitPoint(LoadPoint(xyz + 30));
+    track->SetNominalTPCPointShifted(LoadPoint(xyz + 33));
+  }
+
+  if (fFileColumns & kClusterMaps) {
+    TBits clusters(kNMapBits), shared(kNMapBits);
+    UnpackBits(&fIntColumns[kTPCClusterMap][kNMapWords * index], kNMapBits, clusters);
+    UnpackBits(&fIntColumns[kTPCSharedMap][kNMapWords * index], kNMapBits, shared);
+    track->SetTPCClusterMap(clusters);
+    track->SetTPCSharedMap(shared);
+  }
+
+  if (fFileColumns & kCorrections) {
+    track->SetCorrectionPion(fFloatColumns[kCorrPion][index]);
+    track->SetCorrectionKaon(fFloatColumns[kCorrKaon][index]);
+    track->SetCorrectionProton(fFloatColumns[kCorrProton][index]);
+    track->SetCorrectionPionMinus(fFloatColumns[kCorrPionMinus][index]);
+    track->SetCorrectionKaonMinus(fFloatColumns[kCorrKaonMinus][index]);
+    track->SetCorrectionProtonMinus(fFloatColumns[kCorrProtonMinus][index]);
+    track->SetCorrectionAll(fFloatColumns[kCorrAll][index]);
+  }
+
+  return track;
+}
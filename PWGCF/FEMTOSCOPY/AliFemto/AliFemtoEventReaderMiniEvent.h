@@ -0,0 +1,184 @@
+///
+/// \file AliFemtoEventReaderMiniEvent.h
+///
+
+#ifndef ALIFEMTOEVENTREADERMINIEVENT_H
+#define ALIFEMTOEVENTREADERMINIEVENT_H
+
+#include "AliFemtoEventReader.h"
+
+#include <TString.h>
+#include <vector>
+
+class TFile;
+class TTree;
+class TChain;
+class AliFemtoEvent;
+class AliFemtoTrack;
+
+/// \class AliFemtoEventReaderMiniEvent
+/// \brief Writer and reader of compact femto mini-events
+///
+/// Used as event writer (AliFemtoManager::AddEventWriter), the events
+/// produced by the reader of the manager are stored in a TTree with one
+/// branch per event variable and one branch per track variable (an array
+/// over the tracks of the event), so that each column is compressed and
+/// read on its own. Only the tracks passing the front-loaded track cut
+/// and the events passing the front-loaded event cut are written, if
+/// these cuts are set.
+///
+/// Used as event reader (AliFemtoManager::SetEventReader), the files are
+/// read back into AliFemtoEvent and AliFemtoTrack objects, and the track
+/// helices are rebuilt from the momentum, the primary vertex and the
+/// magnetic field, as in AliFemtoEventReaderAOD. Repeated analysis
+/// passes on the same dataset then skip the AOD I/O and conversion.
+///
+/// The kinematics (charge, momentum, id, label, flags, multiplicity) are
+/// always stored; the other track variables come in groups selected with
+/// SetColumns(). When reading, the branches of the groups which are not
+/// selected are not read, and the corresponding track members keep their
+/// default values.
+///
+/// Not stored: hidden (Monte Carlo) info, V0s, Xis, kinks and the event
+/// plane object. Floating point track variables are stored in single
+/// precision.
+///
+/// \code
+/// // writing, in the configuration of an AOD train
+/// AliFemtoEventReaderMiniEvent *writer = new AliFemtoEventReaderMiniEvent("FemtoMiniEvents.root");
+/// writer->SetTrackCut(looseTrackCut);
+/// manager->AddEventWriter(writer);
+///
+/// // reading, outside of the analysis framework
+/// manager->SetEventReader(new AliFemtoEventReaderMiniEvent("FemtoMiniEvents.root"));
+/// manager->Init();
+/// while (manager->ProcessEvent() == 0) {}
+/// manager->Finish();
+/// \endcode
+///
+class AliFemtoEventReaderMiniEvent : public AliFemtoEventReader {
+public:
+  /// Groups of stored track variables
+  enum EColumnGroup {
+    kKinematics   = 0x01,  ///< charge, momentum, id, label, flags, multiplicity, z of the vertex (always stored)
+    kTrackQuality = 0x02,  ///< impact parameters, chi2, number of clusters, ITS hits, kink indexes
+    kPID          = 0x04,  ///< dE/dx, TPC and TOF n-sigmas, PID probabilities, TOF expected times
+    kTPCPoints    = 0x08,  ///< nominal TPC entrance, exit, shifted and 9 intermediate points
+    kClusterMaps  = 0x10,  ///< TPC cluster and sharing maps
+    kCorrections  = 0x20,  ///< efficiency corrections
+    kAllColumns   = 0x3f
+  };
+
+  /// Single precision track columns
+  enum EFloatColumn {
+    kPx, kPy, kPz, kZvtx,
+    kImpactD, kImpactZ, kCdd, kCdz, kCzz, kImpactDprim, kImpactDweak, kImpactDmat,
+    kITSchi2, kTPCchi2, kSigmaToVertex, kXatDCA, kYatDCA, kZatDCA,
+    kInnerMomentum, kTPCsignal, kTPCsignalS, kVTOF,
+    kNSigmaTPCPi, kNSigmaTPCK, kNSigmaTPCP, kNSigmaTPCE,
+    kNSigmaTOFPi, kNSigmaTOFK, kNSigmaTOFP, kNSigmaTOFE,
+    kPidProbElectron, kPidProbPion, kPidProbKaon, kPidProbProton, kPidProbMuon,
+    kTOFPionTime, kTOFKaonTime, kTOFProtonTime,
+    kTPCPointsXYZ,
+    kCorrPion, kCorrKaon, kCorrProton, kCorrPionMinus, kCorrKaonMinus, kCorrProtonMinus, kCorrAll,
+    kNFloatColumns
+  };
+
+  /// Integer track columns
+  enum EIntColumn {
+    kCharge, kTrackId, kLabel, kMultiplicity,
+    kITSncls, kTPCncls, kTPCnclsF, kITSHits, kKinkIndexes,
+    kTPCsignalN,
+    kTPCClusterMap, kTPCSharedMap,
+    kNIntColumns
+  };
+
+  AliFemtoEventReaderMiniEvent(const char *fileName = "FemtoMiniEvents.root", UInt_t columns = kAllColumns);
+  virtual ~AliFemtoEventReaderMiniEvent();
+
+  virtual AliFemtoEvent* ReturnHbtEvent();
+  virtual int WriteHbtEvent(AliFemtoEvent *event);
+  virtual int Init(const char *ReadWrite, AliFemtoString &Message);
+  virtual void Finish();
+  virtual AliFemtoString Report();
+
+  /// Output file, or input file(s) - wildcards are accepted when reading
+  void SetFileName(const char *fileName) { fFileName = fileName; }
+  /// Additional input file (or wildcard), read after the previous ones
+  void AddFile(const char *fileName);
+  /// Groups of track variables to write, or to read (kKinematics is always added)
+  void SetColumns(UInt_t columns) { fColumns = columns | kKinematics; }
+  /// Compression settings of the output file (see TFile::SetCompressionSettings), -1 for the default
+  void SetCompressionSettings(Int_t settings) { fCompression = settings; }
+
+  const char* GetFileName() const { return fFileName.Data(); }
+  UInt_t GetColumns() const { return fColumns; }
+  /// Groups of track variables of the open file (those read, when reading)
+  UInt_t GetFileColumns() const { return fFileColumns; }
+  /// Events written or read so far
+  Long64_t GetNEventsIO() const { return fNEventsIO; }
+
+  static const char* TreeName() { return "FemtoMiniEvents"; }
+
+private:
+  enum { kNMapWords = 5, kNMapBits = 159, kNTPCPoints = 12 };
+  enum { kMagneticField, kVertexX, kVertexY, kVertexZ, kVertexCov, kNEventDoubles = kVertexCov + 6 };
+  enum {
+    kCentralityV0, kCentralityV0A, kCentralityV0C, kCentralityZNA, kCentralityZNC,
+    kCentralityCL1, kCentralityCL0, kCentralityTKL, kCentralityFMD, kCentralityTrk,
+    kCentralityCND, kCentralityNPA, kCentralitySPD1,
+    kZDCN1Energy, kZDCP1Energy, kZDCN2Energy, kZDCP2Energy, kZDCEMEnergy,
+    kReactionPlaneAngle,
+    kNEventFloats
+  };
+  enum {
+    kRunNumber, kEventNumber, kNumberOfTracks, kNormalizedMult, kSPDMult,
+    kEstimateITSTPC, kEstimateTracklets, kEstimateITSPure,
+    kZDCParticipants, kTriggerCluster, kIsCollisionCandidate,
+    kNEventInts
+  };
+
+  AliFemtoEventReaderMiniEvent(const AliFemtoEventReaderMiniEvent &aReader);
+  AliFemtoEventReaderMiniEvent& operator=(const AliFemtoEventReaderMiniEvent &aReader);
+
+  int  InitWrite(AliFemtoString &Message);
+  int  InitRead(AliFemtoString &Message);
+  void Reserve(Int_t nTracks);
+  void SetBranchAddresses();
+
+  void FillEventColumns(const AliFemtoEvent *event);
+  void FillTrackColumns(Int_t index, const AliFemtoTrack *track);
+  AliFemtoEvent* MakeEvent() const;
+  AliFemtoTrack* MakeTrack(Int_t index, const AliFemtoEvent *event) const;
+
+  TString  fFileName;       ///< output file, or first input file(s)
+  std::vector<TString> fMoreFiles;  ///< additional input files
+  UInt_t   fColumns;        ///< requested groups of track variables
+  Int_t    fCompression;    ///< compression settings of the output file (-1: default)
+
+  TFile   *fFile;           //!<! output file
+  TTree   *fTree;           //!<! output tree
+  TChain  *fChain;          //!<! input chain
+  UInt_t   fFileColumns;    //!<! groups of track variables of the open file
+  Long64_t fNEntries;       //!<! entries of the input chain
+  Long64_t fCurrentEntry;   //!<! next entry to read
+  Long64_t fNEventsIO;      //!<! events written or read
+
+  Int_t    fNTracks;        //!<! tracks of the current event
+  Int_t    fCapacity;       //!<! tracks the column buffers can hold
+  Double_t fEventDoubles[kNEventDoubles];  //!<! event columns
+  Float_t  fEventFloats[kNEventFloats];    //!<! event columns
+  Int_t    fEventInts[kNEventInts];        //!<! event columns
+  Long64_t fTriggerMask;                   //!<! event trigger mask
+  std::vector<Float_t>  fFloatColumns[kNFloatColumns];  //!<! track columns
+  std::vector<Int_t>    fIntColumns[kNIntColumns];      //!<! track columns
+  std::vector<Long64_t> fFlags;                         //!<! track flags
+
+#ifdef __ROOT__
+  /// \cond CLASSIMP
+  ClassDef(AliFemtoEventReaderMiniEvent, 1);
+  /// \endcond
+#endif
+};
+
+#endif
@@ -8,6 +8,11 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoManager.h"
+#include "AliFemtoSimpleAnalysis.h"
+#include "AliFemtoParticleCutCache.h"
+#include "AliFemtoModelCorrFctn.h"
+#include "AliFemtoModelManager.h"
+#include "AliLaneThreadPool.h"
 //#include "AliFemtoParticleCollection.h"
 //#include "AliFemtoTrackCut.h"
 //#include "AliFemtoV0Cut.h"
@@ -25,7 +30,12 @@
 AliFemtoManager::AliFemtoManager():
   fAnalysisCollection(NULL),
   fEventReader(NULL),
-  fEventWriterCollection(NULL)
+  fEventWriterCollection(NULL),
+  fNThreads(1),
+  fShareParticleCuts(false),
+  fParticleCutCache(NULL),
+  fLanePool(NULL),
+  fNDispatchedAnalyses(0)
 {
   // default constructor
   fAnalysisCollection = new AliFemtoAnalysisCollection;
@@ -35,7 +45,12 @@ AliFemtoManager::AliFemtoManager():
 AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
   fAnalysisCollection(new AliFemtoAnalysisCollection),
   fEventReader(aManager.fEventReader),
-  fEventWriterCollection(new AliFemtoEventWriterCollection)
+  fEventWriterCollection(new AliFemtoEventWriterCollection),
+  fNThreads(aManager.fNThreads),
+  fShareParticleCuts(aManager.fShareParticleCuts),
+  fParticleCutCache(NULL),
+  fLanePool(NULL),
+  fNDispatchedAnalyses(0)
 {
   // copy constructor
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
@@ -52,6 +67,7 @@ AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
 AliFemtoManager::~AliFemtoManager()
 {
   // destructor
+  ClearDispatch();
   delete fEventReader;
   // now delete each Analysis in the Collection, and then the Collection itself
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
@@ -74,6 +90,10 @@ AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
     return *this;
   }
 
+  ClearDispatch();
+  fNThreads = aManager.fNThreads;
+  fShareParticleCuts = aManager.fShareParticleCuts;
+
   fEventReader = aManager.fEventReader;
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
   if (fAnalysisCollection) {
@@ -135,6 +155,10 @@ int AliFemtoManager::Init()
       }
     }
   }
+  // Lanes, threads and particle-cut cache of the analyses
+  if (fNThreads != 1 || fShareParticleCuts) {
+    SetupDispatch();
+  }
   return 0;
 }
 //____________________________
@@ -242,9 +266,13 @@ int AliFemtoManager::ProcessEvent()
   }
 
   // loop over all the Analysis
-  AliFemtoSimpleAnalysisIterator tAnalysisIter;
-  for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
-    (*tAnalysisIter)->ProcessEvent(currentHbtEvent);
+  if (fNThreads == 1 && !fShareParticleCuts) {
+    AliFemtoSimpleAnalysisIterator tAnalysisIter;
+    for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
+      (*tAnalysisIter)->ProcessEvent(currentHbtEvent);
+    }
+  } else {
+    ProcessAnalyses(currentHbtEvent);
   }
 
   if (currentHbtEvent) {
@@ -256,3 +284,139 @@ int AliFemtoManager::ProcessEvent()
 #endif
   return 0;    // 0 = "good return"
 }       // ProcessEvent
+//____________________________
+void AliFemtoManager::ClearDispatch()
+{
+  /// Forget the lanes and the particle-cut cache (rebuilt at the next event)
+  if (fParticleCutCache) {
+    AliFemtoSimpleAnalysisIterator tAnalysisIter;
+    for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
+      AliFemtoSimpleAnalysis *simpleAnalysis = dynamic_cast<AliFemtoSimpleAnalysis*>(*tAnalysisIter);
+      if (simpleAnalysis && simpleAnalysis->ParticleCutCache() == fParticleCutCache) {
+        simpleAnalysis->SetParticleCutCache(NULL);
+      }
+    }
+    delete fParticleCutCache;
+    fParticleCutCache = NULL;
+  }
+  delete fLanePool;
+  fLanePool = NULL;
+  fNDispatchedAnalyses = 0;
+}
+//____________________________
+void AliFemtoManager::SetupDispatch()
+{
+  /// Group the analyses sharing objects (cuts, correlation functions, model
+  /// manager and generators) into lanes processed sequentially, and start
+  /// the threads. Lanes are independent and can be processed concurrently.
+  /// Analyses not switched on with
+  /// AliFemtoSimpleAnalysis::SetConcurrentExecution all go into one lane.
+  ClearDispatch();
+  fNDispatchedAnalyses = fAnalysisCollection->size();
+
+  fLanePool = new AliLaneThreadPool;
+  fLanePool->ResetLanes(fNDispatchedAnalyses);
+  int iAnalysis = 0;
+  AliFemtoSimpleAnalysisIterator tAnalysisIter;
+  for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++, iAnalysis++){
+    AliFemtoSimpleAnalysis *simpleAnalysis = dynamic_cast<AliFemtoSimpleAnalysis*>(*tAnalysisIter);
+    if (!simpleAnalysis) {
+      fLanePool->AddResources(iAnalysis, "NotConcurrent");
+      continue;
+    }
+    if (!simpleAnalysis->ConcurrentExecution()) {
+      fLanePool->AddResources(iAnalysis, "NotConcurrent");
+    }
+    // objects of the analysis, which may be shared with other analyses
+    std::vector<const void*> objects;
+    objects.push_back(simpleAnalysis->EventCut());
+    objects.push_back(simpleAnalysis->FirstParticleCut());
+    objects.push_back(simpleAnalysis->SecondParticleCut());
+    objects.push_back(simpleAnalysis->PairCut());
+    AliFemtoCorrFctnCollection *corrFctns = simpleAnalysis->CorrFctnCollection();
+    if (corrFctns) {
+      for (AliFemtoCorrFctnIterator iter = corrFctns->begin(); iter != corrFctns->end(); ++iter) {
+        objects.push_back(*iter);
+        // the weights are computed by the model manager, which may be shared
+        AliFemtoModelCorrFctn *modelCorrFctn = dynamic_cast<AliFemtoModelCorrFctn*>(*iter);
+        AliFemtoModelManager *modelManager = modelCorrFctn ? modelCorrFctn->GetManager() : NULL;
+        if (modelManager) {
+          objects.push_back(modelManager);
+          objects.push_back(modelManager->GetWeightGenerator());
+          objects.push_back(modelManager->GetFreezeOutGenerator());
+        }
+      }
+    }
+    TString resources;
+    for (size_t j = 0; j < objects.size(); j++) {
+      if (objects[j]) {
+        resources += " " + AliLaneThreadPool::GetPointerName(objects[j]);
+      }
+    }
+    fLanePool->AddResources(iAnalysis, resources);
+  }
+  fLanePool->MakeLanes();
+
+  int nLanes = fLanePool->GetNumberOfLanes();
+  int nThreads = (fNThreads > 0) ? fNThreads : AliLaneThreadPool::GetNumberOfCores();
+  if (nThreads > nLanes) {
+    nThreads = nLanes > 0 ? nLanes : 1;
+  }
+  fLanePool->StartThreads(nThreads);
+
+  if (fShareParticleCuts) {
+    fParticleCutCache = new AliFemtoParticleCutCache;
+    fParticleCutCache->Setup(fAnalysisCollection);
+    for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
+      AliFemtoSimpleAnalysis *simpleAnalysis = dynamic_cast<AliFemtoSimpleAnalysis*>(*tAnalysisIter);
+      if (simpleAnalysis) {
+        simpleAnalysis->SetParticleCutCache(fParticleCutCache);
+      }
+    }
+  }
+
+  cout << "AliFemtoManager: " << fNDispatchedAnalyses << " analyses in " << nLanes
+       << " independent lanes, " << fLanePool->GetNumberOfThreads() << " threads, "
+       << (fParticleCutCache ? fParticleCutCache->GetNSharedCuts() : 0)
+       << " particle cuts shared in " << (fParticleCutCache ? fParticleCutCache->GetNGroups() : 0)
+       << " groups" << endl;
+}
+//____________________________
+void AliFemtoManager::ProcessAnalyses(const AliFemtoEvent* hbtEvent)
+{
+  /// Pass the event to all the analyses, lane by lane in the threads of the
+  /// pool, or in the order of the collection without threads.
+  if (!fLanePool || fNDispatchedAnalyses != fAnalysisCollection->size()) {
+    SetupDispatch();
+  }
+  if (fParticleCutCache) {
+    fParticleCutCache->NewEvent();
+  }
+
+  if (fLanePool->GetNumberOfThreads() > 1) {
+    class AnalysisLane : public AliLaneThreadPool::LaneProcessor {
+    public:
+      AnalysisLane(const AliLaneThreadPool &pool, const std::vector<AliFemtoAnalysis*> &analyses, const AliFemtoEvent *event):
+        fPool(pool), fAnalyses(analyses), fEvent(event) {}
+      virtual void ProcessLane(Int_t lane) {
+        const std::vector<Int_t> &items = fPool.GetLane(lane);
+        for (size_t i = 0; i < items.size(); i++) {
+          fAnalyses[items[i]]->ProcessEvent(fEvent);
+        }
+      }
+    private:
+      const AliLaneThreadPool &fPool;
+      const std::vector<AliFemtoAnalysis*> &fAnalyses;
+      const AliFemtoEvent *fEvent;
+    };
+    std::vector<AliFemtoAnalysis*> analyses(fAnalysisCollection->begin(), fAnalysisCollection->end());
+    AnalysisLane processor(*fLanePool, analyses, hbtEvent);
+    fLanePool->ProcessLanes(processor);
+    return;
+  }
+  // sequential: keep the order of the collection
+  AliFemtoSimpleAnalysisIterator tAnalysisIter;
+  for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
+    (*tAnalysisIter)->ProcessEvent(hbtEvent);
+  }
+}
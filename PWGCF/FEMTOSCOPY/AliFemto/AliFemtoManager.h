@@ -19,6 +19,8 @@
 #include "AliFemtoEventReader.h"
 #include "AliFemtoEventWriter.h"
 
+class AliFemtoParticleCutCache;
+class AliLaneThreadPool;
 
 /// \class AliFemtoManager
 /// \brief Main class for managing femtoscopic analyses
@@ -43,6 +45,25 @@
 /// operator private prevents potential dangling pointer (segfault)
 /// errors.
 ///
+/// Trains with many analyses on the same events can use
+///
+/// - `SetNumberOfThreads(n)`: the analyses process each event
+///   concurrently in up to n threads (ROOT 6), kept in a pool from
+///   `Init()` to the destruction of the manager. The event is shared
+///   read-only; each analysis keeps its own cuts, correlation functions
+///   and mixing buffers. Only the AliFemtoSimpleAnalysis switched on with
+///   `SetConcurrentExecution()` run concurrently, all the others run one
+///   after the other in the same thread. Analyses sharing any cut,
+///   correlation function, or model manager and generators of an
+///   AliFemtoModelCorrFctn (same pointer) also run in the same thread.
+///   Other shared objects and global state (e.g. gRandom) are not
+///   detected: analyses using them must not be switched on.
+///
+/// - `SetShareParticleCuts()`: analyses with equal particle cuts share
+///   the cut results of each event (see AliFemtoParticleCutCache).
+///
+/// The outputs are the same as with the sequential dispatch.
+///
 class AliFemtoManager {
 
 private:
@@ -50,6 +71,16 @@ private:
   AliFemtoEventReader*        fEventReader;              ///< Event reader
   AliFemtoEventWriterCollection* fEventWriterCollection; ///< Event writer collection
 
+  int                         fNThreads;                 ///< Threads processing the analyses (1: sequential, 0: number of cores)
+  bool                        fShareParticleCuts;        ///< Share the results of equal particle cuts
+  AliFemtoParticleCutCache*   fParticleCutCache;         //!<! Particle-cut results of the current event
+  AliLaneThreadPool*          fLanePool;                 //!<! Lanes of analyses processed sequentially in one thread
+  unsigned int                fNDispatchedAnalyses;      //!<! Size of the collection when the lanes were built
+
+  void SetupDispatch();   ///< Build the lanes and the particle-cut cache
+  void ClearDispatch();
+  void ProcessAnalyses(const AliFemtoEvent* hbtEvent);  ///< Threaded or cached dispatch of an event
+
 public:
   AliFemtoManager();
   AliFemtoManager(const AliFemtoManager& aManager);
@@ -70,7 +101,13 @@ public:
   AliFemtoEventReader* EventReader();
   void SetEventReader(AliFemtoEventReader* r);
 
-  /// Calls `Init()` on all owned EventWriters
+  void SetNumberOfThreads(int n);               ///< Process the analyses concurrently in n threads (0: number of cores)
+  int GetNumberOfThreads() const;
+  void SetShareParticleCuts(bool share=true);   ///< Share results between equal particle cuts
+  bool GetShareParticleCuts() const;
+
+  /// Calls `Init()` on all owned EventWriters, and builds the lanes and
+  /// starts the threads of the concurrent dispatch if requested
   ///
   /// Returns 0 for success, 1 for failure.
   ///
@@ -99,4 +136,9 @@ inline void AliFemtoManager::SetEventWriter(AliFemtoEventWriter* writer){fEventW
 inline AliFemtoEventReader* AliFemtoManager::EventReader(){return fEventReader;}
 inline void AliFemtoManager::SetEventReader(AliFemtoEventReader* reader){fEventReader = reader;}
 
+inline void AliFemtoManager::SetNumberOfThreads(int n){fNThreads = n; ClearDispatch();}
+inline int AliFemtoManager::GetNumberOfThreads() const {return fNThreads;}
+inline void AliFemtoManager::SetShareParticleCuts(bool share){fShareParticleCuts = share; ClearDispatch();}
+inline bool AliFemtoManager::GetShareParticleCuts() const {return fShareParticleCuts;}
+
 #endif
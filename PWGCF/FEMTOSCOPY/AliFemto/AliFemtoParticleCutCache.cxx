@@ -0,0 +1,225 @@
+///
+/// \file AliFemtoParticleCutCache.cxx
+///
+
+#include "AliFemtoParticleCutCache.h"
+#include "AliFemtoSimpleAnalysis.h"
+#include "AliFemtoParticleCut.h"
+
+#include <TBaseClass.h>
+#include <TBufferFile.h>
+#include <TClass.h>
+#include <TDataMember.h>
+#include <TList.h>
+#include <TString.h>
+
+#include <atomic>
+#include <typeinfo>
+
+/// Results of a group of equal cuts for the current event
+struct AliFemtoParticleCutCache::Group {
+  Group(): fState(kEmpty), fResults() {}
+
+  enum { kEmpty = 0, kClaimed = 1, kPublished = 2 };
+  std::atomic<int> fState;        ///< kEmpty, kClaimed (being filled) or kPublished
+  std::vector<char> fResults;     ///< pass flags, written only by the claiming analysis
+};
+
+//_________________________
+AliFemtoParticleCutCache::AliFemtoParticleCutCache():
+  fGroups(),
+  fGroupOfCut()
+{
+  /* no-op */
+}
+
+//_________________________
+AliFemtoParticleCutCache::~AliFemtoParticleCutCache()
+{
+  Clear();
+}
+
+//_________________________
+void AliFemtoParticleCutCache::Clear()
+{
+  for (std::vector<Group*>::iterator it = fGroups.begin(); it != fGroups.end(); ++it) {
+    delete *it;
+  }
+  fGroups.clear();
+  fGroupOfCut.clear();
+}
+
+//_________________________
+bool AliFemtoParticleCutCache::StreamState(TClass *cl, const void *obj, TBuffer &buffer)
+{
+  if (!cl || !cl->GetListOfDataMembers()) {
+    return false;
+  }
+
+  // the cut monitors are not part of the configuration
+  if (cl == AliFemtoCutMonitorHandler::Class()) {
+    return true;
+  }
+
+  TIter nextBase(cl->GetListOfBases());
+  while (TBaseClass *base = (TBaseClass*)nextBase()) {
+    if (!StreamState(base->GetClassPointer(), (const char*)obj + base->GetDelta(), buffer)) {
+      return false;
+    }
+  }
+
+  TIter nextMember(cl->GetListOfDataMembers());
+  while (TDataMember *member = (TDataMember*)nextMember()) {
+    if (!member->IsPersistent() || (member->Property() & kIsStatic)) {
+      continue;
+    }
+    // pass/fail counters (fNTracksPassed, fNV0sFailed, ...)
+    TString name(member->GetName());
+    if (name.BeginsWith("fN") && (name.EndsWith("Passed") || name.EndsWith("Failed"))) {
+      continue;
+    }
+
+    const char *address = (const char*)obj + member->GetOffset();
+    Int_t n = 1;
+    for (Int_t dim = 0; dim < member->GetArrayDim(); dim++) {
+      n *= member->GetMaxIndex(dim);
+    }
+
+    if (member->IsaPointer()) {
+      TClass *pointee = TClass::GetClass(member->GetTypeName());
+      // back-pointer to the analysis
+      if (pointee && pointee->InheritsFrom("AliFemtoAnalysis")) {
+        continue;
+      }
+      for (Int_t i = 0; i < n; i++) {
+        const void *target = ((const void* const*)address)[i];
+        buffer.WriteBool(target != NULL);
+        if (!target) {
+          continue;
+        }
+        if (!pointee) {
+          return false;
+        }
+        TClass *actual = pointee->GetActualClass(target);
+        if (actual->GetClassVersion() > 0) {
+          buffer.WriteString(actual->GetName());
+          actual->Streamer(const_cast<void*>(target), buffer);
+        } else if (!StreamState(actual, target, buffer)) {
+          return false;
+        }
+      }
+    } else if (member->IsBasic() || member->IsEnum()) {
+      buffer.WriteFastArray(address, member->GetUnitSize() * n);
+    } else {
+      TClass *memberClass = TClass::GetClass(member->GetTrueTypeName());
+      if (!memberClass) {
+        return false;
+      }
+      for (Int_t i = 0; i < n; i++) {
+        const char *element = address + i * memberClass->Size();
+        if (memberClass->GetClassVersion() > 0 || memberClass->GetCollectionProxy()) {
+          memberClass->Streamer(const_cast<char*>(element), buffer);
+        } else if (!StreamState(memberClass, element, buffer)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+//_________________________
+std::string AliFemtoParticleCutCache::CutSignature(AliFemtoParticleCut *cut)
+{
+  TBufferFile buffer(TBuffer::kWrite);
+  if (!StreamState(TClass::GetClass(typeid(*cut)), cut, buffer)) {
+    return std::string();
+  }
+  std::string signature = typeid(*cut).name();
+  signature += "|";
+  signature.append(buffer.Buffer(), buffer.Length());
+  return signature;
+}
+
+//_________________________
+void AliFemtoParticleCutCache::Setup(AliFemtoAnalysisCollection *analyses)
+{
+  Clear();
+
+  // distinct cuts by signature, and number of uses of each cut
+  std::map<std::string, std::vector<const AliFemtoParticleCut*> > cutsBySignature;
+  std::map<const AliFemtoParticleCut*, int> uses;
+
+  for (AliFemtoSimpleAnalysisIterator iter = analyses->begin(); iter != analyses->end(); ++iter) {
+    AliFemtoSimpleAnalysis *analysis = dynamic_cast<AliFemtoSimpleAnalysis*>(*iter);
+    if (!analysis) {
+      continue;
+    }
+    AliFemtoParticleCut *cuts[2] = {analysis->FirstParticleCut(), analysis->SecondParticleCut()};
+    for (int i = 0; i < 2; i++) {
+      if (!cuts[i] || (i == 1 && cuts[1] == cuts[0]) || uses[cuts[i]]++) {
+        continue;
+      }
+      // a cut whose state cannot be streamed is only shared with itself
+      std::string signature = CutSignature(cuts[i]);
+      if (signature.empty()) {
+        signature = TString::Format("%p", (const void*)cuts[i]).Data();
+      }
+      cutsBySignature[signature].push_back(cuts[i]);
+    }
+  }
+
+  typedef std::map<std::string, std::vector<const AliFemtoParticleCut*> >::const_iterator SignatureIter;
+  for (SignatureIter it = cutsBySignature.begin(); it != cutsBySignature.end(); ++it) {
+    if (it->second.size() < 2 && uses[it->second.front()] < 2) {
+      continue;
+    }
+    Group *group = new Group;
+    fGroups.push_back(group);
+    for (size_t i = 0; i < it->second.size(); i++) {
+      fGroupOfCut[it->second[i]] = group;
+    }
+  }
+}
+
+//_________________________
+void AliFemtoParticleCutCache::NewEvent()
+{
+  for (std::vector<Group*>::iterator it = fGroups.begin(); it != fGroups.end(); ++it) {
+    (*it)->fState.store(Group::kEmpty, std::memory_order_relaxed);
+  }
+}
+
+//_________________________
+const std::vector<char>* AliFemtoParticleCutCache::GetResults(const AliFemtoParticleCut *cut, std::vector<char> *&toFill)
+{
+  toFill = NULL;
+  std::map<const AliFemtoParticleCut*, Group*>::const_iterator found = fGroupOfCut.find(cut);
+  if (found == fGroupOfCut.end()) {
+    return NULL;
+  }
+  Group *group = found->second;
+
+  int state = group->fState.load(std::memory_order_acquire);
+  if (state == Group::kPublished) {
+    return &group->fResults;
+  }
+  // first analysis to reach the group fills it; if another one is filling
+  // it, evaluate the cut directly rather than waiting
+  int expected = Group::kEmpty;
+  if (state == Group::kEmpty
+      && group->fState.compare_exchange_strong(expected, Group::kClaimed, std::memory_order_acq_rel)) {
+    group->fResults.clear();
+    toFill = &group->fResults;
+  }
+  return NULL;
+}
+
+//_________________________
+void AliFemtoParticleCutCache::Publish(const AliFemtoParticleCut *cut)
+{
+  std::map<const AliFemtoParticleCut*, Group*>::const_iterator found = fGroupOfCut.find(cut);
+  if (found != fGroupOfCut.end()) {
+    found->second->fState.store(Group::kPublished, std::memory_order_release);
+  }
+}
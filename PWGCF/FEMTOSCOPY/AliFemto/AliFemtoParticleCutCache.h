@@ -0,0 +1,89 @@
+///
+/// \file AliFemtoParticleCutCache.h
+///
+
+#ifndef ALIFEMTOPARTICLECUTCACHE_H
+#define ALIFEMTOPARTICLECUTCACHE_H
+
+#include "AliFemtoAnalysisCollection.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class AliFemtoParticleCut;
+class TBuffer;
+class TClass;
+
+/// \class AliFemtoParticleCutCache
+/// \brief Per-event particle-cut results shared between analyses
+///
+/// Femto trains often hold many analyses with the same particle cuts
+/// (same class, mass, settings) which differ only by their event or pair
+/// cuts. The cache groups the particle cuts of the AliFemtoSimpleAnalysis
+/// objects of a collection which compare equal, i.e. have the same class
+/// and the same streamed state of their persistent data members (cut
+/// monitors, back-pointer to the analysis and fN...Passed/fN...Failed
+/// counters excluded). A cut whose state cannot be streamed (members
+/// without dictionary) is only shared between the analyses using the same
+/// cut object. For each
+/// event, the first analysis reaching a cut of a group evaluates Pass()
+/// on the collection of the event and publishes the results; the other
+/// analyses of the group read them and only fill their own cut monitors
+/// and particle collections.
+///
+/// GetResults() and Publish() are safe to call from the threads of the
+/// concurrent dispatch of AliFemtoManager: each group is claimed with an
+/// atomic compare-and-swap and an analysis finding the group claimed but
+/// not yet published evaluates its own cut instead of waiting.
+///
+/// The Pass() counters of the cuts which read shared results (reported by
+/// some cut classes) are not incremented; cut monitors and particle
+/// collections are the same as without cache.
+///
+class AliFemtoParticleCutCache {
+public:
+  AliFemtoParticleCutCache();
+  virtual ~AliFemtoParticleCutCache();
+
+  /// Group the equal particle cuts of the analyses. Cuts without any
+  /// equal partner and used by a single analysis are not cached.
+  void Setup(AliFemtoAnalysisCollection *analyses);
+
+  /// Invalidate the results of the previous event. Must not be called
+  /// while analyses are being processed.
+  void NewEvent();
+
+  /// Results of the cut for the current event (one entry per object of
+  /// the collection the cut applies to), NULL if not available. If NULL
+  /// and `toFill` is set, the caller has claimed the group: it must fill
+  /// `toFill` and call Publish().
+  const std::vector<char>* GetResults(const AliFemtoParticleCut *cut, std::vector<char> *&toFill);
+
+  /// Make the results filled by the claiming analysis available
+  void Publish(const AliFemtoParticleCut *cut);
+
+  int GetNGroups() const { return (int)fGroups.size(); }  ///< number of groups of equal cuts
+  int GetNSharedCuts() const { return (int)fGroupOfCut.size(); }  ///< number of cuts in the groups
+
+  /// Class and streamed configuration of a cut, empty if the state of
+  /// the cut cannot be streamed
+  static std::string CutSignature(AliFemtoParticleCut *cut);
+
+private:
+  struct Group;
+
+  AliFemtoParticleCutCache(const AliFemtoParticleCutCache &);
+  AliFemtoParticleCutCache& operator=(const AliFemtoParticleCutCache &);
+
+  void Clear();
+
+  /// Append the configuration members of an object of class `cl` (and of
+  /// its bases) to `buffer`; false if a member cannot be streamed
+  static bool StreamState(TClass *cl, const void *obj, TBuffer &buffer);
+
+  std::vector<Group*> fGroups;                                   ///< groups of equal cuts
+  std::map<const AliFemtoParticleCut*, Group*> fGroupOfCut;      ///< group of each cached cut (read-only during events)
+};
+
+#endif
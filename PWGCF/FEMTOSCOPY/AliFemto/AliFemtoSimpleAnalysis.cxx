@@ -9,6 +9,7 @@
 #include "AliFemtoXiCut.h"
 #include "AliFemtoXiTrackCut.h"
 #include "AliFemtoPicoEvent.h"
+#include "AliFemtoParticleCutCache.h"
 
 #include <string>
 #include <iostream>
@@ -45,23 +46,42 @@ AliFemtoCorrFctn*    copyTheCorrFctn(AliFemtoCorrFctn*);
 /// other type, it is recommended to add TrackCollectionIterType to the
 /// template list, and add the appropriate type to the function calls in
 /// FillParticleCollection.
+///
+/// If a particle-cut cache is given and an equal cut already evaluated the
+/// collection in this event, the stored results replace the calls to Pass;
+/// if this cut is the first of its group, its results are stored.
 template <class TrackCollectionType, class TrackCutType>
 void DoFillParticleCollection(TrackCutType *cut,
                               TrackCollectionType *track_collection,
-                              AliFemtoParticleCollection *output)
+                              AliFemtoParticleCollection *output,
+                              AliFemtoParticleCutCache *cache=NULL)
 {
   // lets's just name the iterator type
   typedef typename TrackCollectionType::iterator TrackCollectionIterType;
 
+  std::vector<char> *results_to_fill = NULL;
+  const std::vector<char> *results = cache ? cache->GetResults(cut, results_to_fill) : NULL;
+  if (results && results->size() != track_collection->size()) {
+    results = NULL;
+  }
+
+  size_t index = 0;
   for (TrackCollectionIterType pIter = track_collection->begin();
                                pIter != track_collection->end();
-                               pIter++) {
-    const Bool_t track_passes = cut->Pass(*pIter);
+                               pIter++, index++) {
+    const Bool_t track_passes = results ? (*results)[index] != 0 : cut->Pass(*pIter);
+    if (results_to_fill) {
+      results_to_fill->push_back(track_passes);
+    }
     cut->FillCutMonitor(*pIter, track_passes);
     if (track_passes) {
       output->push_back(new AliFemtoParticle(*pIter, cut->Mass()));
     }
   }
+
+  if (results_to_fill) {
+    cache->Publish(cut);
+  }
 }
 
 // This little function is used to apply ParticleCuts (TrackCuts or V0Cuts) and
@@ -70,10 +90,15 @@ void DoFillParticleCollection(TrackCutType *cut,
 //
 // The actual loop implementation has been moved to the collection-generic
 // DoFillParticleCollection() function
+//
+// The overload with an AliFemtoParticleCutCache shares the cut results
+// between analyses with equal particle cuts (not with the shared daughter
+// cut, which depends on the whole collection).
 void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
                                AliFemtoEvent *hbtEvent,
                                AliFemtoParticleCollection *partCollection,
-                               bool performSharedDaughterCut=kFALSE)
+                               bool performSharedDaughterCut,
+                               AliFemtoParticleCutCache *cache)
 {
   /// Fill particle collection with all particles in the event which pass
   /// the provided cut
@@ -87,7 +112,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
     DoFillParticleCollection(
       (AliFemtoTrackCut*)partCut,
       hbtEvent->TrackCollection(),
-      partCollection
+      partCollection,
+      cache
     );
 
     break;
@@ -109,7 +135,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
       DoFillParticleCollection(
         v0_cut,
         hbtEvent->V0Collection(),
-        partCollection
+        partCollection,
+        cache
       );
 
     }
@@ -136,7 +163,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
       DoFillParticleCollection(
         (AliFemtoXiTrackCut*)partCut,
         hbtEvent->XiCollection(),
-        partCollection
+        partCollection,
+        cache
       );
     }
     break;
@@ -148,7 +176,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
     DoFillParticleCollection(
       (AliFemtoKinkCut*)partCut,
       hbtEvent->KinkCollection(),
-      partCollection
+      partCollection,
+      cache
     );
 
     break;
@@ -160,6 +189,16 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
 
   partCut->FillCutMonitor(hbtEvent, partCollection);
 }
+
+void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
+                               AliFemtoEvent *hbtEvent,
+                               AliFemtoParticleCollection *partCollection,
+                               bool performSharedDaughterCut=kFALSE)
+{
+  /// Fill particle collection with all particles in the event which pass
+  /// the provided cut
+  FillHbtParticleCollection(partCut, hbtEvent, partCollection, performSharedDaughterCut, NULL);
+}
 //____________________________
 AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fPicoEventCollectionVectorHideAway(NULL),
@@ -175,7 +214,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fConcurrentExecution(kFALSE),
+  fParticleCutCache(NULL)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -197,7 +238,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fConcurrentExecution(a.fConcurrentExecution),
+  fParticleCutCache(NULL)
 {
   /// Copy constructor
 
@@ -393,6 +436,7 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fConcurrentExecution = aAna.fConcurrentExecution;
 
   return *this;
 }
@@ -484,14 +528,16 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   FillHbtParticleCollection(fFirstParticleCut,
                             (AliFemtoEvent*)hbtEvent,
                             fPicoEvent->FirstParticleCollection(),
-                            fPerformSharedDaughterCut);
+                            fPerformSharedDaughterCut,
+                            fPerformSharedDaughterCut ? NULL : fParticleCutCache);
 
   // fill second particle cut if not analyzing identical particles
   if ( !AnalyzeIdenticalParticles() ) {
       FillHbtParticleCollection(fSecondParticleCut,
                                 (AliFemtoEvent*)hbtEvent,
                                 fPicoEvent->SecondParticleCollection(),
-                                fPerformSharedDaughterCut);
+                                fPerformSharedDaughterCut,
+                                fPerformSharedDaughterCut ? NULL : fParticleCutCache);
   }
 
   const UInt_t coll_1_size = collection1->size(),
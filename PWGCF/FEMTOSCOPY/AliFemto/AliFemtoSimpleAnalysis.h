@@ -18,6 +18,7 @@
 
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
+class AliFemtoParticleCutCache;
 
 ///
 /// \class AliFemtoSimpleAnalysis
@@ -99,6 +100,18 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Allow AliFemtoManager::SetNumberOfThreads to process this analysis
+  /// concurrently with other analyses. Only switch on if the cuts and
+  /// correlation functions use no global state and share no object with
+  /// other analyses other than the ones the manager checks.
+  void SetConcurrentExecution(Bool_t aConcurrent);
+  Bool_t ConcurrentExecution() const;
+
+  /// Particle-cut results shared with other analyses (not owned), set by
+  /// AliFemtoManager::SetShareParticleCuts
+  void SetParticleCutCache(AliFemtoParticleCutCache *cache);
+  AliFemtoParticleCutCache* ParticleCutCache();
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -177,6 +190,9 @@ protected:
   Bool_t fVerbose;
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
+  Bool_t fConcurrentExecution;                       ///< May be processed concurrently with other analyses
+
+  AliFemtoParticleCutCache*    fParticleCutCache;    //!<! Particle-cut results shared between analyses (not owned)
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -242,6 +258,16 @@ inline bool AliFemtoSimpleAnalysis::EnablePairMonitors()
   return fEnablePairMonitors;
 }
 
+inline Bool_t AliFemtoSimpleAnalysis::ConcurrentExecution() const
+{
+  return fConcurrentExecution;
+}
+
+inline AliFemtoParticleCutCache* AliFemtoSimpleAnalysis::ParticleCutCache()
+{
+  return fParticleCutCache;
+}
+
 // Sets
 inline void AliFemtoSimpleAnalysis::SetPairCut(AliFemtoPairCut* x)
 {
@@ -305,4 +331,14 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetConcurrentExecution(Bool_t aConcurrent)
+{
+  fConcurrentExecution = aConcurrent;
+}
+
+inline void AliFemtoSimpleAnalysis::SetParticleCutCache(AliFemtoParticleCutCache *cache)
+{
+  fParticleCutCache = cache;
+}
+
 #endif
@@ -28,6 +28,15 @@ Detailed description
 #include <TVectorD.h>
 #include <TH1.h>
 #include <TAxis.h>
+#include <TProfile.h>
+#include <TProfile2D.h>
+#include <TProfile3D.h>
+#include <THnBase.h>
+#include <THashList.h>
+#include <TMath.h>
+#include <TVector2.h>
+#include <TRandom.h>
+#include <TDatabasePDG.h>
 
 #include <AliLog.h>
 #include <AliVTrack.h>
@@ -36,6 +45,10 @@ Detailed description
 #include "AliDielectronHelper.h"
 #include "AliDielectronHistos.h"
 #include "AliDielectronEvent.h"
+#include "AliDielectronPair.h"
+#include "AliDielectronHF.h"
+#include "AliDielectronVarCuts.h"
+#include "AliDielectronPairLegCuts.h"
 
 #include "AliDielectronMixingHandler.h"
 
@@ -50,7 +63,16 @@ AliDielectronMixingHandler::AliDielectronMixingHandler() :
   fMixIncomplete(kTRUE),
   fMoveToSameVertex(kFALSE),
   fSkipFirstEvt(kFALSE),
-  fPID(0x0)
+  fDensePools(kFALSE),
+  fMaxMixedPairs(0),
+  fPID(0x0),
+  fDenseInitialised(kFALSE),
+  fDense(),
+  fDenseCurrent(),
+  fDenseVarCuts(),
+  fDenseLegCuts(),
+  fDenseSamePdg(kTRUE),
+  fDensePair(0x0)
 {
   //
   // Default Constructor
@@ -71,7 +93,16 @@ AliDielectronMixingHandler::AliDielectronMixingHandler(const char* name, const c
   fMixIncomplete(kTRUE),
   fMoveToSameVertex(kFALSE),
   fSkipFirstEvt(kFALSE),
-  fPID(0x0)
+  fDensePools(kFALSE),
+  fMaxMixedPairs(0),
+  fPID(0x0),
+  fDenseInitialised(kFALSE),
+  fDense(),
+  fDenseCurrent(),
+  fDenseVarCuts(),
+  fDenseLegCuts(),
+  fDenseSamePdg(kTRUE),
+  fDensePair(0x0)
 {
   //
   // Named Constructor
@@ -90,6 +121,7 @@ AliDielectronMixingHandler::~AliDielectronMixingHandler()
   //
   fAxes.Delete();
   delete fPID;
+  delete fDensePair;
 }
 
 //________________________________________________________________
@@ -169,6 +201,19 @@ void AliDielectronMixingHandler::Fill(const AliVEvent *ev, AliDielectron *diele)
     return;
   }
 
+  // dense pools: mix the legs of the current event with the buffered ones, then buffer them
+  if (fDensePools && !fDenseInitialised) fDensePools=InitDensePools(diele);
+  if (fDensePools){
+    FillDenseEvent(fDenseCurrent,diele);
+    DensePool_t &densePool=fDense[bin];
+    DoDenseMixing(densePool,diele);
+    // the replaced event keeps its memory for the next one
+    densePool.fLast=(densePool.fLast+1)%fDepth;
+    if ((Int_t)densePool.fEvents.size()<=densePool.fLast) densePool.fEvents.resize(densePool.fLast+1);
+    std::swap(densePool.fEvents[densePool.fLast],fDenseCurrent);
+    return;
+  }
+
   // get mixing pool, create it if it does not yet exist.
   TClonesArray *poolp=static_cast<TClonesArray*>(fArrPools.At(bin));
 
@@ -275,10 +320,26 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
   TIter ev1N(&arrTrDummy[1]);
   
 
-  for (Int_t i1=0; i1<pool.GetEntriesFast(); ++i1){
-    const AliDielectronEvent *ev2=static_cast<AliDielectronEvent*>(pool.At(i1));
+  // with a pair budget, start from the most recent event in the ring buffer
+  const Int_t nPoolEvents=pool.GetEntriesFast();
+  const Int_t nP1=arrTrDummy[0].GetEntriesFast();
+  const Int_t nN1=arrTrDummy[1].GetEntriesFast();
+  Long64_t nMixedPairs=0;
+
+  for (Int_t i1=0; i1<nPoolEvents; ++i1){
+    const Int_t iev=(fMaxMixedPairs>0) ? ((Int_t)pool.GetUniqueID()-i1+nPoolEvents)%nPoolEvents : i1;
+    const AliDielectronEvent *ev2=static_cast<AliDielectronEvent*>(pool.At(iev));
     // don't mix with itself
     if (!ev2) continue;
+
+    if (fMaxMixedPairs>0){
+      // pair types as filled below: no ev1+ ev2- pairs with kOSandLS
+      Long64_t nPairs=(Long64_t)nN1*ev2->GetNTracksP();
+      if (fMixType!=kOSandLS) nPairs+=(Long64_t)nP1*ev2->GetNTracksN();
+      if (fMixType!=kOSonly) nPairs+=(Long64_t)nP1*ev2->GetNTracksP()+(Long64_t)nN1*ev2->GetNTracksN();
+      if (nMixedPairs>0 && nMixedPairs+nPairs>fMaxMixedPairs) break;
+      nMixedPairs+=nPairs;
+    }
     // if (!ev1 || !ev2 || ev1==ev2) continue;
     
     //clear arryas
@@ -357,6 +418,305 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
   AliDielectronVarManager::SetEventData(values);
 }
 
+//______________________________________________
+Bool_t AliDielectronMixingHandler::InitDensePools(const AliDielectron *diele)
+{
+  //
+  // check that the configuration can be handled by the dense pools and set them up
+  //
+  // Mixed pairs are built as AliDielectronPair from the KF particles of the buffered legs,
+  // as in AliDielectron::FillPairArrays, but without track references. Only the mixed event
+  // pair histogram classes of the histogram manager are filled, with the pair variables
+  // listed in kDenseVars and the event information. The histograms of these classes and
+  // the pair cuts (AliDielectronVarCuts, or AliDielectronPairLegCuts evaluated once per leg
+  // when the event is buffered) may only use these variables. Otherwise the standard mixing
+  // is used.
+  //
+  fDenseInitialised=kTRUE;
+  fDenseVarCuts.Clear();
+  fDenseLegCuts.Clear();
+
+  TString reason;
+  const THashList *histList=diele->GetHistogramList();
+  if (!histList) reason="no histogram manager";
+  else if (diele->fCfManagerPair) reason="pair CF manager";
+  else if (diele->fHistoArray && !diele->fHistoArray->IsEventArray()) reason="pair histogram array";
+  else if (fMoveToSameVertex) reason="tracks moved to the same vertex";
+  else if ((!diele->fPreFilterAllSigns1 && !diele->fPreFilterUnlikeOnly1 && !diele->fPreFilterLikeOnly1 && diele->fPairPreFilter1.GetCuts()->GetEntries()>0) ||
+           (!diele->fPreFilterAllSigns2 && !diele->fPreFilterUnlikeOnly2 && !diele->fPreFilterLikeOnly2 && diele->fPairPreFilter2.GetCuts()->GetEntries()>0))
+    reason="pair prefilter on the mixed pairs";
+
+  // pair variables filled by MixDenseLegs (event variables above kPairMax are always available)
+  const Int_t kDenseVars[]={AliDielectronVarManager::kPx, AliDielectronVarManager::kPy, AliDielectronVarManager::kPz,
+                            AliDielectronVarManager::kPt, AliDielectronVarManager::kPtSq, AliDielectronVarManager::kP,
+                            AliDielectronVarManager::kXv, AliDielectronVarManager::kYv, AliDielectronVarManager::kZv,
+                            AliDielectronVarManager::kOneOverPt, AliDielectronVarManager::kPhi, AliDielectronVarManager::kTheta,
+                            AliDielectronVarManager::kEta, AliDielectronVarManager::kY, AliDielectronVarManager::kE,
+                            AliDielectronVarManager::kM, AliDielectronVarManager::kCharge, AliDielectronVarManager::kRndm,
+                            AliDielectronVarManager::kChi2NDF, AliDielectronVarManager::kDecayLength, AliDielectronVarManager::kR,
+                            AliDielectronVarManager::kOpeningAngle, AliDielectronVarManager::kOpeningAngleXY,
+                            AliDielectronVarManager::kOpeningAngleRZ, AliDielectronVarManager::kLegDist,
+                            AliDielectronVarManager::kLegDistXY, AliDielectronVarManager::kDeltaEta,
+                            AliDielectronVarManager::kDeltaPhi, AliDielectronVarManager::kMerr, AliDielectronVarManager::kPairType};
+  const Int_t nDenseVars=sizeof(kDenseVars)/sizeof(kDenseVars[0]);
+  Bool_t denseVar[AliDielectronVarManager::kNMaxValues]={kFALSE};
+  for (Int_t ivar=0; ivar<nDenseVars; ++ivar) denseVar[kDenseVars[ivar]]=kTRUE;
+  for (Int_t ivar=AliDielectronVarManager::kPairMax; ivar<AliDielectronVarManager::kNMaxValues; ++ivar) denseVar[ivar]=kTRUE;
+
+  TIter nextCut(diele->fPairFilter.GetCuts());
+  TObject *cut=0x0;
+  while (reason.IsNull() && (cut=nextCut())){
+    if (cut->IsA()==AliDielectronPairLegCuts::Class()){
+      if (fDenseLegCuts.GetEntriesFast()>=16) reason="too many pair leg cuts";
+      fDenseLegCuts.Add(cut);
+      continue;
+    }
+    AliDielectronVarCuts *varCuts=dynamic_cast<AliDielectronVarCuts*>(cut);
+    if (!varCuts || varCuts->GetCutOnMCtruth()){
+      reason=Form("pair cut '%s'",cut->GetName());
+      break;
+    }
+    for (Int_t icut=0; icut<varCuts->GetNCuts(); ++icut){
+      Bool_t known=kFALSE;
+      for (Int_t ivar=0; ivar<AliDielectronVarManager::kNMaxValues && !known; ++ivar)
+        known=denseVar[ivar] && varCuts->IsCutOnVariableX(icut,ivar);
+      if (!known) reason=Form("pair cut '%s' (%s)",cut->GetName(),varCuts->GetCutName(icut));
+    }
+    fDenseVarCuts.Add(varCuts);
+  }
+
+  // legs of mixed pairs are not available, the pair histograms may only use the dense variables
+  for (Int_t i=0; i<11 && histList && reason.IsNull(); ++i){
+    fDensePairClass[i]="";
+    if (i<AliDielectron::kEv1PEv2P || i>AliDielectron::kEv1MEv2M) continue;
+    if (histList->FindObject(Form("Track_Legs_%s",AliDielectron::PairClassName(i)))) reason="mixed pair leg histograms";
+    const THashList *classTable=static_cast<const THashList*>(histList->FindObject(Form("Pair_%s",AliDielectron::PairClassName(i))));
+    if (!classTable) continue;
+    fDensePairClass[i]=classTable->GetName();
+
+    TIter nextHist(classTable);
+    TObject *obj=0x0;
+    while (reason.IsNull() && (obj=nextHist())){
+      UInt_t vars[20]={0};
+      Int_t nVars=0;
+      const UInt_t valueTypes=obj->GetUniqueID();
+      if (valueTypes==(UInt_t)AliDielectronHistos::kNoAutoFill) continue;
+      if (valueTypes!=(UInt_t)AliDielectronHistos::kNoWeights) vars[nVars++]=valueTypes; // weight or profile variable
+      if (obj->InheritsFrom(TH1::Class())){
+        const TH1 *hist=static_cast<const TH1*>(obj);
+        const Bool_t profile=obj->InheritsFrom(TProfile::Class()) || obj->InheritsFrom(TProfile2D::Class()) || obj->InheritsFrom(TProfile3D::Class());
+        const Int_t dim=hist->GetDimension()+(profile ? 1 : 0);
+        vars[nVars++]=hist->GetXaxis()->GetUniqueID();
+        if (dim>1) vars[nVars++]=hist->GetYaxis()->GetUniqueID();
+        if (dim>2) vars[nVars++]=hist->GetZaxis()->GetUniqueID();
+      } else if (obj->InheritsFrom(THnBase::Class())){
+        const THnBase *hist=static_cast<const THnBase*>(obj);
+        for (Int_t iaxis=0; iaxis<hist->GetNdimensions() && nVars<20; ++iaxis) vars[nVars++]=hist->GetAxis(iaxis)->GetUniqueID();
+      }
+      for (Int_t ivar=0; ivar<nVars && reason.IsNull(); ++ivar){
+        if (vars[ivar]<(UInt_t)AliDielectronVarManager::kNMaxValues && !denseVar[vars[ivar]])
+          reason=Form("histogram '%s' of %s (%s)",obj->GetName(),classTable->GetName(),AliDielectronVarManager::GetValueName(vars[ivar]));
+      }
+    }
+  }
+
+  if (reason.IsNull() && (!TDatabasePDG::Instance()->GetParticle(diele->fPdgLeg1) || !TDatabasePDG::Instance()->GetParticle(diele->fPdgLeg2)))
+    reason="unknown leg pdg code";
+
+  if (!reason.IsNull()){
+    AliWarning(Form("Dense pools not possible (%s), using the standard mixing",reason.Data()));
+    fDenseVarCuts.Clear();
+    fDenseLegCuts.Clear();
+    return kFALSE;
+  }
+
+  fDenseSamePdg=(diele->fPdgLeg1==diele->fPdgLeg2);
+  if (!fDensePair) fDensePair=new AliDielectronPair;
+  fDense.resize(GetNumberOfBins());
+  for (UInt_t ibin=0; ibin<fDense.size(); ++ibin) fDense[ibin].fLast=-1;
+  AliInfo(Form("Using dense pools: %d pair variable cuts, %d pair leg cuts",fDenseVarCuts.GetEntriesFast(),fDenseLegCuts.GetEntriesFast()));
+  return kTRUE;
+}
+
+//______________________________________________
+void AliDielectronMixingHandler::FillDenseEvent(DenseEvent_t &event, const AliDielectron *diele) const
+{
+  //
+  // copy the legs of the current event as KF particles, evaluate the leg cuts
+  //
+  const TObjArray &arrP=diele->fTracks[0];
+  const TObjArray &arrN=diele->fTracks[1];
+  const Int_t nP=arrP.GetEntriesFast();
+  const Int_t nLegs=nP+arrN.GetEntriesFast();
+  const Int_t nLegCuts=fDenseLegCuts.GetEntriesFast();
+
+  event.fNLegsP=nP;
+  event.fLegs[0].clear();
+  event.fLegs[1].clear();
+  event.fCutBits.resize(nLegs);
+
+  for (Int_t ileg=0; ileg<nLegs; ++ileg){
+    AliVTrack *track=static_cast<AliVTrack*>(ileg<nP ? arrP.UncheckedAt(ileg) : arrN.UncheckedAt(ileg-nP));
+    event.fLegs[0].push_back(AliKFParticle(*track,diele->fPdgLeg1));
+    if (!fDenseSamePdg) event.fLegs[1].push_back(AliKFParticle(*track,diele->fPdgLeg2));
+
+    UInt_t bits=0;
+    for (Int_t icut=0; icut<nLegCuts; ++icut){
+      AliDielectronPairLegCuts *legCuts=static_cast<AliDielectronPairLegCuts*>(fDenseLegCuts.UncheckedAt(icut));
+      AliAnalysisFilter &filterLeg1=legCuts->GetLeg1Filter();
+      AliAnalysisFilter &filterLeg2=legCuts->GetLeg2Filter();
+      UInt_t selectedMaskLeg1=(1<<filterLeg1.GetCuts()->GetEntries())-1;
+      UInt_t selectedMaskLeg2=(1<<filterLeg2.GetCuts()->GetEntries())-1;
+      if (filterLeg1.IsSelected(track)==selectedMaskLeg1) bits|=1<<(2*icut);
+      if (filterLeg2.IsSelected(track)==selectedMaskLeg2) bits|=1<<(2*icut+1);
+    }
+    event.fCutBits[ileg]=bits;
+  }
+}
+
+//______________________________________________
+void AliDielectronMixingHandler::DoDenseMixing(const DensePool_t &pool, AliDielectron *diele)
+{
+  //
+  // mix the legs of the current event with the buffered events (most recent first)
+  // with the same pair types as DoMixing: ev1- ev2+ for all mixing types, ev1+ ev2+ and
+  // ev1- ev2- for kOSandLS and kAll, ev1+ ev2- in its own class for kAll and in the class
+  // of ev1- ev2+ for kOSonly (with kOSandLS DoMixing does not produce ev1+ ev2- pairs)
+  //
+  if (pool.fLast<0) return;
+
+  // event information of the current event (all events are in the same mixing bin)
+  Double_t values[AliDielectronVarManager::kNMaxValues]={0};
+  const Double_t *data=AliDielectronVarManager::GetData();
+  for (Int_t i=AliDielectronVarManager::kPairMax; i<AliDielectronVarManager::kNMaxValues; ++i)
+    values[i]=data[i];
+
+  const DenseEvent_t &ev1=fDenseCurrent;
+  const Int_t nLegs1=ev1.fCutBits.size();
+  const Int_t nP1=ev1.fNLegsP;
+  const Int_t nN1=nLegs1-nP1;
+  const Int_t nEvents=pool.fEvents.size();
+  Long64_t nMixedPairs=0;
+
+  for (Int_t i1=0; i1<nEvents; ++i1){
+    const DenseEvent_t &ev2=pool.fEvents[(pool.fLast-i1+nEvents)%nEvents];
+    const Int_t nLegs2=ev2.fCutBits.size();
+    const Int_t nP2=ev2.fNLegsP;
+    const Int_t nN2=nLegs2-nP2;
+
+    if (fMaxMixedPairs>0){
+      Long64_t nPairs=(Long64_t)nN1*nP2;
+      if (fMixType!=kOSandLS) nPairs+=(Long64_t)nP1*nN2;
+      if (fMixType!=kOSonly) nPairs+=(Long64_t)nP1*nP2+(Long64_t)nN1*nN2;
+      if (nMixedPairs>0 && nMixedPairs+nPairs>fMaxMixedPairs) break;
+      nMixedPairs+=nPairs;
+    }
+
+    //mixing of ev1- ev2+ (pair type4). This is common for all mixing types
+    MixDenseLegs(ev1,nP1,nLegs1, ev2,0,nP2, AliDielectron::kEv1MEv2P, diele, values);
+
+    if (fMixType==kAll || fMixType==kOSandLS){
+      MixDenseLegs(ev1,0,nP1, ev2,0,nP2, AliDielectron::kEv1PEv2P, diele, values);
+      MixDenseLegs(ev1,nP1,nLegs1, ev2,nP2,nLegs2, AliDielectron::kEv1MEv2M, diele, values);
+    }
+
+    if (fMixType==kAll)
+      MixDenseLegs(ev1,0,nP1, ev2,nP2,nLegs2, AliDielectron::kEv1PEv2M, diele, values);
+    else if (fMixType==kOSonly)
+      MixDenseLegs(ev1,0,nP1, ev2,nP2,nLegs2, AliDielectron::kEv1MEv2P, diele, values);
+  }
+}
+
+//______________________________________________
+Int_t AliDielectronMixingHandler::MixDenseLegs(const DenseEvent_t &ev1, Int_t first1, Int_t last1,
+                                               const DenseEvent_t &ev2, Int_t first2, Int_t last2,
+                                               Int_t pairIndex, AliDielectron *diele, Double_t * const values)
+{
+  //
+  // build the pairs of legs [first1,last1) of ev1 (as leg 1) and [first2,last2) of ev2 (as leg 2),
+  // apply the pair cuts and fill the pair histograms
+  // returns the number of accepted pairs
+  //
+  const TString &histClass=fDensePairClass[pairIndex];
+  if (histClass.IsNull()) return 0;
+
+  const Int_t nVarCuts=fDenseVarCuts.GetEntriesFast();
+  const Int_t nLegCuts=fDenseLegCuts.GetEntriesFast();
+  const std::vector<AliKFParticle> &legs1=ev1.fLegs[0];
+  const std::vector<AliKFParticle> &legs2=fDenseSamePdg ? ev2.fLegs[0] : ev2.fLegs[1];
+  AliDielectronPair *pair=fDensePair;
+  pair->SetKFUsage(diele->fUseKF);
+
+  Int_t nAccepted=0;
+  for (Int_t i1=first1; i1<last1; ++i1){
+    const AliKFParticle &kf1=legs1[i1];
+    for (Int_t i2=first2; i2<last2; ++i2){
+      const AliKFParticle &kf2=legs2[i2];
+      pair->SetTracks(&kf1,&kf2,0x0,0x0);
+      pair->SetType(pairIndex);
+      const AliKFParticle &kfPair=pair->GetKFParticle();
+
+      // as in AliDielectronVarManager::FillVarVParticle and FillVarDielectronPair
+      values[AliDielectronVarManager::kPx]        = pair->Px();
+      values[AliDielectronVarManager::kPy]        = pair->Py();
+      values[AliDielectronVarManager::kPz]        = pair->Pz();
+      values[AliDielectronVarManager::kPt]        = pair->Pt();
+      values[AliDielectronVarManager::kPtSq]      = pair->Pt()*pair->Pt();
+      values[AliDielectronVarManager::kP]         = pair->P();
+      values[AliDielectronVarManager::kXv]        = pair->Xv();
+      values[AliDielectronVarManager::kYv]        = pair->Yv();
+      values[AliDielectronVarManager::kZv]        = pair->Zv();
+      values[AliDielectronVarManager::kOneOverPt] = (pair->Pt()>1.0e-3 ? pair->OneOverPt() : 0.0);
+      values[AliDielectronVarManager::kPhi]       = TVector2::Phi_0_2pi(pair->Phi());
+      values[AliDielectronVarManager::kTheta]     = pair->Theta();
+      values[AliDielectronVarManager::kEta]       = pair->Eta();
+      values[AliDielectronVarManager::kY]         = pair->Y();
+      values[AliDielectronVarManager::kE]         = pair->E();
+      values[AliDielectronVarManager::kM]         = pair->M();
+      values[AliDielectronVarManager::kCharge]    = pair->Charge();
+      values[AliDielectronVarManager::kRndm]      = gRandom->Rndm();
+      values[AliDielectronVarManager::kChi2NDF]   = kfPair.GetChi2()/kfPair.GetNDF();
+      values[AliDielectronVarManager::kDecayLength]    = kfPair.GetDecayLength();
+      values[AliDielectronVarManager::kR]              = kfPair.GetR();
+      values[AliDielectronVarManager::kOpeningAngle]   = pair->OpeningAngle();
+      values[AliDielectronVarManager::kOpeningAngleXY] = pair->OpeningAngleXY();
+      values[AliDielectronVarManager::kOpeningAngleRZ] = pair->OpeningAngleRZ();
+      values[AliDielectronVarManager::kLegDist]   = pair->DistanceDaughters();
+      values[AliDielectronVarManager::kLegDistXY] = pair->DistanceDaughtersXY();
+      values[AliDielectronVarManager::kDeltaEta]  = pair->DeltaEta();
+      values[AliDielectronVarManager::kDeltaPhi]  = pair->DeltaPhi();
+      values[AliDielectronVarManager::kMerr]      = kfPair.GetErrMass()>1e-30&&kfPair.GetMass()>1e-30?kfPair.GetErrMass()/kfPair.GetMass():1000000;
+      values[AliDielectronVarManager::kPairType]  = pair->GetType();
+
+      //pair cuts
+      Bool_t selected=kTRUE;
+      for (Int_t icut=0; icut<nVarCuts && selected; ++icut)
+        selected=static_cast<AliDielectronVarCuts*>(fDenseVarCuts.UncheckedAt(icut))->IsSelected(values);
+      if (selected && nLegCuts>0){
+        // leg cut decisions of the first and second daughter as chosen by AliDielectronPair::SetTracks
+        const AliKFParticle &d1=pair->GetKFFirstDaughter();
+        const Bool_t firstIsLeg1=(d1.GetPx()==kf1.GetPx() && d1.GetPy()==kf1.GetPy() && d1.GetPz()==kf1.GetPz());
+        const UInt_t bitsD1=firstIsLeg1 ? ev1.fCutBits[i1] : ev2.fCutBits[i2];
+        const UInt_t bitsD2=firstIsLeg1 ? ev2.fCutBits[i2] : ev1.fCutBits[i1];
+        for (Int_t icut=0; icut<nLegCuts && selected; ++icut){
+          const Bool_t d1Leg1=TESTBIT(bitsD1,2*icut),   d2Leg2=TESTBIT(bitsD2,2*icut+1);
+          const Bool_t d2Leg1=TESTBIT(bitsD2,2*icut),   d1Leg2=TESTBIT(bitsD1,2*icut+1);
+          switch (static_cast<AliDielectronPairLegCuts*>(fDenseLegCuts.UncheckedAt(icut))->GetCutType()){
+          case AliDielectronPairLegCuts::kAnyLeg:  selected=d1Leg1||d2Leg2; break;
+          case AliDielectronPairLegCuts::kMixLegs: selected=(d1Leg1&&d2Leg2)||(d2Leg1&&d1Leg2); break;
+          default:                                 selected=d1Leg1&&d2Leg2; break;
+          }
+        }
+      }
+      if (!selected) continue;
+
+      diele->fHistos->FillClass(histClass.Data(), AliDielectronVarManager::kNMaxValues, values);
+      ++nAccepted;
+    }
+  }
+  return nAccepted;
+}
+
 //______________________________________________
 Bool_t AliDielectronMixingHandler::MixRemaining(AliDielectron */*diele*/, Int_t /*ipool*/)
 {
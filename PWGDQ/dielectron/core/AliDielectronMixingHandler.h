@@ -13,13 +13,17 @@
 //#                                                           #
 //#############################################################
 
+#include <vector>
 #include <TNamed.h>
 #include <TObjArray.h>
 #include <TClonesArray.h>
 
+#include <AliKFParticle.h>
+
 #include "AliDielectronVarManager.h"
 
 class AliDielectron;
+class AliDielectronPair;
 class AliVTrack;
 class AliVEvent;
 
@@ -55,6 +59,16 @@ public:
 
   void SetSkipFirstEvent(Bool_t skip) { fSkipFirstEvt=skip; }
 
+  // dense pools: legs are buffered as KF particles + leg cut bits and mixed without
+  // the pair arrays (only pair histograms are filled, see InitDensePools)
+  void SetDensePools(Bool_t dense=kTRUE) { fDensePools=dense; }
+  Bool_t GetDensePools() const { return fDensePools; }
+
+  // maximum number of mixed pairs per event (0: no limit), pool events are mixed
+  // starting from the most recent one until the next would exceed the budget
+  void SetMaxMixedPairs(Int_t max) { fMaxMixedPairs=max; }
+  Int_t GetMaxMixedPairs() const { return fMaxMixedPairs; }
+
   Int_t GetNumberOfBins() const;
   Int_t FindBin(const Double_t values[], TString *dim=0x0);
   void Fill(const AliVEvent *ev, AliDielectron *diele);
@@ -77,15 +91,45 @@ private:
   Bool_t fMoveToSameVertex; //whether to move the mixed tracks to the same vertex position
   Bool_t fSkipFirstEvt;   //whether to skip the first event in the pool
 
+  Bool_t fDensePools;     // buffer legs as flat arrays and mix them directly
+  Int_t  fMaxMixedPairs;  // maximum number of mixed pairs per event (0: no limit)
+
   TProcessID *fPID;             //! internal PID for references to buffered objects
+
+  // legs of a buffered event (dense pools), positive legs first
+  struct DenseEvent_t {
+    Int_t fNLegsP;                       // number of positive legs
+    std::vector<AliKFParticle> fLegs[2]; // legs with the pdg code of leg 1 and leg 2 (second empty if the same)
+    std::vector<UInt_t> fCutBits;        // leg decisions of the pair leg cuts (2 bits per cut)
+  };
+  struct DensePool_t {
+    std::vector<DenseEvent_t> fEvents; // ring buffer of up to fDepth events
+    Int_t fLast;                       // position of the last buffered event
+  };
+
+  Bool_t fDenseInitialised;           //! dense pool configuration checked
+  std::vector<DensePool_t> fDense;    //! dense pools per mixing bin
+  DenseEvent_t fDenseCurrent;         //! legs of the current event
+  TObjArray fDenseVarCuts;            //! pair variable cuts (not owned)
+  TObjArray fDenseLegCuts;            //! pair leg cuts (not owned)
+  Bool_t fDenseSamePdg;               //! leg 1 and leg 2 have the same pdg code
+  AliDielectronPair *fDensePair;      //! pair used to build the mixed pairs
+  TString fDensePairClass[11];        //! pair histogram classes, empty if not defined
   
   void DoMixing(TClonesArray &pool, AliDielectron *diele);
 
+  Bool_t InitDensePools(const AliDielectron *diele);
+  void FillDenseEvent(DenseEvent_t &event, const AliDielectron *diele) const;
+  void DoDenseMixing(const DensePool_t &pool, AliDielectron *diele);
+  Int_t MixDenseLegs(const DenseEvent_t &ev1, Int_t first1, Int_t last1,
+                     const DenseEvent_t &ev2, Int_t first2, Int_t last2,
+                     Int_t pairIndex, AliDielectron *diele, Double_t * const values);
+
   AliDielectronMixingHandler(const AliDielectronMixingHandler &c);
   AliDielectronMixingHandler &operator=(const AliDielectronMixingHandler &c);
 
   
-  ClassDef(AliDielectronMixingHandler,1)         // Dielectron MixingHandler
+  ClassDef(AliDielectronMixingHandler,2)         // Dielectron MixingHandler
 };
 
 
@@ -45,6 +45,7 @@ public:
   AliAnalysisFilter& GetLeg2Filter() { return fFilterLeg2; }
 
   void SetCutType(CutType type) {fCutType=type;}
+  CutType GetCutType() const { return fCutType; }
 private:
   AliAnalysisFilter fFilterLeg1;     // Analysis Filter for leg1
   AliAnalysisFilter fFilterLeg2;     // Analysis Filter for leg2
@@ -49,6 +49,9 @@ public:
     
   void         InitdEdXParameters();
   
+  /// Energy and shower shape of the clusters recalculated in WeightHistograms() and ClusterShapeHistograms().
+  TString      GetModifiedSharedResources() const { return "CaloUtils ReaderClusters" ; }
+  
   void         MakeAnalysisFillHistograms() ;
   
   void         Print(const Option_t * opt) const;
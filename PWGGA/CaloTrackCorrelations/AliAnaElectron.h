@@ -54,6 +54,9 @@ class AliAnaElectron : public AliAnaCaloTrackCorrBaseClass {
 
   void         MakeAnalysisFillAOD()  ;
 
+  /// Shower shape of the clusters recalculated in FillShowerShapeHistograms() and WeightHistograms().
+  TString      GetModifiedSharedResources() const { return "CaloUtils ReaderClusters" ; }
+
   void         MakeAnalysisFillHistograms() ; 
   
   void         Print(const Option_t * opt)const;
@@ -123,6 +123,9 @@ class AliAnaInsideClusterInvariantMass : public AliAnaCaloTrackCorrBaseClass {
   
   void         InitParameters();
   
+  /// Local maxima cuts changed in FillNLMDiffCutHistograms(), shower shape of the clusters recalculated.
+  TString      GetModifiedSharedResources() const { return "CaloUtils ReaderClusters" ; }
+  
   void         MakeAnalysisFillHistograms() ;
   
   void         Print(const Option_t * opt) const;
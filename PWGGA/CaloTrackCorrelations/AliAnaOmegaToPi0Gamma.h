@@ -45,6 +45,8 @@ class AliAnaOmegaToPi0Gamma : public AliAnaCaloTrackCorrBaseClass {
     
   void     Terminate(TList * outList);
 
+  TString  GetAODBranchDependencies()      const  { return AliAnaCaloTrackCorrBaseClass::GetAODBranchDependencies() + fInputAODGammaName + " " ; }
+
   TString  GetInputAODPhotonName()  const         { return fInputAODGammaName   ; }
     
   void     SetInputAODPhotonName(TString & name)  { fInputAODGammaName   = name ; }
@@ -1147,6 +1147,22 @@ void AliAnaParticleHadronCorrelation::FillNeutralUnderlyingEventSidesHistograms(
   }
 }
 
+//______________________________________________________
+/// Shared resources of the analysis: the AOD branches of the base class,
+/// the pi0 AOD branch if neutral correlation is done, and the mixing pools
+/// of the reader if they are used for the own mixing.
+//______________________________________________________
+TString AliAnaParticleHadronCorrelation::GetAODBranchDependencies() const
+{
+  TString names = AliAnaCaloTrackCorrBaseClass::GetAODBranchDependencies();
+  
+  if ( fNeutralCorr && fPi0AODBranchName != "" ) names += fPi0AODBranchName + " ";
+  
+  if ( DoOwnMix() && fUseMixStoredInReader ) names += "ReaderMixedEventPools ";
+  
+  return names;
+}
+
 //______________________________________________________
 /// Fill the pool with tracks or clusters if requested.
 //______________________________________________________
@@ -44,6 +44,11 @@ public:
   
   void         FillEventMixPool() ;
   
+  TString      GetAODBranchDependencies()  const ;
+  
+  /// Random phi of the underlying event histograms.
+  TString      GetModifiedSharedResources() const { return "gRandom" ; }
+  
   void         MakeAnalysisFillHistograms() ;
   
   void         Print(const Option_t * opt) const;
@@ -26,6 +26,7 @@
 // --- Analysis system ---
 #include "AliAnaParticleIsolation.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiIndex.h"
 #include "AliMCEvent.h"
 #include "AliIsolationCut.h"
 #include "AliFiducialCut.h"
@@ -80,7 +81,7 @@ fNCellsWithWeight(0),             fTrigSupMod(-1),
 fStudyExoticTrigger(0),           fNExoCutInCandidate(0),                   fExoCutInCandidate(),
 fMomentum(),                      fMomIso(),
 fMomDaugh1(),                     fMomDaugh2(),
-fTrackVector(),                   fProdVertex(),
+fTrackVector(),                   fProdVertex(),                            fUEBandEntries(),
 fCluster(0),                      fClustersArr(0),                          fCaloCells(0),                
 fIsExoticTrigger(0),              fClusterExoticity(1),
 // Histograms
@@ -468,8 +469,19 @@ void AliAnaParticleIsolation::CalculateCaloUEBand(AliAODPWG4ParticleCorrelation
   Float_t phiTrig   = pCandidate->Phi();
   Float_t etaTrig   = pCandidate->Eta();
   
-  for(Int_t icluster=0; icluster < pl->GetEntriesFast(); icluster++)
+  // Loop only on the clusters in the eta and phi bands if the reader provides an
+  // eta-phi cell index, unless all clusters are needed for the eta-phi histograms.
+  // The index is built with the same vertex as the cluster momentum below.
+  AliCaloTrackEtaPhiIndex * index = 0x0;
+  if(fFillUEBandSubtractHistograms <= 1) index = GetReader()->GetEtaPhiCellIndex(pl, vertex);
+  if(index) index->GetEntriesInRegion(etaTrig, phiTrig, conesize, conesize, kTRUE, fUEBandEntries);
+  
+  Int_t nentries = index ? (Int_t) fUEBandEntries.size() : pl->GetEntriesFast();
+  
+  for(Int_t ient=0; ient < nentries; ient++)
   {
+    Int_t icluster = index ? fUEBandEntries[ient] : ient;
+    
     AliVCluster* cluster = (AliVCluster *) pl->At(icluster);
     
     if ( !cluster )
@@ -724,8 +736,20 @@ void AliAnaParticleIsolation::CalculateTrackUEBand(AliAODPWG4ParticleCorrelation
   Double_t bz = GetReader()->GetInputEvent()->GetMagneticField();
   
   TObjArray * trackList   = GetCTSTracks() ;
-  for(Int_t itrack=0; itrack < trackList->GetEntriesFast(); itrack++)
+  
+  // Loop only on the tracks in the eta and phi bands, which contain the perpendicular
+  // cones, if the reader provides an eta-phi cell index, unless all tracks are needed
+  // for the eta-phi histograms
+  AliCaloTrackEtaPhiIndex * index = 0x0;
+  if(fFillUEBandSubtractHistograms <= 1) index = GetReader()->GetEtaPhiCellIndex(trackList);
+  if(index) index->GetEntriesInRegion(etaTrig, phiTrig, conesize, conesize, kTRUE, fUEBandEntries);
+  
+  Int_t nentries = index ? (Int_t) fUEBandEntries.size() : trackList->GetEntriesFast();
+  
+  for(Int_t ient=0; ient < nentries; ient++)
   {
+    Int_t itrack = index ? fUEBandEntries[ient] : ient;
+    
     AliVTrack* track = (AliVTrack *) trackList->At(itrack);
     
     if(!track)
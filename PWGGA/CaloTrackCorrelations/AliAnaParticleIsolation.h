@@ -28,6 +28,9 @@ class TH3F;
 class TList ;
 class TObjString;
 
+// --- C++ ---
+#include <vector>
+
 // --- ANALYSIS system ---
 #include "AliAnaCaloTrackCorrBaseClass.h"
 class AliAODPWG4Particle;
@@ -309,6 +312,7 @@ class AliAnaParticleIsolation : public AliAnaCaloTrackCorrBaseClass {
   TLorentzVector fMomDaugh2;                          //!<! Temporary vector, avoid creation per event.
   TVector3       fTrackVector;                        //!<! Temporary vector, avoid creation per event.
   TVector3       fProdVertex;                         //!<! Temporary vector, avoid creation per event.
+  std::vector<Int_t> fUEBandEntries;                  //!<! Entries of the track/cluster array in the UE bands, from the reader eta-phi cell index.
  
   AliVCluster*   fCluster;                            //!<! Temporary vcluster, avoid creation per event.
   TObjArray  *   fClustersArr;                        //!<! Temporary ClustersArray, avoid creation per event.
@@ -877,7 +881,7 @@ class AliAnaParticleIsolation : public AliAnaCaloTrackCorrBaseClass {
   AliAnaParticleIsolation & operator = (const AliAnaParticleIsolation & iso) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaParticleIsolation,40) ;
+  ClassDef(AliAnaParticleIsolation,41) ;
   /// \endcond
 
 } ;
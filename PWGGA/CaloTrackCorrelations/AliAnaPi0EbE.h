@@ -48,6 +48,9 @@ public:
   
   void           MakeAnalysisFillAOD()  ;
   
+  /// Shower shape of the clusters recalculated for different W0 in FillWeightHistograms().
+  TString        GetModifiedSharedResources() const { return fFillWeightHistograms ? "CaloUtils ReaderClusters" : "" ; }
+  
   void           MakeAnalysisFillHistograms() ;
   
   void           Print(const Option_t * opt) const;
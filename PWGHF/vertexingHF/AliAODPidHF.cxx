@@ -33,6 +33,7 @@
 #include "AliPIDResponse.h"
 #include "AliAODpidUtil.h"
 #include "AliESDtrack.h"
+#include "AliRDHFCandidateCache.h"
 
 /// \cond CLASSIMP
 ClassImp(AliAODPidHF);
@@ -81,7 +82,8 @@ fTPCResponse(new AliTPCPIDResponse()),
 fPriorsH(),
 fCombDetectors(kTPCTOF),
 fUseCombined(kFALSE),
-fDefaultPriors(kTRUE)
+fDefaultPriors(kTRUE),
+fUseCandidateCache(kFALSE)
 {
   ///
   /// Default constructor
@@ -186,7 +188,8 @@ fPidCombined(0x0),
 fTPCResponse(0x0),
 fCombDetectors(pid.fCombDetectors),
 fUseCombined(pid.fUseCombined),
-fDefaultPriors(pid.fDefaultPriors)
+fDefaultPriors(pid.fDefaultPriors),
+fUseCandidateCache(pid.fUseCandidateCache)
 {
   
   fnSigmaCompat=new Double_t[fnNSigmaCompat];
@@ -907,7 +910,8 @@ Int_t AliAODPidHF::GetnSigmaTPC(AliAODTrack *track, Int_t species, Double_t &nsi
   } else{
     if(!fPidResponse) return -1;
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
+    if(fUseCandidateCache) nsigmaTPC = AliRDHFCandidateCache::Instance()->GetNSigma(fPidResponse,track,AliRDHFCandidateCache::kTPC,species);
+    else nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
     nsigma=nsigmaTPC;
   }
   return 1;
@@ -921,7 +925,8 @@ Int_t AliAODPidHF::GetnSigmaTOF(AliAODTrack *track,Int_t species, Double_t &nsig
   if(!CheckTOFPIDStatus(track)) return -1;
   
   if(fPidResponse){
-    nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    if(fUseCandidateCache) nsigma = AliRDHFCandidateCache::Instance()->GetNSigma(fPidResponse,track,AliRDHFCandidateCache::kTOF,species);
+    else nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
     return 1;
   }else{
     AliFatal("To use TOF PID you need to attach AliPIDResponseTask");
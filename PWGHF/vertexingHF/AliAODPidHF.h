@@ -199,6 +199,9 @@ public:
   void SetUpCombinedPID();
   void SetUseCombined(Bool_t useCombined=kTRUE) {fUseCombined=useCombined;}
   void SetUseDefaultPriors(Bool_t defaultP)	    {fDefaultPriors=defaultP;}
+  /// take TPC and TOF n-sigmas from the per-event AliRDHFCandidateCache
+  void SetUseCandidateCache(Bool_t useCache=kTRUE) {fUseCandidateCache=useCache;}
+  Bool_t GetUseCandidateCache() const {return fUseCandidateCache;}
   Int_t ApplyPidTPCRaw(AliAODTrack *track,Int_t specie) const;
   Int_t ApplyPidTOFRaw(AliAODTrack *track,Int_t specie) const;
   Int_t ApplyPidITSRaw(AliAODTrack *track,Int_t specie) const;
@@ -283,6 +286,7 @@ private:
   ECombDetectors fCombDetectors; /// detectors to be involved for combined PID
   Bool_t fUseCombined; /// detectors to be involved for combined PID
   Bool_t fDefaultPriors; /// use default priors for combined PID
+  Bool_t fUseCandidateCache; /// n-sigmas from the shared per-event cache
 
   /// Storage of identification/compatibility band for different species and detectors:
   TF1 *fIdBandMin[AliPID::kSPECIES][4];
@@ -291,7 +295,7 @@ private:
   TF1 *fCompBandMax[AliPID::kSPECIES][4];
 
   /// \cond CLASSIMP
-  ClassDef(AliAODPidHF,24); /// AliAODPid for heavy flavor PID
+  ClassDef(AliAODPidHF,25); /// AliAODPid for heavy flavor PID
   /// \endcond
 
 };
@@ -51,6 +51,7 @@
 #include "AliAODRecoDecayHF2Prong.h"
 #include "AliAODRecoCascadeHF.h"
 #include "AliAnalysisVertexingHF.h"
+#include "AliRDHFCandidateCache.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisTaskSED0Mass.h"
 #include "AliNormalizationCounter.h"
@@ -1247,7 +1248,7 @@ void AliAnalysisTaskSED0Mass::UserExec(Option_t */*option*/)
       }
     if(d->GetIsFilled()==0)fNentries->Fill(19);//tmp check
     if(d->GetIsFilled()==1)fNentries->Fill(20);//tmp check
-    if(!(vHF->FillRecoCand(aod,d))) {//Fill the data members of the candidate only if they are empty.   
+    if(!(fCuts->GetUseCandidateCache() ? AliRDHFCandidateCache::Instance()->FillRecoCand(aod,d) : vHF->FillRecoCand(aod,d))) {//Fill the data members of the candidate only if they are empty.   
       fNentries->Fill(18); //monitor how often this fails 
       continue;
     }
@@ -39,6 +39,7 @@
 #include "AliAODTrack.h"
 #include "AliAODRecoDecayHF3Prong.h"
 #include "AliAnalysisVertexingHF.h"
+#include "AliRDHFCandidateCache.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisTaskSEDplus.h"
 #include "AliNormalizationCounter.h"
@@ -990,7 +991,7 @@ void AliAnalysisTaskSEDplus::UserExec(Option_t */*option*/)
       }
       fHistNCandidates->Fill(1);
 
-      if(!(vHF->FillRecoCand(aod,d))) { //Fill the data members of the candidate only if they are empty.
+      if(!(fRDCutsAnalysis->GetUseCandidateCache() ? AliRDHFCandidateCache::Instance()->FillRecoCand(aod,d) : vHF->FillRecoCand(aod,d))) { //Fill the data members of the candidate only if they are empty.
         fHistNCandidates->Fill(2); //monitor how often this fails
         continue;
       }
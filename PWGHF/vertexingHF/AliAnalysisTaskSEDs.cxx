@@ -42,6 +42,7 @@
 #include "AliAODRecoDecay.h"
 #include "AliAODRecoDecayHF3Prong.h"
 #include "AliAnalysisVertexingHF.h"
+#include "AliRDHFCandidateCache.h"
 #include "AliRDHFCutsDstoKKpi.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliNormalizationCounter.h"
@@ -965,7 +966,7 @@ void AliAnalysisTaskSEDs::UserExec(Option_t */*option*/)
     nFiltered++;
     fHistNEvents->Fill(12);
         
-    if(!(vHF->FillRecoCand(aod,d))) {////Fill the data members of the candidate only if they are empty.
+    if(!(fAnalysisCuts->GetUseCandidateCache() ? AliRDHFCandidateCache::Instance()->FillRecoCand(aod,d) : vHF->FillRecoCand(aod,d))) {////Fill the data members of the candidate only if they are empty.
       fHistNEvents->Fill(14); //monitor how often this fails
       continue;
     }
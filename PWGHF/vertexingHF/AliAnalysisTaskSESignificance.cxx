@@ -25,6 +25,7 @@
 // Chiara Bianchin, cbianchi@pd.infn.it
 /////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <Riostream.h>
 #include <TClonesArray.h>
 #include <TCanvas.h>
@@ -56,6 +57,7 @@
 #include "AliRDHFCutsD0toKpi.h"
 #include "AliRDHFCutsLctopKpi.h"
 #include "AliMultiDimVector.h"
+#include "AliMultiDimCutScan.h"
 
 #include "AliAnalysisTaskSESignificance.h"
 
@@ -79,6 +81,7 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance():
   fAODProtection(1),
   fReadMC(kFALSE),
   fUseSelBit(kFALSE),
+  fUseCutScan(kFALSE),
   fBFeedDown(kBoth),
   fDecChannel(0),
   fPDGmother(0),
@@ -119,6 +122,7 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance(const char *name, T
   fAODProtection(1),
   fReadMC(kFALSE),
   fUseSelBit(kFALSE),
+  fUseCutScan(kFALSE),
   fBFeedDown(kBoth),
   fDecChannel(decaychannel),
   fPDGmother(0),
@@ -608,7 +612,8 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
       TString mdvname=Form("multiDimVectorPtBin%d",ptbin);
       AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(mdvname.Data());
 
-      ULong64_t *addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
+      Int_t nCellsPassed=0;
+      ULong64_t *addresses = GetCellAddresses(muvec,(Float_t)d->Pt(),nVals,nCellsPassed);
       if(fDebug>1)printf("nvals = %d\n",nVals);
       for(Int_t ivals=0;ivals<nVals;ivals++){
 	if(addresses[ivals]>=muvec->GetNTotCells()){
@@ -617,7 +622,7 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
 	  return;
 	}
 	
-	fHistNEvents->Fill(3);
+	fHistNEvents->Fill(3,nCellsPassed/nVals);
 	
 	//fill the histograms with the appropriate method
 	switch (fDecChannel){
@@ -652,7 +657,7 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
 	nVals=0;
 	fRDCuts->GetCutVarsForOpt(d,fVars,fNVars,fPDGdaughters,aod);
 	delete [] addresses;
-	addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
+	addresses = GetCellAddresses(muvec,(Float_t)d->Pt(),nVals,nCellsPassed);
 	if(fDebug>1)printf("nvals = %d\n",nVals);
 	for(Int_t ivals=0;ivals<nVals;ivals++){
 	  if(addresses[ivals]>=muvec->GetNTotCells()){
@@ -954,6 +959,49 @@ void AliAnalysisTaskSESignificance::FillLambdac(AliAODRecoDecayHF* d,TClonesArra
 }
 
 
+//________________________________________________________________________
+ULong64_t* AliAnalysisTaskSESignificance::GetCellAddresses(const AliMultiDimVector* muvec, Float_t pt, Int_t& nVals, Int_t& nCellsPassed) const{
+  // cells of the histograms to be filled with the candidate: all the cut sets
+  // passed by the candidate or, with the cut scan, only the cell of the candidate.
+  // nCellsPassed is the number of cut sets passed in both cases
+  if(!fUseCutScan){
+    ULong64_t *addresses=muvec->GetGlobalAddressesAboveCuts(fVars,pt,nVals);
+    nCellsPassed=nVals;
+    return addresses;
+  }
+  nVals=0;
+  nCellsPassed=0;
+  Int_t ptbin=muvec->GetPtBin(pt);
+  Int_t ind[kMaxCutVar];
+  if(ptbin<0 || !muvec->GetIndicesFromValues(fVars,ind)) return 0x0;
+  nCellsPassed=1;
+  for(Int_t i=0;i<muvec->GetNVariables();i++) nCellsPassed*=(ind[i]+1);
+  ULong64_t *addresses=new ULong64_t[1];
+  addresses[0]=muvec->GetGlobalAddressFromIndices(ind,ptbin);
+  nVals=1;
+  return addresses;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskSESignificance::FinishTaskOutput()
+{
+  // With the cut scan the histograms of each cell contain the candidates of
+  // that cell only: sum them over the cells with tighter cuts (summed-area
+  // table), before the outputs of the workers are merged
+  if(!fUseCutScan || !fOutput) return;
+
+  Int_t nHistpermv=((AliMultiDimVector*)fCutList->FindObject("multiDimVectorPtBin0"))->GetNTotCells();
+  for(Int_t i=0;i<fNPtBins;i++){
+    AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(Form("multiDimVectorPtBin%d",i));
+    if(!muvec) continue;
+    TH1F **histos[4]={fMassHist,fSigHist,fBkgHist,fRflHist};
+    for(Int_t iType=0;iType<4;iType++){
+      std::vector<TH1*> hist(histos[iType]+i*nHistpermv,histos[iType]+(i+1)*nHistpermv);
+      AliMultiDimCutScan::IntegrateHistograms(muvec,&hist[0]);
+    }
+  }
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSESignificance::Terminate(Option_t */*option*/)
 {
@@ -45,6 +45,9 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   void SetFillWithPartAntiPartBoth(Int_t value){fPartOrAndAntiPart=value;}
   void SetDsChannel(Int_t chan){fDsChannel=chan;}
   void SetUseSelBit(Bool_t selBit=kTRUE){fUseSelBit=selBit;}
+  /// fill only the cell of each candidate and integrate the mass histograms
+  /// over the cut sets at the end of the job (AliMultiDimCutScan)
+  void SetUseCutScan(Bool_t cutScan=kTRUE){fUseCutScan=cutScan;}
   void SetAODMismatchProtection(Int_t opt=1) {fAODProtection=opt;}
 
   //void SetMultiVector(const AliMultiDimVector *MultiDimVec){fMultiDimVec->CopyStructure(MultiDimVec);}
@@ -55,11 +58,13 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t GetBFeedDown()const {return fBFeedDown;}
   Int_t GetDsChannel()const {return fDsChannel;}
   Bool_t GetUseSelBit()const {return fUseSelBit;}
+  Bool_t GetUseCutScan()const {return fUseCutScan;}
 
   /// Implementation of interface methods
   virtual void UserCreateOutputObjects();
   virtual void LocalInit();// {Init();}
   virtual void UserExec(Option_t *option);
+  virtual void FinishTaskOutput();
   virtual void Terminate(Option_t *option);
     
  private:
@@ -85,6 +90,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t GetBackgroundHistoIndex(Int_t iPtBin) const { return iPtBin*3+2;}
   Int_t GetLSHistoIndex(Int_t iPtBin)const { return iPtBin*5;}
   Int_t CheckOrigin(const AliAODMCParticle* mcPart, const TClonesArray* mcArray) const;
+  ULong64_t* GetCellAddresses(const AliMultiDimVector* muvec, Float_t pt, Int_t& nVals, Int_t& nCellsPassed) const;
 
   void FillDplus(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index,Int_t isSel);
   void FillD02p(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index, Int_t isSel);
@@ -115,6 +121,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
                          /// -1: no protection,  0: check AOD/dAOD nEvents only,  1: check AOD/dAOD nEvents + TProcessID names
   Bool_t fReadMC;    /// flag for access to MC
   Bool_t fUseSelBit;    /// flag to use selection bit (speed up candidates selection)
+  Bool_t fUseCutScan;   /// flag to fill only the cell of each candidate (histograms integrated in FinishTaskOutput)
   FeedDownEnum fBFeedDown; /// flag to search for D from B decays
   Int_t fDecChannel; /// decay channel identifier
   Int_t fPDGmother;  /// PDG code of D meson
@@ -131,7 +138,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t fPDGD0ToKpi[2];    /// PDG codes for the particles in the D0 -> K + pi decay
 
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSESignificance,6); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
+  ClassDef(AliAnalysisTaskSESignificance,7); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
   /// \endcond
 };
 
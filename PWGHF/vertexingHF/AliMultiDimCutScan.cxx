@@ -0,0 +1,264 @@
+/**************************************************************************
+ * Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+/////////////////////////////////////////////////////////////
+//
+// Cut scan on the grid of an AliMultiDimVector:
+// one cell filled per candidate, counts passing each
+// cut set from suffix sums (summed-area table)
+//
+/////////////////////////////////////////////////////////////
+
+#include "TH1.h"
+#include "AliLog.h"
+#include "AliMultiDimVector.h"
+#include "AliMultiDimCutScan.h"
+
+//--------------------------------------------------------------------------
+AliMultiDimCutScan::AliMultiDimCutScan(const AliMultiDimVector *mv, Int_t nCategories, Int_t nAuxBins) :
+fStructure(0x0),
+fNTotCells(0),
+fNCategories(nCategories>0 ? nCategories : 1),
+fNAuxBins(nAuxBins>0 ? nAuxBins : 1),
+fCounts(),
+fIsIntegrated(kFALSE)
+{
+  //
+  // Standard constructor: grid (cut values, steps, pt bins) of mv
+  //
+  fStructure=new AliMultiDimVector();
+  fStructure->CopyStructure(mv);
+  fNTotCells=fStructure->GetNTotCells();
+  fCounts.assign(fNTotCells*fNCategories*fNAuxBins,0.);
+}
+//--------------------------------------------------------------------------
+AliMultiDimCutScan::~AliMultiDimCutScan()
+{
+  //
+  // Destructor
+  //
+  delete fStructure;
+}
+//--------------------------------------------------------------------------
+ULong64_t AliMultiDimCutScan::GetCellAddress(const Float_t *values, Int_t ptbin) const
+{
+  //
+  // global address of the cell of the candidate (fNTotCells if outside the grid)
+  //
+  if(ptbin<0 || ptbin>=fStructure->GetNPtBins()) return fNTotCells;
+  Int_t ind[kMaxNVariables];
+  if(!fStructure->GetIndicesFromValues(values,ind)) return fNTotCells;
+  return fStructure->GetGlobalAddressFromIndices(ind,ptbin);
+}
+//--------------------------------------------------------------------------
+ULong64_t AliMultiDimCutScan::GetCellAddress(const Float_t *values, Float_t pt) const
+{
+  //
+  // global address of the cell of the candidate (fNTotCells if outside the grid)
+  //
+  return GetCellAddress(values,fStructure->GetPtBin(pt));
+}
+//--------------------------------------------------------------------------
+Bool_t AliMultiDimCutScan::FillCell(ULong64_t globadd, Int_t category, Int_t auxBin, Double_t weight)
+{
+  //
+  // add a candidate to the cell with address globadd
+  //
+  if(fIsIntegrated){
+    AliErrorGeneral("AliMultiDimCutScan::FillCell","Counts already integrated");
+    return kFALSE;
+  }
+  if(globadd>=fNTotCells || category<0 || category>=fNCategories || auxBin<0 || auxBin>=fNAuxBins) return kFALSE;
+  fCounts[(globadd*fNCategories+category)*fNAuxBins+auxBin]+=weight;
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+Bool_t AliMultiDimCutScan::Fill(const Float_t *values, Float_t pt, Int_t category, Int_t auxBin, Double_t weight)
+{
+  //
+  // add a candidate with cut variables values: O(n. variables)
+  //
+  return FillCell(GetCellAddress(values,pt),category,auxBin,weight);
+}
+//--------------------------------------------------------------------------
+Int_t AliMultiDimCutScan::FillCandidates(Int_t nCand, const Float_t *values, const Float_t *pt, const Int_t *category,
+					 const Int_t *auxBin, const Double_t *weight)
+{
+  //
+  // add nCand candidates, values: nCand x n. variables (candidate by candidate),
+  // as filled by AliRDHFCuts::GetCutVarsForOpt. Returns the n. of candidates in the grid
+  //
+  Int_t nVars=fStructure->GetNVariables();
+  Int_t nFilled=0;
+  for(Int_t iCand=0; iCand<nCand; iCand++){
+    if(Fill(values+iCand*nVars,pt[iCand],category ? category[iCand] : 0,auxBin ? auxBin[iCand] : 0,
+	    weight ? weight[iCand] : 1.)) nFilled++;
+  }
+  return nFilled;
+}
+//--------------------------------------------------------------------------
+void AliMultiDimCutScan::IntegrateArray(const AliMultiDimVector *mv, Double_t *vett, Int_t nValuesPerCell)
+{
+  //
+  // replace the content of each cell (nValuesPerCell consecutive values) with the
+  // sum over the cells with tighter or equal cuts in all the variables (same pt bin),
+  // as AliMultiDimVector::Integrate: one suffix sum per variable
+  //
+  ULong64_t nCells=mv->GetNTotCells();
+  ULong64_t stride=mv->GetNPtBins();
+  for(Int_t iVar=mv->GetNVariables()-1; iVar>=0; iVar--){
+    ULong64_t nSteps=mv->GetNCutSteps(iVar);
+    for(ULong64_t iCell=nCells; iCell-->0;){
+      if((iCell/stride)%nSteps==nSteps-1) continue;
+      Double_t *cell=vett+iCell*nValuesPerCell;
+      const Double_t *next=cell+stride*nValuesPerCell;
+      for(Int_t iVal=0; iVal<nValuesPerCell; iVal++) cell[iVal]+=next[iVal];
+    }
+    stride*=nSteps;
+  }
+}
+//--------------------------------------------------------------------------
+void AliMultiDimCutScan::IntegrateHistograms(const AliMultiDimVector *mv, TH1 **hist)
+{
+  //
+  // same as IntegrateArray for one histogram per cell (hist[globadd], missing
+  // histograms are skipped): histograms filled with the cell of each candidate
+  // become the histograms of the candidates passing the cut set of the cell
+  //
+  ULong64_t nCells=mv->GetNTotCells();
+  ULong64_t stride=mv->GetNPtBins();
+  for(Int_t iVar=mv->GetNVariables()-1; iVar>=0; iVar--){
+    ULong64_t nSteps=mv->GetNCutSteps(iVar);
+    for(ULong64_t iCell=nCells; iCell-->0;){
+      if((iCell/stride)%nSteps==nSteps-1) continue;
+      if(hist[iCell] && hist[iCell+stride]) hist[iCell]->Add(hist[iCell+stride]);
+    }
+    stride*=nSteps;
+  }
+}
+//--------------------------------------------------------------------------
+void AliMultiDimCutScan::Integrate()
+{
+  //
+  // counts of candidates passing each cut set
+  //
+  if(fIsIntegrated){
+    AliErrorGeneral("AliMultiDimCutScan::Integrate","Counts already integrated");
+    return;
+  }
+  if(fNTotCells>0) IntegrateArray(fStructure,&fCounts[0],fNCategories*fNAuxBins);
+  fIsIntegrated=kTRUE;
+}
+//--------------------------------------------------------------------------
+void AliMultiDimCutScan::Reset()
+{
+  //
+  // remove all the candidates
+  //
+  fCounts.assign(fCounts.size(),0.);
+  fIsIntegrated=kFALSE;
+}
+//--------------------------------------------------------------------------
+Double_t AliMultiDimCutScan::GetValue(ULong64_t globadd, Int_t category, Int_t auxBin) const
+{
+  //
+  // content of a cell, sum over the auxiliary bins for auxBin<0
+  //
+  if(globadd>=fNTotCells || category<0 || category>=fNCategories || auxBin>=fNAuxBins) return 0.;
+  const Double_t *cell=&fCounts[(globadd*fNCategories+category)*fNAuxBins];
+  if(auxBin>=0) return cell[auxBin];
+  Double_t sum=0.;
+  for(Int_t iBin=0; iBin<fNAuxBins; iBin++) sum+=cell[iBin];
+  return sum;
+}
+//--------------------------------------------------------------------------
+Double_t AliMultiDimCutScan::GetCounts(ULong64_t globadd, Int_t category, Int_t auxBin) const
+{
+  //
+  // n. of candidates passing the cut set of the cell (in the cell before Integrate)
+  //
+  return GetValue(globadd,category,auxBin);
+}
+//--------------------------------------------------------------------------
+Double_t AliMultiDimCutScan::GetCounts(const Int_t *ind, Int_t ptbin, Int_t category, Int_t auxBin) const
+{
+  //
+  // n. of candidates passing the cut set ind (in the cell before Integrate)
+  //
+  return GetValue(fStructure->GetGlobalAddressFromIndices(ind,ptbin),category,auxBin);
+}
+//--------------------------------------------------------------------------
+Double_t AliMultiDimCutScan::GetCountsInBox(const Int_t *lowInd, const Int_t *upInd, Int_t ptbin, Int_t category, Int_t auxBin) const
+{
+  //
+  // n. of candidates with lowInd[i]<=cell[i]<=upInd[i] for all the variables,
+  // from the integrated counts by inclusion-exclusion (2^n. variables terms)
+  //
+  if(!fIsIntegrated){
+    AliErrorGeneral("AliMultiDimCutScan::GetCountsInBox","Counts not integrated");
+    return 0.;
+  }
+  Int_t nVars=fStructure->GetNVariables();
+  for(Int_t iVar=0; iVar<nVars; iVar++){
+    if(lowInd[iVar]<0 || upInd[iVar]<lowInd[iVar] || upInd[iVar]>=fStructure->GetNCutSteps(iVar)) return 0.;
+  }
+  Int_t corner[kMaxNVariables];
+  Double_t sum=0.;
+  for(UInt_t iTerm=0; iTerm<(1u<<nVars); iTerm++){
+    Bool_t empty=kFALSE;
+    Int_t sign=1;
+    for(Int_t iVar=0; iVar<nVars; iVar++){
+      if(iTerm&(1u<<iVar)){
+	corner[iVar]=upInd[iVar]+1;
+	if(corner[iVar]>=fStructure->GetNCutSteps(iVar)) { empty=kTRUE; break; }
+	sign=-sign;
+      }else{
+	corner[iVar]=lowInd[iVar];
+      }
+    }
+    if(!empty) sum+=sign*GetCounts(corner,ptbin,category,auxBin);
+  }
+  return sum;
+}
+//--------------------------------------------------------------------------
+Bool_t AliMultiDimCutScan::FillMultiDimVector(AliMultiDimVector *mv, Int_t category, Int_t auxBin) const
+{
+  //
+  // write the counts of a category (sum over the auxiliary bins for auxBin<0)
+  // into mv, which must have the same grid
+  //
+  if(!mv || mv->GetNTotCells()!=fNTotCells || mv->GetNVariables()!=fStructure->GetNVariables() ||
+     mv->GetNPtBins()!=fStructure->GetNPtBins()){
+    AliErrorGeneral("AliMultiDimCutScan::FillMultiDimVector","Different grid of the AliMultiDimVector");
+    return kFALSE;
+  }
+  for(ULong64_t iCell=0; iCell<fNTotCells; iCell++) mv->SetElement(iCell,(Float_t)GetValue(iCell,category,auxBin));
+  mv->SetIsIntegrated(fIsIntegrated);
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+AliMultiDimVector* AliMultiDimCutScan::MakeMultiDimVector(const char *name, Int_t category, Int_t auxBin) const
+{
+  //
+  // new AliMultiDimVector with the counts of a category
+  //
+  AliMultiDimVector *mv=new AliMultiDimVector();
+  mv->CopyStructure(fStructure);
+  mv->SetName(name);
+  FillMultiDimVector(mv,category,auxBin);
+  return mv;
+}
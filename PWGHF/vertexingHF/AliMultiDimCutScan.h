@@ -0,0 +1,85 @@
+#ifndef ALIMULTIDIMCUTSCAN_H
+#define ALIMULTIDIMCUTSCAN_H
+/* Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//***********************************************************
+/// \class Class AliMultiDimCutScan
+/// \brief cut scan on the grid of an AliMultiDimVector with
+/// summed-area tables
+///
+/// A candidate passes all the cut sets of a hyper-rectangle of the
+/// grid (cells 0...ind[i] in each variable, with ind the cell of the
+/// candidate). Instead of incrementing all the cells of this region
+/// (AliMultiDimVector::FillAndIntegrate, GetGlobalAddressesAboveCuts),
+/// only the cell of the candidate is filled (O(n. variables)) and the
+/// counts are integrated once at the end with suffix sums along each
+/// variable (O(n. variables x n. cells)).
+/// After Integrate()
+///  - GetCounts(ind,ptbin) = candidates passing the cut set ind
+///  - GetCountsInBox(low,up,ptbin) = candidates with cells between low and
+///    up (e.g. passing the cut set low and failing the cut set up)
+/// The results are written back into AliMultiDimVector objects.
+/// Several categories (e.g. signal and background) and auxiliary bins
+/// (e.g. invariant mass bins) are handled in the same table.
+/// IntegrateHistograms applies the same integration to one histogram
+/// per cell filled with the cell of the candidate only
+//***********************************************************
+
+#include <vector>
+#include <Rtypes.h>
+
+class TH1;
+class AliMultiDimVector;
+
+class AliMultiDimCutScan
+{
+ public:
+  AliMultiDimCutScan(const AliMultiDimVector *mv, Int_t nCategories=2, Int_t nAuxBins=1);
+  virtual ~AliMultiDimCutScan();
+
+  Int_t     GetNCategories() const {return fNCategories;}
+  Int_t     GetNAuxBins() const {return fNAuxBins;}
+  ULong64_t GetNTotCells() const {return fNTotCells;}
+  Bool_t    IsIntegrated() const {return fIsIntegrated;}
+  const AliMultiDimVector* GetStructure() const {return fStructure;}
+
+  ULong64_t GetCellAddress(const Float_t *values, Float_t pt) const;
+  ULong64_t GetCellAddress(const Float_t *values, Int_t ptbin) const;
+
+  Bool_t Fill(const Float_t *values, Float_t pt, Int_t category=0, Int_t auxBin=0, Double_t weight=1.);
+  Bool_t FillCell(ULong64_t globadd, Int_t category=0, Int_t auxBin=0, Double_t weight=1.);
+  Int_t  FillCandidates(Int_t nCand, const Float_t *values, const Float_t *pt, const Int_t *category=0x0,
+			const Int_t *auxBin=0x0, const Double_t *weight=0x0);
+  void   Integrate();
+  void   Reset();
+
+  Double_t GetCounts(ULong64_t globadd, Int_t category=0, Int_t auxBin=-1) const;
+  Double_t GetCounts(const Int_t *ind, Int_t ptbin, Int_t category=0, Int_t auxBin=-1) const;
+  Double_t GetCountsInBox(const Int_t *lowInd, const Int_t *upInd, Int_t ptbin, Int_t category=0, Int_t auxBin=-1) const;
+
+  Bool_t FillMultiDimVector(AliMultiDimVector *mv, Int_t category=0, Int_t auxBin=-1) const;
+  AliMultiDimVector* MakeMultiDimVector(const char *name, Int_t category=0, Int_t auxBin=-1) const;
+
+  static void IntegrateArray(const AliMultiDimVector *mv, Double_t *vett, Int_t nValuesPerCell=1);
+  static void IntegrateHistograms(const AliMultiDimVector *mv, TH1 **hist);
+
+ private:
+  enum {kMaxNVariables=10}; /// as AliMultiDimVector
+
+  AliMultiDimCutScan(const AliMultiDimCutScan& source);
+  AliMultiDimCutScan& operator=(const AliMultiDimCutScan& source);
+
+  Double_t  GetValue(ULong64_t globadd, Int_t category, Int_t auxBin) const;
+
+  AliMultiDimVector *fStructure;  /// copy of the structure of the grid (cut values, pt bins)
+  ULong64_t fNTotCells;           /// number of cells of the grid
+  Int_t     fNCategories;         /// number of categories of candidates
+  Int_t     fNAuxBins;            /// number of auxiliary bins per category
+  std::vector<Double_t> fCounts;  /// counts: (cell, category, auxiliary bin), auxiliary bin fastest
+  Bool_t    fIsIntegrated;        /// flag for integrated counts
+};
+
+#endif
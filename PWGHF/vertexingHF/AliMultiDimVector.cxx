@@ -29,7 +29,9 @@
 #include <fstream>
 #include <Riostream.h>
 #include "TH2.h"
+#include "TArrayD.h"
 #include "AliMultiDimVector.h"
+#include "AliMultiDimCutScan.h"
 #include "AliLog.h"
 #include "TString.h"
 
@@ -546,8 +548,11 @@ void AliMultiDimVector::Integrate(){
     AliError("MultiDimVector already integrated");
     return;
   }
-  TArrayF integral(fNTotCells);
-  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=CountsAboveCell(i);
+  // summed-area table: one suffix sum per variable instead of
+  // CountsAboveCell for each cell
+  TArrayD integral(fNTotCells);
+  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=fVett[i];
+  AliMultiDimCutScan::IntegrateArray(this,integral.GetArray());
   for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]= integral[i];
   fIsIntegrated=kTRUE;
 }//_____________________________________________________________________________ 
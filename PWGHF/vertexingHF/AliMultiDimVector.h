@@ -94,6 +94,7 @@ class AliMultiDimVector :  public TNamed{
   void IncrementElement(ULong64_t globadd){
     SetElement(globadd,GetElement(globadd)+1.);
   }
+  void SetIsIntegrated(Bool_t flag=kTRUE) {fIsIntegrated=flag;}
 
   void Fill(Float_t* values, Int_t ptbin);
   void FillAndIntegrate(Float_t* values, Int_t ptbin);
@@ -0,0 +1,186 @@
+/**************************************************************************
+ * Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+/////////////////////////////////////////////////////////////
+//
+// Per-event cache of heavy-flavour candidate information
+// (refilled candidates, n-sigmas)
+// shared by the AliRDHFCuts objects of a train
+//
+/////////////////////////////////////////////////////////////
+
+#include <Riostream.h>
+
+#include "AliVEvent.h"
+#include "AliAODTrack.h"
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+#include "AliAnalysisManager.h"
+#include "AliAODRecoDecayHF2Prong.h"
+#include "AliAODRecoDecayHF3Prong.h"
+#include "AliAnalysisVertexingHF.h"
+#include "AliRDHFCandidateCache.h"
+
+using std::cout;
+using std::endl;
+
+AliRDHFCandidateCache* AliRDHFCandidateCache::fgInstance=0x0;
+
+//--------------------------------------------------------------------------
+AliRDHFCandidateCache::AliRDHFCandidateCache() :
+fEvent(0x0),
+fEntry(-1),
+fVertexerHF(0x0),
+fPidResponse(0x0),
+fTrackSlot(),
+fNSigma(),
+fNEvents(0),
+fNNSigmaRequests(0),
+fNNSigmaComputed(0)
+{
+  //
+  // Default Constructor
+  //
+  for(Int_t i=0; i<5; i++) fEventHeader[i]=0;
+}
+//--------------------------------------------------------------------------
+AliRDHFCandidateCache::~AliRDHFCandidateCache()
+{
+  //
+  // Destructor
+  //
+  delete fVertexerHF;
+}
+//--------------------------------------------------------------------------
+AliRDHFCandidateCache* AliRDHFCandidateCache::Instance()
+{
+  //
+  // Cache shared by all the cut objects (tasks of a train are executed sequentially)
+  //
+  if(!fgInstance) fgInstance=new AliRDHFCandidateCache();
+  return fgInstance;
+}
+//--------------------------------------------------------------------------
+void AliRDHFCandidateCache::SetEvent(const AliVEvent *event)
+{
+  //
+  // Reset the cache if the event is not the one of the cached information.
+  // The event object is reused by the input handler, so the entry number
+  // and the header information are compared as well
+  //
+  if(!event) return;
+  Long64_t entry=-1;
+  AliAnalysisManager *mgr=AliAnalysisManager::GetAnalysisManager();
+  if(mgr) entry=mgr->GetCurrentEntry();
+  UInt_t header[5]={(UInt_t)event->GetRunNumber(),event->GetPeriodNumber(),event->GetOrbitNumber(),
+		    (UInt_t)event->GetBunchCrossNumber(),(UInt_t)event->GetNumberOfTracks()};
+
+  Bool_t sameEvent=(event==fEvent && entry==fEntry);
+  for(Int_t i=0; i<5 && sameEvent; i++) sameEvent=(header[i]==fEventHeader[i]);
+  if(sameEvent) return;
+
+  Reset();
+  fEvent=event;
+  fEntry=entry;
+  for(Int_t i=0; i<5; i++) fEventHeader[i]=header[i];
+  fNEvents++;
+}
+//--------------------------------------------------------------------------
+void AliRDHFCandidateCache::Reset()
+{
+  //
+  // Clear the per-event information (memory of the arrays is kept)
+  //
+  delete fVertexerHF;
+  fVertexerHF=0x0;
+  fPidResponse=0x0;
+  fTrackSlot.clear();
+  fNSigma.clear();
+}
+//--------------------------------------------------------------------------
+AliAnalysisVertexingHF* AliRDHFCandidateCache::GetVertexerHF()
+{
+  //
+  // AliAnalysisVertexingHF of the current event: the AOD track map and the
+  // vertexer are built once per event as done by the tasks
+  //
+  if(!fVertexerHF) fVertexerHF=new AliAnalysisVertexingHF();
+  return fVertexerHF;
+}
+//--------------------------------------------------------------------------
+Bool_t AliRDHFCandidateCache::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd2)
+{
+  //
+  // Refill a 2-prong candidate of a reduced dAOD (no-op if already filled)
+  //
+  if(rd2->GetIsFilled()!=0) return kTRUE;
+  SetEvent(event);
+  return GetVertexerHF()->FillRecoCand(event,rd2);
+}
+//--------------------------------------------------------------------------
+Bool_t AliRDHFCandidateCache::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3Prong *rd3)
+{
+  //
+  // Refill a 3-prong candidate of a reduced dAOD (no-op if already filled)
+  //
+  if(rd3->GetIsFilled()!=0) return kTRUE;
+  SetEvent(event);
+  return GetVertexerHF()->FillRecoCand(event,rd3);
+}
+//--------------------------------------------------------------------------
+Double_t AliRDHFCandidateCache::GetNSigma(AliPIDResponse *response,AliAODTrack *track,Int_t det,Int_t species)
+{
+  //
+  // Cached TPC/TOF n-sigma of a track, computed on first request
+  //
+  fNNSigmaRequests++;
+  if(!fPidResponse) fPidResponse=response;
+  if(response!=fPidResponse || species<0 || species>=AliPID::kSPECIESC || det<0 || det>=kNDetectors){
+    // not the response of the cached values: compute directly
+    fNNSigmaComputed++;
+    if(det==kTOF) return response->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    return response->NumberOfSigmasTPC(track,(AliPID::EParticleType)species);
+  }
+
+  const Int_t nValues=kNDetectors*AliPID::kSPECIESC;
+  std::map<const AliAODTrack*,Int_t>::iterator it=fTrackSlot.find(track);
+  Int_t slot=0;
+  if(it==fTrackSlot.end()){
+    slot=fNSigma.size()/nValues;
+    fTrackSlot[track]=slot;
+    fNSigma.resize(fNSigma.size()+nValues,-9999.);
+  }else{
+    slot=it->second;
+  }
+
+  Double_t &nsigma=fNSigma[slot*nValues+det*AliPID::kSPECIESC+species];
+  if(nsigma<-9998.){
+    if(det==kTOF) nsigma=response->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    else nsigma=response->NumberOfSigmasTPC(track,(AliPID::EParticleType)species);
+    fNNSigmaComputed++;
+  }
+  return nsigma;
+}
+//--------------------------------------------------------------------------
+void AliRDHFCandidateCache::PrintStatistics() const
+{
+  //
+  // Fraction of the requests served from the cache
+  //
+  cout<<"AliRDHFCandidateCache: "<<fNEvents<<" events"<<endl;
+  cout<<"  n-sigmas: "<<fNNSigmaRequests<<" requested, "<<fNNSigmaComputed<<" computed"<<endl;
+}
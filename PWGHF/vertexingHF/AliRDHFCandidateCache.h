@@ -0,0 +1,79 @@
+#ifndef ALIRDHFCANDIDATECACHE_H
+#define ALIRDHFCANDIDATECACHE_H
+/* Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//***********************************************************
+/// \class Class AliRDHFCandidateCache
+/// \brief per-event cache of candidate information shared by the
+/// AliRDHFCuts objects of the tasks running on the same input
+///
+/// Enabled with AliRDHFCuts::SetUseCandidateCache(). Within one event
+///  - candidates of reduced dAODs are refilled (FillRecoCand) with a single
+///    AliAnalysisVertexingHF and a single AOD track map
+///  - TPC and TOF n-sigmas of a track are computed once per species
+/// Candidate variables are not cached: candidates are also built on the heap
+/// (e.g. on-the-fly reconstruction) and a later candidate can reuse the
+/// address of a deleted one, while the getters are cheap compared to a lookup
+/// The cache is reset when a new event is seen by AliRDHFCuts::IsEventSelected
+//***********************************************************
+
+#include <vector>
+#include <map>
+#include <Rtypes.h>
+
+class AliVEvent;
+class AliAODTrack;
+class AliPIDResponse;
+class AliAODRecoDecayHF2Prong;
+class AliAODRecoDecayHF3Prong;
+class AliAnalysisVertexingHF;
+
+class AliRDHFCandidateCache
+{
+ public:
+
+  enum EDetector {kTPC,kTOF,kNDetectors};
+
+  static AliRDHFCandidateCache* Instance();
+  virtual ~AliRDHFCandidateCache();
+
+  void SetEvent(const AliVEvent *event);
+
+  Bool_t FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd2);
+  Bool_t FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3Prong *rd3);
+
+  Double_t GetNSigma(AliPIDResponse *response,AliAODTrack *track,Int_t det,Int_t species);
+
+  Long64_t GetNEvents() const {return fNEvents;}
+  Long64_t GetNNSigmaRequests() const {return fNNSigmaRequests;}
+  Long64_t GetNNSigmaComputed() const {return fNNSigmaComputed;}
+  void PrintStatistics() const;
+
+ private:
+  AliRDHFCandidateCache();
+  AliRDHFCandidateCache(const AliRDHFCandidateCache& source);
+  AliRDHFCandidateCache& operator=(const AliRDHFCandidateCache& source);
+
+  void Reset();
+  AliAnalysisVertexingHF* GetVertexerHF();
+
+  static AliRDHFCandidateCache* fgInstance; /// shared instance
+
+  const AliVEvent *fEvent;   /// current event
+  Long64_t fEntry;           /// entry of the current event in the analysis manager
+  UInt_t fEventHeader[5];    /// run, period, orbit, bunch crossing, number of tracks of the current event
+  AliAnalysisVertexingHF *fVertexerHF; /// refilling of candidates (one AOD map per event)
+
+  AliPIDResponse *fPidResponse;     /// PID response used for the cached n-sigmas
+  std::map<const AliAODTrack*,Int_t> fTrackSlot; /// slot of each track in the n-sigma array
+  std::vector<Double_t> fNSigma;    /// kNDetectors x AliPID::kSPECIESC n-sigmas per track (-9999: not yet computed)
+
+  Long64_t fNEvents;           /// number of events seen
+  Long64_t fNNSigmaRequests;   /// number of requested n-sigmas
+  Long64_t fNNSigmaComputed;   /// number of computed n-sigmas
+};
+
+#endif
@@ -36,6 +36,7 @@
 #include "AliCentrality.h"
 #include "AliAODRecoDecayHF.h"
 #include "AliAnalysisVertexingHF.h"
+#include "AliRDHFCandidateCache.h"
 #include "AliAODMCHeader.h"
 #include "AliAODMCParticle.h"
 #include "AliVertexerTracks.h"
@@ -125,7 +126,8 @@ fCutGeoNcrNclLength(130.),
 fCutGeoNcrNclGeom1Pt(1.5),
 fCutGeoNcrNclFractionNcr(0.85),
 fCutGeoNcrNclFractionNcl(0.7),
-fUseV0ANDSelectionOffline(kFALSE)
+fUseV0ANDSelectionOffline(kFALSE),
+fUseCandidateCache(kFALSE)
 {
   //
   // Default Constructor
@@ -198,7 +200,8 @@ AliRDHFCuts::AliRDHFCuts(const AliRDHFCuts &source) :
   fCutGeoNcrNclGeom1Pt(source.fCutGeoNcrNclGeom1Pt),
   fCutGeoNcrNclFractionNcr(source.fCutGeoNcrNclFractionNcr),
   fCutGeoNcrNclFractionNcl(source.fCutGeoNcrNclFractionNcl),
-  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline)
+  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline),
+  fUseCandidateCache(source.fUseCandidateCache)
 {
   //
   // Copy constructor
@@ -298,6 +301,7 @@ AliRDHFCuts &AliRDHFCuts::operator=(const AliRDHFCuts &source)
   fCutGeoNcrNclFractionNcr=source.fCutGeoNcrNclFractionNcr;
   fCutGeoNcrNclFractionNcl=source.fCutGeoNcrNclFractionNcl;
   fUseV0ANDSelectionOffline=source.fUseV0ANDSelectionOffline;
+  fUseCandidateCache=source.fUseCandidateCache;
 
   PrintAll();
 
@@ -504,6 +508,9 @@ Bool_t AliRDHFCuts::IsEventSelected(AliVEvent *event) {
 
   SetupPID(event);
 
+  // new event: reset the information shared with the other cut objects
+  if(fUseCandidateCache) AliRDHFCandidateCache::Instance()->SetEvent(event);
+
   // trigger class
   TString firedTriggerClasses=((AliAODEvent*)event)->GetFiredTriggerClasses();
   // don't do for MC and for PbPb 2010 data
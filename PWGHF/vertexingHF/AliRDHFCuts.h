@@ -212,6 +212,13 @@ class AliRDHFCuts : public AliAnalysisCuts
   void SetPidHF(AliAODPidHF* pidObj) {
     if(fPidHF) delete fPidHF;
     fPidHF=new AliAODPidHF(*pidObj);
+    if(fUseCandidateCache) fPidHF->SetUseCandidateCache(kTRUE);
+  }
+  /// share refilled candidates and n-sigmas with the other cut objects
+  /// of the train (see AliRDHFCandidateCache)
+  void SetUseCandidateCache(Bool_t flag=kTRUE) {
+    fUseCandidateCache=flag;
+    if(fPidHF) fPidHF->SetUseCandidateCache(flag);
   }
   void SetRemoveDaughtersFromPrim(Bool_t removeDaughtersPrim) {fRemoveDaughtersFromPrimary=removeDaughtersPrim;}
   void SetMinPtCandidate(Double_t ptCand=-1.) {fMinPtCand=ptCand; return;}
@@ -341,6 +348,7 @@ class AliRDHFCuts : public AliAnalysisCuts
   void SetFixRefs(Bool_t fix=kTRUE) {fFixRefs=fix; return;}
   void SetUsePhysicsSelection(Bool_t use=kTRUE){fUsePhysicsSelection=use; return;}
   Bool_t GetUsePhysicsSelection() const { return fUsePhysicsSelection; }
+  Bool_t GetUseCandidateCache() const { return fUseCandidateCache; }
 
 
 
@@ -456,10 +464,11 @@ class AliRDHFCuts : public AliAnalysisCuts
   Double_t fCutGeoNcrNclFractionNcr; /// 4th parameter of GeoNcrNcl cut
   Double_t fCutGeoNcrNclFractionNcl; /// 5th parameter of GeoNcrNcl cut
   Bool_t fUseV0ANDSelectionOffline; ///flag to apply V0AND selection offline
+  Bool_t fUseCandidateCache; /// flag to use the shared per-event AliRDHFCandidateCache
   
 
   /// \cond CLASSIMP    
-  ClassDef(AliRDHFCuts,40);  /// base class for cuts on AOD reconstructed heavy-flavour decays
+  ClassDef(AliRDHFCuts,41);  /// base class for cuts on AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
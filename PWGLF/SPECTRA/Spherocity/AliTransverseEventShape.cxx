@@ -52,7 +52,9 @@
 #include <TFile.h>
 #include "AliAODHeader.h"
 // STL includes
+#include <algorithm>
 #include <iostream>
+#include <utility>
 using namespace std;
 
 
@@ -74,6 +76,7 @@ AliTransverseEventShape::AliTransverseEventShape():TObject(),
         fAODFilterGlobal(0),
 	fMinMultESA(0),
 	fSizeStepESA(0),
+	fUseExactSpherocity(kFALSE),
 	fIsAbsEtaESA(0),
 	fEtaMaxCutESA(0),
 	fEtaMinCutESA(0),
@@ -115,6 +118,7 @@ AliTransverseEventShape::AliTransverseEventShape(const AliTransverseEventShape &
         fAODFilterGlobal(0),
 	fMinMultESA(0),
 	fSizeStepESA(0),
+	fUseExactSpherocity(kFALSE),
 	fIsAbsEtaESA(0),
 	fEtaMaxCutESA(0),
 	fEtaMinCutESA(0),
@@ -458,6 +462,15 @@ Float_t AliTransverseEventShape::AnalyseGetSpherocity( Bool_t fillHist, const ve
 
 	}
 
+	if( fUseExactSpherocity ){
+		if( fNrec > 0 && sumapt > 0 ){
+			Float_t numerador = GetMinSumPerpExact( fNrec, pt, phi );
+			Spherocity = TMath::Power( (numerador / sumapt),2 );
+		}
+		spherocity=((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
+		return spherocity;
+	}
+
 	//Getting thrust
 	for(Int_t i = 0; i < 360/(fSizeStepESA); ++i){
 		Float_t numerador = 0;
@@ -486,6 +499,53 @@ Float_t AliTransverseEventShape::AnalyseGetSpherocity( Bool_t fillHist, const ve
 
 	return spherocity;
 
+}
+//_____________________________________________________________________
+Double_t AliTransverseEventShape::GetMinSumPerpExact( Int_t ntracks, const vector<Float_t> &pt, const vector<Float_t> &phi ){
+
+	// Minimum over the unit vectors n of sum_i |pT_i x n|, in O(N log N).
+	// Between two consecutive track directions (modulo pi) the sum is a
+	// positive sinusoid of the axis angle, hence concave: the minimum is
+	// reached for n along one of the tracks. The momenta are folded to the
+	// half plane [0,pi) and sorted in azimuth; for n along the folded track j,
+	// tracks before j contribute with a negative sign and tracks after j with
+	// a positive sign, so each candidate is obtained from running sums.
+
+	vector<Double_t> px( ntracks ), py( ntracks );
+	vector< pair<Double_t,Int_t> > order( ntracks );
+	Double_t sumx = 0, sumy = 0;
+	for(Int_t i1 = 0; i1 < ntracks; ++i1){
+		px[i1] = pt[i1] * TMath::Cos( phi[i1] );
+		py[i1] = pt[i1] * TMath::Sin( phi[i1] );
+		Double_t psi = TMath::ATan2( py[i1], px[i1] );
+		if( psi < 0 ){
+			psi += TMath::Pi();
+			px[i1] = -px[i1];
+			py[i1] = -py[i1];
+		}
+		if( psi >= TMath::Pi() ) psi -= TMath::Pi();
+		order[i1] = make_pair( psi, i1 );
+		sumx += px[i1];
+		sumy += py[i1];
+	}
+	sort( order.begin(), order.end() );
+
+	Double_t minsum = -1;
+	Double_t belowx = 0, belowy = 0;
+	for(Int_t k = 0; k < ntracks; ++k){
+		Int_t j = order[k].second;
+		Double_t ptj = TMath::Sqrt( px[j]*px[j] + py[j]*py[j] );
+		if( ptj > 0 ){
+			// projection on the normal to n = p_j / |p_j|
+			Double_t sum = TMath::Abs( ( (sumx - 2*belowx) * (-py[j]) + (sumy - 2*belowy) * px[j] ) / ptj );
+			if( minsum < 0 || sum < minsum ) minsum = sum;
+		}
+		belowx += px[j];
+		belowy += py[j];
+	}
+
+	return ( minsum < 0 ) ? 0 : minsum;
+
 }
 //_____________________________________________________________________
 Float_t AliTransverseEventShape::GetSpherocity( Bool_t fillHist )
@@ -45,6 +45,7 @@ class AliTransverseEventShape : public TObject {
 
   void  SetMinMultForESA(Int_t minnch)     {fMinMultESA = minnch;}
   void  SetStepSizeESA(Float_t sizestep)   {fSizeStepESA = sizestep;}
+  void  SetUseExactSpherocity(Bool_t exact) {fUseExactSpherocity = exact;} // exact minimisation instead of the scan in steps of fSizeStepESA
   void  SetIsEtaAbsESA(Bool_t isabseta)    {fIsAbsEtaESA = isabseta;}
   void  SetTrackEtaMinESA(Float_t etaminF) {fEtaMinCutESA = etaminF;}
   void  SetTrackEtaMaxESA(Float_t etamaxF) {fEtaMaxCutESA = etamaxF;}
@@ -77,6 +78,9 @@ class AliTransverseEventShape : public TObject {
 		  const std::vector<Float_t> &eta,
 		  const std::vector<Float_t> &phi);
 
+  static Double_t GetMinSumPerpExact(Int_t ntracks, const std::vector<Float_t> &pt,
+		  const std::vector<Float_t> &phi);
+
 
   //EvSel Snippets
   Float_t MinVal( Float_t A, Float_t B ); 
@@ -98,6 +102,7 @@ class AliTransverseEventShape : public TObject {
 
   Int_t   fMinMultESA;
   Float_t fSizeStepESA;
+  Bool_t  fUseExactSpherocity; // minimise over the track directions instead of the step scan
   Bool_t  fIsAbsEtaESA;
   Float_t fEtaMaxCutESA;
   Float_t fEtaMinCutESA;
@@ -118,7 +123,7 @@ class AliTransverseEventShape : public TObject {
   TH1D    *fhptStMC;
 
 
-  ClassDef(AliTransverseEventShape,2) // base helper class
+  ClassDef(AliTransverseEventShape,3) // base helper class
 };
 #endif
 
@@ -43,6 +43,8 @@ class AliESDFMD;
 class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
+class AliV0ResultCutTable;
+class AliCascadeResultCutTable;
 
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
@@ -226,6 +228,8 @@ private:
     TList  *fListHist;      //! List of Cascade histograms
     TList  *fListV0;        // List of Cascade histograms
     TList  *fListCascade;   // List of Cascade histograms
+    AliV0ResultCutTable      *fV0CutTable;      //! fListV0 selections in struct-of-arrays form
+    AliCascadeResultCutTable *fCascadeCutTable; //! fListCascade selections in struct-of-arrays form
     TTree  *fTreeEvent;              //! Output Tree, Events
     TTree  *fTreeV0;              //! Output Tree, V0s
     TTree  *fTreeCascade;              //! Output Tree, Cascades
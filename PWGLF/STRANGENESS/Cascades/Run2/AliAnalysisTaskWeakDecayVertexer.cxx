@@ -53,6 +53,7 @@ class AliAODv0;
 #include "TLegend.h"
 #include "TRandom3.h"
 #include "TLorentzVector.h"
+#include "TDatabasePDG.h"
 //#include "AliLog.h"
 
 #include "AliESDEvent.h"
@@ -91,6 +92,10 @@ class AliAODv0;
 #include "AliCascadeResult.h"
 #include "AliAnalysisTaskWeakDecayVertexer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 using std::cout;
 using std::endl;
 
@@ -123,6 +128,9 @@ fkDoImprovedCascadePosition( kFALSE ),
 fkDoImprovedDCAV0DauPropagation( kFALSE ),
 fkIfImprovedPerformInitialLinearPropag( kFALSE ),
 fkIfImprovedExtraPrecisionFactor ( 1.0 ),
+fkV0PairPreselection( kTRUE ),
+fkCascadePairPreselection( kFALSE ),
+fV0VertexerThreads( 1 ),
 fMinPtCascade(   0.3 ),
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
@@ -164,6 +172,9 @@ fkDoImprovedCascadePosition ( kFALSE ),
 fkDoImprovedDCAV0DauPropagation( kFALSE ),
 fkIfImprovedPerformInitialLinearPropag( kFALSE ),
 fkIfImprovedExtraPrecisionFactor ( 1.0 ),
+fkV0PairPreselection( kTRUE ),
+fkCascadePairPreselection( kFALSE ),
+fV0VertexerThreads( 1 ),
 fMinPtCascade(   0.3 ), //pre-selection
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
@@ -486,15 +497,16 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
     
     Double_t xPrimaryVertex=vtxT3D->GetX();
     Double_t yPrimaryVertex=vtxT3D->GetY();
-    Double_t zPrimaryVertex=vtxT3D->GetZ();
     
     Long_t nentr=event->GetNumberOfTracks();
     Double_t b=event->GetMagneticField();
     
     if (nentr<2) return 0;
     
-    TArrayI neg(nentr);
-    TArrayI pos(nentr);
+    std::vector<Int_t> neg, pos;
+    std::vector<Double_t> lNegD, lPosD; //|DCA to PV|, reused in the pair loop
+    neg.reserve(nentr); pos.reserve(nentr);
+    lNegD.reserve(nentr); lPosD.reserve(nentr);
     
     Long_t nneg=0, npos=0, nvtx=0;
     
@@ -515,16 +527,116 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (TMath::Abs(d)<fV0VertexerSels[2]) continue;
         if (TMath::Abs(d)>fV0VertexerSels[6]) continue;
         
-        if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
-        else pos[npos++]=i;
+        if (esdTrack->GetSign() < 0.) { neg.push_back(i); lNegD.push_back(TMath::Abs(d)); }
+        else { pos.push_back(i); lPosD.push_back(TMath::Abs(d)); }
+    }
+    nneg = neg.size();
+    npos = pos.size();
+    
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    //Pair pre-selection: transverse helix circles of all daughter candidates,
+    //positive tracks sorted by the lower edge of their (enlarged) bounding box
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    std::vector<HelixCircle_t> lNegCircle(nneg), lPosCircle(npos);
+    std::vector<Int_t> lPosByXmin(npos);
+    for (i=0; i<nneg; i++) GetHelixCircle(event->GetTrack(neg[i]), b, lNegCircle[i]);
+    for (i=0; i<npos; i++) {
+        GetHelixCircle(event->GetTrack(pos[i]), b, lPosCircle[i]);
+        lPosByXmin[i] = i;
+    }
+    std::sort(lPosByXmin.begin(), lPosByXmin.end(), [&lPosCircle](Int_t a, Int_t c) {
+        return lPosCircle[a].fXmin < lPosCircle[c].fXmin;
+    });
+    
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    //Pair search in chunks of negative tracks, possibly in parallel.
+    //Chunks are merged in order: the V0 list does not depend on the threads
+    //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+    Int_t lNThreads = fV0VertexerThreads;
+    if (lNThreads <= 0) lNThreads = std::thread::hardware_concurrency();
+    if (lNThreads < 1) lNThreads = 1;
+    Long_t lNChunks = (lNThreads == 1) ? 1 : TMath::Min(nneg, (Long_t)4*lNThreads);
+    if (lNChunks < 1) lNChunks = 1;
+    std::vector< std::vector<AliESDv0> > lChunkV0s(lNChunks);
+    
+    if (lNThreads == 1) {
+        Tracks2V0verticesRange(event, 0, nneg, neg, pos, lNegD, lPosD, lNegCircle, lPosCircle, lPosByXmin, lChunkV0s[0]);
+    } else {
+        //lazy initialisation of the particle table is not thread safe: do it here
+        TDatabasePDG::Instance()->GetParticle(kK0Short);
+        std::atomic<Long_t> lNextChunk(0);
+        std::vector<std::thread> lWorkers;
+        for (Int_t ith=0; ith<lNThreads; ith++) {
+            lWorkers.push_back(std::thread([&]() {
+                for (Long_t ich=lNextChunk++; ich<lNChunks; ich=lNextChunk++) {
+                    Tracks2V0verticesRange(event, ich*nneg/lNChunks, (ich+1)*nneg/lNChunks, neg, pos,
+                                           lNegD, lPosD, lNegCircle, lPosCircle, lPosByXmin, lChunkV0s[ich]);
+                }
+            }));
+        }
+        for (UInt_t ith=0; ith<lWorkers.size(); ith++) lWorkers[ith].join();
     }
     
+    for (Long_t ich=0; ich<lNChunks; ich++) {
+        for (UInt_t iv0=0; iv0<lChunkV0s[ich].size(); iv0++) {
+            AliESDv0 &vertex = lChunkV0s[ich][iv0];
+            vertex.ChangeMassHypothesis(kK0Short);
+            event->AddV0(&vertex);
+            nvtx++;
+        }
+    }
+    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %ld",nvtx);
+    return nvtx;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesRange(AliESDEvent *event, Long_t lFirstNeg, Long_t lLastNeg,
+                                                              const std::vector<Int_t> &neg, const std::vector<Int_t> &pos,
+                                                              const std::vector<Double_t> &lNegD, const std::vector<Double_t> &lPosD,
+                                                              const std::vector<HelixCircle_t> &lNegCircle, const std::vector<HelixCircle_t> &lPosCircle,
+                                                              const std::vector<Int_t> &lPosByXmin, std::vector<AliESDv0> &lFound) {
+    //--------------------------------------------------------------------
+    // V0 pair search for the negative tracks lFirstNeg ... lLastNeg-1.
+    // Candidates are stored in lFound in the order of the sequential
+    // search; nothing is written to the event (may run in a thread)
+    //--------------------------------------------------------------------
+    
+    const AliESDVertex *vtxT3D=event->GetPrimaryVertex();
+    
+    Double_t xPrimaryVertex=vtxT3D->GetX();
+    Double_t yPrimaryVertex=vtxT3D->GetY();
+    Double_t zPrimaryVertex=vtxT3D->GetZ();
     
-    for (i=0; i<nneg; i++) {
+    Double_t b=event->GetMagneticField();
+    Long_t npos=pos.size();
+    
+    std::vector<Int_t> lCandidates;
+    lCandidates.reserve(npos);
+    
+    for (Long_t i=lFirstNeg; i<lLastNeg; i++) {
         Long_t nidx=neg[i];
         AliESDtrack *ntrk=event->GetTrack(nidx);
         
-        for (Int_t k=0; k<npos; k++) {
+        //Positive tracks whose circle can get close enough, in original order
+        lCandidates.clear();
+        const HelixCircle_t &lNeg = lNegCircle[i];
+        if ( fkV0PairPreselection && lNeg.fUsable ){
+            for (Long_t ik=0; ik<npos; ik++) {
+                Int_t k = lPosByXmin[ik];
+                const HelixCircle_t &lPos = lPosCircle[k];
+                if ( lPos.fXmin > lNeg.fXmax ) break;
+                if ( lPos.fXmax < lNeg.fXmin ) continue;
+                if ( lPos.fYmin > lNeg.fYmax || lPos.fYmax < lNeg.fYmin ) continue;
+                if ( !IsV0PairCompatible(lNeg, lPos) ) continue;
+                lCandidates.push_back(k);
+            }
+            std::sort(lCandidates.begin(), lCandidates.end());
+        } else {
+            for (Int_t k=0; k<npos; k++) lCandidates.push_back(k);
+        }
+        
+        for (UInt_t ic=0; ic<lCandidates.size(); ic++) {
+            Int_t k=lCandidates[ic];
             Int_t pidx=pos[k];
             AliESDtrack *ptrk=event->GetTrack(pidx);
             
@@ -537,8 +649,8 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
              }
              */
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[1])
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[2]) continue;
+            if (lNegD[i]<fV0VertexerSels[1])
+                if (lPosD[k]<fV0VertexerSels[2]) continue;
             
             AliExternalTrackParam nt(*ntrk), pt(*ptrk);
             Double_t xn, xp, dca;
@@ -608,15 +720,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             
             vertex.SetDcaV0Daughters(dca);
             vertex.SetV0CosineOfPointingAngle(cpa);
-            vertex.ChangeMassHypothesis(kK0Short);
             
-            event->AddV0(&vertex);
-            
-            nvtx++;
+            //mass hypothesis set when adding to the event
+            lFound.push_back(vertex);
         }
     }
-    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %ld",nvtx);
-    return nvtx;
 }
 
 
@@ -742,6 +850,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         trk[ntr++]=i;
     }
     
+    //Pair pre-selection: transverse helix circles of the bachelor candidates
+    Bool_t lCascPairPreselection = fkCascadePairPreselection && fkDoImprovedCascadeVertexFinding;
+    std::vector<HelixCircle_t> lBachCircle( lCascPairPreselection ? ntr : 0 );
+    for (Int_t j=0; j<(Int_t)lBachCircle.size(); j++) GetHelixCircle(event->GetTrack(trk[j]), b, lBachCircle[j]);
+    
     Double_t massLambda=1.11568;
     Long_t ncasc=0;
     
@@ -749,6 +862,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
     for (i=0; i<nV0; i++) { //loop on V0s
         AliESDv0 *v=(AliESDv0*)vtcs.UncheckedAt(i);
         AliESDv0 v0(*v);
+        Double_t lV0Line[4]; GetV0Line(&v0, lV0Line);
         v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
@@ -760,6 +874,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             
             if (btrk->GetSign()>0) continue;  // bachelor's charge
             
+            //Pair pre-selection: skip if the bachelor cannot get close enough to the V0 line
+            if ( lCascPairPreselection && !IsCascadePairCompatible(lBachCircle[j], lV0Line) ) continue;
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -917,6 +1034,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
     for (i=0; i<nV0; i++) { //loop on V0s
         AliESDv0 *v=(AliESDv0*)vtcs.UncheckedAt(i);
         AliESDv0 v0(*v);
+        Double_t lV0Line[4]; GetV0Line(&v0, lV0Line);
         v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
         
@@ -928,6 +1046,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             
             if (btrk->GetSign()<0) continue;  // bachelor's charge
             
+            //Pair pre-selection: skip if the bachelor cannot get close enough to the V0 line
+            if ( lCascPairPreselection && !IsCascadePairCompatible(lBachCircle[j], lV0Line) ) continue;
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -1234,6 +1355,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         trk[ntr++]=i;
     }
     
+    //Pair pre-selection: transverse helix circles of the bachelor candidates
+    Bool_t lCascPairPreselection = fkCascadePairPreselection && fkDoImprovedCascadeVertexFinding;
+    std::vector<HelixCircle_t> lBachCircle( lCascPairPreselection ? ntr : 0 );
+    for (Int_t j=0; j<(Int_t)lBachCircle.size(); j++) GetHelixCircle(event->GetTrack(trk[j]), b, lBachCircle[j]);
+    
     Double_t massLambda=1.11568;
     Int_t ncasc=0;
     
@@ -1243,6 +1369,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         
         AliESDv0 *v=(AliESDv0*)vtcs.UncheckedAt(i);
         AliESDv0 v0(*v);
+        Double_t lV0Line[4]; GetV0Line(&v0, lV0Line);
         
         Float_t lMassAsLambda     = 0;
         Float_t lMassAsAntiLambda = 0;
@@ -1267,6 +1394,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
             AliESDtrack *btrk=event->GetTrack(bidx);
             
             //Do not check charges!
+            //Pair pre-selection: skip if the bachelor cannot get close enough to the V0 line
+            if ( lCascPairPreselection && !IsCascadePairCompatible(lBachCircle[j], lV0Line) ) continue;
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -2053,3 +2183,83 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     center[1] =	ypos + ypoint;
     return;
 }
+
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixCircle(const AliExternalTrackParam *track, Double_t b, HelixCircle_t &lCircle) const {
+    // Transverse circle of the track helix, in the parametrization used by
+    // Evaluate (equivalent to GetHelixCenter), together with the enlarged
+    // bounding box used in the V0 pair search.
+    //
+    // The (weighted) DCA between two tracks is
+    //   dca^2 = ( dxy^2/dy2 + dz^2/dz2 ) sqrt(dy2*dz2) >= dxy^2 sqrt(dz2/dy2)
+    // with dy2, dz2 the sums of the SigmaY2, SigmaZ2 of the two tracks and dxy
+    // at least the gap between the two circles. A pair can therefore only
+    // pass dca < fV0VertexerSels[3] if the circle gap is below
+    // fV0VertexerSels[3]*(dy2/dz2)^(1/4), which is bounded by the sum of the
+    // fReach of the two tracks.
+    Double_t h[6]; track->GetHelixParameters(h,b);
+    lCircle.fSigmaY2 = track->GetSigmaY2();
+    lCircle.fSigmaZ2 = track->GetSigmaZ2();
+    
+    //No pre-selection for (almost) straight tracks or broken covariance
+    lCircle.fUsable = ( TMath::Abs(h[4]) > 1e-6 && lCircle.fSigmaY2 > 0 && lCircle.fSigmaZ2 > 0 );
+    if ( !lCircle.fUsable ){
+        lCircle.fX = lCircle.fY = lCircle.fR = lCircle.fReach = 0;
+        lCircle.fXmin = lCircle.fYmin = -1e+30;
+        lCircle.fXmax = lCircle.fYmax = +1e+30;
+        return;
+    }
+    lCircle.fR = 1./TMath::Abs(h[4]);
+    lCircle.fX = h[5] - TMath::Sin(h[2])/h[4];
+    lCircle.fY = h[0] + TMath::Cos(h[2])/h[4];
+    
+    //1 mum + relative margin against rounding
+    const Double_t lMargin = 1e-4 + 1e-9*lCircle.fR;
+    lCircle.fReach = fV0VertexerSels[3]*TMath::Power(lCircle.fSigmaY2/lCircle.fSigmaZ2, 0.25) + lMargin;
+    lCircle.fXmin = lCircle.fX - lCircle.fR - lCircle.fReach;
+    lCircle.fXmax = lCircle.fX + lCircle.fR + lCircle.fReach;
+    lCircle.fYmin = lCircle.fY - lCircle.fR - lCircle.fReach;
+    lCircle.fYmax = lCircle.fY + lCircle.fR + lCircle.fReach;
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::IsV0PairCompatible(const HelixCircle_t &lNeg, const HelixCircle_t &lPos) const {
+    // kFALSE if the weighted DCA of the two tracks is certainly above
+    // fV0VertexerSels[3] (see GetHelixCircle)
+    if ( !lNeg.fUsable || !lPos.fUsable ) return kTRUE;
+    Double_t lDist = TMath::Sqrt( (lNeg.fX-lPos.fX)*(lNeg.fX-lPos.fX) + (lNeg.fY-lPos.fY)*(lNeg.fY-lPos.fY) );
+    
+    //Smallest distance between the two circles (separated or nested)
+    Double_t lGap = TMath::Max( lDist - lNeg.fR - lPos.fR, TMath::Abs(lNeg.fR - lPos.fR) - lDist );
+    if ( lGap <= 0 ) return kTRUE;
+    
+    Double_t dy2 = lNeg.fSigmaY2 + lPos.fSigmaY2;
+    Double_t dz2 = lNeg.fSigmaZ2 + lPos.fSigmaZ2;
+    Double_t lMargin = 1e-4 + 1e-9*(lNeg.fR + lPos.fR);
+    return lGap <= fV0VertexerSels[3]*TMath::Power(dy2/dz2, 0.25) + lMargin;
+}
+
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetV0Line(const AliESDv0 *v0, Double_t lLine[4]) const {
+    // Transverse projection of the V0 line: point (lLine[0],lLine[1]) and unit
+    // direction (lLine[2],lLine[3]); zero direction if the V0 has no pT
+    Double_t x,y,z,px,py,pz;
+    v0->GetXYZ(x,y,z);
+    v0->GetPxPyPz(px,py,pz);
+    Double_t lPt = TMath::Sqrt(px*px+py*py);
+    lLine[0] = x; lLine[1] = y;
+    lLine[2] = lPt > 1e-9 ? px/lPt : 0.;
+    lLine[3] = lPt > 1e-9 ? py/lPt : 0.;
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::IsCascadePairCompatible(const HelixCircle_t &lBach, const Double_t lV0Line[4]) const {
+    // kFALSE if the V0/bachelor DCA of the improved cascade vertex finding is
+    // certainly above fCascadeVertexerSels[4]. That DCA is the 3D distance of
+    // a point of the bachelor helix to the V0 line, which is at least the
+    // transverse distance of the bachelor circle to the projected V0 line.
+    if ( !lBach.fUsable || (lV0Line[2]==0 && lV0Line[3]==0) ) return kTRUE;
+    Double_t lDistCenter = TMath::Abs( (lBach.fX-lV0Line[0])*lV0Line[3] - (lBach.fY-lV0Line[1])*lV0Line[2] );
+    Double_t lMargin = 1e-4 + 1e-9*(lBach.fR + lDistCenter);
+    return lDistCenter - lBach.fR <= fCascadeVertexerSels[4] + lMargin;
+}
@@ -30,8 +30,11 @@ class TH1F;
 
 class AliESDpid;
 class AliESDEvent;
+class AliESDv0;
 class AliPhysicsSelection;
+class AliExternalTrackParam;
 
+#include <vector>
 #include "AliEventCuts.h"
 
 class AliAnalysisTaskWeakDecayVertexer : public AliAnalysisTaskSE {
@@ -74,6 +77,21 @@ public:
         //Highly experimental, use with care!
         fkIfImprovedExtraPrecisionFactor = lOpt;
     }
+    void SetV0PairPreselection( Bool_t lOpt = kTRUE ){
+        //Skip track pairs whose helix circles cannot get within the DCA cut
+        //(candidate list unchanged)
+        fkV0PairPreselection = lOpt;
+    }
+    void SetCascadePairPreselection( Bool_t lOpt = kTRUE ){
+        //Skip V0/bachelor pairs that cannot get within the DCA cut (improved
+        //cascade vertex finding only). Candidate list unchanged, but skipped
+        //pairs are not counted in fHistV0ToBachelorPropagationStatus
+        fkCascadePairPreselection = lOpt;
+    }
+    void SetV0VertexerThreads( Int_t lNThreads = 0 ){
+        //Number of threads for the V0 pair search, 0: hardware concurrency
+        fV0VertexerThreads = lNThreads;
+    }
     
 //---------------------------------------------------------------------------------------
     //Task Configuration: trigger selection
@@ -192,6 +210,24 @@ public:
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
     //---------------------------------------------------------------------------------------
+    //Pair pre-selection: transverse projection of the track helix
+    struct HelixCircle_t {
+        Double_t fX, fY, fR;         //center and radius of the circle
+        Double_t fSigmaY2, fSigmaZ2; //track uncertainties used in the DCA weighting
+        Double_t fReach;             //largest circle gap still compatible with the DCA cut
+        Double_t fXmin, fXmax, fYmin, fYmax; //bounding box enlarged by fReach
+        Bool_t fUsable;              //kFALSE: no pre-selection possible (straight track)
+    };
+    void GetHelixCircle(const AliExternalTrackParam *track, Double_t b, HelixCircle_t &lCircle) const;
+    Bool_t IsV0PairCompatible(const HelixCircle_t &lNeg, const HelixCircle_t &lPos) const;
+    void GetV0Line(const AliESDv0 *v0, Double_t lLine[4]) const;
+    Bool_t IsCascadePairCompatible(const HelixCircle_t &lBach, const Double_t lLine[4]) const;
+    void Tracks2V0verticesRange(AliESDEvent *event, Long_t lFirstNeg, Long_t lLastNeg,
+                                const std::vector<Int_t> &neg, const std::vector<Int_t> &pos,
+                                const std::vector<Double_t> &lNegD, const std::vector<Double_t> &lPosD,
+                                const std::vector<HelixCircle_t> &lNegCircle, const std::vector<HelixCircle_t> &lPosCircle,
+                                const std::vector<Int_t> &lPosByXmin, std::vector<AliESDv0> &lFound);
+    //---------------------------------------------------------------------------------------
 
 private:
     // Note : In ROOT, "//!" means "do not stream the data from Master node to Worker node" ...
@@ -215,6 +251,9 @@ private:
     Bool_t fkIfImprovedPerformInitialLinearPropag;
     Double_t fkIfImprovedExtraPrecisionFactor;
     Bool_t fkDoExtraEvSels; //if true, rely on AliEventCuts
+    Bool_t fkV0PairPreselection;      //if true, skip geometrically impossible V0 daughter pairs
+    Bool_t fkCascadePairPreselection; //if true, skip geometrically impossible V0/bachelor pairs
+    Int_t  fV0VertexerThreads;        //number of threads for the V0 pair search (0: hardware concurrency)
 
     //Objects Controlling Task Behaviour: has to be streamed!
     Bool_t    fkRunV0Vertexer;           // if true, re-run V0 vertexer
@@ -253,8 +292,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: pair pre-selection and multithreaded V0 pair search
 };
 
 #endif
@@ -0,0 +1,481 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Struct-of-arrays cut tables for the superlight output mode
+//
+// Every selection below is a literal copy of the per-configuration
+// selection of AliAnalysisTaskStrangenessVsMultiplicityRun2, including
+// the Float_t / Double_t precision of each comparison, so that the
+// output histograms are unchanged.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "TList.h"
+#include "TH3F.h"
+#include "TMath.h"
+#include "AliLog.h"
+#include "AliV0Result.h"
+#include "AliCascadeResult.h"
+#include "AliWeakResultCutTable.h"
+
+//________________________________________________________________
+AliWeakResultCutTable::AliWeakResultCutTable() :
+fNConfigurations(0),
+fHisto(),
+fHypo(),
+fPass(),
+fMask()
+{
+    // Dummy Constructor - not to be used!
+}
+//________________________________________________________________
+void AliWeakResultCutTable::Resize( Int_t lNConfigurations )
+{
+    fNConfigurations = lNConfigurations;
+    fHisto.assign(lNConfigurations, 0x0);
+    fHypo.assign(lNConfigurations, -1);
+    fPass.assign(lNConfigurations, 0);
+    fMask.assign((lNConfigurations+63)/64, 0);
+}
+//________________________________________________________________
+Int_t AliWeakResultCutTable::AddVarCosPASet( std::vector<Float_t> &lSets, const Float_t *lPar )
+{
+    //Return index of an identical parameter set if already present
+    Int_t lNSets = lSets.size()/5;
+    for(Int_t iset=0; iset<lNSets; iset++){
+        Bool_t lSame = kTRUE;
+        for(Int_t ipar=0; ipar<5; ipar++) if( lSets[5*iset+ipar] != lPar[ipar] ) lSame = kFALSE;
+        if( lSame ) return iset;
+    }
+    for(Int_t ipar=0; ipar<5; ipar++) lSets.push_back(lPar[ipar]);
+    return lNSets;
+}
+//________________________________________________________________
+void AliWeakResultCutTable::EvalVarCosPASets( const std::vector<Float_t> &lSets, Float_t lPt, std::vector<Float_t> &lValues )
+{
+    Int_t lNSets = lSets.size()/5;
+    lValues.resize(lNSets);
+    for(Int_t iset=0; iset<lNSets; iset++){
+        const Float_t *lPar = &lSets[5*iset];
+        lValues[iset] = TMath::Cos(
+                                   lPar[0]*TMath::Exp(lPar[1]*lPt) +
+                                   lPar[2]*TMath::Exp(lPar[3]*lPt) +
+                                   lPar[4]);
+    }
+}
+//________________________________________________________________
+void AliWeakResultCutTable::PackMask()
+{
+    for(UInt_t iword=0; iword<fMask.size(); iword++) fMask[iword] = 0;
+    for(Int_t lcfg=0; lcfg<fNConfigurations; lcfg++)
+        fMask[lcfg>>6] |= ((ULong64_t)fPass[lcfg]) << (lcfg&63);
+}
+//________________________________________________________________
+Int_t AliWeakResultCutTable::FillHistograms( Float_t lCentrality, Float_t lPt, const Float_t *lMassPerHypo ) const
+{
+    Int_t lNFilled = 0;
+    for(UInt_t iword=0; iword<fMask.size(); iword++){
+        ULong64_t lWord = fMask[iword];
+        for(Int_t lcfg = 64*iword; lWord; lcfg++, lWord >>= 1){
+            if( !(lWord & 1) ) continue;
+            fHisto[lcfg] -> Fill ( lCentrality, lPt, lMassPerHypo[fHypo[lcfg]] );
+            lNFilled++;
+        }
+    }
+    return lNFilled;
+}
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// V0 table
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+//________________________________________________________________
+AliV0ResultCutTable::AliV0ResultCutTable() :
+AliWeakResultCutTable()
+{
+    // Dummy Constructor - not to be used!
+}
+//________________________________________________________________
+void AliV0ResultCutTable::Build( TList *lList )
+{
+    Int_t lNConfigurations = lList ? lList->GetEntries() : 0;
+    Resize(lNConfigurations);
+    fOnTheFly.resize(lNConfigurations);
+    fIsK0Short.resize(lNConfigurations);
+    fArmenteros.resize(lNConfigurations);
+    fITSrefit.resize(lNConfigurations);
+    fMinRapidity.resize(lNConfigurations);
+    fMaxRapidity.resize(lNConfigurations);
+    fMinEtaTracks.resize(lNConfigurations);
+    fMaxEtaTracks.resize(lNConfigurations);
+    fV0Radius.resize(lNConfigurations);
+    fDCANegToPV.resize(lNConfigurations);
+    fDCAPosToPV.resize(lNConfigurations);
+    fDCAV0Daughters.resize(lNConfigurations);
+    fV0CosPA.resize(lNConfigurations);
+    fVarV0CosPASet.resize(lNConfigurations);
+    fProperLifetime.resize(lNConfigurations);
+    fLeastNbrCrossedRows.resize(lNConfigurations);
+    fLeastRatioCrossedRows.resize(lNConfigurations);
+    fMinBaryonMomentum.resize(lNConfigurations);
+    fTPCdEdx.resize(lNConfigurations);
+    fArmenterosParameter.resize(lNConfigurations);
+    fMaxChi2PerCluster.resize(lNConfigurations);
+    fMinTrackLength.resize(lNConfigurations);
+    fVarV0CosPAPar.clear();
+
+    for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+        AliV0Result *lV0Result = (AliV0Result*) lList->At(lcfg);
+        fHisto[lcfg] = lV0Result->GetHistogram();
+        Int_t lHypo = lV0Result->GetMassHypothesis();
+        if( lHypo < AliV0Result::kK0Short || lHypo > AliV0Result::kAntiLambda ){
+            AliWarningGeneral("AliV0ResultCutTable", Form("Unknown mass hypothesis in configuration %s, will not be filled", lV0Result->GetName()));
+            lHypo = -1;
+        }
+        fHypo[lcfg]                  = lHypo;
+        fOnTheFly[lcfg]              = lV0Result->GetUseOnTheFly();
+        fIsK0Short[lcfg]             = ( lHypo == AliV0Result::kK0Short );
+        fArmenteros[lcfg]            = ( lV0Result->GetCutArmenteros() && lHypo == AliV0Result::kK0Short );
+        fITSrefit[lcfg]              = lV0Result->GetCutUseITSRefitTracks();
+        fMinRapidity[lcfg]           = lV0Result->GetCutMinRapidity();
+        fMaxRapidity[lcfg]           = lV0Result->GetCutMaxRapidity();
+        fMinEtaTracks[lcfg]          = lV0Result->GetCutMinEtaTracks();
+        fMaxEtaTracks[lcfg]          = lV0Result->GetCutMaxEtaTracks();
+        fV0Radius[lcfg]              = lV0Result->GetCutV0Radius();
+        fDCANegToPV[lcfg]            = lV0Result->GetCutDCANegToPV();
+        fDCAPosToPV[lcfg]            = lV0Result->GetCutDCAPosToPV();
+        fDCAV0Daughters[lcfg]        = lV0Result->GetCutDCAV0Daughters();
+        fV0CosPA[lcfg]               = lV0Result->GetCutV0CosPA();
+        fProperLifetime[lcfg]        = lV0Result->GetCutProperLifetime();
+        fLeastNbrCrossedRows[lcfg]   = lV0Result->GetCutLeastNumberOfCrossedRows();
+        fLeastRatioCrossedRows[lcfg] = lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable();
+        fMinBaryonMomentum[lcfg]     = lV0Result->GetCutMinBaryonMomentum();
+        fTPCdEdx[lcfg]               = lV0Result->GetCutTPCdEdx();
+        fArmenterosParameter[lcfg]   = lV0Result->GetCutArmenterosParameter();
+        fMaxChi2PerCluster[lcfg]     = lV0Result->GetCutMaxChi2PerCluster();
+        fMinTrackLength[lcfg]        = lV0Result->GetCutMinTrackLength();
+
+        //Variable V0 CosPA: configurations sharing parameters share the evaluation
+        fVarV0CosPASet[lcfg] = -1;
+        if( lV0Result->GetCutUseVarV0CosPA() ){
+            Float_t lVarV0CosPApar[5];
+            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
+            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
+            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
+            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
+            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
+            fVarV0CosPASet[lcfg] = AddVarCosPASet(fVarV0CosPAPar, lVarV0CosPApar);
+        }
+    }
+}
+//________________________________________________________________
+Int_t AliV0ResultCutTable::Select( const Candidate_t &c )
+{
+    EvalVarCosPASets(fVarV0CosPAPar, c.fPt, fVarV0CosPAValue);
+
+    //Hypothesis-dependent quantities: K0Short, Lambda, AntiLambda
+    const Float_t lRap[3]            = { c.fRapK0Short, c.fRapLambda, c.fRapLambda };
+    const Float_t lPDGMass[3]        = { 0.497, 1.115683, 1.115683 };
+    const Float_t lNegdEdx[3]        = { c.fNSigmasNegPion, c.fNSigmasNegPion, c.fNSigmasNegProton };
+    const Float_t lPosdEdx[3]        = { c.fNSigmasPosPion, c.fNSigmasPosProton, c.fNSigmasPosPion };
+    const Float_t lBaryonMomentum[3] = { -0.5, c.fPosInnerP, c.fNegInnerP };
+    Float_t lLifetime[3];
+    for(Int_t ih=0; ih<3; ih++) lLifetime[ih] = c.fDistOverTotMom*lPDGMass[ih];
+
+    Int_t lNPassed = 0;
+    for(Int_t lcfg=0; lcfg<fNConfigurations; lcfg++){
+        const Int_t h = fHypo[lcfg];
+        if( h < 0 ){ fPass[lcfg] = 0; continue; }
+
+        Float_t lV0CosPACut = fV0CosPA[lcfg];
+        const Int_t lSet = fVarV0CosPASet[lcfg];
+        //Only use if tighter than the non-variable cut
+        if( lSet >= 0 && fVarV0CosPAValue[lSet] > lV0CosPACut ) lV0CosPACut = fVarV0CosPAValue[lSet];
+
+        const Bool_t lPass =
+        //Check 1: Offline Vertexer
+        ( c.fOnFlyStatus == fOnTheFly[lcfg] ) &
+
+        //Check 2: Basic Acceptance cuts
+        ( fMinEtaTracks[lcfg] < c.fNegEta ) & ( c.fNegEta < fMaxEtaTracks[lcfg] ) &
+        ( fMinEtaTracks[lcfg] < c.fPosEta ) & ( c.fPosEta < fMaxEtaTracks[lcfg] ) &
+        ( lRap[h] > fMinRapidity[lcfg] ) &
+        ( lRap[h] < fMaxRapidity[lcfg] ) &
+
+        //Check 3: Topological Variables
+        ( c.fV0Radius > fV0Radius[lcfg] ) &
+        ( c.fDcaNegToPV > fDCANegToPV[lcfg] ) &
+        ( c.fDcaPosToPV > fDCAPosToPV[lcfg] ) &
+        ( c.fDcaV0Daughters < fDCAV0Daughters[lcfg] ) &
+        ( c.fV0CosPA > lV0CosPACut ) &
+        ( lLifetime[h] < fProperLifetime[lcfg] ) &
+        ( c.fLeastNbrCrossedRows > fLeastNbrCrossedRows[lcfg] ) &
+        ( c.fLeastRatioCrossedRowsOverFindable > fLeastRatioCrossedRows[lcfg] ) &
+
+        //Check 4: Minimum momentum of baryon daughter
+        ( fIsK0Short[lcfg] | ( lBaryonMomentum[h] > fMinBaryonMomentum[lcfg] ) ) &
+
+        //Check 5: TPC dEdx selections
+        ( TMath::Abs(lNegdEdx[h]) < fTPCdEdx[lcfg] ) &
+        ( TMath::Abs(lPosdEdx[h]) < fTPCdEdx[lcfg] ) &
+
+        //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+        ( !fArmenteros[lcfg] | ( c.fPtArmV0 > fArmenterosParameter[lcfg]*TMath::Abs(c.fAlphaV0) ) ) &
+
+        //Check 7: kITSrefit track selection if requested
+        ( c.fITSrefit | !fITSrefit[lcfg] ) &
+
+        //Check 8: Max Chi2/Clusters if not absurd
+        ( ( fMaxChi2PerCluster[lcfg] > 1e+3 ) | ( c.fMaxChi2PerCluster < fMaxChi2PerCluster[lcfg] ) ) &
+
+        //Check 9: Min Track Length if positive
+        ( ( fMinTrackLength[lcfg] < 0 ) | ( c.fMinTrackLength > fMinTrackLength[lcfg] ) );
+
+        fPass[lcfg] = lPass;
+        lNPassed += lPass;
+    }
+    PackMask();
+    return lNPassed;
+}
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Cascade table
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+//________________________________________________________________
+AliCascadeResultCutTable::AliCascadeResultCutTable() :
+AliWeakResultCutTable()
+{
+    // Dummy Constructor - not to be used!
+}
+//________________________________________________________________
+void AliCascadeResultCutTable::Build( TList *lList )
+{
+    Int_t lNConfigurations = lList ? lList->GetEntries() : 0;
+    Resize(lNConfigurations);
+    fCharge.resize(lNConfigurations);
+    fIsOmega.resize(lNConfigurations);
+    fITSrefit.resize(lNConfigurations);
+    fUse276TeVV0CosPA.resize(lNConfigurations);
+    fMinRapidity.resize(lNConfigurations);
+    fMaxRapidity.resize(lNConfigurations);
+    fMinEtaTracks.resize(lNConfigurations);
+    fMaxEtaTracks.resize(lNConfigurations);
+    fDCANegToPV.resize(lNConfigurations);
+    fDCAPosToPV.resize(lNConfigurations);
+    fDCAV0Daughters.resize(lNConfigurations);
+    fV0CosPA.resize(lNConfigurations);
+    fVarV0CosPASet.resize(lNConfigurations);
+    fV0Radius.resize(lNConfigurations);
+    fDCAV0ToPV.resize(lNConfigurations);
+    fV0Mass.resize(lNConfigurations);
+    fV0MassSigma.resize(lNConfigurations);
+    fDCABachToPV.resize(lNConfigurations);
+    fDCACascDaughters.resize(lNConfigurations);
+    fCascCosPA.resize(lNConfigurations);
+    fVarCascCosPASet.resize(lNConfigurations);
+    fCascRadius.resize(lNConfigurations);
+    fProperLifetime.resize(lNConfigurations);
+    fLeastNbrClusters.resize(lNConfigurations);
+    fTPCdEdx.resize(lNConfigurations);
+    fXiRejection.resize(lNConfigurations);
+    fDCABachToBaryon.resize(lNConfigurations);
+    fBBCosPA.resize(lNConfigurations);
+    fVarBBCosPASet.resize(lNConfigurations);
+    fMinV0Lifetime.resize(lNConfigurations);
+    fMaxV0Lifetime.resize(lNConfigurations);
+    fMaxChi2PerCluster.resize(lNConfigurations);
+    fMinTrackLength.resize(lNConfigurations);
+    fVarV0CosPAPar.clear();
+    fVarCascCosPAPar.clear();
+    fVarBBCosPAPar.clear();
+
+    for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) lList->At(lcfg);
+        fHisto[lcfg] = lCascadeResult->GetHistogram();
+        Int_t lHypo = lCascadeResult->GetMassHypothesis();
+        if( lHypo < AliCascadeResult::kXiMinus || lHypo > AliCascadeResult::kOmegaPlus ){
+            AliWarningGeneral("AliCascadeResultCutTable", Form("Unknown mass hypothesis in configuration %s, will not be filled", lCascadeResult->GetName()));
+            lHypo = -1;
+        }
+        fHypo[lcfg] = lHypo;
+
+        //Expected charge, bachelor charge swap included
+        Int_t lCharge = ( lHypo == AliCascadeResult::kXiPlus || lHypo == AliCascadeResult::kOmegaPlus ) ? +1 : -1;
+        if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+        fCharge[lcfg]           = lCharge;
+        fIsOmega[lcfg]          = ( lHypo == AliCascadeResult::kOmegaMinus || lHypo == AliCascadeResult::kOmegaPlus );
+        fITSrefit[lcfg]         = lCascadeResult->GetCutUseITSRefitTracks();
+        fUse276TeVV0CosPA[lcfg] = lCascadeResult->GetCutUse276TeVV0CosPA();
+        fMinRapidity[lcfg]      = lCascadeResult->GetCutMinRapidity();
+        fMaxRapidity[lcfg]      = lCascadeResult->GetCutMaxRapidity();
+        fMinEtaTracks[lcfg]     = lCascadeResult->GetCutMinEtaTracks();
+        fMaxEtaTracks[lcfg]     = lCascadeResult->GetCutMaxEtaTracks();
+        fDCANegToPV[lcfg]       = lCascadeResult->GetCutDCANegToPV();
+        fDCAPosToPV[lcfg]       = lCascadeResult->GetCutDCAPosToPV();
+        fDCAV0Daughters[lcfg]   = lCascadeResult->GetCutDCAV0Daughters();
+        fV0CosPA[lcfg]          = lCascadeResult->GetCutV0CosPA();
+        fV0Radius[lcfg]         = lCascadeResult->GetCutV0Radius();
+        fDCAV0ToPV[lcfg]        = lCascadeResult->GetCutDCAV0ToPV();
+        fV0Mass[lcfg]           = lCascadeResult->GetCutV0Mass();
+        fV0MassSigma[lcfg]      = lCascadeResult->GetCutV0MassSigma();
+        fDCABachToPV[lcfg]      = lCascadeResult->GetCutDCABachToPV();
+        fDCACascDaughters[lcfg] = lCascadeResult->GetCutDCACascDaughters();
+        fCascCosPA[lcfg]        = lCascadeResult->GetCutCascCosPA();
+        fCascRadius[lcfg]       = lCascadeResult->GetCutCascRadius();
+        fProperLifetime[lcfg]   = lCascadeResult->GetCutProperLifetime();
+        fLeastNbrClusters[lcfg] = lCascadeResult->GetCutLeastNumberOfClusters();
+        fTPCdEdx[lcfg]          = lCascadeResult->GetCutTPCdEdx();
+        fXiRejection[lcfg]      = lCascadeResult->GetCutXiRejection();
+        fDCABachToBaryon[lcfg]  = lCascadeResult->GetCutDCABachToBaryon();
+        fBBCosPA[lcfg]          = lCascadeResult->GetCutBachBaryonCosPA();
+        fMinV0Lifetime[lcfg]    = lCascadeResult->GetCutMinV0Lifetime();
+        fMaxV0Lifetime[lcfg]    = lCascadeResult->GetCutMaxV0Lifetime();
+        fMaxChi2PerCluster[lcfg]= lCascadeResult->GetCutMaxChi2PerCluster();
+        fMinTrackLength[lcfg]   = lCascadeResult->GetCutMinTrackLength();
+
+        //Variable CosPA cuts: configurations sharing parameters share the evaluation
+        Float_t lPar[5];
+        fVarCascCosPASet[lcfg] = -1;
+        if( lCascadeResult->GetCutUseVarCascCosPA() ){
+            lPar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
+            lPar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
+            lPar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
+            lPar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
+            lPar[4] = lCascadeResult->GetCutVarCascCosPAConst();
+            fVarCascCosPASet[lcfg] = AddVarCosPASet(fVarCascCosPAPar, lPar);
+        }
+        fVarV0CosPASet[lcfg] = -1;
+        if( lCascadeResult->GetCutUseVarV0CosPA() ){
+            lPar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
+            lPar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
+            lPar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
+            lPar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
+            lPar[4] = lCascadeResult->GetCutVarV0CosPAConst();
+            fVarV0CosPASet[lcfg] = AddVarCosPASet(fVarV0CosPAPar, lPar);
+        }
+        fVarBBCosPASet[lcfg] = -1;
+        if( lCascadeResult->GetCutUseVarBBCosPA() ){
+            lPar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
+            lPar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
+            lPar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
+            lPar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
+            lPar[4] = lCascadeResult->GetCutVarBBCosPAConst();
+            fVarBBCosPASet[lcfg] = AddVarCosPASet(fVarBBCosPAPar, lPar);
+        }
+    }
+}
+//________________________________________________________________
+void AliCascadeResultCutTable::GetMassPerHypo( const Candidate_t &c, Float_t *lMass )
+{
+    lMass[AliCascadeResult::kXiMinus]    = c.fMassAsXi;
+    lMass[AliCascadeResult::kXiPlus]     = c.fMassAsXi;
+    lMass[AliCascadeResult::kOmegaMinus] = c.fMassAsOmega;
+    lMass[AliCascadeResult::kOmegaPlus]  = c.fMassAsOmega;
+}
+//________________________________________________________________
+Int_t AliCascadeResultCutTable::Select( const Candidate_t &c )
+{
+    EvalVarCosPASets(fVarCascCosPAPar, c.fPt, fVarCascCosPAValue);
+    EvalVarCosPASets(fVarV0CosPAPar,   c.fPt, fVarV0CosPAValue);
+    EvalVarCosPASets(fVarBBCosPAPar,   c.fPt, fVarBBCosPAValue);
+
+    //Hypothesis-dependent quantities: XiMinus, XiPlus, OmegaMinus, OmegaPlus
+    const Float_t lV0Mass[4]   = { c.fV0MassLambda, c.fV0MassAntiLambda, c.fV0MassLambda, c.fV0MassAntiLambda };
+    const Float_t lRap[4]      = { c.fRapXi, c.fRapXi, c.fRapOmega, c.fRapOmega };
+    const Float_t lPDGMass[4]  = { 1.32171, 1.32171, 1.67245, 1.67245 };
+    const Float_t lNegdEdx[4]  = { c.fNegNSigmaPion, c.fNegNSigmaProton, c.fNegNSigmaPion, c.fNegNSigmaProton };
+    const Float_t lPosdEdx[4]  = { c.fPosNSigmaProton, c.fPosNSigmaPion, c.fPosNSigmaProton, c.fPosNSigmaPion };
+    const Float_t lBachdEdx[4] = { c.fBachNSigmaPion, c.fBachNSigmaPion, c.fBachNSigmaKaon, c.fBachNSigmaKaon };
+    Double_t lV0MassDev[4];
+    Float_t lV0MassNSigma[4], lLifetime[4];
+    for(Int_t ih=0; ih<4; ih++){
+        lV0MassDev[ih]    = TMath::Abs(lV0Mass[ih]-1.116);
+        lV0MassNSigma[ih] = TMath::Abs( (lV0Mass[ih]-c.fExpV0Mass) / c.fExpV0Sigma );
+        lLifetime[ih]     = c.fDistOverTotMom*lPDGMass[ih];
+    }
+    const Double_t lXiMassDev = TMath::Abs( c.fMassAsXi - 1.32171 );
+
+    Int_t lNPassed = 0;
+    for(Int_t lcfg=0; lcfg<fNConfigurations; lcfg++){
+        const Int_t h = fHypo[lcfg];
+        if( h < 0 ){ fPass[lcfg] = 0; continue; }
+
+        //Variable CosPA cuts, only used if tighter than the non-variable cut
+        //(for the BB CosPA: looser, WARNING: BEWARE INVERSE LOGIC)
+        Float_t lCascCosPACut = fCascCosPA[lcfg];
+        Float_t lV0CosPACut   = fV0CosPA[lcfg];
+        Float_t lBBCosPACut   = fBBCosPA[lcfg];
+        Int_t lSet = fVarCascCosPASet[lcfg];
+        if( lSet >= 0 && fVarCascCosPAValue[lSet] > lCascCosPACut ) lCascCosPACut = fVarCascCosPAValue[lSet];
+        lSet = fVarV0CosPASet[lcfg];
+        if( lSet >= 0 && fVarV0CosPAValue[lSet] > lV0CosPACut ) lV0CosPACut = fVarV0CosPAValue[lSet];
+        lSet = fVarBBCosPASet[lcfg];
+        if( lSet >= 0 && fVarBBCosPAValue[lSet] > lBBCosPACut ) lBBCosPACut = fVarBBCosPAValue[lSet];
+
+        const Bool_t lPass =
+        //Check 1: Charge consistent with expectations
+        ( c.fCharge == fCharge[lcfg] ) &
+
+        //Check 2: Basic Acceptance cuts
+        ( fMinEtaTracks[lcfg] < c.fPosEta ) & ( c.fPosEta < fMaxEtaTracks[lcfg] ) &
+        ( fMinEtaTracks[lcfg] < c.fNegEta ) & ( c.fNegEta < fMaxEtaTracks[lcfg] ) &
+        ( fMinEtaTracks[lcfg] < c.fBachEta ) & ( c.fBachEta < fMaxEtaTracks[lcfg] ) &
+        ( lRap[h] > fMinRapidity[lcfg] ) &
+        ( lRap[h] < fMaxRapidity[lcfg] ) &
+
+        //Check 3: Topological Variables
+        // - V0 Selections
+        ( c.fDCANegToPV > fDCANegToPV[lcfg] ) &
+        ( c.fDCAPosToPV > fDCAPosToPV[lcfg] ) &
+        ( c.fDCAV0Daughters < fDCAV0Daughters[lcfg] ) &
+        ( c.fV0CosPA > lV0CosPACut ) &
+        ( c.fV0Radius > fV0Radius[lcfg] ) &
+        // - Cascade Selections
+        ( c.fDCAV0ToPV > fDCAV0ToPV[lcfg] ) &
+        ( lV0MassDev[h] < fV0Mass[lcfg] ) &
+        ( c.fDCABachToPV > fDCABachToPV[lcfg] ) &
+        ( c.fDCACascDaughters < fDCACascDaughters[lcfg] ) &
+        ( c.fCascCosPA > lCascCosPACut ) &
+        ( c.fCascRadius > fCascRadius[lcfg] ) &
+
+        // - Implementation of a parametric V0 Mass cut if requested
+        ( ( fV0MassSigma[lcfg] > 50 ) | ( lV0MassNSigma[h] < fV0MassSigma[lcfg] ) ) &
+
+        // - Miscellaneous
+        ( lLifetime[h] < fProperLifetime[lcfg] ) &
+        ( c.fLeastNbrClusters > fLeastNbrClusters[lcfg] ) &
+
+        //Check 4: TPC dEdx selections
+        ( TMath::Abs(lNegdEdx[h] ) < fTPCdEdx[lcfg] ) &
+        ( TMath::Abs(lPosdEdx[h] ) < fTPCdEdx[lcfg] ) &
+        ( TMath::Abs(lBachdEdx[h]) < fTPCdEdx[lcfg] ) &
+
+        //Check 5: Xi rejection for Omega analysis
+        ( !fIsOmega[lcfg] | ( lXiMassDev > fXiRejection[lcfg] ) ) &
+
+        //Check 6: Experimental DCA Bachelor to Baryon cut
+        ( c.fDCABachToBaryon > fDCABachToBaryon[lcfg] ) &
+
+        //Check 7: Experimental Bach Baryon CosPA
+        ( c.fWrongCosPA < lBBCosPACut ) &
+
+        //Check 8: Min/Max V0 Lifetime cut
+        ( c.fV0Lifetime > fMinV0Lifetime[lcfg] ) &
+        ( ( c.fV0Lifetime < fMaxV0Lifetime[lcfg] ) | ( fMaxV0Lifetime[lcfg] > 1e+3 ) ) &
+
+        //Check 9: kITSrefit track selection if requested
+        ( c.fITSrefit | !fITSrefit[lcfg] ) &
+
+        //Check 10: Max Chi2/Clusters if not absurd
+        ( ( fMaxChi2PerCluster[lcfg] > 1e+3 ) | ( c.fMaxChi2PerCluster < fMaxChi2PerCluster[lcfg] ) ) &
+
+        //Check 11: Min Track Length if positive
+        ( ( fMinTrackLength[lcfg] < 0 ) | ( c.fMinTrackLength > fMinTrackLength[lcfg] ) ) &
+
+        //Check 12: Check if special V0 CosPA cut used
+        ( !fUse276TeVV0CosPA[lcfg] | ( c.fV0CosPA > c.f276TeVV0CosPA ) );
+
+        fPass[lcfg] = lPass;
+        lNPassed += lPass;
+    }
+    PackMask();
+    return lNPassed;
+}
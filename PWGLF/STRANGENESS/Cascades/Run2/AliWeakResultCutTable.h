@@ -0,0 +1,227 @@
+#ifndef AliWeakResultCutTable_H
+#define AliWeakResultCutTable_H
+#include <vector>
+#include <Rtypes.h>
+
+class TList;
+class TH3F;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Struct-of-arrays cut tables for the superlight output mode
+//
+// The AliV0Result / AliCascadeResult configurations of a TList are
+// copied once into one array per cut variable. A candidate is then
+// tested against all the configurations in a single loop without
+// virtual calls, the pt-dependent (variable CosPA) cuts being computed
+// once per distinct parameter set. The result is a bitmask of the
+// passing configurations, used to fill their TH3F histograms.
+//
+// Usage (per candidate):
+//   AliV0ResultCutTable::Candidate_t c; ... fill from tree variables
+//   lTable.Select(c);
+//   lTable.FillHistograms(fCentrality, c.fPt, c.fInvMass);
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliWeakResultCutTable {
+
+public:
+    AliWeakResultCutTable();
+    virtual ~AliWeakResultCutTable() {}
+
+    Int_t GetNConfigurations() const { return fNConfigurations; }
+    const std::vector<ULong64_t>& GetMask() const { return fMask; }
+    Bool_t GetPassed( Int_t lcfg ) const { return (fMask[lcfg>>6] >> (lcfg&63)) & 1; }
+
+    //Fill histograms of passing configurations with the mass of their hypothesis
+    Int_t FillHistograms( Float_t lCentrality, Float_t lPt, const Float_t *lMassPerHypo ) const;
+
+protected:
+    void Resize( Int_t lNConfigurations );
+    Int_t AddVarCosPASet( std::vector<Float_t> &lSets, const Float_t *lPar );
+    static void EvalVarCosPASets( const std::vector<Float_t> &lSets, Float_t lPt, std::vector<Float_t> &lValues );
+    void PackMask();
+
+    Int_t fNConfigurations;        //number of configurations in the table
+    std::vector<TH3F*> fHisto;     //output histogram of each configuration
+    std::vector<Int_t> fHypo;      //mass hypothesis of each configuration
+    std::vector<UChar_t> fPass;    //selection result of the current candidate
+    std::vector<ULong64_t> fMask;  //bitmask of passing configurations
+
+private:
+    AliWeakResultCutTable(const AliWeakResultCutTable&);            // not implemented
+    AliWeakResultCutTable& operator=(const AliWeakResultCutTable&); // not implemented
+};
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliV0ResultCutTable : public AliWeakResultCutTable {
+
+public:
+    //Candidate properties needed by the AliV0Result selections
+    struct Candidate_t {
+        Int_t fOnFlyStatus;
+        Float_t fPt;
+        Float_t fInvMass[3];       //K0Short, Lambda, AntiLambda
+        Float_t fRapK0Short;
+        Float_t fRapLambda;
+        Float_t fNegEta;
+        Float_t fPosEta;
+        Float_t fV0Radius;
+        Float_t fDcaNegToPV;
+        Float_t fDcaPosToPV;
+        Float_t fDcaV0Daughters;
+        Float_t fV0CosPA;
+        Float_t fDistOverTotMom;
+        Int_t fLeastNbrCrossedRows;
+        Float_t fLeastRatioCrossedRowsOverFindable;
+        Float_t fNSigmasNegPion;
+        Float_t fNSigmasNegProton;
+        Float_t fNSigmasPosPion;
+        Float_t fNSigmasPosProton;
+        Float_t fNegInnerP;
+        Float_t fPosInnerP;
+        Float_t fPtArmV0;
+        Float_t fAlphaV0;
+        Bool_t fITSrefit;          //both daughters ITS refit
+        Float_t fMaxChi2PerCluster;
+        Float_t fMinTrackLength;
+    };
+
+    AliV0ResultCutTable();
+    virtual ~AliV0ResultCutTable() {}
+
+    void Build( TList *lList );
+    Int_t Select( const Candidate_t &c );
+
+private:
+    AliV0ResultCutTable(const AliV0ResultCutTable&);            // not implemented
+    AliV0ResultCutTable& operator=(const AliV0ResultCutTable&); // not implemented
+
+    std::vector<UChar_t> fOnTheFly;
+    std::vector<UChar_t> fIsK0Short;
+    std::vector<UChar_t> fArmenteros;        //AP cut active (K0Short only)
+    std::vector<UChar_t> fITSrefit;
+    std::vector<Double_t> fMinRapidity;
+    std::vector<Double_t> fMaxRapidity;
+    std::vector<Double_t> fMinEtaTracks;
+    std::vector<Double_t> fMaxEtaTracks;
+    std::vector<Double_t> fV0Radius;
+    std::vector<Double_t> fDCANegToPV;
+    std::vector<Double_t> fDCAPosToPV;
+    std::vector<Double_t> fDCAV0Daughters;
+    std::vector<Float_t> fV0CosPA;
+    std::vector<Int_t> fVarV0CosPASet;       //-1 if no variable cut
+    std::vector<Double_t> fProperLifetime;
+    std::vector<Double_t> fLeastNbrCrossedRows;
+    std::vector<Double_t> fLeastRatioCrossedRows;
+    std::vector<Double_t> fMinBaryonMomentum;
+    std::vector<Double_t> fTPCdEdx;
+    std::vector<Double_t> fArmenterosParameter;
+    std::vector<Double_t> fMaxChi2PerCluster;
+    std::vector<Double_t> fMinTrackLength;
+
+    std::vector<Float_t> fVarV0CosPAPar;     //distinct parameter sets, 5 per set
+    std::vector<Float_t> fVarV0CosPAValue;   //value for the current candidate
+};
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliCascadeResultCutTable : public AliWeakResultCutTable {
+
+public:
+    //Candidate properties needed by the AliCascadeResult selections
+    struct Candidate_t {
+        Int_t fCharge;
+        Float_t fPt;
+        Float_t fMassAsXi;
+        Float_t fMassAsOmega;
+        Float_t fV0MassLambda;
+        Float_t fV0MassAntiLambda;
+        Float_t fRapXi;
+        Float_t fRapOmega;
+        Float_t fNegEta;
+        Float_t fPosEta;
+        Float_t fBachEta;
+        Float_t fDCANegToPV;
+        Float_t fDCAPosToPV;
+        Float_t fDCAV0Daughters;
+        Float_t fV0CosPA;
+        Float_t fV0Radius;
+        Float_t fDCAV0ToPV;
+        Float_t fDCABachToPV;
+        Float_t fDCACascDaughters;
+        Float_t fCascCosPA;
+        Float_t fCascRadius;
+        Float_t fExpV0Mass;        //parametric V0 mass mean
+        Float_t fExpV0Sigma;       //parametric V0 mass width
+        Float_t fDistOverTotMom;
+        Int_t fLeastNbrClusters;
+        Float_t fNegNSigmaPion;
+        Float_t fNegNSigmaProton;
+        Float_t fPosNSigmaPion;
+        Float_t fPosNSigmaProton;
+        Float_t fBachNSigmaPion;
+        Float_t fBachNSigmaKaon;
+        Float_t fDCABachToBaryon;
+        Float_t fWrongCosPA;
+        Float_t fV0Lifetime;
+        Bool_t fITSrefit;          //all three daughters ITS refit
+        Float_t fMaxChi2PerCluster;
+        Float_t fMinTrackLength;
+        Float_t f276TeVV0CosPA;    //2.76 TeV-like momentum dependent V0 CosPA cut
+    };
+
+    AliCascadeResultCutTable();
+    virtual ~AliCascadeResultCutTable() {}
+
+    void Build( TList *lList );
+    Int_t Select( const Candidate_t &c );
+    //Invariant mass per mass hypothesis (XiMinus, XiPlus, OmegaMinus, OmegaPlus)
+    static void GetMassPerHypo( const Candidate_t &c, Float_t *lMass );
+
+private:
+    AliCascadeResultCutTable(const AliCascadeResultCutTable&);            // not implemented
+    AliCascadeResultCutTable& operator=(const AliCascadeResultCutTable&); // not implemented
+
+    std::vector<Int_t> fCharge;              //expected charge (bachelor swap included)
+    std::vector<UChar_t> fIsOmega;
+    std::vector<UChar_t> fITSrefit;
+    std::vector<UChar_t> fUse276TeVV0CosPA;
+    std::vector<Double_t> fMinRapidity;
+    std::vector<Double_t> fMaxRapidity;
+    std::vector<Double_t> fMinEtaTracks;
+    std::vector<Double_t> fMaxEtaTracks;
+    std::vector<Double_t> fDCANegToPV;
+    std::vector<Double_t> fDCAPosToPV;
+    std::vector<Double_t> fDCAV0Daughters;
+    std::vector<Float_t> fV0CosPA;
+    std::vector<Int_t> fVarV0CosPASet;       //-1 if no variable cut
+    std::vector<Double_t> fV0Radius;
+    std::vector<Double_t> fDCAV0ToPV;
+    std::vector<Double_t> fV0Mass;
+    std::vector<Double_t> fV0MassSigma;
+    std::vector<Double_t> fDCABachToPV;
+    std::vector<Double_t> fDCACascDaughters;
+    std::vector<Float_t> fCascCosPA;
+    std::vector<Int_t> fVarCascCosPASet;     //-1 if no variable cut
+    std::vector<Double_t> fCascRadius;
+    std::vector<Double_t> fProperLifetime;
+    std::vector<Double_t> fLeastNbrClusters;
+    std::vector<Double_t> fTPCdEdx;
+    std::vector<Double_t> fXiRejection;
+    std::vector<Double_t> fDCABachToBaryon;
+    std::vector<Float_t> fBBCosPA;
+    std::vector<Int_t> fVarBBCosPASet;       //-1 if no variable cut
+    std::vector<Double_t> fMinV0Lifetime;
+    std::vector<Double_t> fMaxV0Lifetime;
+    std::vector<Double_t> fMaxChi2PerCluster;
+    std::vector<Double_t> fMinTrackLength;
+
+    std::vector<Float_t> fVarV0CosPAPar;     //distinct parameter sets, 5 per set
+    std::vector<Float_t> fVarV0CosPAValue;   //value for the current candidate
+    std::vector<Float_t> fVarCascCosPAPar;
+    std::vector<Float_t> fVarCascCosPAValue;
+    std::vector<Float_t> fVarBBCosPAPar;
+    std::vector<Float_t> fVarBBCosPAValue;
+};
+#endif
@@ -79,6 +79,7 @@
 #include "AliMCEventHandler.h"
 #include "AliFilteredTreeEventCuts.h"
 #include "AliFilteredTreeAcceptanceCuts.h"
+#include "AliFilteredTreeColumnWriter.h"
 
 #include "AliAnalysisTaskFilteredTree.h"
 #include "AliKFParticle.h"
@@ -134,8 +135,13 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fPtResCentPtTPCITS(0)
   , fCurrentFileName("")
   , fDummyTrack(0)
+  , fUseColumnWriter(kFALSE)
+  , fColumnCompression(101)
+  , fColumnBasketSize(256000)
+  , fColumnHasMC(kFALSE)
 {
   // Constructor
+  for (Int_t i=0; i<kNColumnTrees; i++) fColumnWriter[i]=0;
 
   // Define input and output slots here
   DefineOutput(1, TTree::Class());
@@ -157,6 +163,7 @@ AliAnalysisTaskFilteredTree::~AliAnalysisTaskFilteredTree()
   delete fFilteredTreeAcceptanceCuts;
   delete fFilteredTreeRecAcceptanceCuts;
   delete fEsdTrackCuts;
+  for (Int_t i=0; i<kNColumnTrees; i++) delete fColumnWriter[i];
 }
 
 //____________________________________________________________________________
@@ -200,12 +207,22 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
 
   //
   // Create trees
-  fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
-  fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
-  fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
-  fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
-  fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
-  fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  if (fUseColumnWriter) {
+    CreateColumnWriters(AliAnalysisManager::GetAnalysisManager()->GetMCtruthEventHandler()!=NULL);
+    fV0Tree = fColumnWriter[kColumnV0s]->GetTree();
+    fHighPtTree = fColumnWriter[kColumnHighPt]->GetTree();
+    fdEdxTree = fColumnWriter[kColumndEdx]->GetTree();
+    fLaserTree = fColumnWriter[kColumnLaser]->GetTree();
+    fMCEffTree = fColumnWriter[kColumnMCEff]->GetTree();
+    fCosmicPairsTree = fColumnWriter[kColumnCosmicPairs]->GetTree();
+  } else {
+    fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
+    fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
+    fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
+    fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
+    fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
+    fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  }
 
   if (!fDummyTrack)  {
     fDummyTrack=new AliESDtrack();
@@ -491,7 +508,7 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
 	  friendTrackStore1 = 0;
 	}
       }
-      if (fFriendDownscaling<=0){
+      if (fFriendDownscaling<=0 && !fColumnWriter[kColumnCosmicPairs]){
 	if (((*fTreeSRedirector)<<"CosmicPairs").GetTree()){
 	  TTree * tree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
 	  if (tree){
@@ -508,6 +525,17 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
 	}
       }
       if(!fFillTree) return;
+      if (fColumnWriter[kColumnCosmicPairs]) {
+        AliFilteredTreeColumnWriter *writer=fColumnWriter[kColumnCosmicPairs];
+        PushEventColumns(writer, gid, runNumber, timeStamp, eventNumber, magField);
+        writer->PushULong64(triggerMask).Push(ntracksSPD).Push(ntracksTPC);
+        PushVertexColumns(writer, vertexSPD);
+        PushVertexColumns(writer, vertexTPC);
+        PushESDTrackColumns(writer, track0);
+        PushESDTrackColumns(writer, track1);
+        writer->Fill();
+        continue;
+      }
       if(!fTreeSRedirector) return;
       (*fTreeSRedirector)<<"CosmicPairs"<<
         "gid="<<gid<<                         // global id of track
@@ -767,6 +795,15 @@ void AliAnalysisTaskFilteredTree::ProcessLaser(AliESDEvent *const esdEvent, AliM
       Bool_t skipTrack=gRandom->Rndm()>1/(1+TMath::Abs(fFriendDownscaling));
       if (skipTrack) continue;
       if (esdFriend) {if (!esdFriend->TestSkipBit()) friendTrack = esdFriend->GetTrack(iTrack);} //this guy can be NULL      
+      if (fColumnWriter[kColumnLaser]) {
+        AliFilteredTreeColumnWriter *writer=fColumnWriter[kColumnLaser];
+        PushEventColumns(writer, gid, runNumber, evtTimeStamp, evtNumberInFile, bz);
+        writer->Push(countLaserTracks);
+        PushESDTrackColumns(writer, track);
+        writer->PushTrackParam(track->GetInnerParam()).PushTrackParam(track->GetOuterParam());
+        writer->Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"Laser"<<
         "gid="<<gid<<                          // global identifier of event
         "fileName.="<<&fCurrentFileName<<              //
@@ -1376,7 +1413,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	if (fFriendDownscaling>=1){  // downscaling number of friend tracks
 	  friendTrackStore = (gRandom->Rndm()<1./fFriendDownscaling)? friendTrack:0;
 	}
-	if (fFriendDownscaling<=0){
+	if (fFriendDownscaling<=0 && !fColumnWriter[kColumnHighPt]){
 	  if (((*fTreeSRedirector)<<"highPt").GetTree()){
 	    TTree * tree = ((*fTreeSRedirector)<<"highPt").GetTree();
 	    if (tree){
@@ -1431,7 +1468,36 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	  pidResponse->ComputePIDProbability(AliPIDResponse::kTPC, track, nSpecies, tpcPID.GetMatrixArray());
 	  pidResponse->ComputePIDProbability(AliPIDResponse::kTOF, track, nSpecies, tofPID.GetMatrixArray());	    
 	}
-        if(fTreeSRedirector && dumpToTree && fFillTree) {
+        if(fColumnWriter[kColumnHighPt] && dumpToTree && fFillTree) {
+	  downscaleCounter++;
+          AliFilteredTreeColumnWriter *writer=fColumnWriter[kColumnHighPt];
+          writer->Push(downscaleCounter);
+          PushEventColumns(writer, gid, runNumber, evtTimeStamp, evtNumberInFile, bz);
+          PushVertexColumns(writer, vtxESD);
+          writer->Push(mult).Push(ntracks).Push(contTPC).Push(contSPD).Push(ntracksTPC).Push(ntracksITS).Push(centralityF);
+          writer->PushArray(vertexPosTPC.GetMatrixArray(),3).PushArray(vertexPosSPD.GetMatrixArray(),3);
+          PushESDTrackColumns(writer, track);
+          writer->PushArray(tofClInfo.GetMatrixArray(),5);
+          writer->PushArray(tpcNsigma.GetMatrixArray(),nSpecies).PushArray(tofNsigma.GetMatrixArray(),nSpecies);
+          writer->PushArray(tpcPID.GetMatrixArray(),nSpecies).PushArray(tofPID.GetMatrixArray(),nSpecies);
+          writer->PushTrackParam(tpcInnerC).PushTrackParam(trackInnerV).PushTrackParam(trackInnerC);
+          writer->PushTrackParam(trackInnerC2).PushTrackParam(outerITSc).PushTrackParam(trackInnerC3);
+          writer->Push(chi2(0,0)).Push(chi2trackC(0,0)).Push(chi2OuterITS(0,0));
+          writer->PushTrackParam(&paramITS).PushTrackParam(&paramITSC).PushTrackParam(&paramComb);
+          writer->Push(indexNearestITS).Push(indexNearestITSC).Push(indexNearestComb);
+          if (fColumnHasMC) { // same condition as for the declaration, defaults if mcEvent is missing
+            writer->Push(multMCTrueTracks).Push(nrefITS).Push(nrefTPC).Push(nrefTRD).Push(nrefTOF).Push(nrefEMCAL).Push(nrefPHOS);
+            PushParticleColumns(writer, particle);
+            PushParticleColumns(writer, particleMother);
+            writer->Push(mech).Push(isPrim).Push(isFromStrangess).Push(isFromConversion).Push(isFromMaterial);
+            PushParticleColumns(writer, particleTPC);
+            writer->Push(mechTPC).Push(isPrimTPC);
+            PushParticleColumns(writer, particleITS);
+            writer->Push(mechITS).Push(isPrimITS);
+          }
+          writer->Fill();
+        }
+        else if(fTreeSRedirector && dumpToTree && fFillTree) {
 	  downscaleCounter++;
           (*fTreeSRedirector)<<"highPt"<<
 	    "downscaleCounter="<<downscaleCounter<<   
@@ -1780,7 +1846,22 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
 
 
       //
-      if(fTreeSRedirector && fFillTree) {
+      if(fColumnWriter[kColumnMCEff] && fFillTree) {
+	downscaleCounter++;
+        AliFilteredTreeColumnWriter *writer=fColumnWriter[kColumnMCEff];
+        PushEventColumns(writer, 0, (Int_t)runNumber, (Int_t)evtTimeStamp, evtNumberInFile, bz);
+        PushVertexColumns(writer, vtxESD);
+        writer->Push(mult).Push(multMCTrueTracks).Push(contTPC).Push(contSPD).Push(ntracksTPC).Push(ntracksITS);
+        writer->PushArray(vertexPosTPC.GetMatrixArray(),3).PushArray(vertexPosSPD.GetMatrixArray(),3);
+        writer->Push(isESDtrackCut).Push(isAccCuts);
+        PushESDTrackColumns(writer, recTrack);
+        writer->Push(isRec).Push(tpcTrackLength);
+        PushParticleColumns(writer, particle);
+        PushParticleColumns(writer, particleMother);
+        writer->Push(mech).Push(nRec).Push(nFakes);
+        writer->Fill();
+      }
+      else if(fTreeSRedirector && fFillTree) {
 	downscaleCounter++;
         (*fTreeSRedirector)<<"MCEffTree"<<
           "fileName.="<<&fCurrentFileName<<
@@ -1988,7 +2069,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
 	  friendTrackStore1 = 0;
 	}
       }
-      if (fFriendDownscaling<=0){
+      if (fFriendDownscaling<=0 && !fColumnWriter[kColumnV0s]){
 	if (((*fTreeSRedirector)<<"V0s").GetTree()){
 	  TTree * tree = ((*fTreeSRedirector)<<"V0s").GetTree();
 	  if (tree){
@@ -2046,6 +2127,24 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       }
 
       downscaleCounter++;
+      if (fColumnWriter[kColumnV0s]) {
+        AliFilteredTreeColumnWriter *writer=fColumnWriter[kColumnV0s];
+        PushEventColumns(writer, gid, run, time, evNr, bz);
+        writer->Push(isDownscaled).Push(type).Push(ntracks).Push(centralityF);
+        Double_t v0xyz[3], v0pxyz[3];
+        v0->GetXYZ(v0xyz[0],v0xyz[1],v0xyz[2]);
+        v0->GetPxPyPz(v0pxyz[0],v0pxyz[1],v0pxyz[2]);
+        writer->PushArray(v0xyz,3).PushArray(v0pxyz,3);
+        writer->Push(v0->GetDcaV0Daughters()).Push(v0->GetV0CosineOfPointingAngle()).Push(v0->GetOnFlyStatus());
+        writer->Push(kfparticle.GetMass()).Push(kfparticle.GetChi2()).Push(kfparticle.GetNDF());
+        PushESDTrackColumns(writer, track0);
+        PushESDTrackColumns(writer, track1);
+        writer->PushArray(tofClInfo0.GetMatrixArray(),5).PushArray(tofClInfo1.GetMatrixArray(),5);
+        writer->PushArray(tpcNsigma0.GetMatrixArray(),nSpecies).PushArray(tpcNsigma1.GetMatrixArray(),nSpecies);
+        writer->PushArray(tofNsigma0.GetMatrixArray(),nSpecies).PushArray(tofNsigma1.GetMatrixArray(),nSpecies);
+        writer->Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"V0s"<<
         "gid="<<gid<<                         //  global id of event
         "isDownscaled="<<isDownscaled<<       //  
@@ -2197,6 +2296,16 @@ void AliAnalysisTaskFilteredTree::ProcessdEdx(AliESDEvent *const esdEvent, AliMC
       }
 	
       downscaleCounter++;
+      if (fColumnWriter[kColumndEdx]) {
+        AliFilteredTreeColumnWriter *writer=fColumnWriter[kColumndEdx];
+        PushEventColumns(writer, gid, (Int_t)runNumber, (Int_t)evtTimeStamp, evtNumberInFile, bz);
+        PushVertexColumns(writer, vtxESD);
+        writer->Push(mult);
+        PushESDTrackColumns(writer, track);
+        writer->PushArray(tpcNsigma.GetMatrixArray(),nSpecies).PushArray(tofNsigma.GetMatrixArray(),nSpecies);
+        writer->Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"dEdx"<<           // high dEdx tree
         "gid="<<gid<<                         // global id
         "fileName.="<<&fCurrentFileName<<     // file name
@@ -2563,7 +2672,10 @@ void AliAnalysisTaskFilteredTree::FinishTaskOutput()
         AliAnalysisManager::kProofAnalysis)
       deleteTrees=kFALSE;
   }
-  if (deleteTrees) delete fTreeSRedirector;
+  if (deleteTrees) {
+    for (Int_t i=0; i<kNColumnTrees; i++) if (fColumnWriter[i]) fColumnWriter[i]->WriteTree();
+    delete fTreeSRedirector;
+  }
   fTreeSRedirector=NULL;
 }
 
@@ -3364,4 +3476,264 @@ void AliAnalysisTaskFilteredTree::ProcessMC(){
     Int_t result = GetMCInfoTrack(iMc, trackInfoF,trackInfoO);
 
   }
-}
\ No newline at end of file
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::CreateColumnWriters(Bool_t hasMC){
+  //
+  // Declare the flat column schema of the output trees once.
+  // The order of the columns has to follow the order of the Push calls in the Process methods.
+  // Object members (tracks, vertices, particles) are split into numeric columns,
+  // friend tracks and trigger class strings are not stored.
+  //
+  const Int_t nSpecies=AliPID::kSPECIES;
+  const char *treeNames[kNColumnTrees]={"highPt","V0s","dEdx","Laser","MCEffTree","CosmicPairs"};
+  fColumnHasMC=hasMC;
+  for (Int_t i=0; i<kNColumnTrees; i++) {
+    delete fColumnWriter[i];
+    fColumnWriter[i]=new AliFilteredTreeColumnWriter(treeNames[i],fColumnCompression,fColumnBasketSize);
+  }
+  AliFilteredTreeColumnWriter *writer=0;
+  //
+  // highPt
+  writer=fColumnWriter[kColumnHighPt];
+  writer->AddColumn("downscaleCounter",AliFilteredTreeColumnWriter::kInt);
+  AddEventColumns(writer);
+  AddVertexColumns(writer,"vtxESD");
+  writer->AddColumn("mult",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("ntracks",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("contTPC",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("contSPD",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("ntracksTPC",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("ntracksITS",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("centralityF");
+  writer->AddArray("vertexPosTPC",3);
+  writer->AddArray("vertexPosSPD",3);
+  AddESDTrackColumns(writer,"esdTrack");
+  writer->AddArray("tofClInfo",5);
+  writer->AddArray("tpcNsigma",nSpecies);
+  writer->AddArray("tofNsigma",nSpecies);
+  writer->AddArray("tpcPID",nSpecies);
+  writer->AddArray("tofPID",nSpecies);
+  writer->AddTrackParam("extTPCInnerC");
+  writer->AddTrackParam("extInnerParamV");
+  writer->AddTrackParam("extInnerParamC");
+  writer->AddTrackParam("extInnerParam");
+  writer->AddTrackParam("extOuterITS");
+  writer->AddTrackParam("extInnerParamRef");
+  writer->AddColumn("chi2TPCInnerC");
+  writer->AddColumn("chi2InnerC");
+  writer->AddColumn("chi2OuterITS");
+  writer->AddTrackParam("paramITS");
+  writer->AddTrackParam("paramITSC");
+  writer->AddTrackParam("paramComb");
+  writer->AddColumn("indexNearestITS",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("indexNearestITSC",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("indexNearestComb",AliFilteredTreeColumnWriter::kInt);
+  if (hasMC) {
+    writer->AddColumn("multMCTrueTracks",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("nrefITS",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("nrefTPC",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("nrefTRD",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("nrefTOF",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("nrefEMCAL",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("nrefPHOS",AliFilteredTreeColumnWriter::kInt);
+    AddParticleColumns(writer,"particle");
+    AddParticleColumns(writer,"particleMother");
+    writer->AddColumn("mech",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("isPrim",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("isFromStrangess",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("isFromConversion",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("isFromMaterial",AliFilteredTreeColumnWriter::kInt);
+    AddParticleColumns(writer,"particleTPC");
+    writer->AddColumn("mechTPC",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("isPrimTPC",AliFilteredTreeColumnWriter::kInt);
+    AddParticleColumns(writer,"particleITS");
+    writer->AddColumn("mechITS",AliFilteredTreeColumnWriter::kInt);
+    writer->AddColumn("isPrimITS",AliFilteredTreeColumnWriter::kInt);
+  }
+  //
+  // V0s
+  writer=fColumnWriter[kColumnV0s];
+  AddEventColumns(writer);
+  writer->AddColumn("isDownscaled",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("type",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("ntracks",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("centralityF");
+  writer->AddArray("v0_xyz",3);
+  writer->AddArray("v0_pxyz",3);
+  writer->AddColumn("v0_dcaV0Daughters");
+  writer->AddColumn("v0_cosPointingAngle");
+  writer->AddColumn("v0_onFlyStatus",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("kf_mass");
+  writer->AddColumn("kf_chi2");
+  writer->AddColumn("kf_ndf",AliFilteredTreeColumnWriter::kInt);
+  AddESDTrackColumns(writer,"track0");
+  AddESDTrackColumns(writer,"track1");
+  writer->AddArray("tofClInfo0",5);
+  writer->AddArray("tofClInfo1",5);
+  writer->AddArray("tpcNsigma0",nSpecies);
+  writer->AddArray("tpcNsigma1",nSpecies);
+  writer->AddArray("tofNsigma0",nSpecies);
+  writer->AddArray("tofNsigma1",nSpecies);
+  //
+  // dEdx
+  writer=fColumnWriter[kColumndEdx];
+  AddEventColumns(writer);
+  AddVertexColumns(writer,"vtxESD");
+  writer->AddColumn("mult",AliFilteredTreeColumnWriter::kInt);
+  AddESDTrackColumns(writer,"esdTrack");
+  writer->AddArray("tpcNsigma",nSpecies);
+  writer->AddArray("tofNsigma",nSpecies);
+  //
+  // Laser
+  writer=fColumnWriter[kColumnLaser];
+  AddEventColumns(writer);
+  writer->AddColumn("multTPCtracks",AliFilteredTreeColumnWriter::kInt);
+  AddESDTrackColumns(writer,"track");
+  writer->AddTrackParam("trackInner");
+  writer->AddTrackParam("trackOuter");
+  //
+  // MCEffTree
+  writer=fColumnWriter[kColumnMCEff];
+  AddEventColumns(writer);
+  AddVertexColumns(writer,"vtxESD");
+  writer->AddColumn("mult",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("multMCTrueTracks",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("contTPC",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("contSPD",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("ntracksTPC",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("ntracksITS",AliFilteredTreeColumnWriter::kInt);
+  writer->AddArray("vertexPosTPC",3);
+  writer->AddArray("vertexPosSPD",3);
+  writer->AddColumn("isAcc0",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("isAcc1",AliFilteredTreeColumnWriter::kInt);
+  AddESDTrackColumns(writer,"esdTrack");
+  writer->AddColumn("isRec",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("tpcTrackLength");
+  AddParticleColumns(writer,"particle");
+  AddParticleColumns(writer,"particleMother");
+  writer->AddColumn("mech",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("nRec",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("nFakes",AliFilteredTreeColumnWriter::kInt);
+  //
+  // CosmicPairs
+  writer=fColumnWriter[kColumnCosmicPairs];
+  AddEventColumns(writer);
+  writer->AddColumn("trigger",AliFilteredTreeColumnWriter::kULong64);
+  writer->AddColumn("multSPD",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("multTPC",AliFilteredTreeColumnWriter::kInt);
+  AddVertexColumns(writer,"vertSPD");
+  AddVertexColumns(writer,"vertTPC");
+  AddESDTrackColumns(writer,"t0");
+  AddESDTrackColumns(writer,"t1");
+  //
+  for (Int_t i=0; i<kNColumnTrees; i++) fColumnWriter[i]->CreateTree();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::AddEventColumns(AliFilteredTreeColumnWriter* writer){
+  //
+  // event identification columns
+  //
+  writer->AddColumn("gid",AliFilteredTreeColumnWriter::kULong64);
+  writer->AddColumn("runNumber",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("evtTimeStamp",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("evtNumberInFile",AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn("Bz");
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::PushEventColumns(AliFilteredTreeColumnWriter* writer, ULong64_t gid, Int_t runNumber, Int_t evtTimeStamp, Int_t evtNumberInFile, Float_t bz){
+  //
+  // fill event identification columns
+  //
+  writer->PushULong64(gid).Push(runNumber).Push(evtTimeStamp).Push(evtNumberInFile).Push(bz);
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::AddVertexColumns(AliFilteredTreeColumnWriter* writer, const char* prefix){
+  //
+  // vertex position and number of contributors
+  //
+  writer->AddColumn(Form("%s_X",prefix));
+  writer->AddColumn(Form("%s_Y",prefix));
+  writer->AddColumn(Form("%s_Z",prefix));
+  writer->AddColumn(Form("%s_NContributors",prefix),AliFilteredTreeColumnWriter::kInt);
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::PushVertexColumns(AliFilteredTreeColumnWriter* writer, const AliESDVertex* vertex){
+  //
+  // fill vertex columns
+  //
+  if (!vertex) {
+    writer->PushArray(0,3).Push(-1);
+    return;
+  }
+  writer->Push(vertex->GetX()).Push(vertex->GetY()).Push(vertex->GetZ()).Push(vertex->GetNContributors());
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::AddESDTrackColumns(AliFilteredTreeColumnWriter* writer, const char* prefix){
+  //
+  // track parameters at the DCA and the most used track quality variables
+  //
+  writer->AddTrackParam(prefix);
+  writer->AddColumn(Form("%s_status",prefix),AliFilteredTreeColumnWriter::kULong64);
+  writer->AddColumn(Form("%s_dcaR",prefix));
+  writer->AddColumn(Form("%s_dcaZ",prefix));
+  writer->AddColumn(Form("%s_tpcNcl",prefix),AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn(Form("%s_tpcChi2",prefix));
+  writer->AddColumn(Form("%s_tpcSignal",prefix));
+  writer->AddColumn(Form("%s_tpcSignalN",prefix),AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn(Form("%s_itsNcl",prefix),AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn(Form("%s_itsChi2",prefix));
+  writer->AddColumn(Form("%s_itsClusterMap",prefix),AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn(Form("%s_tofSignal",prefix));
+  writer->AddColumn(Form("%s_trdSignal",prefix));
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::PushESDTrackColumns(AliFilteredTreeColumnWriter* writer, const AliESDtrack* track){
+  //
+  // fill the columns declared by AddESDTrackColumns
+  //
+  writer->PushTrackParam(track);
+  if (!track) {
+    writer->PushULong64(0).PushArray(0,12);
+    return;
+  }
+  Float_t dcaR=0, dcaZ=0;
+  track->GetImpactParameters(dcaR,dcaZ);
+  writer->PushULong64(track->GetStatus()).Push(dcaR).Push(dcaZ);
+  writer->Push(track->GetTPCNcls()).Push(track->GetTPCchi2()).Push(track->GetTPCsignal()).Push(track->GetTPCsignalN());
+  writer->Push(track->GetITSNcls()).Push(track->GetITSchi2()).Push(track->GetITSClusterMap());
+  writer->Push(track->GetTOFsignal()).Push(track->GetTRDsignal());
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::AddParticleColumns(AliFilteredTreeColumnWriter* writer, const char* prefix){
+  //
+  // MC particle kinematics
+  //
+  writer->AddColumn(Form("%s_pdg",prefix),AliFilteredTreeColumnWriter::kInt);
+  writer->AddColumn(Form("%s_px",prefix));
+  writer->AddColumn(Form("%s_py",prefix));
+  writer->AddColumn(Form("%s_pz",prefix));
+  writer->AddColumn(Form("%s_vx",prefix));
+  writer->AddColumn(Form("%s_vy",prefix));
+  writer->AddColumn(Form("%s_vz",prefix));
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::PushParticleColumns(AliFilteredTreeColumnWriter* writer, const TParticle* particle){
+  //
+  // fill MC particle columns
+  //
+  if (!particle) {
+    writer->Push(0).PushArray(0,6);
+    return;
+  }
+  writer->Push(particle->GetPdgCode()).Push(particle->Px()).Push(particle->Py()).Push(particle->Pz());
+  writer->Push(particle->Vx()).Push(particle->Vy()).Push(particle->Vz());
+}
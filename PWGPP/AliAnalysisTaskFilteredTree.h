@@ -30,6 +30,7 @@ class TTree;
 class TTreeSRedirector;
 class TParticle;
 class TH3D;
+class AliFilteredTreeColumnWriter;
 #include <string>
 
 #include "AliTriggerAnalysis.h"
@@ -42,6 +43,9 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
                       kTPCITSAnalysisMode=0,
                       kTPCAnalysisMode=1 };
 
+  // output trees which can be written by the flat column writer
+  enum EColumnTree { kColumnHighPt=0, kColumnV0s, kColumndEdx, kColumnLaser, kColumnMCEff, kColumnCosmicPairs, kNColumnTrees };
+
   AliAnalysisTaskFilteredTree(const char *name = "AliAnalysisTaskFilteredTree");
   virtual ~AliAnalysisTaskFilteredTree();
   
@@ -115,6 +119,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   void SetFillTrees(Bool_t filltree) { fFillTree = filltree ;}
   Bool_t GetFillTrees() { return fFillTree ;}
 
+  // write the output trees as flat numeric columns (AliFilteredTreeColumnWriter)
+  // instead of TTreeSRedirector object streaming; friend tracks are not stored in this mode
+  void SetUseColumnWriter(Bool_t use, Int_t compression=101, Int_t basketSize=256000) { fUseColumnWriter = use; fColumnCompression = compression; fColumnBasketSize = basketSize; }
+  Bool_t GetUseColumnWriter() const { return fUseColumnWriter; }
+
   void FillHistograms(AliESDtrack* const ptrack, AliExternalTrackParam* const ptpcInnerC, Double_t centralityF, Double_t chi2TPCInnerC);
   Int_t   GetNearestTrack(const AliExternalTrackParam * trackMatch, Int_t indexSkip, AliESDEvent*event, Int_t trackType, Int_t paramType,  AliExternalTrackParam & paramNearest);
   static void SetDefaultAliasesV0(TTree *treeV0);
@@ -124,6 +133,17 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   static Int_t GetMCTrackDiff(const TParticle &particle, const AliExternalTrackParam &param, TClonesArray &trackRefArray, TVectorF &mcDiff); //TODO test before enabling
  private:
 
+  // flat column output
+  void CreateColumnWriters(Bool_t hasMC);
+  static void AddEventColumns(AliFilteredTreeColumnWriter* writer);
+  static void PushEventColumns(AliFilteredTreeColumnWriter* writer, ULong64_t gid, Int_t runNumber, Int_t evtTimeStamp, Int_t evtNumberInFile, Float_t bz);
+  static void AddVertexColumns(AliFilteredTreeColumnWriter* writer, const char* prefix);
+  static void PushVertexColumns(AliFilteredTreeColumnWriter* writer, const AliESDVertex* vertex);
+  static void AddESDTrackColumns(AliFilteredTreeColumnWriter* writer, const char* prefix);
+  static void PushESDTrackColumns(AliFilteredTreeColumnWriter* writer, const AliESDtrack* track);
+  static void AddParticleColumns(AliFilteredTreeColumnWriter* writer, const char* prefix);
+  static void PushParticleColumns(AliFilteredTreeColumnWriter* writer, const TParticle* particle);
+
   AliESDEvent *fESD;    //! ESD event
   AliMCEvent *fMC;      //! MC event
   AliESDfriend *fESDfriend; //! ESDfriend event
@@ -175,9 +195,15 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TObjString fCurrentFileName; // cached value of current file name
   AliESDtrack* fDummyTrack; //! dummy track for tree init
 
+  Bool_t fUseColumnWriter;    // write output trees with the flat column writer
+  Int_t  fColumnCompression;  // compression settings of the column writer (algorithm*100+level)
+  Int_t  fColumnBasketSize;   // basket size of the column writer branches
+  AliFilteredTreeColumnWriter* fColumnWriter[kNColumnTrees]; //! column writers of the output trees
+  Bool_t fColumnHasMC;        //! MC columns are declared in the column writers
+
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
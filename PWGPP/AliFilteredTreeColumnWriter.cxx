@@ -0,0 +1,177 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+//------------------------------------------------------------------------------
+// Implementation of AliFilteredTreeColumnWriter class. Every declared column
+// is bound to one 8 byte slot of a flat buffer. The tree is created once with
+// one leaf per branch, so no object streaming is involved while filling.
+//------------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "TBranch.h"
+#include "TDirectory.h"
+#include "TString.h"
+#include "TTree.h"
+
+#include "AliLog.h"
+#include "AliExternalTrackParam.h"
+#include "AliFilteredTreeColumnWriter.h"
+
+ClassImp(AliFilteredTreeColumnWriter)
+
+const Double_t AliFilteredTreeColumnWriter::kEmptyValue = -999.;
+
+//_____________________________________________________________________________
+AliFilteredTreeColumnWriter::AliFilteredTreeColumnWriter(const char* treeName, Int_t compression, Int_t basketSize) :
+  TNamed(treeName, treeName),
+  fCompression(compression),
+  fBasketSize(basketSize),
+  fAutoFlushBytes(50000000),
+  fNames(),
+  fTypes(),
+  fBuffer(),
+  fCursor(0),
+  fTree(0)
+{
+  // constructor
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeColumnWriter::AddColumn(const char* name, EColumnType type)
+{
+  // declare one column
+  if (fTree) {
+    AliError(Form("%s: schema is frozen, column %s ignored", GetName(), name));
+    return;
+  }
+  fNames.push_back(name);
+  fTypes.push_back(type);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeColumnWriter::AddArray(const char* prefix, Int_t n, EColumnType type)
+{
+  // declare n columns prefix0 ... prefix(n-1)
+  for (Int_t i=0; i<n; i++) AddColumn(Form("%s%d", prefix, i), type);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeColumnWriter::AddTrackParam(const char* prefix, Bool_t covariance)
+{
+  // declare the numeric members of an AliExternalTrackParam
+  AddColumn(Form("%s_X", prefix));
+  AddColumn(Form("%s_Alpha", prefix));
+  AddArray(Form("%s_P", prefix), 5);
+  if (covariance) AddArray(Form("%s_C", prefix), 15);
+}
+
+//_____________________________________________________________________________
+TTree* AliFilteredTreeColumnWriter::CreateTree(TDirectory* dir)
+{
+  // create the output tree in dir (current directory if 0) and freeze the schema
+  if (fTree) return fTree;
+
+  TDirectory* save = gDirectory;
+  if (dir) dir->cd();
+  fTree = new TTree(GetName(), GetTitle());
+  fTree->SetAutoFlush(-fAutoFlushBytes);
+  if (save) save->cd();
+
+  static const char* kLeafType[4] = { "F", "D", "I", "l" };
+  fBuffer.assign(fTypes.size(), 0);
+  for (UInt_t i=0; i<fTypes.size(); i++) {
+    TString leaf = TString::Format("%s/%s", fNames[i].c_str(), kLeafType[fTypes[i]]);
+    TBranch* br = fTree->Branch(fNames[i].c_str(), &fBuffer[i], leaf.Data(), fBasketSize);
+    if (br) br->SetCompressionSettings(fCompression);
+  }
+  fCursor = 0;
+  return fTree;
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeColumnWriter& AliFilteredTreeColumnWriter::Push(Double_t value)
+{
+  // set the value of the next column, converted to its declared type
+  if (fCursor >= (Int_t)fTypes.size()) { fCursor++; return *this; }
+  void* slot = &fBuffer[fCursor];
+  switch (fTypes[fCursor]) {
+    case kFloat:   { Float_t v = value;               memcpy(slot, &v, sizeof(v)); break; }
+    case kDouble:  {                                  memcpy(slot, &value, sizeof(value)); break; }
+    case kInt:     { Int_t v = (Int_t)value;          memcpy(slot, &v, sizeof(v)); break; }
+    case kULong64: { ULong64_t v = (ULong64_t)value;  memcpy(slot, &v, sizeof(v)); break; }
+  }
+  fCursor++;
+  return *this;
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeColumnWriter& AliFilteredTreeColumnWriter::PushULong64(ULong64_t value)
+{
+  // set the value of the next column without the conversion to double
+  if (fCursor < (Int_t)fTypes.size() && fTypes[fCursor] == kULong64) {
+    fBuffer[fCursor++] = value;
+    return *this;
+  }
+  return Push(value);
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeColumnWriter& AliFilteredTreeColumnWriter::PushArray(const Double_t* values, Int_t n)
+{
+  // set n consecutive columns, missing array is written as kEmptyValue
+  for (Int_t i=0; i<n; i++) Push(values ? values[i] : kEmptyValue);
+  return *this;
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeColumnWriter& AliFilteredTreeColumnWriter::PushTrackParam(const AliExternalTrackParam* param, Bool_t covariance)
+{
+  // set the columns declared by AddTrackParam
+  Push(param ? param->GetX() : kEmptyValue);
+  Push(param ? param->GetAlpha() : kEmptyValue);
+  PushArray(param ? param->GetParameter() : 0, 5);
+  if (covariance) PushArray(param ? param->GetCovariance() : 0, 15);
+  return *this;
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeColumnWriter::Fill()
+{
+  // fill one entry, all declared columns have to be pushed before
+  Int_t nPushed = fCursor;
+  fCursor = 0;
+  if (!fTree) {
+    AliError(Form("%s: CreateTree() not called", GetName()));
+    return -1;
+  }
+  if (nPushed != (Int_t)fTypes.size()) {
+    AliError(Form("%s: %d values pushed for %d columns, entry skipped", GetName(), nPushed, (Int_t)fTypes.size()));
+    return -1;
+  }
+  return fTree->Fill();
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeColumnWriter::WriteTree()
+{
+  // write the tree into its directory
+  if (!fTree || !fTree->GetDirectory()) return 0;
+  TDirectory* save = gDirectory;
+  fTree->GetDirectory()->cd();
+  Int_t nbytes = fTree->Write();
+  if (save) save->cd();
+  return nbytes;
+}
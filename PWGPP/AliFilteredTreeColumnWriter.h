@@ -0,0 +1,80 @@
+#ifndef ALIFILTEREDTREECOLUMNWRITER_H
+#define ALIFILTEREDTREECOLUMNWRITER_H
+
+//------------------------------------------------------------------------------
+// Fast flat-column tree writer used by AliAnalysisTaskFilteredTree as an
+// alternative to the TTreeSRedirector operator<< chains.
+//
+// The schema is declared once (AddColumn, AddArray, AddTrackParam) before the
+// tree is created. Every column is a single numeric leaf in its own branch with
+// a large basket and configurable compression. Track parameters are split into
+// their numeric members (x, alpha, 5 parameters, 15 covariance elements).
+// Values are pushed per entry in the declaration order - no string or branch
+// lookup is done at fill time.
+//
+// Usage:
+//   AliFilteredTreeColumnWriter w("highPt");
+//   w.AddColumn("runNumber", AliFilteredTreeColumnWriter::kInt);
+//   w.AddTrackParam("esdTrack");
+//   w.CreateTree();
+//   ...
+//   w.Push(runNumber); w.PushTrackParam(track); w.Fill();
+//------------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include "TNamed.h"
+
+class TTree;
+class TDirectory;
+class AliExternalTrackParam;
+
+class AliFilteredTreeColumnWriter : public TNamed
+{
+public:
+  enum EColumnType { kFloat=0, kDouble=1, kInt=2, kULong64=3 };
+
+  AliFilteredTreeColumnWriter(const char* treeName="columns", Int_t compression=101, Int_t basketSize=256000);
+  virtual ~AliFilteredTreeColumnWriter() {;}
+
+  // schema declaration
+  void AddColumn(const char* name, EColumnType type=kFloat);
+  void AddArray(const char* prefix, Int_t n, EColumnType type=kFloat);
+  void AddTrackParam(const char* prefix, Bool_t covariance=kTRUE);
+  TTree* CreateTree(TDirectory* dir=0);
+
+  // filling, values have to be pushed in the declaration order
+  AliFilteredTreeColumnWriter& Push(Double_t value);
+  AliFilteredTreeColumnWriter& PushULong64(ULong64_t value);
+  AliFilteredTreeColumnWriter& PushArray(const Double_t* values, Int_t n);
+  AliFilteredTreeColumnWriter& PushTrackParam(const AliExternalTrackParam* param, Bool_t covariance=kTRUE);
+  Int_t Fill();
+  Int_t WriteTree();
+
+  TTree* GetTree() const          { return fTree; }
+  Int_t  GetNColumns() const      { return fTypes.size(); }
+  Int_t  GetCompression() const   { return fCompression; }
+  Int_t  GetBasketSize() const    { return fBasketSize; }
+  void   SetCompression(Int_t compression) { fCompression = compression; }
+  void   SetBasketSize(Int_t basketSize)   { fBasketSize = basketSize; }
+  void   SetAutoFlushBytes(Long64_t bytes) { fAutoFlushBytes = bytes; }
+
+  static const Double_t kEmptyValue; // value written for missing objects
+
+private:
+  AliFilteredTreeColumnWriter(const AliFilteredTreeColumnWriter&); // not implemented
+  AliFilteredTreeColumnWriter& operator=(const AliFilteredTreeColumnWriter&); // not implemented
+
+  Int_t    fCompression;      // compression settings (algorithm*100+level, see TFile)
+  Int_t    fBasketSize;       // basket size of every column branch
+  Long64_t fAutoFlushBytes;   // auto flush size of the tree in bytes
+  std::vector<std::string> fNames;  //! column names
+  std::vector<Int_t>  fTypes;       //! column types (EColumnType)
+  std::vector<ULong64_t> fBuffer;   //! one 8 byte slot per column, bound to the branches
+  Int_t    fCursor;           //! next column to be filled
+  TTree*   fTree;             //! output tree (owned by the output file)
+
+  ClassDef(AliFilteredTreeColumnWriter,1);
+};
+
+#endif
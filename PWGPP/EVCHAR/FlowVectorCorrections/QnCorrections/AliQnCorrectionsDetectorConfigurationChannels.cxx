@@ -455,12 +455,7 @@ void AliQnCorrectionsDetectorConfigurationChannels::FillQAHistograms(const Float
     }
   }
   if (fQAQnAverageHistogram != NULL) {
-    Int_t harmonic = fPlainQnVector.GetFirstHarmonic();
-    while (harmonic != -1) {
-      fQAQnAverageHistogram->FillX(harmonic, variableContainer, fPlainQnVector.Qx(harmonic));
-      fQAQnAverageHistogram->FillY(harmonic, variableContainer, fPlainQnVector.Qy(harmonic));
-      harmonic = fPlainQnVector.GetNextHarmonic(harmonic);
-    }
+    fQAQnAverageHistogram->FillComponents(&fPlainQnVector, variableContainer);
   }
 }
 
@@ -228,12 +228,7 @@ void AliQnCorrectionsDetectorConfigurationTracks::AfterInputsAttachActions() {
 void AliQnCorrectionsDetectorConfigurationTracks::FillQAHistograms(const Float_t *variableContainer) {
 
   if (fQAQnAverageHistogram != NULL) {
-    Int_t harmonic = fPlainQnVector.GetFirstHarmonic();
-    while (harmonic != -1) {
-      fQAQnAverageHistogram->FillX(harmonic, variableContainer, fPlainQnVector.Qx(harmonic));
-      fQAQnAverageHistogram->FillY(harmonic, variableContainer, fPlainQnVector.Qy(harmonic));
-      harmonic = fPlainQnVector.GetNextHarmonic(harmonic);
-    }
+    fQAQnAverageHistogram->FillComponents(&fPlainQnVector, variableContainer);
   }
 }
 
@@ -4,6 +4,7 @@
 #include "TList.h"
 
 #include "AliQnCorrectionsEventClassVariablesSet.h"
+#include "AliQnCorrectionsQnVector.h"
 #include "AliQnCorrectionsProfileComponents.h"
 #include "AliLog.h"
 
@@ -517,3 +518,67 @@ void AliQnCorrectionsProfileComponents::FillY(Int_t harmonic, const Float_t *var
 }
 
 
+
+/// Fills the X and Y components for the whole set of harmonics
+///
+/// The involved bin is computed only once according to the current
+/// variables content. For each harmonic of the passed Qn vector the
+/// bins of the X and Y component histograms are then increased by
+/// the Qn vector components and the entries are updated. The Qn vector
+/// has to provide the whole set of harmonics of the histograms, and
+/// no individual component fill has to be pending.
+///
+/// Bin contents, bin errors and entries are the same as with the
+/// FillX(), FillY() sequence. The sums of weights kept by THnBase for
+/// its statistics (fTsumw, fTsumw2, fTsumwx, fTsumwx2) are not updated,
+/// they are only accessible through THnBase::Fill(); they are not used
+/// by the correction steps, which read the bin contents and errors.
+///
+/// \param QnVector the Qn vector whose components are to be filled
+/// \param variableContainer the current variables content addressed by var Id
+void AliQnCorrectionsProfileComponents::FillComponents(const AliQnCorrectionsQnVector *QnVector, const Float_t *variableContainer) {
+  /* first the sanity checks */
+  if ((fXharmonicFillMask != 0x0000) || (fYharmonicFillMask != 0x0000)) {
+    AliFatal(Form("Filling the whole set of harmonics before entries update in histogram %s.\n" \
+        "   This means you probably have not updated the other components for some harmonic. FIX IT, PLEASE.", GetName()));
+  }
+
+  UInt_t harmonicFillMask = 0x0000;
+  Int_t harmonic = QnVector->GetFirstHarmonic();
+  while (harmonic != -1) {
+    if ((fXValues[harmonic] == NULL) || (fYValues[harmonic] == NULL)) {
+      AliFatal(Form("Accessing non allocated harmonic %d in component histogram %s. FIX IT, PLEASE.", harmonic, GetName()));
+    }
+    harmonicFillMask |= harmonicNumberMask[harmonic];
+    harmonic = QnVector->GetNextHarmonic(harmonic);
+  }
+  if (harmonicFillMask != fFullFilled) {
+    AliFatal(Form("The Qn vector %s does not provide the whole set of harmonics of histogram %s. FIX IT, PLEASE.",
+        QnVector->GetName(), GetName()));
+  }
+
+  /* now it's safe to continue */
+
+  /* the event class bin is the same for all the histograms */
+  FillBinAxesValues(variableContainer);
+  Long64_t bin = fEntries->GetBin(fBinAxesValues);
+
+  harmonic = QnVector->GetFirstHarmonic();
+  while (harmonic != -1) {
+    Double_t qx = QnVector->Qx(harmonic);
+    Double_t qy = QnVector->Qy(harmonic);
+
+    fXValues[harmonic]->AddBinContent(bin, qx);
+    fXValues[harmonic]->AddBinError2(bin, qx * qx);
+    fXValues[harmonic]->SetEntries(fXValues[harmonic]->GetEntries() + 1);
+    fYValues[harmonic]->AddBinContent(bin, qy);
+    fYValues[harmonic]->AddBinError2(bin, qy * qy);
+    fYValues[harmonic]->SetEntries(fYValues[harmonic]->GetEntries() + 1);
+
+    harmonic = QnVector->GetNextHarmonic(harmonic);
+  }
+
+  /* and the entries */
+  fEntries->AddBinContent(bin, 1.0);
+  fEntries->SetEntries(fEntries->GetEntries() + 1);
+}
@@ -6,6 +6,8 @@
 
 #include "AliQnCorrectionsHistogramBase.h"
 
+class AliQnCorrectionsQnVector;
+
 /// \class AliQnCorrectionsProfileComponents
 /// \brief Base class for the components based set of profiles
 ///
@@ -35,6 +37,13 @@
 /// component before the whole set is filled you will get an execution
 /// error because you are doing something that shall be corrected
 ///
+/// The whole set of harmonics of a Qn vector can be filled at once
+/// with FillComponents(). The event class bin is then computed only
+/// once and the X, Y components and the entries are added to that bin
+/// of each histogram, which keep the same layout as with the
+/// individual FillX(), FillY() calls. Only the THnBase sums of weights
+/// statistics are not updated by FillComponents().
+///
 /// \author Jaap Onderwaater <jacobus.onderwaater@cern.ch>, GSI
 /// \author Ilya Selyuzhenkov <ilya.selyuzhenkov@gmail.com>, GSI
 /// \author Víctor González <victor.gonzalez@cern.ch>, UCM
@@ -66,6 +75,7 @@ public:
 
   virtual void FillX(Int_t harmonic, const Float_t *variableContainer, Float_t weight);
   virtual void FillY(Int_t harmonic, const Float_t *variableContainer, Float_t weight);
+  virtual void FillComponents(const AliQnCorrectionsQnVector *QnVector, const Float_t *variableContainer);
 
 private:
   THnF **fXValues;            //!<! X component histogram for each requested harmonic
@@ -335,12 +335,7 @@ Bool_t AliQnCorrectionsQnVectorAlignment::ProcessDataCollection(const Float_t *v
   case QCORRSTEP_apply: /* apply the correction if the current Qn vector is good enough */
     /* provide QA info if required */
     if (fQAQnAverageHistogram != NULL) {
-      Int_t harmonic = fCorrectedQnVector->GetFirstHarmonic();
-      while (harmonic != -1) {
-        fQAQnAverageHistogram->FillX(harmonic, variableContainer, fCorrectedQnVector->Qx(harmonic));
-        fQAQnAverageHistogram->FillY(harmonic, variableContainer, fCorrectedQnVector->Qy(harmonic));
-        harmonic = fCorrectedQnVector->GetNextHarmonic(harmonic);
-     }
+      fQAQnAverageHistogram->FillComponents(fCorrectedQnVector, variableContainer);
     }
     break;
   default:
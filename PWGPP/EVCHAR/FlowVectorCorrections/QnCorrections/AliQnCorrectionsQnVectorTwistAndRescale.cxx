@@ -656,21 +656,12 @@ Bool_t AliQnCorrectionsQnVectorTwistAndRescale::ProcessDataCollection(const Floa
   /* and proceed to ... */
   case QCORRSTEP_apply: { /* apply the correction if the current Qn vector is good enough */
     /* provide QA info if required */
+    /* the twist and rescale corrected Qn vectors have the harmonics of the corrected one */
     if (fQATwistQnAverageHistogram != NULL) {
-      Int_t harmonic = fCorrectedQnVector->GetFirstHarmonic();
-      while (harmonic != -1) {
-        fQATwistQnAverageHistogram->FillX(harmonic, variableContainer, fTwistCorrectedQnVector->Qx(harmonic));
-        fQATwistQnAverageHistogram->FillY(harmonic, variableContainer, fTwistCorrectedQnVector->Qy(harmonic));
-        harmonic = fCorrectedQnVector->GetNextHarmonic(harmonic);
-      }
+      fQATwistQnAverageHistogram->FillComponents(fTwistCorrectedQnVector, variableContainer);
     }
     if (fQARescaleQnAverageHistogram != NULL) {
-      Int_t harmonic = fCorrectedQnVector->GetFirstHarmonic();
-      while (harmonic != -1) {
-        fQARescaleQnAverageHistogram->FillX(harmonic, variableContainer, fRescaleCorrectedQnVector->Qx(harmonic));
-        fQARescaleQnAverageHistogram->FillY(harmonic, variableContainer, fRescaleCorrectedQnVector->Qy(harmonic));
-        harmonic = fCorrectedQnVector->GetNextHarmonic(harmonic);
-      }
+      fQARescaleQnAverageHistogram->FillComponents(fRescaleCorrectedQnVector, variableContainer);
     }
   }
   break;
@@ -286,6 +286,7 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
   TObject* obj = 0;
   TObjArray* objArrayList = 0;
   objArrayList = new TObjArray();
+  TObjArray deDxHistoList;
 
   // collection of generated histograms
   Int_t count=0;
@@ -294,13 +295,16 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
     AliPerformanceDEdx* entry = dynamic_cast<AliPerformanceDEdx*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fDeDxHisto) && (entry->fDeDxHisto)) { fDeDxHisto->Add(entry->fDeDxHisto); }        
+        if ((fDeDxHisto) && (entry->fDeDxHisto)) { deDxHistoList.Add(entry->fDeDxHisto); }        
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
 
     count++;
   }
+  if (merge) {
+    MergeTHnSparse(fDeDxHisto, &deDxHistoList);
+  }
   if (fFolderObj) { fFolderObj->Merge(objArrayList); } 
   // to signal that track histos were not merged: reset
   if (!merge) { fDeDxHisto->Reset(); }
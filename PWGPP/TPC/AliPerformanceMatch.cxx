@@ -667,6 +667,10 @@ Long64_t AliPerformanceMatch::Merge(TCollection* const list)
   TObject* obj = 0;
   TObjArray* objArrayList = 0;
   objArrayList = new TObjArray();
+  TObjArray resolHistoList;
+  TObjArray pullHistoList;
+  TObjArray trackingEffHistoList;
+  TObjArray tpcConstrainList;
 
   // collection of generated histograms
   Int_t count=0;
@@ -675,17 +679,23 @@ Long64_t AliPerformanceMatch::Merge(TCollection* const list)
     AliPerformanceMatch* entry = dynamic_cast<AliPerformanceMatch*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fResolHisto) && (entry->fResolHisto)) { fResolHisto->Add(entry->fResolHisto); }
-        if ((fPullHisto) && (entry->fPullHisto)) { fPullHisto->Add(entry->fPullHisto); }
-        if ((fTrackingEffHisto) && (entry->fTrackingEffHisto)) { fTrackingEffHisto->Add(entry->fTrackingEffHisto); }
+        if ((fResolHisto) && (entry->fResolHisto)) { resolHistoList.Add(entry->fResolHisto); }
+        if ((fPullHisto) && (entry->fPullHisto)) { pullHistoList.Add(entry->fPullHisto); }
+        if ((fTrackingEffHisto) && (entry->fTrackingEffHisto)) { trackingEffHistoList.Add(entry->fTrackingEffHisto); }
 
-        if ((fTPCConstrain) && (entry->fTPCConstrain)) { fTPCConstrain->Add(entry->fTPCConstrain); }
+        if ((fTPCConstrain) && (entry->fTPCConstrain)) { tpcConstrainList.Add(entry->fTPCConstrain); }
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
 
     count++;
   }
+  if (merge) {
+    MergeTHnSparse(fResolHisto, &resolHistoList);
+    MergeTHnSparse(fPullHisto, &pullHistoList);
+    MergeTHnSparse(fTrackingEffHisto, &trackingEffHistoList);
+    MergeTHnSparse(fTPCConstrain, &tpcConstrainList);
+  }
   if (fFolderObj) { fFolderObj->Merge(objArrayList); } 
   // to signal that track histos were not merged: reset
   if (!merge) { fResolHisto->Reset(); fPullHisto->Reset(); fTrackingEffHisto->Reset(); fTPCConstrain->Reset(); }
@@ -35,11 +35,15 @@
 #include "AliLog.h" 
 #include "AliESDVertex.h" 
 #include "AliPerformanceObject.h" 
+#include "AliPerformanceSparseMerger.h" 
 
 using namespace std;
 
 ClassImp(AliPerformanceObject)
 
+Int_t AliPerformanceObject::fgMergeTHnSparseMode = AliPerformanceSparseMerger::kSequential;
+Int_t AliPerformanceObject::fgMergeTHnSparseThreads = 0;
+
 //_____________________________________________________________________________
 AliPerformanceObject::AliPerformanceObject():
   TNamed("AliPerformanceObject","AliPerformanceObject"),
@@ -243,3 +247,24 @@ void AliPerformanceObject::AddProjection(TObjArray* aFolderObj, TString nameSpar
   h3->SetTitle(title.Data());  
   aFolderObj->Add(h3);
 }
+
+
+//_____________________________________________________________________________
+void AliPerformanceObject::MergeTHnSparse(THnSparse* const target, TCollection* const list)
+{
+  // merge all THnSparse in the list into target
+  // the parallel merger falls back to THnSparse::Add if the binning cannot be handled
+  if (!target || !list || list->IsEmpty()) return;
+
+  if (fgMergeTHnSparseMode != AliPerformanceSparseMerger::kSequential) {
+    AliPerformanceSparseMerger merger(fgMergeTHnSparseMode, fgMergeTHnSparseThreads);
+    if (merger.Merge(target, list) >= 0) return;
+  }
+
+  TIter next(list);
+  TObject* obj = 0;
+  while ((obj = next())) {
+    THnSparse* h = dynamic_cast<THnSparse*>(obj);
+    if (h) target->Add(h);
+  }
+}
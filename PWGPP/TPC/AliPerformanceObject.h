@@ -89,6 +89,13 @@ public :
   // merging of thnsparse
   Bool_t GetMergeTHnSparseObj() { return fMergeTHnSparseObj; }
   void SetMergeTHnSparseObj(Bool_t merge) {fMergeTHnSparseObj = merge; }  
+
+  // algorithm used to merge the thnsparse: 0 - sequential THnSparse::Add,
+  // 1 - parallel tree reduction, 2 - tree reduction on sorted compact bins
+  // (see AliPerformanceSparseMerger), nThreads=0 uses all cores
+  static void SetMergeTHnSparseMode(Int_t mode, Int_t nThreads=0) { fgMergeTHnSparseMode = mode; fgMergeTHnSparseThreads = nThreads; }
+  static Int_t GetMergeTHnSparseMode() { return fgMergeTHnSparseMode; }
+  static Int_t GetMergeTHnSparseThreads() { return fgMergeTHnSparseThreads; }
   
   void SetRunNumber(Int_t run) { fRunNumber = run; }
   Int_t GetRunNumber() const { return fRunNumber; }
@@ -111,6 +118,12 @@ protected:
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, TString* selString = 0);
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, Int_t zDim, TString* selString = 0);
 
+  // merge list of THnSparse into target according to fgMergeTHnSparseMode
+  static void MergeTHnSparse(THnSparse* const target, TCollection* const list);
+
+  static Int_t fgMergeTHnSparseMode;    // THnSparse merge algorithm
+  static Int_t fgMergeTHnSparseThreads; // number of threads for THnSparse merging
+
   // merge THnSparse
   Bool_t fMergeTHnSparseObj;
   
@@ -0,0 +1,312 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+//------------------------------------------------------------------------------
+// Implementation of AliPerformanceSparseMerger class. It merges a list of
+// THnSparse with identical binning into a target THnSparse using a parallel
+// pairwise tree reduction over hash-partitioned compact bin lists.
+//
+// The shape of the reduction tree and the order of the additions do not
+// depend on the number of threads, hence the result is reproducible.
+//
+// Usage (as done in AliPerformanceObject::MergeTHnSparse):
+//
+//   AliPerformanceSparseMerger merger(AliPerformanceSparseMerger::kCompactBins, 8);
+//   if (merger.Merge(target, listOfSparses) < 0) { /* fall back to THnSparse::Add */ }
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+#include "TAxis.h"
+#include "TCollection.h"
+#include "THnSparse.h"
+#include "TMath.h"
+#include "TObjArray.h"
+
+#include "AliLog.h"
+#include "AliPerformanceSparseMerger.h"
+
+namespace {
+  //_____________________________________________________________________________
+  template <typename F>
+  void RunParallel(Int_t nTasks, Int_t nThreads, F func)
+  {
+    // execute func(i) for i in [0,nTasks) on nThreads workers
+    if (nThreads > nTasks) nThreads = nTasks;
+    if (nThreads <= 1) {
+      for (Int_t i=0; i<nTasks; i++) func(i);
+      return;
+    }
+    std::atomic<Int_t> next(0);
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads);
+    for (Int_t t=0; t<nThreads; t++) {
+      workers.push_back(std::thread([&]() {
+        Int_t i = 0;
+        while ((i = next++) < nTasks) func(i);
+      }));
+    }
+    for (UInt_t t=0; t<workers.size(); t++) workers[t].join();
+  }
+
+  //_____________________________________________________________________________
+  Bool_t LessIndex(const AliPerformanceSparseMerger::Bin_t& a, const AliPerformanceSparseMerger::Bin_t& b)
+  {
+    return a.fIndex < b.fIndex;
+  }
+}
+
+//_____________________________________________________________________________
+AliPerformanceSparseMerger::AliPerformanceSparseMerger(Int_t mode, Int_t nThreads, Int_t nPartitions):
+  fMode(mode),
+  fNThreads(nThreads),
+  fNPartitions(nPartitions)
+{
+  // constructor
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceSparseMerger::GetNThreads() const
+{
+  // number of worker threads to be used
+  if (fNThreads > 0) return fNThreads;
+  Int_t n = std::thread::hardware_concurrency();
+  return (n > 0) ? n : 1;
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceSparseMerger::GetNPartitions() const
+{
+  // number of hash partitions of the global bin index
+  if (fNPartitions > 0) return fNPartitions;
+  return 4*GetNThreads();
+}
+
+//_____________________________________________________________________________
+UInt_t AliPerformanceSparseMerger::PartitionOf(Long64_t index, Int_t nPart) const
+{
+  // multiplicative (Fibonacci) hash of the global bin index
+  ULong64_t h = static_cast<ULong64_t>(index) * 11400714819323198485ull;
+  return static_cast<UInt_t>((h >> 32) % static_cast<ULong64_t>(nPart));
+}
+
+//_____________________________________________________________________________
+Bool_t AliPerformanceSparseMerger::ComputeStrides(const THnSparse* const target, std::vector<Long64_t>& strides) const
+{
+  // strides of the global bin index (axis bins including under/overflow)
+  // return kFALSE if the index does not fit into 63 bits
+  Int_t ndim = target->GetNdimensions();
+  strides.resize(ndim);
+  Double_t nCells = 1.;
+  Long64_t stride = 1;
+  for (Int_t d=0; d<ndim; d++) {
+    strides[d] = stride;
+    Long64_t nbins = target->GetAxis(d)->GetNbins() + 2;
+    nCells *= nbins;
+    if (nCells > 9.e18) return kFALSE;
+    stride *= nbins;
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliPerformanceSparseMerger::IsCompatible(const THnSparse* const target, const THnSparse* const h) const
+{
+  // check that h has the same number of dimensions, bins, axis limits
+  // and bin edges as target
+  if (h->GetNdimensions() != target->GetNdimensions()) return kFALSE;
+  for (Int_t d=0; d<target->GetNdimensions(); d++) {
+    const TAxis* at = target->GetAxis(d);
+    const TAxis* ah = h->GetAxis(d);
+    Int_t nbins = at->GetNbins();
+    if (ah->GetNbins() != nbins) return kFALSE;
+    Double_t tolerance = 1.e-10*TMath::Abs(at->GetXmax() - at->GetXmin());
+    if (TMath::Abs(ah->GetXmin() - at->GetXmin()) > tolerance) return kFALSE;
+    if (TMath::Abs(ah->GetXmax() - at->GetXmax()) > tolerance) return kFALSE;
+    if (!at->IsVariableBinSize() && !ah->IsVariableBinSize()) continue;
+    for (Int_t i=1; i<=nbins; i++) {
+      if (TMath::Abs(ah->GetBinUpEdge(i) - at->GetBinUpEdge(i)) > tolerance) return kFALSE;
+    }
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceSparseMerger::Extract(const THnSparse* const h, const std::vector<Long64_t>& strides, Compact_t& out) const
+{
+  // convert the filled bins of h into the hash-partitioned compact representation
+  // h is only accessed by the calling thread
+  Int_t ndim = h->GetNdimensions();
+  Int_t nPart = GetNPartitions();
+  Bool_t calcErrors = h->GetCalculateErrors();
+  std::vector<Int_t> coord(ndim);
+
+  out.assign(nPart, Partition_t());
+  Long64_t nFilled = h->GetNbins();
+  for (Int_t p=0; p<nPart; p++) out[p].reserve(nFilled/nPart + 1);
+
+  Bin_t bin;
+  for (Long64_t i=0; i<nFilled; i++) {
+    bin.fContent = h->GetBinContent(i, &coord[0]);
+    bin.fError2 = calcErrors ? h->GetBinError2(i) : bin.fContent;
+    if (bin.fContent == 0. && bin.fError2 == 0.) continue;
+    bin.fIndex = 0;
+    for (Int_t d=0; d<ndim; d++) bin.fIndex += coord[d]*strides[d];
+    out[PartitionOf(bin.fIndex, nPart)].push_back(bin);
+  }
+
+  if (fMode == kCompactBins) {
+    for (Int_t p=0; p<nPart; p++) std::sort(out[p].begin(), out[p].end(), LessIndex);
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceSparseMerger::MergePartition(Partition_t& a, const Partition_t& b) const
+{
+  // add partition b to partition a
+  if (b.empty()) return;
+  if (a.empty()) { a = b; return; }
+
+  if (fMode == kCompactBins) {
+    // both partitions are sorted: linear merge
+    Partition_t merged;
+    merged.reserve(a.size() + b.size());
+    const Partition_t& ca = a;
+    Partition_t::const_iterator ia = ca.begin(), ib = b.begin();
+    while (ia != ca.end() && ib != b.end()) {
+      if (ia->fIndex < ib->fIndex)      { merged.push_back(*ia); ++ia; }
+      else if (ib->fIndex < ia->fIndex) { merged.push_back(*ib); ++ib; }
+      else {
+        Bin_t sum = *ia;
+        sum.fContent += ib->fContent;
+        sum.fError2  += ib->fError2;
+        merged.push_back(sum);
+        ++ia; ++ib;
+      }
+    }
+    merged.insert(merged.end(), ia, ca.end());
+    merged.insert(merged.end(), ib, b.end());
+    a.swap(merged);
+    return;
+  }
+
+  // unsorted partitions: hash lookup of the bins of a
+  std::unordered_map<Long64_t, UInt_t> lookup;
+  lookup.reserve(a.size() + b.size());
+  for (UInt_t i=0; i<a.size(); i++) lookup[a[i].fIndex] = i;
+  for (UInt_t i=0; i<b.size(); i++) {
+    std::unordered_map<Long64_t, UInt_t>::const_iterator it = lookup.find(b[i].fIndex);
+    if (it == lookup.end()) {
+      lookup[b[i].fIndex] = a.size();
+      a.push_back(b[i]);
+    } else {
+      a[it->second].fContent += b[i].fContent;
+      a[it->second].fError2  += b[i].fError2;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceSparseMerger::Fill(THnSparse* const target, const std::vector<Long64_t>& strides, const Compact_t& in) const
+{
+  // write the compact representation back into target (target is reset before)
+  Int_t ndim = target->GetNdimensions();
+  std::vector<Int_t> coord(ndim);
+  std::vector<Long64_t> nbins(ndim);
+  for (Int_t d=0; d<ndim; d++) nbins[d] = target->GetAxis(d)->GetNbins() + 2;
+
+  Long64_t nFilled = 0;
+  for (UInt_t p=0; p<in.size(); p++) nFilled += in[p].size();
+  target->Reserve(nFilled);
+
+  Bool_t calcErrors = target->GetCalculateErrors();
+  for (UInt_t p=0; p<in.size(); p++) {
+    const Partition_t& part = in[p];
+    for (UInt_t i=0; i<part.size(); i++) {
+      for (Int_t d=0; d<ndim; d++) coord[d] = static_cast<Int_t>((part[i].fIndex / strides[d]) % nbins[d]);
+      Long64_t bin = target->GetBin(&coord[0], kTRUE);
+      target->SetBinContent(bin, part[i].fContent);
+      if (calcErrors) target->SetBinError2(bin, part[i].fError2);
+    }
+  }
+}
+
+//_____________________________________________________________________________
+Long64_t AliPerformanceSparseMerger::Merge(THnSparse* const target, TCollection* const list) const
+{
+  // Merge all THnSparse in list into target (target content is kept)
+  // return the number of merged objects or -1 if the fast path cannot be used
+
+  if (!target || !list) return -1;
+  if (fMode == kSequential) return -1;
+
+  std::vector<Long64_t> strides;
+  if (!ComputeStrides(target, strides)) {
+    AliDebugClass(1, Form("%s: global bin index exceeds 63 bits, use THnSparse::Add", target->GetName()));
+    return -1;
+  }
+
+  // collect the inputs, the target is the first leaf of the reduction tree
+  std::vector<const THnSparse*> inputs;
+  inputs.push_back(target);
+  Bool_t calcErrors = target->GetCalculateErrors();
+  Double_t entries = target->GetEntries();
+  TIter next(list);
+  TObject* obj = 0;
+  while ((obj = next())) {
+    const THnSparse* h = dynamic_cast<const THnSparse*>(obj);
+    if (!h || h == target) continue;
+    if (!IsCompatible(target, h)) {
+      AliDebugClass(1, Form("%s: incompatible binning of %s, use THnSparse::Add", target->GetName(), h->GetName()));
+      return -1;
+    }
+    calcErrors |= h->GetCalculateErrors();
+    entries += h->GetEntries();
+    inputs.push_back(h);
+  }
+  Int_t nInputs = inputs.size();
+  if (nInputs == 1) return 0;
+
+  Int_t nThreads = GetNThreads();
+  Int_t nPart = GetNPartitions();
+
+  // convert all inputs, one task per input
+  std::vector<Compact_t> nodes(nInputs);
+  RunParallel(nInputs, nThreads, [&](Int_t i) { Extract(inputs[i], strides, nodes[i]); });
+
+  // pairwise tree reduction, one task per (pair, partition)
+  for (Int_t step=1; step<nInputs; step*=2) {
+    std::vector<Int_t> left;
+    for (Int_t i=0; i+step<nInputs; i+=2*step) left.push_back(i);
+    Int_t nPairs = left.size();
+    RunParallel(nPairs*nPart, nThreads, [&](Int_t t) {
+      Int_t a = left[t/nPart];
+      Int_t p = t%nPart;
+      MergePartition(nodes[a][p], nodes[a+step][p]);
+    });
+    for (Int_t k=0; k<nPairs; k++) Compact_t().swap(nodes[left[k]+step]);
+  }
+
+  // convert back
+  target->Reset();
+  if (calcErrors && !target->GetCalculateErrors()) target->Sumw2();
+  Fill(target, strides, nodes[0]);
+  target->SetEntries(entries);
+
+  return nInputs-1;
+}
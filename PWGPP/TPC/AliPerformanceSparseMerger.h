@@ -0,0 +1,68 @@
+#ifndef ALIPERFORMANCESPARSEMERGER_H
+#define ALIPERFORMANCESPARSEMERGER_H
+
+//------------------------------------------------------------------------------
+// Helper to merge many THnSparse objects with identical binning in parallel
+// (same number of bins, axis limits and bin edges on every axis).
+//
+// The inputs are converted to a compact list of (global bin, content, error2)
+// entries which is hash-partitioned by global bin. The partitions of all
+// inputs are then combined by a pairwise tree reduction, where every
+// (pair, partition) combination is an independent task executed on a pool of
+// threads. Only the final result is written back into a THnSparse.
+//
+// Two bin merge flavours are available:
+//   kTreeReduction - partitions are kept unsorted and merged via a hash lookup
+//   kCompactBins   - each partition is kept sorted by global bin and merged
+//                    linearly; the result is filled back partition by
+//                    partition (sorted only within a partition)
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include "Rtypes.h"
+
+class THnSparse;
+class TCollection;
+
+class AliPerformanceSparseMerger {
+public:
+  enum EMergeMode { kSequential=0, kTreeReduction=1, kCompactBins=2 };
+
+  AliPerformanceSparseMerger(Int_t mode=kTreeReduction, Int_t nThreads=0, Int_t nPartitions=0);
+  ~AliPerformanceSparseMerger() {;}
+
+  // merge all THnSparse in the list into target, returns number of merged objects
+  // or -1 if the inputs cannot be handled (the caller should use THnSparse::Add)
+  Long64_t Merge(THnSparse* const target, TCollection* const list) const;
+
+  void SetMode(Int_t mode)               { fMode = mode; }
+  void SetNThreads(Int_t nThreads)       { fNThreads = nThreads; }
+  void SetNPartitions(Int_t nPartitions) { fNPartitions = nPartitions; }
+  Int_t GetMode() const                  { return fMode; }
+  Int_t GetNThreads() const;
+  Int_t GetNPartitions() const;
+
+  // one filled bin of the compact representation
+  struct Bin_t {
+    Long64_t fIndex;   // global bin index including under/overflow
+    Double_t fContent; // bin content
+    Double_t fError2;  // squared bin error
+  };
+
+private:
+  typedef std::vector<Bin_t> Partition_t;
+  typedef std::vector<Partition_t> Compact_t;
+
+  Bool_t   ComputeStrides(const THnSparse* const target, std::vector<Long64_t>& strides) const;
+  Bool_t   IsCompatible(const THnSparse* const target, const THnSparse* const h) const;
+  void     Extract(const THnSparse* const h, const std::vector<Long64_t>& strides, Compact_t& out) const;
+  void     MergePartition(Partition_t& a, const Partition_t& b) const;
+  void     Fill(THnSparse* const target, const std::vector<Long64_t>& strides, const Compact_t& in) const;
+  UInt_t   PartitionOf(Long64_t index, Int_t nPart) const;
+
+  Int_t fMode;        // merge mode (EMergeMode)
+  Int_t fNThreads;    // number of worker threads, 0 = hardware concurrency
+  Int_t fNPartitions; // number of hash partitions, 0 = 4 x number of threads
+};
+
+#endif
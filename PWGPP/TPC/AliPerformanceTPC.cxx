@@ -778,6 +778,9 @@ Long64_t AliPerformanceTPC::Merge(TCollection* const list)
   TObject* obj = 0;
   TObjArray* objArrayList = 0;
   objArrayList = new TObjArray();
+  TObjArray clustHistoList;
+  TObjArray eventHistoList;
+  TObjArray trackHistoList;
 
   // collection of generated histograms
   Int_t count=0;
@@ -786,15 +789,20 @@ Long64_t AliPerformanceTPC::Merge(TCollection* const list)
     AliPerformanceTPC* entry = dynamic_cast<AliPerformanceTPC*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fTPCClustHisto) && (entry->fTPCClustHisto)) { fTPCClustHisto->Add(entry->fTPCClustHisto); }
-        if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { fTPCEventHisto->Add(entry->fTPCEventHisto); }
-        if ((fTPCTrackHisto) && (entry->fTPCTrackHisto)) { fTPCTrackHisto->Add(entry->fTPCTrackHisto); }
+        if ((fTPCClustHisto) && (entry->fTPCClustHisto)) { clustHistoList.Add(entry->fTPCClustHisto); }
+        if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { eventHistoList.Add(entry->fTPCEventHisto); }
+        if ((fTPCTrackHisto) && (entry->fTPCTrackHisto)) { trackHistoList.Add(entry->fTPCTrackHisto); }
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
 
     count++;
   }
+  if (merge) {
+    MergeTHnSparse(fTPCClustHisto, &clustHistoList);
+    MergeTHnSparse(fTPCEventHisto, &eventHistoList);
+    MergeTHnSparse(fTPCTrackHisto, &trackHistoList);
+  }
   if (fFolderObj) { fFolderObj->Merge(objArrayList); } 
   // to signal that track histos were not merged: reset
   if (!merge) { fTPCTrackHisto->Reset(); fTPCClustHisto->Reset(); fTPCEventHisto->Reset(); }
@@ -15,10 +15,16 @@
 
 /* $Id$ */
 
+#include <TBufferFile.h>
 #include <TChain.h>
 #include <TFile.h>
+#include <TMD5.h>
+#include <TROOT.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
  
 #include "AliTender.h"
+#include "AliTenderRunContext.h"
 #include "AliTenderSupply.h"
 #include "AliAnalysisManager.h"
 #include "AliCDBManager.h"
@@ -41,7 +47,10 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fRunCacheDir(),
+           fRunCacheNThreads(0),
+           fRunContext(NULL)
 {
 // Dummy constructor
 }
@@ -58,7 +67,10 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fRunCacheDir(),
+           fRunCacheNThreads(0),
+           fRunContext(NULL)
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -72,6 +84,7 @@ AliTender::~AliTender()
     fSupplies->Delete();
     delete fSupplies;
   }
+  delete fRunContext;
 }
 
 //______________________________________________________________________________
@@ -115,6 +128,9 @@ void AliTender::ConnectInputData(Option_t* option)
   }   
 
   fCDB = AliCDBManager::Instance();
+  // Run conditions of the supplies kept in per-run snapshots (only done when explicitly requested)
+  if (fRunCacheDir.Length() && !fRunContext)
+    fRunContext = new AliTenderRunContext(fRunCacheDir, GetConfigurationKey(), fRunCacheNThreads);
   // Initialize OCDB (only done when explicitly requested)
   if(fHandleCDB){
     // Create CDB manager
@@ -124,12 +140,24 @@ void AliTender::ConnectInputData(Option_t* option)
     // Unlock CDB
     fCDBkey = fCDB->SetLock(kFALSE, fCDBkey);
     if(run){ fCDB->SetRun(fRun); }
+    if(run && fRunContext) fRunContext->BeginRun(fRun, fCDB);
     // Lock CDB
     fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
+  } else if (run && fRunContext) {
+    fRunContext->BeginRun(fRun);
   }
   TIter next(fSupplies);
   AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->Init();
+  if (!fRunContext) {
+    while ((supply=(AliTenderSupply*)next())) supply->Init();
+    return;
+  }
+  TStopwatch timer;
+  while ((supply=(AliTenderSupply*)next())) {
+    timer.Start(kTRUE);
+    supply->Init();
+    fRunContext->AddSupplyTime(supply->GetName(), timer.RealTime());
+  }
 }
 
 //______________________________________________________________________________
@@ -166,13 +194,27 @@ void AliTender::UserExec(Option_t* option)
       // Unlock CDB
       fCDBkey = fCDB->SetLock(kFALSE, fCDBkey);
       fCDB->SetRun(fRun);
+      if (fRunContext) fRunContext->BeginRun(fRun, fCDB);
       // Lock CDB
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
-    } 
+    } else if (fRunContext) {
+      fRunContext->BeginRun(fRun);
+    }
   }
   TIter next(fSupplies);
   AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  if (fRunChanged && fRunContext) {
+    // The supplies load the run conditions here: time them, then snapshot
+    TStopwatch timer;
+    while ((supply=(AliTenderSupply*)next())) {
+      timer.Start(kTRUE);
+      supply->ProcessEvent();
+      fRunContext->AddSupplyTime(supply->GetName(), timer.RealTime());
+    }
+    fRunContext->EndRunInit(fHandleCDB ? fCDB : NULL);
+  } else {
+    while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  }
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -187,3 +229,33 @@ void AliTender::SetDefaultCDBStorage(const char *dbString)
 // Set default CDB storage
    fDefaultStorage = dbString;
 }
+
+//______________________________________________________________________________
+TString AliTender::GetConfigurationKey() const
+{
+// Hash of the configuration of the supplies, of the OCDB settings and of the
+// software versions, identifying the run snapshots that can be shared between
+// jobs. The state of the OADB files is checked when a snapshot is read
+// (see AliTenderRunContext).
+  TBufferFile buffer(TBuffer::kWrite);
+  TIter next(fSupplies);
+  AliTenderSupply *supply;
+  while ((supply=(AliTenderSupply*)next())) {
+    // The tender itself is not part of the configuration
+    supply->SetTender(NULL);
+    buffer.WriteObject(supply);
+    supply->SetTender(this);
+  }
+  if (fCDBSettings) buffer.WriteObject(fCDBSettings);
+  TString settings = TString::Format("%s|%d|%s|%s|%s", fDefaultStorage.Data(), (Int_t)fHandleCDB,
+                                     gROOT->GetVersion(), gSystem->Getenv("ALIROOT_VERSION"),
+                                     gSystem->Getenv("ALIPHYSICS_VERSION"));
+#ifdef ALIROOT_REVISION
+  settings += TString::Format("|%s", ALIROOT_REVISION);
+#endif
+  buffer.WriteString(settings.Data());
+  TMD5 md5;
+  md5.Update((const UChar_t*)buffer.Buffer(), buffer.Length());
+  md5.Final();
+  return TString(md5.AsString());
+}
@@ -24,6 +24,7 @@ class AliCDBManager;
 class AliESDEvent;
 class AliESDInputHandler;
 class AliTenderSupply;
+class AliTenderRunContext;
 
 class AliTender : public AliAnalysisTaskSE {
 
@@ -43,6 +44,9 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  TString                   fRunCacheDir;    // Directory of the per-run snapshots (empty: no run cache)
+  Int_t                     fRunCacheNThreads; // Threads for preloading the OADB containers (0: all cores)
+  AliTenderRunContext      *fRunContext;     //! Run conditions of the supplies (snapshots, timings)
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
@@ -58,6 +62,8 @@ public:
   AliESDInputHandler       *GetESDhandler() const {return fESDhandler;}
   AliESDEvent              *GetEvent() const {return fESD;}
   TObjArray                *GetSupplies() const {return fSupplies;}
+  AliTenderRunContext      *GetRunContext() const {return fRunContext;}
+  TString                   GetConfigurationKey() const;
   void                      SetCheckEventSelection(Bool_t flag=kTRUE) {TObject::SetBit(kCheckEventSelection,flag);}
   Bool_t                    RunChanged() const {return fRunChanged;}
   // Configuration
@@ -68,6 +74,15 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Keep the run-dependent conditions of the supplies (OADB objects requested via
+   * AliTenderSupply::GetOADBObject and, with SetHandleOCDB, the OCDB entries) in
+   * per-run snapshots in a local directory, shared by the jobs with the same
+   * configuration. Without snapshot, the OADB containers are preloaded in parallel.
+   * @param[in] dir Cache directory (empty: disabled)
+   * @param[in] nThreads Threads for preloading (0: number of cores)
+   */
+  void                      SetRunCache(const char *dir="./TenderRunCache", Int_t nThreads=0) {fRunCacheDir = dir; fRunCacheNThreads = nThreads;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
@@ -75,6 +90,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
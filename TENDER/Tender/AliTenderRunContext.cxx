@@ -0,0 +1,426 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+#include <algorithm>
+
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#include <atomic>
+#include <thread>
+#endif
+#include <TROOT.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TList.h>
+#include <TMap.h>
+#include <TObjString.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+
+#include "AliCDBManager.h"
+#include "AliOADBContainer.h"
+#include "AliTenderRunContext.h"
+
+//______________________________________________________________________________
+AliTenderRunContext::AliTenderRunContext(const char *cacheDir, const char *configKey, Int_t nThreads)
+                    :fCacheDir(cacheDir),
+                     fConfigKey(configKey),
+                     fNThreads(nThreads),
+                     fRun(-1),
+                     fFromSnapshot(kFALSE),
+                     fRunInitDone(kFALSE),
+                     fRunObjects(new TMap()),
+                     fManifest(new TList()),
+                     fContainers(),
+                     fTimings(),
+                     fSupplyOrder()
+{
+// Default constructor
+  fRunObjects->SetOwnerKeyValue(kTRUE, kTRUE);
+  fManifest->SetOwner(kTRUE);
+  gSystem->ExpandPathName(fCacheDir);
+  if (fCacheDir.Length()) gSystem->mkdir(fCacheDir, kTRUE);
+}
+
+//______________________________________________________________________________
+AliTenderRunContext::~AliTenderRunContext()
+{
+// Destructor
+  ReleaseContainers();
+  delete fRunObjects;
+  delete fManifest;
+}
+
+//______________________________________________________________________________
+TString AliTenderRunContext::GetSnapshotName(Int_t run, Bool_t ocdb) const
+{
+// Snapshot file of a run for the current configuration
+  return TString::Format("%s/TenderRun%09d_%s%s.root", fCacheDir.Data(), run, fConfigKey.Data(), ocdb ? "_OCDB" : "");
+}
+
+//______________________________________________________________________________
+TString AliTenderRunContext::GetManifestName() const
+{
+// OADB containers requested with the current configuration (any run)
+  return TString::Format("%s/TenderManifest_%s.root", fCacheDir.Data(), fConfigKey.Data());
+}
+
+//______________________________________________________________________________
+TString AliTenderRunContext::GetFileState(const char *fileName)
+{
+// Size and modification time of an OADB file, empty if not accessible
+  TString path(fileName);
+  gSystem->ExpandPathName(path);
+  FileStat_t stat;
+  if (gSystem->GetPathInfo(path, stat)) return TString();
+  return TString::Format("%lld|%ld", (Long64_t)stat.fSize, stat.fMtime);
+}
+
+//______________________________________________________________________________
+TList *AliTenderRunContext::GetFileStates() const
+{
+// State of the OADB files of the manifest ("file|size|mtime"), owned by the caller
+  TList *states = new TList();
+  states->SetOwner(kTRUE);
+  TIter next(fManifest);
+  TObject *entry;
+  while ((entry=next())) {
+    TString fileName(entry->GetName());
+    Ssiz_t separator = fileName.Index("|");
+    if (separator != kNPOS) fileName.Remove(separator);
+    TString state = TString::Format("%s|%s", fileName.Data(), GetFileState(fileName).Data());
+    if (!states->FindObject(state)) states->Add(new TObjString(state));
+  }
+  return states;
+}
+
+//______________________________________________________________________________
+AliTenderRunContext::SupplyTiming &AliTenderRunContext::GetTiming(const char *supply)
+{
+// Timing record of a supply, created on first use
+  std::string name(supply ? supply : "");
+  if (fTimings.find(name) == fTimings.end()) fSupplyOrder.push_back(name);
+  return fTimings[name];
+}
+
+//______________________________________________________________________________
+void AliTenderRunContext::AddSupplyTime(const char *supply, Double_t seconds)
+{
+// Add the time spent by a supply in the initialisation for the current run
+  GetTiming(supply).fSeconds += seconds;
+}
+
+//______________________________________________________________________________
+void AliTenderRunContext::BeginRun(Int_t run, AliCDBManager *cdb)
+{
+// Conditions of a new run: from the snapshot if available, otherwise the
+// OADB containers known to be needed are preloaded concurrently.
+// The OCDB manager (if handled by the tender) must be unlocked and set to the run.
+  if (run == fRun) return;
+  fRun = run;
+  fFromSnapshot = kFALSE;
+  fRunInitDone = kFALSE;
+  fRunObjects->DeleteAll();
+  fTimings.clear();
+  fSupplyOrder.clear();
+
+  if (ReadSnapshot(cdb)) {
+    fFromSnapshot = kTRUE;
+    Printf("AliTenderRunContext: #### Conditions of run %d from snapshot %s", fRun, GetSnapshotName(fRun).Data());
+    return;
+  }
+  // OCDB entries are kept in the cache of the manager to be dumped in the snapshot
+  if (cdb) cdb->SetCacheFlag(kTRUE);
+
+  // Containers requested by a previous job with the same configuration
+  if (!fManifest->GetEntries() && !gSystem->AccessPathName(GetManifestName())) {
+    TDirectory *owd = gDirectory;
+    TFile *file = TFile::Open(GetManifestName());
+    TList *manifest = file ? dynamic_cast<TList*>(file->Get("Manifest")) : NULL;
+    if (manifest) {
+      TIter next(manifest);
+      TObject *entry;
+      while ((entry=next())) fManifest->Add(new TObjString(entry->GetName()));
+      manifest->SetOwner(kTRUE);
+      delete manifest;
+    }
+    delete file;
+    if (owd) owd->cd();
+  }
+  PreloadContainers();
+}
+
+//______________________________________________________________________________
+void AliTenderRunContext::EndRunInit(AliCDBManager *cdb)
+{
+// The supplies are initialised for the current run: write the snapshot,
+// release the OADB containers and report the timings
+  if (fRunInitDone || fRun < 0) return;
+  fRunInitDone = kTRUE;
+  if (!fFromSnapshot) WriteSnapshot(cdb);
+  ReleaseContainers();
+  PrintTimings();
+}
+
+//______________________________________________________________________________
+AliOADBContainer *AliTenderRunContext::LoadContainer(const std::string &key)
+{
+// Read an OADB container, key: "file|container key"
+  size_t separator = key.find('|');
+  if (separator == std::string::npos) return NULL;
+  std::string fileName = key.substr(0, separator);
+  std::string containerKey = key.substr(separator+1);
+  AliOADBContainer *cont = new AliOADBContainer("");
+  if (cont->InitFromFile(fileName.c_str(), containerKey.c_str())) {
+    delete cont;
+    return NULL;
+  }
+  return cont;
+}
+
+//______________________________________________________________________________
+AliOADBContainer *AliTenderRunContext::GetContainer(const TString &fileName, const TString &containerKey)
+{
+// OADB container, read if not yet preloaded
+  std::string key(TString::Format("%s|%s", fileName.Data(), containerKey.Data()).Data());
+  if (!fManifest->FindObject(key.c_str())) fManifest->Add(new TObjString(key.c_str()));
+  std::map<std::string, AliOADBContainer*>::iterator it = fContainers.find(key);
+  if (it != fContainers.end()) return it->second;
+  AliOADBContainer *cont = LoadContainer(key);
+  fContainers[key] = cont;
+  return cont;
+}
+
+//______________________________________________________________________________
+void AliTenderRunContext::PreloadContainers()
+{
+// Read the OADB containers of the manifest, in parallel threads with ROOT 6
+  std::vector<std::string> keys;
+  TIter next(fManifest);
+  TObject *entry;
+  while ((entry=next())) {
+    if (fContainers.find(entry->GetName()) == fContainers.end()) keys.push_back(entry->GetName());
+  }
+  if (keys.empty()) return;
+
+  std::vector<AliOADBContainer*> loaded(keys.size(), (AliOADBContainer*)NULL);
+  TStopwatch timer;
+  timer.Start();
+  TDirectory *owd = gDirectory;
+  Int_t nThreads = 1;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  nThreads = (fNThreads > 0) ? fNThreads : (Int_t)std::thread::hardware_concurrency();
+  nThreads = std::max(1, std::min(nThreads, (Int_t)keys.size()));
+  if (nThreads > 1) {
+    ROOT::EnableThreadSafety();
+    std::atomic<size_t> nextKey(0);
+    std::vector<std::thread> workers;
+    for (Int_t iThread = 0; iThread < nThreads; iThread++) {
+      workers.push_back(std::thread([&]() {
+        size_t iKey;
+        while ((iKey = nextKey++) < keys.size()) loaded[iKey] = LoadContainer(keys[iKey]);
+      }));
+    }
+    for (size_t iThread = 0; iThread < workers.size(); iThread++) workers[iThread].join();
+  }
+#endif
+  if (nThreads == 1) {
+    for (size_t iKey = 0; iKey < keys.size(); iKey++) loaded[iKey] = LoadContainer(keys[iKey]);
+  }
+  if (owd) owd->cd();
+  for (size_t iKey = 0; iKey < keys.size(); iKey++) fContainers[keys[iKey]] = loaded[iKey];
+  timer.Stop();
+  Printf("AliTenderRunContext: #### Run %d: %d OADB containers preloaded with %d threads in %.2f s",
+         fRun, (Int_t)keys.size(), nThreads, timer.RealTime());
+}
+
+//______________________________________________________________________________
+void AliTenderRunContext::ReleaseContainers()
+{
+// Delete the OADB containers (the objects given to the supplies are copies)
+  for (std::map<std::string, AliOADBContainer*>::iterator it = fContainers.begin(); it != fContainers.end(); ++it)
+    delete it->second;
+  fContainers.clear();
+}
+
+//______________________________________________________________________________
+Bool_t AliTenderRunContext::ReadSnapshot(AliCDBManager *cdb)
+{
+// Read the OADB objects (and OCDB entries) of the current run from the snapshot.
+// The snapshot is not used if one of its OADB files was modified since it was written.
+  if (!fCacheDir.Length()) return kFALSE;
+  TString name = GetSnapshotName(fRun);
+  TString ocdbName = GetSnapshotName(fRun, kTRUE);
+  if (gSystem->AccessPathName(name)) return kFALSE;
+  if (cdb && gSystem->AccessPathName(ocdbName)) return kFALSE;
+
+  TDirectory *owd = gDirectory;
+  TFile *file = TFile::Open(name);
+  TMap *objects = NULL;
+  TList *manifest = NULL;
+  TList *fileStates = NULL;
+  if (file && !file->IsZombie()) {
+    objects = dynamic_cast<TMap*>(file->Get("RunObjects"));
+    manifest = dynamic_cast<TList*>(file->Get("Manifest"));
+    fileStates = dynamic_cast<TList*>(file->Get("FileStates"));
+  }
+  delete file;
+  if (owd) owd->cd();
+  Bool_t upToDate = (fileStates != NULL);
+  if (fileStates) {
+    TIter next(fileStates);
+    TObject *entry;
+    while ((entry=next())) {
+      TString fileName(entry->GetName());
+      Ssiz_t separator = fileName.Index("|");
+      if (separator != kNPOS) fileName.Remove(separator);
+      if (TString::Format("%s|%s", fileName.Data(), GetFileState(fileName).Data()) != entry->GetName()) {
+        Printf("AliTenderRunContext: OADB file %s modified, snapshot %s not used", fileName.Data(), name.Data());
+        upToDate = kFALSE;
+        break;
+      }
+    }
+    fileStates->SetOwner(kTRUE);
+    delete fileStates;
+  }
+  if (manifest) {
+    TIter next(manifest);
+    TObject *entry;
+    while ((entry=next())) {
+      if (!fManifest->FindObject(entry->GetName())) fManifest->Add(new TObjString(entry->GetName()));
+    }
+    manifest->SetOwner(kTRUE);
+    delete manifest;
+  }
+  if (!objects) return kFALSE;
+  if (!upToDate) {
+    delete objects;
+    return kFALSE;
+  }
+  if (cdb) {
+    cdb->SetCacheFlag(kTRUE);
+    Bool_t ok = cdb->InitFromSnapshot(ocdbName);
+    if (owd) owd->cd();
+    if (!ok) {
+      delete objects;
+      return kFALSE;
+    }
+  }
+  delete fRunObjects;
+  fRunObjects = objects;
+  fRunObjects->SetOwnerKeyValue(kTRUE, kTRUE);
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+void AliTenderRunContext::WriteSnapshot(AliCDBManager *cdb)
+{
+// Write the snapshot of the current run. Files are written under a temporary
+// name and renamed, the OCDB part first, so that concurrent jobs only see
+// complete snapshots.
+  if (!fCacheDir.Length()) return;
+  TDirectory *owd = gDirectory;
+  TString name = GetSnapshotName(fRun);
+  TString tmpName = TString::Format("%s.%d.tmp", name.Data(), gSystem->GetPid());
+  TFile *file = TFile::Open(tmpName, "RECREATE");
+  if (!file || file->IsZombie()) {
+    Printf("AliTenderRunContext: cannot write snapshot %s", name.Data());
+    delete file;
+    if (owd) owd->cd();
+    return;
+  }
+  fRunObjects->Write("RunObjects", TObject::kSingleKey);
+  fManifest->Write("Manifest", TObject::kSingleKey);
+  TList *fileStates = GetFileStates();
+  fileStates->Write("FileStates", TObject::kSingleKey);
+  delete fileStates;
+  file->Close();
+  delete file;
+
+  if (cdb) {
+    TString ocdbName = GetSnapshotName(fRun, kTRUE);
+    TString ocdbTmpName = TString::Format("%s.%d.tmp", ocdbName.Data(), gSystem->GetPid());
+    cdb->DumpToSnapshotFile(ocdbTmpName, kFALSE);
+    gSystem->Rename(ocdbTmpName, ocdbName);
+  }
+  gSystem->Rename(tmpName, name);
+
+  // Containers needed by this configuration, preloaded by the next jobs
+  TString manifestName = GetManifestName();
+  TString manifestTmpName = TString::Format("%s.%d.tmp", manifestName.Data(), gSystem->GetPid());
+  file = TFile::Open(manifestTmpName, "RECREATE");
+  if (file && !file->IsZombie()) {
+    fManifest->Write("Manifest", TObject::kSingleKey);
+    file->Close();
+    gSystem->Rename(manifestTmpName, manifestName);
+  }
+  delete file;
+  if (owd) owd->cd();
+  Printf("AliTenderRunContext: #### Snapshot of run %d written to %s", fRun, name.Data());
+}
+
+//______________________________________________________________________________
+TObject *AliTenderRunContext::LoadOADBObject(const char *fileName, const char *containerKey,
+                                             Int_t run, const char *defName, const char *passName)
+{
+// Copy (owned by the caller) of an object of an OADB container read from
+// file (no caching). The container owns its objects and is deleted here.
+  AliOADBContainer cont("");
+  if (cont.InitFromFile(fileName, containerKey)) return NULL;
+  TObject *obj = cont.GetObject(run, defName, passName);
+  return obj ? obj->Clone() : NULL;
+}
+
+//______________________________________________________________________________
+TObject *AliTenderRunContext::GetOADBObject(const char *supply, const char *fileName, const char *containerKey,
+                                            Int_t run, const char *defName, const char *passName)
+{
+// Copy (owned by the caller) of an object of an OADB container, taken from
+// the snapshot or from the (preloaded) container
+  TStopwatch timer;
+  timer.Start();
+  SupplyTiming &timing = GetTiming(supply);
+  timing.fNRequests++;
+  TString key = TString::Format("%s|%s|%d|%s|%s", fileName, containerKey, run, defName, passName);
+  TObject *obj = fRunObjects->GetValue(key);
+  if (obj) {
+    if (fFromSnapshot) timing.fNFromSnapshot++;
+  } else {
+    AliOADBContainer *cont = GetContainer(fileName, containerKey);
+    TObject *found = cont ? cont->GetObject(run, defName, passName) : NULL;
+    if (found) {
+      obj = found->Clone();
+      fRunObjects->Add(new TObjString(key), obj);
+    }
+  }
+  TObject *copy = obj ? obj->Clone() : NULL;
+  timer.Stop();
+  timing.fOADBSeconds += timer.RealTime();
+  return copy;
+}
+
+//______________________________________________________________________________
+void AliTenderRunContext::PrintTimings() const
+{
+// Load timings of the supplies for the current run
+  Printf("AliTenderRunContext: #### Run %d, conditions %s", fRun, fFromSnapshot ? "from snapshot" : "loaded");
+  for (size_t i = 0; i < fSupplyOrder.size(); i++) {
+    const SupplyTiming &timing = fTimings.find(fSupplyOrder[i])->second;
+    Printf("   %-30s %8.3f s (OADB %.3f s, %d objects, %d from snapshot)", fSupplyOrder[i].c_str(),
+           timing.fSeconds, timing.fOADBSeconds, timing.fNRequests, timing.fNFromSnapshot);
+  }
+}
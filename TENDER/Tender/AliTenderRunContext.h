@@ -0,0 +1,95 @@
+#ifndef ALITENDERRUNCONTEXT_H
+#define ALITENDERRUNCONTEXT_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//==============================================================================
+//   AliTenderRunContext - Run-dependent conditions of the tender supplies.
+//      Enabled with AliTender::SetRunCache(). At each run change:
+//      - the OADB objects requested by the supplies (AliTenderSupply::
+//        GetOADBObject) and, if the tender handles the OCDB, the OCDB entries
+//        are taken from a per-run snapshot in the local cache directory, keyed
+//        by run and tender configuration; a snapshot is discarded if the size
+//        or modification time of one of its OADB files changed
+//      - without snapshot, the OADB containers requested for the previous run
+//        (or by a previous job with the same configuration) are preloaded
+//        concurrently, and the snapshot is written once the supplies are
+//        initialised
+//      - the load time of each supply is reported
+//==============================================================================
+
+#include <map>
+#include <string>
+#include <vector>
+#include <Rtypes.h>
+#include <TString.h>
+
+class TObject;
+class TMap;
+class TList;
+class AliCDBManager;
+class AliOADBContainer;
+
+class AliTenderRunContext {
+
+public:
+  AliTenderRunContext(const char *cacheDir, const char *configKey, Int_t nThreads=0);
+  virtual ~AliTenderRunContext();
+
+  Int_t                     GetRun() const {return fRun;}
+  Bool_t                    IsFromSnapshot() const {return fFromSnapshot;}
+  const char               *GetConfigKey() const {return fConfigKey.Data();}
+
+  // Run control
+  void                      BeginRun(Int_t run, AliCDBManager *cdb=NULL);
+  void                      EndRunInit(AliCDBManager *cdb=NULL);
+
+  // Conditions
+  TObject                  *GetOADBObject(const char *supply, const char *fileName, const char *containerKey,
+                                          Int_t run, const char *defName="", const char *passName="");
+  static TObject           *LoadOADBObject(const char *fileName, const char *containerKey,
+                                           Int_t run, const char *defName="", const char *passName="");
+
+  // Timings
+  void                      AddSupplyTime(const char *supply, Double_t seconds);
+  void                      PrintTimings() const;
+
+private:
+  struct SupplyTiming {
+    SupplyTiming() : fSeconds(0.), fOADBSeconds(0.), fNRequests(0), fNFromSnapshot(0) {}
+    Double_t fSeconds;      // Init and first event of the run
+    Double_t fOADBSeconds;  // OADB requests (container loading included)
+    Int_t    fNRequests;    // OADB objects requested
+    Int_t    fNFromSnapshot;// OADB objects taken from the snapshot
+  };
+
+  AliTenderRunContext(const AliTenderRunContext &other);
+  AliTenderRunContext& operator=(const AliTenderRunContext &other);
+
+  TString                   GetSnapshotName(Int_t run, Bool_t ocdb=kFALSE) const;
+  TString                   GetManifestName() const;
+  static TString            GetFileState(const char *fileName);
+  TList                    *GetFileStates() const;
+  AliOADBContainer         *GetContainer(const TString &fileName, const TString &containerKey);
+  SupplyTiming             &GetTiming(const char *supply);
+  static AliOADBContainer  *LoadContainer(const std::string &key);
+  void                      PreloadContainers();
+  void                      ReleaseContainers();
+  Bool_t                    ReadSnapshot(AliCDBManager *cdb);
+  void                      WriteSnapshot(AliCDBManager *cdb);
+
+  TString                   fCacheDir;       // Directory of the snapshots
+  TString                   fConfigKey;      // Hash of the tender configuration
+  Int_t                     fNThreads;       // Threads for preloading (0: hardware concurrency)
+  Int_t                     fRun;            // Current run
+  Bool_t                    fFromSnapshot;   // Conditions of the current run from snapshot
+  Bool_t                    fRunInitDone;    // Snapshot written / timings reported for the current run
+  TMap                     *fRunObjects;     // OADB objects of the current run (owned)
+  TList                    *fManifest;       // OADB containers requested ("file|key")
+  std::map<std::string, AliOADBContainer*> fContainers; // Loaded OADB containers
+  std::map<std::string, SupplyTiming>      fTimings;    // Load timings per supply
+  std::vector<std::string>                 fSupplyOrder;// Supplies in order of first appearance
+};
+#endif
@@ -16,6 +16,7 @@
 /* $Id$ */
  
 #include "AliTender.h"
+#include "AliTenderRunContext.h"
 #include "AliTenderSupply.h"
 
 ClassImp(AliTenderSupply)
@@ -60,3 +61,15 @@ AliTenderSupply& AliTenderSupply::operator=(const AliTenderSupply &other)
    fTender = other.fTender;
    return *this;
 }
+
+//______________________________________________________________________________
+TObject *AliTenderSupply::GetOADBObject(const char *fileName, const char *containerKey, Int_t run,
+                                        const char *defName, const char *passName) const
+{
+// Object of an OADB container for a run, owned by the caller. Taken from the run
+// context of the tender if enabled (AliTender::SetRunCache), otherwise read from
+// the OADB file.
+   AliTenderRunContext *context = fTender ? fTender->GetRunContext() : NULL;
+   if (context) return context->GetOADBObject(GetName(), fileName, containerKey, run, defName, passName);
+   return AliTenderRunContext::LoadOADBObject(fileName, containerKey, run, defName, passName);
+}
@@ -33,6 +33,9 @@ public:
   virtual void              ProcessEvent() = 0;
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
+  // Conditions
+  TObject                  *GetOADBObject(const char *fileName, const char *containerKey, Int_t run,
+                                          const char *defName="", const char *passName="") const;
     
   ClassDef(AliTenderSupply,1)  // Base class for tender user algorithms
 };
@@ -912,38 +912,28 @@ Bool_t AliEMCALTenderSupply::InitMisalignMatrix()
 
   if (fMisalignSurvey == kdefault)
   { //take default alignment corresponding to run no
-    AliOADBContainer emcalgeoCont(Form("emcal"));
-    emcalgeoCont.InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root",Form("AliEMCALgeo"));
-    mobj=(TObjArray*)emcalgeoCont.GetObject(runGM,"EmcalMatrices");
+    mobj=(TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root","AliEMCALgeo",runGM,"EmcalMatrices");
   }
   
   if (fMisalignSurvey == kSurveybyS)
   { //take alignment at sector level
     if (runGM <= 140000) { //2010 data
-      AliOADBContainer emcalgeoCont(Form("emcal2010"));
-      emcalgeoCont.InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root",Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey10");
+      mobj=(TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root","AliEMCALgeo",100,"survey10");
     } 
     else if (runGM>140000)
     { // 2011 LHC11a pass1 data
-      AliOADBContainer emcalgeoCont(Form("emcal2011"));
-      emcalgeoCont.InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root",Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey11byS");      
+      mobj=(TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root","AliEMCALgeo",100,"survey11byS");      
     }
   }
 
   if (fMisalignSurvey == kSurveybyM)
   { //take alignment at module level
     if (runGM <= 140000) { //2010 data
-      AliOADBContainer emcalgeoCont(Form("emcal2010"));
-      emcalgeoCont.InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root",Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey10");
+      mobj=(TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root","AliEMCALgeo",100,"survey10");
     } 
     else if (runGM>140000) 
     { // 2011 LHC11a pass1 data
-      AliOADBContainer emcalgeoCont(Form("emcal2011"));
-      emcalgeoCont.InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root",Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey11byM");      
+      mobj=(TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/EMCAL/EMCALlocal2master.root","AliEMCALgeo",100,"survey11byM");      
     }
   }
 
@@ -991,7 +981,7 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
   
   Int_t runBC = event->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0) AliInfo(Form("Loading Bad Channels OADB from given path %s",fBasePath.Data()));
@@ -1005,7 +995,7 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
     
     if (fbad) delete fbad;
     
-    contBC->InitFromFile(Form("%s/EMCALBadChannels.root",fBasePath.Data()),"AliEMCALBadChannels");    
+    fileBC = Form("%s/EMCALBadChannels.root",fBasePath.Data());    
   } 
   else 
   { // Else choose the one in the $ALICE_PHYSICS directory
@@ -1020,14 +1010,13 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
       
     if (fbad) delete fbad;
     
-    contBC->InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALBadChannels.root","AliEMCALBadChannels"); 
+    fileBC = "$ALICE_PHYSICS/OADB/EMCAL/EMCALBadChannels.root"; 
   }
   
-  TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
+  TObjArray *arrayBC=(TObjArray*)GetOADBObject(fileBC.Data(),"AliEMCALBadChannels",runBC);
   if (!arrayBC)
   {
     AliError(Form("No external hot channel set for run number: %d", runBC));
-    delete contBC;
     return 2; 
   }
 
@@ -1045,10 +1034,11 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
       continue;
     }
     h->SetDirectory(0);
+    arrayBC->Remove(h); // kept by the reco utils
     fEMCALRecoUtils->SetEMCALChannelStatusMap(i,h);
   }
   
-  delete contBC;
+  delete arrayBC;
   
   return 1;  
 }
@@ -1072,7 +1062,7 @@ Int_t AliEMCALTenderSupply::InitRecalib()
 
   Int_t runRC = event->GetRunNumber();
       
-  AliOADBContainer *contRF=new AliOADBContainer("");
+  TString fileRF;
   if (fBasePath!="") 
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0)  AliInfo(Form("Loading Recalib OADB from given path %s",fBasePath.Data()));
@@ -1086,7 +1076,7 @@ Int_t AliEMCALTenderSupply::InitRecalib()
     
     if (fRecalib) delete fRecalib;
     
-    contRF->InitFromFile(Form("%s/EMCALRecalib.root",fBasePath.Data()),"AliEMCALRecalib");
+    fileRF = Form("%s/EMCALRecalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
@@ -1101,14 +1091,13 @@ Int_t AliEMCALTenderSupply::InitRecalib()
     
     if (fRecalib) delete fRecalib;
       
-    contRF->InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALRecalib.root","AliEMCALRecalib");     
+    fileRF = "$ALICE_PHYSICS/OADB/EMCAL/EMCALRecalib.root";     
   }
 
-  TObjArray *recal=(TObjArray*)contRF->GetObject(runRC);
+  TObjArray *recal=(TObjArray*)GetOADBObject(fileRF.Data(),"AliEMCALRecalib",runRC);
   if (!recal)
   {
     AliError(Form("No Objects for run: %d",runRC));
-    delete contRF;
     return 2;
   } 
 
@@ -1116,7 +1105,7 @@ Int_t AliEMCALTenderSupply::InitRecalib()
   if (!recalpass)
   {
     AliError(Form("No Objects for run: %d - %s",runRC,fFilepass.Data()));
-    delete contRF;
+    delete recal;
     return 2;
   }
 
@@ -1124,7 +1113,7 @@ Int_t AliEMCALTenderSupply::InitRecalib()
   if (!recalib)
   {
     AliError(Form("No Recalib histos found for  %d - %s",runRC,fFilepass.Data())); 
-    delete contRF;
+    delete recal;
     return 2;
   }
 
@@ -1143,10 +1132,11 @@ Int_t AliEMCALTenderSupply::InitRecalib()
       continue;
     }
     h->SetDirectory(0);
+    recalib->Remove(h); // kept by the reco utils
     fEMCALRecoUtils->SetEMCALChannelRecalibrationFactors(i,h);
   }
   
-  delete contRF;
+  delete recal;
   
   return 1;
 }
@@ -1170,7 +1160,8 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
   
   Int_t runRC = event->GetRunNumber();
   
-  AliOADBContainer *contRF=new AliOADBContainer("");
+  AliOADBContainer *contRF=0;
+  TString fileRF;
   if (fBasePath!="") 
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0)  AliInfo(Form("Loading Recalib OADB from given path %s",fBasePath.Data()));
@@ -1184,7 +1175,7 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
     
     if (fRunDepRecalib) delete fRunDepRecalib;
     
-    contRF->InitFromFile(Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data()),"AliEMCALRunDepTempCalibCorrections");
+    fileRF = Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
@@ -1199,15 +1190,17 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
     
     if (fRunDepRecalib) delete fRunDepRecalib;
     
-    contRF->InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALTemperatureCorrCalib.root","AliEMCALRunDepTempCalibCorrections");     
+    fileRF = "$ALICE_PHYSICS/OADB/EMCAL/EMCALTemperatureCorrCalib.root";     
   }
   
-  TH1S *rundeprecal=(TH1S*)contRF->GetObject(runRC);
+  TH1S *rundeprecal=(TH1S*)GetOADBObject(fileRF.Data(),"AliEMCALRunDepTempCalibCorrections",runRC);
     
   if (!rundeprecal)
   {
     AliWarning(Form("No TemperatureCorrCalib Objects for run: %d",runRC));
     // let's get the closest runnumber instead then..
+    contRF=new AliOADBContainer("");
+    contRF->InitFromFile(fileRF.Data(),"AliEMCALRunDepTempCalibCorrections");
     Int_t lower = 0;
     Int_t ic = 0;
     Int_t maxEntry = contRF->GetNumberOfEntries();
@@ -1224,7 +1217,8 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
     }
 
     AliWarning(Form("TemperatureCorrCalib Objects found closest id %d from run: %d", closest, contRF->LowerLimit(closest)));
-    rundeprecal = (TH1S*) contRF->GetObjectByIndex(closest);  
+    rundeprecal = (TH1S*) contRF->GetObjectByIndex(closest)->Clone();  
+    delete contRF;
   } 
   
   Int_t nSM = fEMCALGeo->GetEMCGeometry()->GetNumberOfSuperModules();
@@ -1235,7 +1229,7 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
   {
     AliError(Form("Total SM is %d but T corrections available for %d channels, skip Init of T recalibration factors",nSM,nbins));
     
-    delete contRF;
+    delete rundeprecal;
     
     return 2;
   }
@@ -1258,7 +1252,7 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
     } // rows 
   } // SM loop
   
-  delete contRF;
+  delete rundeprecal;
   
   return 1;
 }
@@ -1282,7 +1276,7 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
 
   Int_t runBC = event->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0) AliInfo(Form("Loading time calibration OADB from given path %s",fBasePath.Data()));
@@ -1296,7 +1290,7 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
     
     if (fbad) delete fbad;
     
-    contBC->InitFromFile(Form("%s/EMCALTimeCalib.root",fBasePath.Data()),"AliEMCALTimeCalib");    
+    fileBC = Form("%s/EMCALTimeCalib.root",fBasePath.Data());    
   } 
   else 
   { // Else choose the one in the $ALICE_PHYSICS directory
@@ -1311,14 +1305,13 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
       
     if (fbad) delete fbad;
     
-    contBC->InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALTimeCalib.root","AliEMCALTimeCalib"); 
+    fileBC = "$ALICE_PHYSICS/OADB/EMCAL/EMCALTimeCalib.root"; 
   }
   
-  TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
+  TObjArray *arrayBC=(TObjArray*)GetOADBObject(fileBC.Data(),"AliEMCALTimeCalib",runBC);
   if (!arrayBC)
   {
     AliError(Form("No external time calibration set for run number: %d", runBC));
-    delete contBC;
     return 2; 
   }
   
@@ -1329,7 +1322,7 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
   if (!arrayBCpass)
   {
     AliError(Form("No external time calibration set for: %d -%s", runBC,pass.Data()));
-    delete contBC;
+    delete arrayBC;
     return 2; 
   }
 
@@ -1349,10 +1342,11 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
       continue;
     }
     h->SetDirectory(0);
+    arrayBCpass->Remove(h); // kept by the reco utils
     fEMCALRecoUtils->SetEMCALChannelTimeRecalibrationFactors(i,h);
   }
   
-  delete contBC;
+  delete arrayBC;
   
   return 1;  
 }
@@ -1375,7 +1369,7 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
 
   Int_t runBC = event->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0) AliInfo(Form("Loading time calibration OADB from given path %s",fBasePath.Data()));
@@ -1389,7 +1383,7 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
     
     if (timeFile) delete timeFile;
     
-    contBC->InitFromFile(Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data()),"AliEMCALTimeL1PhaseCalib");    
+    fileBC = Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data());    
   } 
   else 
   { // Else choose the one in the $ALICE_PHYSICS directory
@@ -1404,14 +1398,13 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
       
     if (timeFile) delete timeFile;
     
-    contBC->InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALTimeL1PhaseCalib.root","AliEMCALTimeL1PhaseCalib"); 
+    fileBC = "$ALICE_PHYSICS/OADB/EMCAL/EMCALTimeL1PhaseCalib.root"; 
   }
   
-  TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
+  TObjArray *arrayBC=(TObjArray*)GetOADBObject(fileBC.Data(),"AliEMCALTimeL1PhaseCalib",runBC);
   if (!arrayBC)
   {
     AliError(Form("No external L1 phase in time calibration set for run number: %d", runBC));
-    delete contBC;
     return 2; 
   }
   
@@ -1425,7 +1418,7 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
   if (!arrayBCpass)
   {
     AliError(Form("No external L1 phase in time calibration set for: %d -%s", runBC,pass.Data()));
-    delete contBC;
+    delete arrayBC;
     return 2; 
   }
 
@@ -1441,9 +1434,10 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
     AliFatal(Form("There is no calibration histogram h%d for this run",runBC));
   }
   h->SetDirectory(0);
+  arrayBCpass->Remove(h); // kept by the reco utils
   fEMCALRecoUtils->SetEMCALL1PhaseInTimeRecalibrationForAllSM(h);
   
-  delete contBC;
+  delete arrayBC;
   
   return 1;  
 }
@@ -43,7 +43,6 @@
 #include "AliPHOSGeometry.h"
 #include "AliPHOSEsdCluster.h"
 #include "AliPHOSAodCluster.h"
-#include "AliOADBContainer.h"
 #include "AliAODCaloCells.h"
 #include "AliESDCaloCells.h"
 
@@ -192,7 +191,6 @@ void AliPHOSTenderSupply::InitTender()
       fPHOSGeo =  AliPHOSGeometry::GetInstance("IHEP") ;
     else
       fPHOSGeo =  AliPHOSGeometry::GetInstance("Run2") ;      
-    AliOADBContainer geomContainer("phosGeo");
     if(fIsMC){ //use excatly the same geometry as in simulation, stored in esd
       if(esd){
         for(Int_t mod=0; mod<6; mod++) {
@@ -205,41 +203,42 @@ void AliPHOSTenderSupply::InitTender()
 	}
       } 
       if(aod){ //To be fixed
-        geomContainer.InitFromFile("$ALICE_PHYSICS/OADB/PHOS/PHOSMCGeometry.root","PHOSMCRotationMatrixes");
-        TObjArray *matrixes = (TObjArray*)geomContainer.GetObject(fRunNumber,"PHOSRotationMatrixes");
+        TObjArray *matrixes = (TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/PHOS/PHOSMCGeometry.root","PHOSMCRotationMatrixes",
+                                                        fRunNumber,"PHOSRotationMatrixes");
         for(Int_t mod=0; mod<6; mod++) {
           if(!matrixes->At(mod)) continue;
           fPHOSGeo->SetMisalMatrix(((TGeoHMatrix*)matrixes->At(mod)),mod) ;
           printf(".........Adding Matrix(%d), geo=%p\n",mod,fPHOSGeo) ;
           ((TGeoHMatrix*)matrixes->At(mod))->Print() ;
         } 
+        delete matrixes ; // the geometry keeps copies
       }
     }
     else{ //Use best approaximation to real geometry
-      geomContainer.InitFromFile("$ALICE_PHYSICS/OADB/PHOS/PHOSGeometry.root","PHOSRotationMatrixes");
-      TObjArray *matrixes = (TObjArray*)geomContainer.GetObject(fRunNumber,"PHOSRotationMatrixes");
+      TObjArray *matrixes = (TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/PHOS/PHOSGeometry.root","PHOSRotationMatrixes",
+                                                      fRunNumber,"PHOSRotationMatrixes");
       for(Int_t mod=0; mod<6; mod++) {
         if(!matrixes->At(mod)) continue;
         fPHOSGeo->SetMisalMatrix(((TGeoHMatrix*)matrixes->At(mod)),mod) ;
         printf(".........Adding Matrix(%d), geo=%p\n",mod,fPHOSGeo) ;
         ((TGeoHMatrix*)matrixes->At(mod))->Print() ;
       } 
+      delete matrixes ; // the geometry keeps copies
     }
   }
   
   //Init Bad channels map
   if(!fUsePrivateBadMap){
-    AliOADBContainer badmapContainer(Form("phosBadMap"));
+    TString badmapFile("$ALICE_PHYSICS/OADB/PHOS/PHOSBadMaps.root");
     if(fPrivateOADBBadMap.Length()!=0){
       //Load standard bad maps file if no OADB file is force loaded
       AliInfo(Form("using custom bad channel map from %s\n",fPrivateOADBBadMap.Data()));
-       badmapContainer.InitFromFile(fPrivateOADBBadMap.Data(),"phosBadMap");
+      badmapFile=fPrivateOADBBadMap;
     } else {
       //Load force loaded OADB file
       AliInfo("using standard bad channel map from $ALICE_PHYSICS/OADB/PHOS/PHOSBadMaps.root\n");
-      badmapContainer.InitFromFile("$ALICE_PHYSICS/OADB/PHOS/PHOSBadMaps.root","phosBadMap");
     }
-    TObjArray *maps = (TObjArray*)badmapContainer.GetObject(fRunNumber,"phosBadMap");
+    TObjArray *maps = (TObjArray*)GetOADBObject(badmapFile.Data(),"phosBadMap",fRunNumber,"phosBadMap");
     if(!maps){
       AliError(Form("Can not read Bad map for run %d. \n You may choose to use your map with ForceUsingBadMap()\n",fRunNumber)) ;
     }
@@ -251,6 +250,7 @@ void AliPHOSTenderSupply::InitTender()
         TH2I * h = (TH2I*)maps->At(mod) ;
         if(h) fPHOSBadMap[mod]=new TH2I(*h) ;
       }
+      delete maps ;
     }
   }
 
@@ -260,11 +260,9 @@ void AliPHOSTenderSupply::InitTender()
   if(!fUsePrivateCalib){
     if(fIsMC){ //re/de-calibration for MC productions
       //Init recalibration
-      AliOADBContainer calibContainer("phosRecalibration");
-      calibContainer.InitFromFile("$ALICE_PHYSICS/OADB/PHOS/PHOSMCCalibrations.root","phosRecalibration");
-
       AliInfo(Form("Reading PHOS MC recalibration object for production %s, run=%d", fMCProduction.Data(),fRunNumber)) ;      
-      TObjArray *recalib = (TObjArray*)calibContainer.GetObject(fRunNumber,"PHOSRecalibration",fMCProduction.Data());
+      TObjArray *recalib = (TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/PHOS/PHOSMCCalibrations.root","phosRecalibration",
+                                                     fRunNumber,"PHOSRecalibration",fMCProduction.Data());
       if(!recalib){
         AliFatal(Form("Can not read calibrations for run %d and name >%s<\n. You may choose your specific calibration with ForceUsingCalibration()\n",fRunNumber,fMCProduction.Data())) ;
       }
@@ -280,15 +278,16 @@ void AliPHOSTenderSupply::InitTender()
         if(!fPHOSCalibData) {
           AliFatal(Form("Can not find calibration for run %d, and name %s \n",fRunNumber, fMCProduction.Data())) ;
         }
+        recalib->Remove(fPHOSCalibData) ; // owned by the supply
+        delete recalib ;
       }
       
     }
     else{ //real data
       //Init recalibration
       //Check the pass1-pass2-pass3 reconstruction
-      AliOADBContainer calibContainer("phosRecalibration");
-      calibContainer.InitFromFile("$ALICE_PHYSICS/OADB/PHOS/PHOSCalibrations.root","phosRecalibration");
-      TObjArray *recalib = (TObjArray*)calibContainer.GetObject(fRunNumber,"PHOSRecalibration");
+      TObjArray *recalib = (TObjArray*)GetOADBObject("$ALICE_PHYSICS/OADB/PHOS/PHOSCalibrations.root","phosRecalibration",
+                                                     fRunNumber,"PHOSRecalibration");
       if(!recalib){
         AliFatal(Form("Can not read calibrations for run %d\n. You may choose your specific calibration with ForceUsingCalibration()\n",fRunNumber)) ;
       }
@@ -297,6 +296,8 @@ void AliPHOSTenderSupply::InitTender()
         if(!fPHOSCalibData) {
           AliFatal(Form("Can not find calibration for run %d, pass %d \n",fRunNumber, fRecoPass)) ;
         }
+        recalib->Remove(fPHOSCalibData) ; // owned by the supply
+        delete recalib ;
       }
     }
   }
@@ -305,9 +306,7 @@ void AliPHOSTenderSupply::InitTender()
       //L1phase and run-by-run correction for Run2
       if(fRunNumber>209122){ //Run2
         //L1phase for Run2  
-        AliOADBContainer L1Container("phosL1Calibration");
-        L1Container.InitFromFile("$ALICE_PHYSICS/OADB/PHOS/PHOSL1Calibrations.root","phosL1Calibration");
-        TNamed* a= (TNamed*)L1Container.GetObject(fRunNumber);
+        TNamed* a= (TNamed*)GetOADBObject("$ALICE_PHYSICS/OADB/PHOS/PHOSL1Calibrations.root","phosL1Calibration",fRunNumber);
 	if(!a){
 	  AliError(Form("L1phase for run %d was not found, time calibration will be wrong!\n",fRunNumber)) ; 
           for(Int_t ii=0; ii<15; ii++)fL1phase[ii]=0;
@@ -315,15 +314,15 @@ void AliPHOSTenderSupply::InitTender()
 	else{
           const char*c=a->GetName();
           for(Int_t ii=0; ii<15; ii++)fL1phase[ii]=c[ii]-'0';
+          delete a;
 	}
       
 
 	//Run-by-run correction
-        AliOADBContainer runByRunContainer("phosRunByRunCalibration");
-        runByRunContainer.InitFromFile("$ALICE_PHYSICS/OADB/PHOS/PHOSRunByRunCalibrations.root","phosRunByRunCalibration");
-        TNamed* rbr= (TNamed*)runByRunContainer.GetObject(fRunNumber);
+        TNamed* rbr= (TNamed*)GetOADBObject("$ALICE_PHYSICS/OADB/PHOS/PHOSRunByRunCalibrations.root","phosRunByRunCalibration",fRunNumber);
 	if(rbr){
           sscanf(rbr->GetName(),"%f,%f,%f,%f",&fRunByRunCorr[1],&fRunByRunCorr[2],&fRunByRunCorr[3],&fRunByRunCorr[4]) ;  
+          delete rbr;
 	}
 	//In any case correction should not be zero
 	//If it is zero, set default and write warning
@@ -43,7 +43,6 @@
 #include <AliCDBManager.h>
 #include <AliCDBEntry.h>
 
-#include <AliOADBContainer.h>
 #include <AliTOFPIDParams.h>
 
 #include <AliT0CalibSeasonTimeShift.h>
@@ -1268,18 +1267,15 @@ void AliTOFTenderSupply::LoadTOFPIDParams(Int_t runNumber)
   fTOFPIDParams=0x0;
   
   //  TFile *oadbf = new TFile("$ALICE_PHYSICS/OADB/COMMON/PID/data/TOFPIDParams.root");
-  TFile *oadbf = new TFile(Form("%s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
-  if (oadbf && oadbf->IsOpen()) {
-    AliInfo(Form("Tender loading TOF OADB Params from %s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
-    AliOADBContainer *oadbc = (AliOADBContainer *)oadbf->Get("TOFoadb");
-    Int_t passNr = fRecoPass;
-    if (fIsMC) passNr=2;   // this is because tender on MC is used only for pass2 LHC10
-    TString passName = Form("pass%d",passNr);
-    if (oadbc) fTOFPIDParams = dynamic_cast<AliTOFPIDParams *>(oadbc->GetObject(runNumber,"TOFparams",passName));
-    oadbf->Close();
-    delete oadbc;
-  }
-  delete oadbf;
+  AliInfo(Form("Tender loading TOF OADB Params from %s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
+  Int_t passNr = fRecoPass;
+  if (fIsMC) passNr=2;   // this is because tender on MC is used only for pass2 LHC10
+  TString passName = Form("pass%d",passNr);
+  // copy owned by the supply
+  TObject *params = GetOADBObject(Form("%s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()),
+                                  "TOFoadb",runNumber,"TOFparams",passName.Data());
+  fTOFPIDParams = dynamic_cast<AliTOFPIDParams *>(params);
+  if (!fTOFPIDParams) delete params;
 
   if (!fTOFPIDParams) {
     AliError(Form("TOFPIDParams.root not found in %s/COMMON/PID/data !!",AliAnalysisManager::GetOADBPath()));